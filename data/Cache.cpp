@@ -17,6 +17,11 @@ Cache::Cache(Disk* dataProvider, size_t capacity
 , m_typeSize(type_size)
 , m_bVerbose(verbose)
 , m_bRandomize(randomize)
+, m_currentRow(0)
+, m_capacityRows(0)
+, m_epochRow(0)
+, m_bResident(false)
+, m_bRewind(false)
 , m_rndGenerator(randomSeed)
 {
     BOOST_ASSERT_MSG(dataProvider, "Disk can not be null.");
@@ -40,10 +45,7 @@ math::pimatrix Cache::Get(size_t sampleCount)
         // request more data
         if (m_currentRow >= m_data.size1())
         {
-            m_dataProvider->Get(m_data.size1(), m_data);
-            m_currentRow = 0;
-            if (m_bRandomize)
-                m_data.shuffleRows(m_rndGenerator);
+            fill();
         }
         
         size_t remainingCache = m_data.size1() - m_currentRow;
@@ -53,10 +55,25 @@ math::pimatrix Cache::Get(size_t sampleCount)
         mRet.copyRows(m_data, m_currentRow, copyingRows, copied);
         copied += copyingRows;
         m_currentRow += copyingRows;
+        
+        m_epochRow += copyingRows;
+        if (m_epochRow >= GetSize())
+        {
+            // end of the pass, the next sample comes from a new one
+            m_epochRow = 0;
+            m_currentRow = m_data.size1();
+        }
     }
     return mRet;
 }
 
+void Cache::Reset()
+{
+    m_epochRow = 0;
+    m_bRewind = true;
+    m_currentRow = m_data.size1();
+}
+
 size_t Cache::GetSize()
 {
     return m_dataProvider->GetSize();
@@ -64,9 +81,10 @@ size_t Cache::GetSize()
 
 void Cache::Append(std::vector<std::string>& files
     , size_t size, size_t dimension
-    , model::DatasetInfo_DataFormat dataFormat)
+    , model::DatasetInfo_DataFormat dataFormat
+    , model::DatasetInfo_DiskReader diskReader /*= model::DatasetInfo::STREAM*/)
 {
-    m_dataProvider->Append(files, size, dimension, dataFormat);
+    m_dataProvider->Append(files, size, dimension, dataFormat, diskReader);
     AllocateMemory();
 }
 
@@ -84,6 +102,31 @@ void Cache::AllocateMemory()
     numRow = (numRow < maxRowCount ? numRow : maxRowCount);
     m_data.resize(numRow, dim);
     m_currentRow = numRow;
+    m_capacityRows = numRow;
+    m_epochRow = 0;
+    m_bResident = false;
+}
+
+void Cache::fill()
+{
+    // no need to go to disk again when the whole dataset is in memory
+    if (!m_bResident)
+    {
+        if (m_bRewind)
+            m_dataProvider->Reset();
+        m_bRewind = false;
+        
+        // A new pass continues where the Disk stopped, so that rows beyond
+        // GetSize() (uneven shards or files) come in the following passes.
+        // Only when one fill went through all files the data is resident.
+        bool bFromFirstRow = m_dataProvider->IsAtFirstRow();
+        size_t rows = std::min(m_capacityRows, GetSize() - m_epochRow);
+        m_dataProvider->Get(rows, m_data);
+        m_bResident = bFromFirstRow && m_dataProvider->IsAtFirstRow();
+    }
+    m_currentRow = 0;
+    if (m_bRandomize)
+        m_data.shuffleRows(m_rndGenerator);
 }
 
 }
\ No newline at end of file
@@ -25,6 +25,10 @@ class Cache : boost::noncopyable
     bool m_bVerbose, m_bRandomize;
     math::pimatrix m_data;
     size_t m_currentRow;                // current row in m_data
+    size_t m_capacityRows;              // maximum number of rows in m_data
+    size_t m_epochRow;                  // rows returned in the current pass
+    bool m_bResident;                   // whole dataset is in m_data
+    bool m_bRewind;                     // restart the Disk on the next fill
     boost::minstd_rand m_rndGenerator;
     
 public:
@@ -37,16 +41,30 @@ public:
 
     virtual ~Cache();
 
+    /*
+     * Wraps around to the next pass over the data when needed.
+     */
     virtual math::pimatrix Get(size_t sampleCount);
 
+    /*
+     * Start a new pass from the first sample of the first file.
+     */
+    virtual void Reset();
+
     virtual size_t GetSize();
     
     virtual void Append(std::vector<std::string>& files
         , size_t size, size_t dimension
-        , model::DatasetInfo_DataFormat dataFormat);
+        , model::DatasetInfo_DataFormat dataFormat
+        , model::DatasetInfo_DiskReader diskReader = model::DatasetInfo::STREAM);
     
 protected:
     virtual void AllocateMemory();
+
+    /*
+     * Refill m_data, without crossing the end of the current pass.
+     */
+    virtual void fill();
 };
 
 }
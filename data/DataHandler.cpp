@@ -7,6 +7,7 @@
 
 #include <DataHandler.h>
 #include <DeepLearnDataHandler.h>
+#include <SharedMemoryDataHandler.h>
 
 namespace data
 {
@@ -16,11 +17,30 @@ DataHandler* DataHandler::GetDataHandler(const model::DatabaseInfo& databaseInfo
 {
     std::string sName = databaseInfo.data_handler();
 
+    if (databaseInfo.shard_count() < 1 || databaseInfo.shard_rank() < 0
+        || databaseInfo.shard_rank() >= databaseInfo.shard_count())
+    {
+        std::cout << "ERR\tInvalid shard: shard_rank = " << databaseInfo.shard_rank()
+                  << ", shard_count = " << databaseInfo.shard_count() << std::endl;
+        return NULL;
+    }
+
     if (sName.compare(DeepLearnDataHandler::GetHandlerName()) == 0)
     {
         return new DeepLearnDataHandler(databaseInfo
                 , randomize, randomSeed, verbose);
     }
+    if (sName.compare(SharedMemoryDataHandler::GetHandlerName()) == 0)
+    {
+        SharedMemoryDataHandler* handler = new SharedMemoryDataHandler(
+                databaseInfo, randomize, randomSeed, verbose);
+        if (!handler->IsAttached())
+        {
+            delete handler;
+            return NULL;
+        }
+        return handler;
+    }
     return NULL;
 }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/regex.hpp>
 #include <Disk.h>
+#include <algorithm>
 
 #define DEFAULT_BATCH_SIZE 100
 namespace data
@@ -18,13 +19,23 @@ namespace data
 Dataset::Dataset(size_t capacity
         , bool randomize /*= false*/
         , int randomSeed /*= 42*/
-        , bool verbose /*= false*/)
+        , bool verbose /*= false*/
+        , int shardRank /*= 0*/
+        , int shardCount /*= 1*/)
 : m_batchSize(DEFAULT_BATCH_SIZE)
+, m_epochRow(0)
 {
-    m_cache = new Cache(new Disk(verbose), capacity
+    m_cache = new Cache(new Disk(verbose, shardRank, shardCount), capacity
             , 4, randomize, randomSeed, verbose);
 }
 
+Dataset::Dataset()
+: m_cache(NULL)
+, m_batchSize(DEFAULT_BATCH_SIZE)
+, m_epochRow(0)
+{
+}
+
 Dataset::~Dataset()
 {
     delete m_cache;
@@ -45,7 +56,8 @@ void Dataset::Append(const model::DatasetInfo& dataInfo, const std::string &sPat
     if (files.size() > 0)
     {
         m_cache->Append(files, dataInfo.size()
-            , dataInfo.dimensions(), dataInfo.data_format());
+            , dataInfo.dimensions(), dataInfo.data_format()
+            , dataInfo.disk_reader());
     }
 }
 
@@ -62,7 +74,31 @@ void Dataset::BeginLoadNextBatch()
 void Dataset::EndLoadNextBatch()
 {
     // actually load
-    m_currentBatch = m_cache->Get(m_batchSize);
+    loadBatch(m_batchSize);
+    if (GetSize() > 0)
+        m_epochRow = (m_epochRow + m_batchSize) % GetSize();
+}
+
+bool Dataset::LoadEpochBatch()
+{
+    if (IsEpochEnd())
+        return false;
+    
+    size_t nSamples = std::min(m_batchSize, GetSize() - m_epochRow);
+    loadBatch(nSamples);
+    m_epochRow += nSamples;
+    return true;
+}
+
+bool Dataset::IsEpochEnd()
+{
+    return m_epochRow >= GetSize();
+}
+
+void Dataset::ResetEpoch()
+{
+    m_epochRow = 0;
+    rewind();
 }
     
 void Dataset::AllocateMemory()
@@ -77,8 +113,25 @@ void Dataset::SetBatchSize(size_t nSamples)
 
 int Dataset::GetNumBatches()
 {
-    size_t n = m_cache->GetSize() / m_batchSize;
-    return (m_cache->GetSize() % m_batchSize == 0 ? n : n+1);
+    size_t n = GetSize() / m_batchSize;
+    return (GetSize() % m_batchSize == 0 ? n : n+1);
+}
+
+size_t Dataset::GetSize()
+{
+    return m_cache->GetSize();
+}
+
+/***************************************************************************/
+
+void Dataset::loadBatch(size_t sampleCount)
+{
+    m_currentBatch = m_cache->Get(sampleCount);
+}
+
+void Dataset::rewind()
+{
+    m_cache->Reset();
 }
     
 /***************************************************************************/
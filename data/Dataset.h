@@ -19,14 +19,22 @@ namespace data
 
 class Dataset : boost::noncopyable
 {
+protected:
     Cache *m_cache;
     size_t m_batchSize;
     math::pimatrix m_currentBatch;    
+    size_t m_epochRow;              // samples loaded in the current epoch
 
+    /*
+     * For subclasses which do not read data through a Cache.
+     */
+    Dataset();
+    
 public:
     Dataset(size_t capacity
             , bool randomize = false
-            , int randomSeed = 42, bool verbose = false);
+            , int randomSeed = 42, bool verbose = false
+            , int shardRank = 0, int shardCount = 1);
     
     virtual ~Dataset();
     
@@ -36,13 +44,47 @@ public:
     virtual void BeginLoadNextBatch();
     virtual void EndLoadNextBatch();
     
+    /*
+     * Load the next batch of the current epoch into GetCurrentBatch().
+     * The last batch of an epoch only holds the remaining samples, so
+     * every sample is read exactly once per epoch.
+     * Returns false, without loading anything, once the epoch is over.
+     */
+    virtual bool LoadEpochBatch();
+    
+    /*
+     * true when all samples of the current epoch have been loaded
+     */
+    virtual bool IsEpochEnd();
+    
+    /*
+     * Start a new epoch from the first sample.
+     */
+    virtual void ResetEpoch();
+    
     virtual void AllocateMemory();
     
     virtual void SetBatchSize(size_t nSamples);
     
     virtual int GetNumBatches();
+    
+    /*
+     * The number of samples in this set
+     */
+    virtual size_t GetSize();
         
 protected:
+    /*
+     * Load the next sampleCount samples into m_currentBatch,
+     * wrapping around to the next pass over the data when needed.
+     */
+    virtual void loadBatch(size_t sampleCount);
+    
+    /*
+     * Make the next loadBatch() start from the first sample.
+     */
+    virtual void rewind();
+    
     void loadFileNames(const std::string sFilePattern
     , std::vector<std::string>& filesOut, const std::string &sPathPrefix);
 };
@@ -9,6 +9,8 @@
 
 #include "Dataset.h"
 #include <cmath>
+#include <algorithm>
+#include <iostream>
 
 namespace data
 {
@@ -18,13 +20,8 @@ DeepLearnDataHandler::DeepLearnDataHandler(const model::DatabaseInfo& databaseIn
 {
     m_sName = databaseInfo.name();
 
-    std::map<model::DatasetInfo_DataType, float> memoryRatios;
-    memoryRatios[model::DatasetInfo::TRAIN_SET] = 0.6f;
-    memoryRatios[model::DatasetInfo::EVAL_SET] = 0.2f;
-    memoryRatios[model::DatasetInfo::TEST_SET] = 0.2f;
-    
-    // datasetInfo.main_memory() is in GB
-    float memorySize = databaseInfo.main_memory() * (float)1E9;
+    std::map<model::DatasetInfo_DataType, size_t> capacities;
+    planMemory(databaseInfo, capacities, verbose);
     
     for(int i = databaseInfo.data_size() - 1; i >= 0; --i)
     {
@@ -33,10 +30,13 @@ DeepLearnDataHandler::DeepLearnDataHandler(const model::DatabaseInfo& databaseIn
         
         if (m_datasets.count(dataType) == 0)
         {
+            // only the training set is sharded among the workers
+            bool bShard = (dataType == model::DatasetInfo::TRAIN_SET);
             m_datasets[dataType] = 
-                    new Dataset(
-                        (size_t)std::floor(memoryRatios[dataType] * memorySize)
-                        , randomize, randomSeed, verbose);
+                    new Dataset(capacities[dataType]
+                        , randomize, randomSeed, verbose
+                        , bShard ? databaseInfo.shard_rank() : 0
+                        , bShard ? databaseInfo.shard_count() : 1);
         }
         m_datasets[dataType]->Append(dataset, databaseInfo.path_prefix());
     }
@@ -64,4 +64,73 @@ std::string DeepLearnDataHandler::GetDatasetName()
     return m_sName;
 }
 
+/*****************************************************************************/
+
+void DeepLearnDataHandler::planMemory(const model::DatabaseInfo& databaseInfo
+        , std::map<model::DatasetInfo_DataType, size_t>& capacities
+        , bool verbose)
+{
+    // the share of each dataset when not everything fits in memory
+    std::map<model::DatasetInfo_DataType, double> memoryRatios;
+    memoryRatios[model::DatasetInfo::TRAIN_SET] = 0.6;
+    memoryRatios[model::DatasetInfo::EVAL_SET] = 0.2;
+    memoryRatios[model::DatasetInfo::TEST_SET] = 0.2;
+    
+    // datasetInfo.main_memory() is in GB
+    size_t memorySize = (size_t)std::floor(databaseInfo.main_memory() * 1E9);
+    
+    // the number of bytes needed to keep each dataset in memory
+    std::map<model::DatasetInfo_DataType, size_t> footprints;
+    std::map<model::DatasetInfo_DataType, size_t>::iterator it;
+    for(int i = databaseInfo.data_size() - 1; i >= 0; --i)
+    {
+        const model::DatasetInfo& dataset = databaseInfo.data(i);
+        size_t sampleCount = dataset.size();
+        
+        // the training set is sharded among the workers
+        if (dataset.type() == model::DatasetInfo::TRAIN_SET)
+            sampleCount /= databaseInfo.shard_count();
+        
+        footprints[dataset.type()] += 
+                sampleCount * dataset.dimensions() * dataset.type_size();
+    }
+    
+    // every dataset gets its share, but not more than it needs
+    size_t used = 0;
+    capacities.clear();
+    for (it = footprints.begin(); it != footprints.end(); ++it)
+    {
+        size_t share = (size_t)std::floor(memoryRatios[it->first] * memorySize);
+        capacities[it->first] = std::min(it->second, share);
+        used += capacities[it->first];
+    }
+    
+    // the rest goes to the training set first, then eval and test sets.
+    model::DatasetInfo_DataType order[] = {model::DatasetInfo::TRAIN_SET
+        , model::DatasetInfo::EVAL_SET, model::DatasetInfo::TEST_SET};
+    size_t spare = (memorySize > used ? memorySize - used : 0);
+    for (int i = 0; i < 3 && spare > 0; ++i)
+    {
+        if (footprints.count(order[i]) == 0)
+            continue;
+        size_t extra = std::min(spare, footprints[order[i]] - capacities[order[i]]);
+        capacities[order[i]] += extra;
+        spare -= extra;
+    }
+    
+    if (verbose)
+    {
+        std::cout << "Memory plan for " << databaseInfo.name() << " ("
+                  << memorySize / 1E6 << " MB):" << std::endl;
+        for (it = footprints.begin(); it != footprints.end(); ++it)
+        {
+            std::cout << "\t" << model::DatasetInfo_DataType_Name(it->first)
+                      << ": " << capacities[it->first] / 1E6 << " MB for "
+                      << it->second / 1E6 << " MB of data"
+                      << (capacities[it->first] >= it->second ? " (resident)" : "")
+                      << std::endl;
+        }
+    }
+}
+
 }
\ No newline at end of file
@@ -36,6 +36,15 @@ public:
     {
         return "deeplearn";
     }
+    
+    /*
+     * Split main_memory among the caches of the datasets, based on their
+     * actual sizes. A dataset gets all the space it needs when it fits.
+     * Memory not needed by the eval and test sets goes to the training set.
+     */
+    static void planMemory(const model::DatabaseInfo& databaseInfo
+        , std::map<model::DatasetInfo_DataType, size_t>& capacities
+        , bool verbose);
 };
 
 }
@@ -0,0 +1,211 @@
+/*
+ * File:   DirectReader.cpp
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:22 PM
+ */
+
+#include <DirectReader.h>
+#include <Util.h>
+
+#ifndef _MSC_VER
+#include <aio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define INT_SIZE        4
+#define HEADER_SIZE     (3*INT_SIZE)
+#define IO_ALIGNMENT    4096
+
+namespace data
+{
+
+DirectReader::DirectReader(size_t chunkSize /*= (1 << 20)*/
+    , size_t queueDepth /*= 8*/)
+: m_buffer(NULL)
+, m_bufferSize(0)
+, m_queueDepth(queueDepth)
+, m_fileSize(0)
+{
+    BOOST_ASSERT_MSG(queueDepth > 0, "Invalid queue depth");
+
+    // O_DIRECT needs every request to start at an aligned offset
+    m_chunkSize = std::max(chunkSize / IO_ALIGNMENT, (size_t)1) * IO_ALIGNMENT;
+}
+
+DirectReader::~DirectReader()
+{
+    free(m_buffer);
+    m_buffer = NULL;
+}
+
+/*****************************************************************************/
+
+bool DirectReader::Read(const std::string& sFile, math::pimatrix& matRet
+    , size_t shard /*= 0*/, size_t shardCount /*= 1*/)
+{
+    BOOST_ASSERT_MSG(shard < shardCount, "Invalid shard");
+
+#ifdef _MSC_VER
+    return matRet.load(sFile, shard, shardCount);
+#else
+    int fd = open(sFile.c_str(), O_RDONLY | O_DIRECT);
+    if (fd < 0 && errno == EINVAL)
+    {
+        // tmpfs and friends don't do O_DIRECT
+        fd = open(sFile.c_str(), O_RDONLY);
+    }
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < HEADER_SIZE)
+    {
+        close(fd);
+        return false;
+    }
+    m_fileSize = st.st_size;
+
+    if (!reserve(IO_ALIGNMENT) || !readRange(fd, 0, IO_ALIGNMENT))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t sz = util::Util::ReadSize(m_buffer);
+    size_t sz1 = util::Util::ReadSize(m_buffer + INT_SIZE);
+    size_t sz2 = util::Util::ReadSize(m_buffer + 2*INT_SIZE);
+
+    if (sz <= HEADER_SIZE || sz > m_fileSize
+        || sz - HEADER_SIZE != sz1 * sz2 * INT_SIZE)
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t startRow = shard * sz1 / shardCount;
+    size_t endRow = (shard + 1) * sz1 / shardCount;
+    size_t start = HEADER_SIZE + startRow * sz2 * INT_SIZE;
+    size_t end = HEADER_SIZE + endRow * sz2 * INT_SIZE;
+
+    // widen the byte range to the alignment, then skip the extra bytes
+    size_t alignedStart = start / IO_ALIGNMENT * IO_ALIGNMENT;
+    size_t alignedEnd = (end + IO_ALIGNMENT - 1) / IO_ALIGNMENT * IO_ALIGNMENT;
+
+    bool bRet = true;
+    if (end > start && alignedEnd > IO_ALIGNMENT)
+    {
+        bRet = reserve(alignedEnd - alignedStart)
+            && readRange(fd, alignedStart, alignedEnd - alignedStart);
+    }
+    close(fd);
+
+    if (bRet)
+        matRet.FromBytes(m_buffer + (start - alignedStart), endRow - startRow, sz2);
+    return bRet;
+#endif
+}
+
+/*****************************************************************************/
+
+bool DirectReader::reserve(size_t size)
+{
+    if (size <= m_bufferSize)
+        return true;
+
+#ifdef _MSC_VER
+    return false;
+#else
+    free(m_buffer);
+    m_buffer = NULL;
+    m_bufferSize = 0;
+
+    void* p = NULL;
+    if (posix_memalign(&p, IO_ALIGNMENT, size) != 0)
+        return false;
+    m_buffer = (char*)p;
+    m_bufferSize = size;
+    return true;
+#endif
+}
+
+bool DirectReader::readRange(int fd, size_t offset, size_t size)
+{
+#ifdef _MSC_VER
+    return false;
+#else
+    size_t chunkCount = (size + m_chunkSize - 1) / m_chunkSize;
+    std::vector<struct aiocb> requests(m_queueDepth);
+    std::vector<const struct aiocb*> inFlight(m_queueDepth, NULL);
+    size_t nextChunk = 0, pending = 0;
+    bool bRet = true;
+
+    while (nextChunk < chunkCount || pending > 0)
+    {
+        // keep the queue full
+        for (size_t i = 0; i < m_queueDepth && bRet && nextChunk < chunkCount; ++i)
+        {
+            if (inFlight[i])
+                continue;
+
+            struct aiocb& req = requests[i];
+            std::memset(&req, 0, sizeof(req));
+            req.aio_fildes = fd;
+            req.aio_offset = offset + nextChunk * m_chunkSize;
+            req.aio_buf = m_buffer + nextChunk * m_chunkSize;
+            req.aio_nbytes = std::min(m_chunkSize, size - nextChunk * m_chunkSize);
+            if (aio_read(&req) != 0)
+            {
+                bRet = false;
+                break;
+            }
+            inFlight[i] = &req;
+            ++pending;
+            ++nextChunk;
+        }
+        if (!bRet)
+            nextChunk = chunkCount;
+        if (pending == 0)
+            break;
+
+        // aio_suspend() ignores the NULL entries
+        if (aio_suspend(&inFlight[0], m_queueDepth, NULL) != 0 && errno != EINTR)
+        {
+            // can't wait on the requests, but they still write into m_buffer
+            aio_cancel(fd, NULL);
+            bRet = false;
+        }
+
+        for (size_t i = 0; i < m_queueDepth; ++i)
+        {
+            if (!inFlight[i])
+                continue;
+
+            struct aiocb& req = requests[i];
+            int err = aio_error(&req);
+            if (err == EINPROGRESS)
+                continue;
+
+            ssize_t readBytes = aio_return(&req);
+            inFlight[i] = NULL;
+            --pending;
+
+            // short reads are only fine past the end of the file
+            size_t expected = (size_t)req.aio_offset < m_fileSize
+                ? std::min(req.aio_nbytes, m_fileSize - req.aio_offset) : 0;
+            if (err != 0 || readBytes < 0 || (size_t)readBytes < expected)
+                bRet = false;
+        }
+    }
+    return bRet;
+#endif
+}
+
+}
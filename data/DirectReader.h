@@ -0,0 +1,63 @@
+/*
+ * File:   DirectReader.h
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:22 PM
+ */
+
+#ifndef DIRECTREADER_H
+#define	DIRECTREADER_H
+
+#include <boost/noncopyable.hpp>
+#include <string>
+#include <pimatrix.h>
+
+namespace data
+{
+
+/*
+ * Reads matrix files (the format of pimatrix::save()) with O_DIRECT
+ * and several asynchronous reads in flight, bypassing the page cache.
+ * The aligned read buffer is kept and reused for the following files.
+ *
+ * Falls back to buffered asynchronous reads when the file system
+ * does not support O_DIRECT, and to pimatrix::load() on Windows.
+ */
+class DirectReader : boost::noncopyable
+{
+    char* m_buffer;
+    size_t m_bufferSize;
+    size_t m_chunkSize;
+    size_t m_queueDepth;
+    size_t m_fileSize;
+
+public:
+
+    /*
+     * chunkSize: size of each read request, in bytes
+     * queueDepth: maximum number of requests in flight
+     */
+    DirectReader(size_t chunkSize = (1 << 20), size_t queueDepth = 8);
+
+    virtual ~DirectReader();
+
+    /*
+     * Same as matRet.load(sFile, shard, shardCount)
+     */
+    bool Read(const std::string& sFile, math::pimatrix& matRet
+            , size_t shard = 0, size_t shardCount = 1);
+
+private:
+
+    bool reserve(size_t size);
+
+    /*
+     * Read [offset, offset + size) of the file into m_buffer.
+     * offset and size must be multiples of the alignment.
+     */
+    bool readRange(int fd, size_t offset, size_t size);
+};
+
+}
+
+#endif	/* DIRECTREADER_H */
@@ -13,9 +13,16 @@
 namespace data
 {
 
-Disk::Disk(bool verbose /*= true*/)
+Disk::Disk(bool verbose /*= true*/
+    , int shardRank /*= 0*/, int shardCount /*= 1*/)
 : m_currentFile(0, 0)
+, m_shardRank(shardRank)
+, m_shardCount(shardCount)
+, m_directReader(NULL)
 {
+    BOOST_ASSERT_MSG(shardCount >= 1 && shardRank >= 0 && shardRank < shardCount
+            , "Invalid shard");
+
     m_verbose = verbose;
     m_iReadingFile = 0;
     m_iDimension = 0;
@@ -24,7 +31,10 @@ Disk::Disk(bool verbose /*= true*/)
 }
 
 Disk::~Disk()
-{   }
+{
+    delete m_directReader;
+    m_directReader = NULL;
+}
 
 /*************************************************************************/
 
@@ -49,7 +59,9 @@ void Disk::Get(size_t sampleCount, math::pimatrix& matRet)
                 // only load next file if we have more than 1 file
                 // or this is the first file ever read.
                 loadFile(m_files.at(m_iReadingFile), m_currentFile
-                        , m_fileFormat.at(m_iReadingFile));
+                        , m_fileFormat.at(m_iReadingFile)
+                        , m_fileSharded.at(m_iReadingFile)
+                        , m_fileReader.at(m_iReadingFile));
                 m_iReadingFile = (m_iReadingFile + 1) % m_files.size();
             }
             m_currentRow = 0;
@@ -65,9 +77,34 @@ void Disk::Get(size_t sampleCount, math::pimatrix& matRet)
     }
 }
 
+void Disk::Reset()
+{
+    if (m_files.size() > 1)
+    {
+        // forces reloading the first file
+        m_iReadingFile = 0;
+        m_currentFile.resize(0, 0);
+    }
+    m_currentRow = 0;
+}
+
+bool Disk::IsAtFirstRow()
+{
+    if (m_files.empty())
+        return true;
+    if (m_currentRow >= m_currentFile.size1())
+    {
+        // the next Get() loads the file at m_iReadingFile
+        return m_iReadingFile == 0;
+    }
+    // the file in m_currentFile is the one before m_iReadingFile
+    return m_currentRow == 0 && m_iReadingFile == 1 % m_files.size();
+}
+
 void Disk::Append(std::vector<std::string>& files
     , size_t size, size_t dimension
-    , model::DatasetInfo_DataFormat dataFormat)
+    , model::DatasetInfo_DataFormat dataFormat
+    , model::DatasetInfo_DiskReader diskReader /*= model::DatasetInfo::STREAM*/)
 {
     if (m_iDimension == 0 && m_dataSize == 0)
     {
@@ -79,34 +116,64 @@ void Disk::Append(std::vector<std::string>& files
                 , "Invalid dimension of data files");
     }
     
-    for (std::vector<std::string>::iterator it = files.begin(); 
-            it != files.end(); it++)
+    // When the files can be split evenly among the workers, each worker
+    // takes whole files. Otherwise every worker reads its own range of rows
+    // in every file.
+    bool bShardRows = (m_shardCount > 1 && files.size() % m_shardCount != 0);
+    
+    for (size_t i = 0; i < files.size(); ++i)
     {
-        m_files.push_back((*it));
+        if (m_shardCount > 1 && !bShardRows && i % m_shardCount != m_shardRank)
+            continue;
+        
+        m_files.push_back(files.at(i));
         m_fileFormat.push_back(dataFormat);
+        m_fileSharded.push_back(bShardRows);
+        m_fileReader.push_back(diskReader);
     }
-    m_dataSize += size;
+    
+    // all workers report the same size, so they run the same number of steps.
+    m_dataSize += size / m_shardCount;
 }
 /****************************************************************************/
 
 void Disk::loadFile(std::string sFile, math::pimatrix& matRet
-        , model::DatasetInfo_DataFormat dataFormat)
+        , model::DatasetInfo_DataFormat dataFormat
+        , bool bSharded /*= false*/
+        , model::DatasetInfo_DiskReader diskReader /*= model::DatasetInfo::STREAM*/)
 {
     bool bRet;
+    size_t shard = (bSharded ? m_shardRank : 0);
+    size_t shardCount = (bSharded ? m_shardCount : 1);
+    
     if (m_verbose)
     {
-        std::cout << "Reading from disk: " << sFile << std::endl;
+        std::cout << "Reading from disk: " << sFile;
+        if (bSharded)
+            std::cout << " (shard " << shard << "/" << shardCount << ")";
+        std::cout << std::endl;
     }
     switch(dataFormat)
     {
         case model::DatasetInfo::BOOST_MATRIX:
-            bRet = matRet.load(sFile);
+            if (diskReader == model::DatasetInfo::DIRECT_ASYNC)
+            {
+                if (!m_directReader)
+                    m_directReader = new DirectReader();
+                bRet = m_directReader->Read(sFile, matRet, shard, shardCount);
+            }
+            else
+            {
+                bRet = matRet.load(sFile, shard, shardCount);
+            }
             break;
         case model::DatasetInfo::CSV:
-            bRet = matRet.loadCsv(sFile);
+            bRet = matRet.loadCsv(sFile, shard, shardCount);
             break;
     }
     
+    BOOST_ASSERT_MSG(!bSharded || matRet.size1() > 0
+            , "Data file is too small to be sharded among the workers.");
     BOOST_ASSERT_MSG(bRet && matRet.size2() == m_iDimension
             , "Invalid data file.");
 }
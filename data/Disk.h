@@ -12,6 +12,7 @@
 #include <string>
 #include <pimatrix.h>
 #include <deeplearn.pb.h>
+#include <DirectReader.h>
 
 namespace data
 {
@@ -21,24 +22,50 @@ class Disk : boost::noncopyable
 protected:
     std::vector<std::string> m_files;
     std::vector<model::DatasetInfo_DataFormat> m_fileFormat;
+    /*
+     * true if we only read our shard of the rows in the file
+     */
+    std::vector<bool> m_fileSharded;
+    std::vector<model::DatasetInfo_DiskReader> m_fileReader;
     math::pimatrix m_currentFile;
     size_t m_currentRow;
     size_t m_iReadingFile;
     bool m_verbose;
     size_t m_iDimension;
     size_t m_dataSize;
+    size_t m_shardRank, m_shardCount;
+    /*
+     * created on the first file read with DIRECT_ASYNC
+     */
+    DirectReader* m_directReader;
     
 public:
     
-    Disk(bool verbose = true);
+    /*
+     * shardRank, shardCount: only read the shardRank-th part of the data,
+     * out of shardCount disjoint parts.
+     */
+    Disk(bool verbose = true, int shardRank = 0, int shardCount = 1);
     
     virtual ~Disk();
 
     virtual void Get(size_t sampleCount, math::pimatrix& matRet);
 
+    /*
+     * Continue reading from the first row of the first file.
+     */
+    virtual void Reset();
+    
+    /*
+     * true when the next sample is the first row of the first file,
+     * i.e. after Reset() or after reading the last row of the last file.
+     */
+    virtual bool IsAtFirstRow();
+
     virtual void Append(std::vector<std::string>& files
                 , size_t size, size_t dimension
-                , model::DatasetInfo_DataFormat dataFormat);
+                , model::DatasetInfo_DataFormat dataFormat
+                , model::DatasetInfo_DiskReader diskReader = model::DatasetInfo::STREAM);
         
     size_t GetDimension()
     {
@@ -56,7 +83,9 @@ public:
 protected:
     
     virtual void loadFile(std::string sFile, math::pimatrix& matRet
-                        , model::DatasetInfo_DataFormat dataFormat);
+                        , model::DatasetInfo_DataFormat dataFormat
+                        , bool bSharded = false
+                        , model::DatasetInfo_DiskReader diskReader = model::DatasetInfo::STREAM);
     
 };
 
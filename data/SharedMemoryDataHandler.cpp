@@ -0,0 +1,346 @@
+/*
+ * File:   SharedMemoryDataHandler.cpp
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:15 PM
+ */
+
+#include <SharedMemoryDataHandler.h>
+#include <DeepLearnDataHandler.h>
+
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <boost/random/variate_generator.hpp>
+#include <cstring>
+#include <iostream>
+
+#define SHM_MAGIC       "DLSHM01"
+#define SHM_ALIGNMENT   64
+#define SHM_SET_COUNT   3       // TRAIN_SET, EVAL_SET, TEST_SET
+
+namespace data
+{
+
+/*
+ * Layout of the shared memory segment: this header, followed by
+ * the datasets, each as a (rows x dims) row-major float matrix.
+ */
+struct SharedMemoryHeader
+{
+    char magic[8];
+    uint64_t size;                      // total size of the segment, in bytes
+    uint64_t rows[SHM_SET_COUNT];       // 0 if there is no such dataset
+    uint64_t dims[SHM_SET_COUNT];
+    uint64_t offsets[SHM_SET_COUNT];    // from the start of the segment
+};
+
+size_t alignSize(size_t sz)
+{
+    return (sz + SHM_ALIGNMENT - 1) / SHM_ALIGNMENT * SHM_ALIGNMENT;
+}
+
+/*****************************************************************************/
+
+SharedMemoryDataset::SharedMemoryDataset(const float* data
+        , size_t size, size_t dimension
+        , bool randomize /*= false*/, int randomSeed /*= 42*/)
+: m_data(data)
+, m_size(size)
+, m_dimension(dimension)
+, m_currentRow(size)
+, m_bRandomize(randomize)
+, m_rndGenerator(randomSeed)
+{
+    if (m_bRandomize)
+    {
+        m_order.resize(m_size);
+        for (size_t i = 0; i < m_size; ++i)
+            m_order[i] = i;
+    }
+}
+
+SharedMemoryDataset::~SharedMemoryDataset()
+{
+    m_data = NULL;
+}
+
+void SharedMemoryDataset::Append(const model::DatasetInfo& dataInfo
+        , const std::string &sPathPrefix)
+{
+    // the data server already loaded everything.
+}
+
+void SharedMemoryDataset::loadBatch(size_t sampleCount)
+{
+    if (m_size == 0)
+    {
+        m_currentBatch.resize(0, 0);
+        return;
+    }
+
+    m_currentBatch.resize(sampleCount, m_dimension);
+    size_t copied = 0;
+
+    while (copied < sampleCount)
+    {
+        // start a new pass
+        if (m_currentRow >= m_size)
+        {
+            m_currentRow = 0;
+            if (m_bRandomize)
+            {
+                // shuffle the order of rows, the shared data is read-only
+                for (size_t r = m_size - 1; r > 0; --r)
+                {
+                    boost::variate_generator<boost::minstd_rand&, boost::uniform_int<> >
+                        rnd(m_rndGenerator, boost::uniform_int<>(0, r));
+                    std::swap(m_order[r], m_order[rnd()]);
+                }
+            }
+        }
+
+        size_t copyingRows = std::min(m_size - m_currentRow, sampleCount - copied);
+        if (m_bRandomize)
+        {
+            for (size_t i = 0; i < copyingRows; ++i)
+            {
+                m_currentBatch.copyRows(
+                    m_data + m_order[m_currentRow + i] * m_dimension, 1, copied + i);
+            }
+        }
+        else
+        {
+            m_currentBatch.copyRows(m_data + m_currentRow * m_dimension
+                , copyingRows, copied);
+        }
+        copied += copyingRows;
+        m_currentRow += copyingRows;
+    }
+}
+
+size_t SharedMemoryDataset::GetSize()
+{
+    return m_size;
+}
+
+void SharedMemoryDataset::rewind()
+{
+    // the next batch starts a new pass
+    m_currentRow = m_size;
+}
+
+/*****************************************************************************/
+
+SharedMemoryDataHandler::SharedMemoryDataHandler(const model::DatabaseInfo& databaseInfo
+    , bool randomize, int randomSeed, bool verbose)
+: m_pMemory(NULL)
+, m_memorySize(0)
+{
+    m_sName = databaseInfo.name();
+
+#ifdef _MSC_VER
+    std::cout << "ERR\tShared memory datasets are not supported on this platform."
+              << std::endl;
+#else
+    std::string sSegment = GetSegmentName(databaseInfo);
+    int fd = shm_open(sSegment.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        std::cout << "ERR\tCouldn't open the shared memory segment " << sSegment
+                  << ". Is the data server running?" << std::endl;
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(SharedMemoryHeader))
+    {
+        std::cout << "ERR\tInvalid shared memory segment " << sSegment << std::endl;
+        close(fd);
+        return;
+    }
+
+    void* pMemory = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (pMemory == MAP_FAILED)
+    {
+        std::cout << "ERR\tCouldn't map the shared memory segment " << sSegment
+                  << std::endl;
+        return;
+    }
+
+    const SharedMemoryHeader* header = (const SharedMemoryHeader*)pMemory;
+    if (std::strncmp(header->magic, SHM_MAGIC, sizeof(header->magic)) != 0
+        || header->size != (uint64_t)st.st_size)
+    {
+        std::cout << "ERR\tInvalid shared memory segment " << sSegment << std::endl;
+        munmap(pMemory, st.st_size);
+        return;
+    }
+    m_pMemory = pMemory;
+    m_memorySize = st.st_size;
+
+    for (int t = 0; t < SHM_SET_COUNT; ++t)
+    {
+        if (header->rows[t] == 0)
+            continue;
+
+        const float* data = (const float*)((const char*)m_pMemory + header->offsets[t]);
+        size_t rows = header->rows[t];
+        size_t dims = header->dims[t];
+
+        // only the training set is sharded among the workers
+        if (t == model::DatasetInfo::TRAIN_SET && databaseInfo.shard_count() > 1)
+        {
+            size_t startRow = databaseInfo.shard_rank() * rows / databaseInfo.shard_count();
+            data += startRow * dims;
+            rows = rows / databaseInfo.shard_count();
+        }
+        m_datasets[(model::DatasetInfo_DataType)t] =
+                new SharedMemoryDataset(data, rows, dims, randomize, randomSeed);
+
+        if (verbose)
+        {
+            std::cout << "Attached " << model::DatasetInfo_DataType_Name(
+                            (model::DatasetInfo_DataType)t)
+                      << ": " << rows << " x " << dims << " from " << sSegment
+                      << std::endl;
+        }
+    }
+#endif
+}
+
+SharedMemoryDataHandler::~SharedMemoryDataHandler()
+{
+    std::map<model::DatasetInfo_DataType, Dataset*>::iterator it;
+    for(it = m_datasets.begin(); it != m_datasets.end(); it++)
+    {
+        delete (it->second);
+    }
+    m_datasets.clear();
+
+#ifndef _MSC_VER
+    if (m_pMemory)
+    {
+        munmap(m_pMemory, m_memorySize);
+        m_pMemory = NULL;
+    }
+#endif
+}
+
+Dataset* SharedMemoryDataHandler::GetDataset(model::DatasetInfo_DataType type)
+{
+    if (m_datasets.count(type) == 0)
+        return NULL;
+    return m_datasets[type];
+}
+
+std::string SharedMemoryDataHandler::GetDatasetName()
+{
+    return m_sName;
+}
+
+/*****************************************************************************/
+
+std::string SharedMemoryDataHandler::GetSegmentName(const model::DatabaseInfo& databaseInfo)
+{
+    return "/deeplearn_" + databaseInfo.name();
+}
+
+bool SharedMemoryDataHandler::Publish(const model::DatabaseInfo& databaseInfo
+    , bool verbose)
+{
+#ifdef _MSC_VER
+    std::cout << "ERR\tShared memory datasets are not supported on this platform."
+              << std::endl;
+    return false;
+#else
+    // load everything from disk, without sharding.
+    model::DatabaseInfo diskInfo(databaseInfo);
+    diskInfo.set_data_handler(DeepLearnDataHandler::GetHandlerName());
+    diskInfo.clear_shard_rank();
+    diskInfo.clear_shard_count();
+    DeepLearnDataHandler loader(diskInfo, false, 42, verbose);
+
+    SharedMemoryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::strncpy(header.magic, SHM_MAGIC, sizeof(header.magic));
+
+    size_t offset = alignSize(sizeof(SharedMemoryHeader));
+    math::pimatrix sets[SHM_SET_COUNT];
+    for (int t = 0; t < SHM_SET_COUNT; ++t)
+    {
+        Dataset* dataset = loader.GetDataset((model::DatasetInfo_DataType)t);
+        if (!dataset || dataset->GetSize() == 0)
+            continue;
+
+        // read the whole set as one batch
+        dataset->SetBatchSize(dataset->GetSize());
+        dataset->EndLoadNextBatch();
+        sets[t] = *(dataset->GetCurrentBatch());
+
+        header.rows[t] = sets[t].size1();
+        header.dims[t] = sets[t].size2();
+        header.offsets[t] = offset;
+        offset += alignSize(sets[t].size1() * sets[t].size2() * sizeof(float));
+    }
+    header.size = offset;
+
+    // a new segment under the same name: trainers still attached to
+    // the last one keep their mapping of it until they detach
+    std::string sSegment = GetSegmentName(databaseInfo);
+    shm_unlink(sSegment.c_str());
+    int fd = shm_open(sSegment.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        std::cout << "ERR\tCouldn't create the shared memory segment "
+                  << sSegment << std::endl;
+        return false;
+    }
+    if (ftruncate(fd, header.size) != 0)
+    {
+        std::cout << "ERR\tCouldn't allocate " << header.size
+                  << " bytes of shared memory" << std::endl;
+        close(fd);
+        shm_unlink(sSegment.c_str());
+        return false;
+    }
+    void* pMemory = mmap(NULL, header.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (pMemory == MAP_FAILED)
+    {
+        std::cout << "ERR\tCouldn't map the shared memory segment "
+                  << sSegment << std::endl;
+        shm_unlink(sSegment.c_str());
+        return false;
+    }
+
+    for (int t = 0; t < SHM_SET_COUNT; ++t)
+    {
+        if (header.rows[t] > 0)
+            sets[t].copyTo((float*)((char*)pMemory + header.offsets[t]));
+    }
+    // write the header last, so trainers never see a half-filled segment
+    std::memcpy(pMemory, &header, sizeof(header));
+    munmap(pMemory, header.size);
+
+    if (verbose)
+    {
+        std::cout << "Published " << databaseInfo.name() << " to " << sSegment
+                  << " (" << header.size / 1E6 << " MB)" << std::endl;
+    }
+    return true;
+#endif
+}
+
+void SharedMemoryDataHandler::Unpublish(const model::DatabaseInfo& databaseInfo)
+{
+#ifndef _MSC_VER
+    shm_unlink(GetSegmentName(databaseInfo).c_str());
+#endif
+}
+
+}
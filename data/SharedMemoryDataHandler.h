@@ -0,0 +1,108 @@
+/*
+ * File:   SharedMemoryDataHandler.h
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:15 PM
+ */
+
+#ifndef SHAREDMEMORY_DATAHANDLER_H
+#define	SHAREDMEMORY_DATAHANDLER_H
+
+#include <DataHandler.h>
+#include <Dataset.h>
+#include <deeplearn.pb.h>
+#include <pimatrix.h>
+#include <map>
+
+namespace data
+{
+
+/*
+ * A dataset whose samples live in a shared memory segment published
+ * by SharedMemoryDataHandler::Publish(). Batches are copied straight
+ * from the shared segment, there is no Cache and no disk access.
+ */
+class SharedMemoryDataset : public Dataset
+{
+    const float* m_data;
+    size_t m_size, m_dimension;
+    size_t m_currentRow;
+    bool m_bRandomize;
+    std::vector<size_t> m_order;
+    boost::minstd_rand m_rndGenerator;
+
+public:
+    /*
+     * data: size x dimension floats in row-major order
+     */
+    SharedMemoryDataset(const float* data, size_t size, size_t dimension
+            , bool randomize = false, int randomSeed = 42);
+
+    virtual ~SharedMemoryDataset();
+
+    virtual void Append(const model::DatasetInfo& dataInfo, const std::string &sPathPrefix);
+
+    virtual size_t GetSize();
+
+protected:
+    virtual void loadBatch(size_t sampleCount);
+
+    virtual void rewind();
+};
+
+/*
+ * Reads the datasets from a shared memory segment, which is filled once
+ * by a data server (see Publish()) and shared by all trainers on the host.
+ */
+class SharedMemoryDataHandler : public DataHandler
+{
+    std::map<model::DatasetInfo_DataType, Dataset*> m_datasets;
+    std::string m_sName;
+    void* m_pMemory;
+    size_t m_memorySize;
+
+public:
+    SharedMemoryDataHandler(const model::DatabaseInfo& databaseInfo
+        , bool randomize, int randomSeed, bool verbose);
+
+    virtual ~SharedMemoryDataHandler();
+
+    virtual Dataset* GetDataset(model::DatasetInfo_DataType type);
+
+    virtual std::string GetDatasetName();
+
+    /*
+     * false if the shared memory segment could not be attached
+     */
+    bool IsAttached()
+    {
+        return m_pMemory != NULL;
+    }
+
+    static std::string GetHandlerName()
+    {
+        return "shared_memory";
+    }
+
+    /*
+     * Name of the shared memory segment of the database
+     */
+    static std::string GetSegmentName(const model::DatabaseInfo& databaseInfo);
+
+    /*
+     * Data server: load all datasets in databaseInfo from disk
+     * and copy them into a new shared memory segment. A segment published
+     * before is unlinked, not overwritten, so the trainers using it are safe.
+     */
+    static bool Publish(const model::DatabaseInfo& databaseInfo, bool verbose);
+
+    /*
+     * Remove the shared memory segment. Trainers which already attached
+     * to it can keep reading until they exit.
+     */
+    static void Unpublish(const model::DatabaseInfo& databaseInfo);
+};
+
+}
+
+#endif
@@ -13,6 +13,8 @@
 
 #include "deeplearn.pb.h"
 #include <spnet/Spn.h>
+#include <SharedMemoryDataHandler.h>
+#include <Util.h>
 
 
 void testMatrix()
@@ -35,11 +37,38 @@ void testNodeData()
             << std::endl << model::NodeData::default_instance().SerializeAsString();
 }
 
+/*
+ * Data server: load the datasets once into shared memory, so that trainers
+ * using data_handler: "shared_memory" can read them.
+ */
+int serveData(const std::string& sDataProto)
+{
+    model::DatabaseInfo databaseInfo;
+    if (!util::Util::LoadProto(sDataProto, &databaseInfo))
+    {
+        std::cout << "ERR\tUnable to load the dataset proto file." << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!data::SharedMemoryDataHandler::Publish(databaseInfo, true))
+        return EXIT_FAILURE;
+    
+    std::cout << "Serving " << databaseInfo.name() << ". Press Enter to stop."
+              << std::endl;
+    std::cin.get();
+    data::SharedMemoryDataHandler::Unpublish(databaseInfo);
+    return EXIT_SUCCESS;
+}
+
 /*
  * 
  */
 int main(int argc, char** argv) 
 {
+    if (argc == 3 && std::string(argv[1]).compare("serve") == 0)
+    {
+        return serveData(argv[2]);
+    }
+    
     //testMatrix();
     testNodeData();
     return 0;
@@ -108,6 +108,30 @@ void pimatrix::copyRows(pimatrix& source, size_t startRowSrc
             , bu::range(0, source.size2()));
 }
 
+void pimatrix::copyRows(const float* source, size_t rowCount, size_t startRowDest)
+{
+    BOOST_ASSERT_MSG(size1() >= startRowDest + rowCount
+            , "Invalid dimensions of the destination matrix");
+    
+    std::copy(source, source + rowCount * size2()
+            , m_matrix.data().begin() + startRowDest * size2());
+}
+
+void pimatrix::copyTo(float* dest) const
+{
+    std::copy(m_matrix.data().begin(), m_matrix.data().end(), dest);
+}
+
+float* pimatrix::data()
+{
+    return &m_matrix.data()[0];
+}
+
+const float* pimatrix::data() const
+{
+    return &m_matrix.data()[0];
+}
+
 /*
 void pimatrix::copyRows(pimatrix& source, size_t startRow, size_t rowCount)
 {
@@ -377,12 +401,13 @@ void pimatrix::save(std::string sFileName)
     delete[] bytes;
 }
 
-bool pimatrix::load(std::string sFileName)
+bool pimatrix::load(std::string sFileName
+    , size_t shard /*= 0*/, size_t shardCount /*= 1*/)
 {
     std::ifstream ifs(sFileName.c_str()
         , std::ios_base::in | std::ios_base::binary);
     ifs.seekg(0);
-    bool bRet = FromStream(ifs);
+    bool bRet = FromStream(ifs, shard, shardCount);
     ifs.close();
     return bRet;
 }
@@ -395,24 +420,35 @@ T op_string2number(std::string x)
     ss >> f;
     return f;
 }
-bool pimatrix::loadCsv(const std::string& sCsvFilePath)
+bool pimatrix::loadCsv(const std::string& sCsvFilePath
+    , size_t shard /*= 0*/, size_t shardCount /*= 1*/)
 {
+    BOOST_ASSERT_MSG(shard < shardCount, "Invalid shard");
+    
     std::ifstream f(sCsvFilePath.c_str(), std::ios_base::in);
-    size_t sz1, sz2;
+    size_t sz1, sz2, i;
     std::string sLine;
-    std::vector<std::string> vLine;
+    std::vector<std::string> vLines, vLine;
     std::vector<std::vector<float> > arrFile;
     std::vector<float> arrLine;
     
-    sz1 = sz2 = 0;
     while (std::getline(f, sLine))
     {
-        if(sLine.length() == 0)
-            continue;
-        
+        if(sLine.length() > 0)
+            vLines.push_back(sLine);
+    }
+    f.close();
+    
+    // only parse the lines in our shard
+    size_t startLine = shard * vLines.size() / shardCount;
+    size_t endLine = (shard + 1) * vLines.size() / shardCount;
+    
+    sz1 = sz2 = 0;
+    for (i = startLine; i < endLine; ++i)
+    {
         ++sz1;
         vLine.clear();
-        boost::split(vLine, sLine, boost::is_any_of(","));
+        boost::split(vLine, vLines.at(i), boost::is_any_of(","));
         if (sz2 == 0)
         {
             sz2 = vLine.size();
@@ -420,8 +456,7 @@ bool pimatrix::loadCsv(const std::string& sCsvFilePath)
         else if (sz2 != vLine.size())
         {
             std::cout << "Invalid CSV file: " << sCsvFilePath
-                      << " at line " << sz1 << std::endl;
-            f.close();
+                      << " at line " << startLine + sz1 << std::endl;
             return false;
         }
         arrLine.resize(sz2, 0);
@@ -429,10 +464,9 @@ bool pimatrix::loadCsv(const std::string& sCsvFilePath)
             , arrLine.begin(), op_string2number<float>);
         arrFile.push_back(arrLine);
     }
-    f.close();
     
     m_matrix.resize(sz1, sz2);
-    for (size_t i = 0; i < sz1; ++i)
+    for (i = 0; i < sz1; ++i)
     {
         const std::vector<float> aLine = arrFile.at(i);
         for(size_t j = 0; j < sz2; ++j)
@@ -473,17 +507,22 @@ bool pimatrix::FromString(const std::string& sMat)
     if(sz != sMat.size() - HEADER_SIZE || sz != sz1 * sz2 * INT_SIZE)
         return false;
 
-    m_matrix.resize(sz1, sz2);
-    bytes += HEADER_SIZE;
-    for (size_t i = 0; i < sz1; ++i)
+    FromBytes(bytes + HEADER_SIZE, sz1, sz2);
+    return true;
+}
+
+void pimatrix::FromBytes(const char* bytes, size_t rowCount, size_t colCount)
+{
+    m_matrix.resize(rowCount, colCount);
+    char *arr = (char*)bytes;
+    for (size_t i = 0; i < rowCount; ++i)
     {
-        for (size_t j = 0; j < sz2; ++j)
+        for (size_t j = 0; j < colCount; ++j)
         {
-            m_matrix(i, j) = util::Util::ReadFloat(bytes);
-            bytes += INT_SIZE;
+            m_matrix(i, j) = util::Util::ReadFloat(arr);
+            arr += INT_SIZE;
         }
     }
-    return true;
 }
 
 std::string pimatrix::ToDebugString()
@@ -524,8 +563,11 @@ size_t pimatrix::ToArray(char* &bytes)
     return sz;
 }
 
-bool pimatrix::FromStream(std::istream& stream)
+bool pimatrix::FromStream(std::istream& stream
+    , size_t shard /*= 0*/, size_t shardCount /*= 1*/)
 {
+    BOOST_ASSERT_MSG(shard < shardCount, "Invalid shard");
+    
     char header[HEADER_SIZE], *matrixData;
     stream.read(header, HEADER_SIZE);
 
@@ -540,6 +582,22 @@ bool pimatrix::FromStream(std::istream& stream)
     if(sz != sz1 * sz2 * INT_SIZE)
         return false;
 
+    if (shardCount > 1)
+    {
+        // skip the rows before our shard, then only read the rows in it.
+        size_t startRow = shard * sz1 / shardCount;
+        size_t endRow = (shard + 1) * sz1 / shardCount;
+        
+        stream.seekg(startRow * sz2 * INT_SIZE, std::ios_base::cur);
+        sz1 = endRow - startRow;
+        sz = sz1 * sz2 * INT_SIZE;
+        if (sz == 0)
+        {
+            m_matrix.resize(0, sz2);
+            return true;
+        }
+    }
+    
     matrixData = new char[sz];
     size_t readCount = 0;
     while(readCount < sz)
@@ -552,16 +610,7 @@ bool pimatrix::FromStream(std::istream& stream)
 
     if (readCount == sz)
     {
-        m_matrix.resize(sz1, sz2);
-        char *arr = matrixData;
-        for (size_t i = 0; i < sz1; ++i)
-        {
-            for (size_t j = 0; j < sz2; ++j)
-            {
-                m_matrix(i, j) = util::Util::ReadFloat(arr);
-                arr += INT_SIZE;
-            }
-        }
+        FromBytes(matrixData, sz1, sz2);
     }
     
     delete[] matrixData;
@@ -46,6 +46,24 @@ public:
     void copyRows(pimatrix& source, size_t startRowSrc
                 , size_t rowCount, size_t startRowDest);
     
+    /*
+     * source: rowCount x size2() floats, in row-major order
+     */
+    void copyRows(const float* source, size_t rowCount, size_t startRowDest);
+    
+    /*
+     * Copy all the entries, in row-major order, to dest
+     * which should have space for size1() x size2() floats.
+     */
+    void copyTo(float* dest) const;
+    
+    /*
+     * The size1() x size2() entries, in row-major order
+     */
+    float* data();
+    
+    const float* data() const;
+    
     //void copyRows(pimatrix& source, size_t startRow, size_t rowCount);
     
     pimatrix rows(size_t startRow, size_t rowCount);
@@ -122,9 +140,14 @@ public:
     
     void save(std::string sFileName);
     
-    bool load(std::string sFileName);
+    /*
+     * shard, shardCount: only load rows [shard*N/shardCount, (shard+1)*N/shardCount)
+     * where N is the number of rows in the file.
+     */
+    bool load(std::string sFileName, size_t shard = 0, size_t shardCount = 1);
     
-    bool loadCsv(const std::string& sCsvFilePath);
+    bool loadCsv(const std::string& sCsvFilePath
+                , size_t shard = 0, size_t shardCount = 1);
     
     /*************************************************************************/
     
@@ -132,6 +155,12 @@ public:
 
     bool FromString(const std::string& sMat);
 
+    /*
+     * Fill the matrix with rowCount x colCount floats in the binary format
+     * of ToString(), without the header.
+     */
+    void FromBytes(const char* bytes, size_t rowCount, size_t colCount);
+
     /*
      * Serialize the matrix into a human-friendly format
      */
@@ -144,7 +173,7 @@ private:
     
     size_t ToArray(char* &bytes);
 
-    bool FromStream(std::istream& stream);
+    bool FromStream(std::istream& stream, size_t shard = 0, size_t shardCount = 1);
 
 };
 
@@ -5,6 +5,7 @@
  * Created on September 4, 2013, 3:17 PM
  */
 
+#include <algorithm>
 #include "Edge.h"
 #include "Util.h"
 
@@ -12,14 +13,16 @@ namespace model
 {
 
 Edge::Edge(Node *node1, Node* node2, bool directed)
+: m_params(NULL)
+, m_offset(0)
+, m_size1(node1->GetDimension())
+, m_size2(node2->GetDimension())
+, m_bOwnParams(false)
 {
     m_node1 = node1;
     m_node2 = node2;
     m_edgeData.set_directed(directed);
     
-    m_weight.resize(m_node1->GetDimension(), m_node2->GetDimension(), false);
-    m_weight.setValue(1);
-    
     m_node1->AddOutgoingEdge(this);
     m_node2->AddIncomingEdge(this);
     if (!directed)
@@ -31,16 +34,60 @@ Edge::Edge(Node *node1, Node* node2, bool directed)
 
 Edge::~Edge()
 {
+    if (m_bOwnParams)
+        delete m_params;
+    m_params = NULL;
     m_node1 = m_node2 = NULL;
 }
 
 /*****************************************************************************/
 
+math::pimatrix Edge::GetWeight()
+{
+    math::pimatrix weight(m_size1, m_size2);
+    weight.copyRows(GetWeightData(), m_size1, 0);
+    return weight;
+}
+
+void Edge::SetWeight(const math::pimatrix& weight)
+{
+    BOOST_ASSERT_MSG(weight.size1() == m_size1 && weight.size2() == m_size2
+            , "Invalid dimensions of the weight matrix");
+    weight.copyTo(GetWeightData());
+}
+
+void Edge::BindParameters(ParameterBuffer* params)
+{
+    const size_t size = GetParameterCount();
+    const size_t offset = params->Allocate(size);
+    
+    // params might be m_params, whose arrays just moved.
+    // Without parameters yet, the new range has the initial values.
+    if (m_params)
+    {
+        const float* src[3] = {m_params->GetWeights(), m_params->GetGradients()
+                                , m_params->GetOldGradients()};
+        float* dest[3] = {params->GetWeights(), params->GetGradients()
+                                , params->GetOldGradients()};
+        for (int a = 0; a < 3; ++a)
+            std::copy(src[a] + m_offset, src[a] + m_offset + size, dest[a] + offset);
+    }
+    
+    if (m_bOwnParams)
+        delete m_params;
+    m_params = params;
+    m_offset = offset;
+    m_bOwnParams = false;
+}
+
+/*****************************************************************************/
+
 math::pimatrix Edge::Forward()
 {
     BOOST_ASSERT(m_node1);
     math::pimatrix m = m_node1->GetActivations();
-    m.mult(m_weight);
+    math::pimatrix weight = GetWeight();
+    m.mult(weight);
     return m;
 }
 
@@ -55,43 +102,51 @@ void Edge::Backward(math::pimatrix& derivatives)
     
     BOOST_ASSERT_MSG(derivatives.size2() == m_node2->GetDimension(),
             "Derivatives should have size (batch_size x m_node2->GetDimension())");
-    if (m_derivatives.size1() > 0 && m_derivatives.size2() > 0)
-    {
-        m_oldDerivatives = m_derivatives;
-    }
-    m_derivatives = m_node1->GetActivations();
-    m_derivatives.mult(derivatives, 1);
+    math::pimatrix weightDeriv = m_node1->GetActivations();
+    weightDeriv.mult(derivatives, 1);
+    SetDerivatives(weightDeriv);
     
     math::pimatrix node1_deriv = derivatives;
-    node1_deriv.mult(m_weight, 2);
+    math::pimatrix weight = GetWeight();
+    node1_deriv.mult(weight, 2);
     m_node1->AccumDerivatives(node1_deriv);
 }
 
+void Edge::SetDerivatives(const math::pimatrix& derivatives)
+{
+    BOOST_ASSERT_MSG(derivatives.size1() == m_size1 
+            && derivatives.size2() == m_size2,
+            "Derivatives should have the same size as the weight");
+    SetDerivatives(derivatives.data());
+}
+
+void Edge::SetDerivatives(const float* derivatives)
+{
+    const size_t size = GetParameterCount();
+    ParameterBuffer* params = getParams();
+    float* gradients = params->GetGradients() + m_offset;
+    std::copy(gradients, gradients + size, params->GetOldGradients() + m_offset);
+    std::copy(derivatives, derivatives + size, gradients);
+}
+
 void Edge::UpdateParams(int iStep, int batchSize)
 {
-    if (m_derivatives.size1() == 0)
-        return;
-    
     float learningRate, momentum;
-    math::pimatrix delta_w(m_derivatives.size1(), m_derivatives.size2(), 0);
     
     // get learning rate and momentum...
     util::Util::GetLearningRateAndMomentum(iStep, 
             m_edgeData.hyper_params(), learningRate, momentum);
     
-    if (m_oldDerivatives.size1() == m_derivatives.size1()
-            && m_oldDerivatives.size2() == m_derivatives.size2())
-    {
-        delta_w.element_add(m_oldDerivatives, momentum);
-    }
-    delta_w.element_add(m_derivatives);
-    
-    m_weight.element_add(delta_w, -learningRate/batchSize);
+    // derivatives which were never set are 0
+    getParams()->Update(m_offset, m_offset + GetParameterCount()
+            , learningRate, momentum, batchSize);
 }
 
 void Edge::NormalizeWeights(const math::pimatrix& matSum)
 {
-    m_weight.element_div(matSum);
+    math::pimatrix weight = GetWeight();
+    weight.element_div(matSum);
+    SetWeight(weight);
 }
 
 /*****************************************************************************/
@@ -102,11 +157,9 @@ void Edge::MergeEdgeData(const EdgeData& edgeData)
     
     if (m_edgeData.has_weight())
     {
-        m_weight.FromString(m_edgeData.weight());
-                
-        BOOST_ASSERT_MSG(m_weight.size1() == m_node1->GetDimension()
-                && m_weight.size2() == m_node2->GetDimension(),
-                "Invalid dimensions of the weight matrix");
+        math::pimatrix weight;
+        weight.FromString(m_edgeData.weight());
+        SetWeight(weight);
     }
 }
 
@@ -123,7 +176,7 @@ void Edge::ToEdgeData(EdgeData& edgeData)
     edgeData.MergeFrom(m_edgeData);
     edgeData.set_node1(m_node1->GetName());
     edgeData.set_node2(m_node2->GetName());
-    edgeData.set_weight(m_weight.ToString());
+    edgeData.set_weight(GetWeight().ToString());
 }
 
 }
@@ -9,8 +9,10 @@
 #define	EDGE_H
 
 #include <boost/noncopyable.hpp>
+#include <boost/assert.hpp>
 #include <pimatrix.h>
 #include <Node.h>
+#include <ParameterBuffer.h>
 
 namespace model
 {
@@ -22,13 +24,16 @@ class Edge : boost::noncopyable
 
 private:
     /*
-     * node1_size x node2_size
+     * The weight, its derivatives and the previous derivatives are
+     * node1_size x node2_size matrices in row-major order, at m_offset
+     * in m_params: the buffer of the model (see BindParameters()).
+     * Before that, a buffer of the edge itself (m_bOwnParams), allocated
+     * when the parameters are first accessed: until then, the weights
+     * are 1 and the derivatives 0, like in a new range of a buffer.
      */
-    math::pimatrix m_weight;
-    /*
-     * node1_size x node2_size
-     */
-    math::pimatrix m_derivatives, m_oldDerivatives;
+    ParameterBuffer* m_params;
+    size_t m_offset, m_size1, m_size2;
+    bool m_bOwnParams;
     
     Node *m_node1, *m_node2;
 
@@ -48,15 +53,57 @@ public:
         return m_node2;
     }
     
-    const math::pimatrix& GetWeight()
+    math::pimatrix GetWeight();
+    
+    /*
+     * node1_size x node2_size
+     */
+    void SetWeight(const math::pimatrix& weight);
+    
+    /*
+     * The node1_size x node2_size weights, without copying them.
+     * Invalid after the next BindParameters().
+     */
+    float* GetWeightData()
+    {
+        return getParams()->GetWeights() + m_offset;
+    }
+    
+    size_t GetParameterOffset()
+    {
+        return m_offset;
+    }
+    
+    size_t GetParameterCount()
     {
-        return m_weight;
+        return m_size1 * m_size2;
+    }
+    
+    /*
+     * Move the weight and the derivatives to a new range of params
+     */
+    void BindParameters(ParameterBuffer* params);
+    
+    const Hyperparams& GetHyperparams()
+    {
+        return m_edgeData.hyper_params();
     }
 
     virtual math::pimatrix Forward();
     
     virtual void Backward(math::pimatrix& derivatives);
     
+    /*
+     * Set the derivatives wrt the weight, for the next UpdateParams().
+     * Used when they are computed outside of Backward().
+     */
+    virtual void SetDerivatives(const math::pimatrix& derivatives);
+    
+    /*
+     * The same, from node1_size x node2_size floats in row-major order
+     */
+    void SetDerivatives(const float* derivatives);
+    
     virtual void UpdateParams(int iStep, int batchSize);
     
     virtual void NormalizeWeights(const math::pimatrix& matSum);
@@ -69,6 +116,18 @@ public:
     
     virtual void ToEdgeData(EdgeData& edgeData);
     
+private:
+    ParameterBuffer* getParams()
+    {
+        if (!m_params)
+        {
+            m_params = new ParameterBuffer();
+            m_bOwnParams = true;
+            m_offset = m_params->Allocate(GetParameterCount());
+        }
+        return m_params;
+    }
+    
 };
 
 }
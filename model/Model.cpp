@@ -7,15 +7,18 @@
 
 #include <boost/assert.hpp>
 #include <algorithm>
+#include <iostream>
 #include <queue>
 #include <fstream>
 #include "Model.h"
+#include "Util.h"
 #include "spnet/Spn.h"
 
 namespace model
 {
 
 Model::Model()
+: m_params(NULL)
 {
 }
 
@@ -24,6 +27,7 @@ Model::Model(const std::string& modelName
     , std::vector<Edge*> &edges)
 : m_nodes(nodes)
 , m_edges(edges)
+, m_params(NULL)
 {
 }
 
@@ -34,6 +38,8 @@ Model::~Model()
     m_nodes.clear();
     deleteList(m_edges);
     m_edges.clear();
+    delete m_params;
+    m_params = NULL;
 }
 
 /*****************************************************************************/
@@ -47,8 +53,15 @@ std::string Model::GetName()
 bool Model::Validate()
 {
     m_nodeList.clear();
-    std::vector<bool> removedEdges(m_edges.size());
-    std::fill(removedEdges.begin(), removedEdges.end(), false);
+    
+    // index of the nodes, and their number of incoming edges not yet removed
+    boost::unordered_map<Node*, size_t> nodeIndices;
+    std::vector<size_t> inDegrees(m_nodes.size());
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+    {
+        nodeIndices[m_nodes[i]] = i;
+        inDegrees[i] = m_nodes[i]->GetIncomingEdgesCount();
+    }
     
     // get all nodes without incomining edges
     std::deque<Node*> S;
@@ -68,41 +81,130 @@ bool Model::Validate()
         for (std::vector<Edge*>::iterator itEdge = neighbors.begin();
                 itEdge != neighbors.end(); ++itEdge)
         {
-            size_t idx = std::distance(m_edges.begin(), 
-                    std::find(m_edges.begin(), m_edges.end(), (*itEdge)));
-            BOOST_ASSERT(idx < m_edges.size());
-            removedEdges[idx] = true;
+            boost::unordered_map<Node*, size_t>::iterator itNode = 
+                    nodeIndices.find((*itEdge)->GetNode2());
+            BOOST_ASSERT(itNode != nodeIndices.end());
             
-            // check neighbors[i].node2 has any edge
-            bool bAllRemoved = true;
-            std::vector<Edge*>& incomingOfNode2 = (*itEdge)->GetNode2()->GetIncomingEdges();
-            for (std::vector<Edge*>::iterator itEdge2 = incomingOfNode2.begin();
-                    itEdge2 != incomingOfNode2.end(); ++itEdge2)
-            {
-                size_t idx2 = std::distance(m_edges.begin(), 
-                    std::find(m_edges.begin(), m_edges.end(), *itEdge2));
-                BOOST_ASSERT(idx2 < m_edges.size());
-                if (!removedEdges[idx2])
-                {
-                    bAllRemoved = false;
-                    break;
-                }
-            }
-            if (bAllRemoved)
+            // all incoming edges of node2 removed
+            if (--inDegrees[itNode->second] == 0)
             {
                 S.push_back((*itEdge)->GetNode2());
             }
         }
     }
     
-    if (removedEdges.end() != std::find(removedEdges.begin(), removedEdges.end(), false))
+    if (m_nodeList.size() != m_nodes.size())
     {
+        printCycle(nodeIndices, inDegrees);
         m_nodeList.clear();
         return false;
     }
     return true;
 }
 
+void Model::printCycle(boost::unordered_map<Node*, size_t>& nodeIndices
+        , const std::vector<size_t>& inDegrees)
+{
+    // every node left has an incoming edge from another node left,
+    // so walking backward along them must come back to a visited node.
+    std::vector<size_t> visitOrder(m_nodes.size(), m_nodes.size());
+    std::vector<Node*> path;
+    size_t i = 0;
+    while (i < m_nodes.size() && inDegrees[i] == 0)
+        ++i;
+    
+    while (i < m_nodes.size() && visitOrder[i] == m_nodes.size())
+    {
+        visitOrder[i] = path.size();
+        path.push_back(m_nodes[i]);
+        
+        size_t next = m_nodes.size();
+        std::vector<Edge*>& incoming = m_nodes[i]->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end() && next == m_nodes.size(); ++itEdge)
+        {
+            size_t j = nodeIndices[(*itEdge)->GetNode1()];
+            if (inDegrees[j] > 0)
+                next = j;
+        }
+        i = next;
+    }
+    
+    std::cout << "ERR\tThe network has a cycle:";
+    if (i < m_nodes.size())
+    {
+        std::cout << " " << m_nodes[i]->GetName();
+        for (size_t k = path.size(); k-- > visitOrder[i]; )
+            std::cout << " -> " << path[k]->GetName();
+    }
+    std::cout << std::endl;
+}
+
+void Model::bindParameters()
+{
+    ParameterBuffer* params = new ParameterBuffer();
+    m_paramSegments.clear();
+    
+    std::string sHyperparams, sLastHyperparams;
+    size_t boundEdges = 0;
+    std::vector<Node*>::iterator it;
+    for (it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    {
+        std::vector<Edge*>& incoming = (*it)->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end(); ++itEdge)
+        {
+            (*itEdge)->BindParameters(params);
+            boundEdges++;
+            
+            (*itEdge)->GetHyperparams().SerializeToString(&sHyperparams);
+            if (m_paramSegments.empty() || sHyperparams != sLastHyperparams)
+            {
+                m_paramSegments.push_back(*itEdge);
+                sLastHyperparams.swap(sHyperparams);
+            }
+        }
+    }
+    BOOST_ASSERT_MSG(boundEdges == m_edges.size()
+            , "Some edges are not incoming edges of m_nodeList");
+    
+    delete m_params;
+    m_params = params;
+}
+
+void Model::updateParams(int iStep, int batchSize
+        , Operation_Optimizer optimizer /*= Operation::GRADIENT_DESCENT*/)
+{
+    float learningRate, momentum;
+    for (size_t s = 0; s < m_paramSegments.size(); ++s)
+    {
+        const Hyperparams& hyp = m_paramSegments[s]->GetHyperparams();
+        size_t begin = m_paramSegments[s]->GetParameterOffset();
+        size_t end = (s + 1 < m_paramSegments.size()
+                ? m_paramSegments[s + 1]->GetParameterOffset() : m_params->GetSize());
+        util::Util::GetLearningRateAndMomentum(iStep, hyp, learningRate, momentum);
+        
+        switch (optimizer)
+        {
+            case Operation::ADAM:
+                m_params->UpdateAdam(begin, end, learningRate, hyp.adam_beta1()
+                        , hyp.adam_beta2(), hyp.epsilon(), iStep + 1, batchSize);
+                break;
+            case Operation::ADAGRAD:
+                m_params->UpdateAdaGrad(begin, end, learningRate
+                        , hyp.epsilon(), batchSize);
+                break;
+            case Operation::RMSPROP:
+                m_params->UpdateRmsProp(begin, end, learningRate
+                        , hyp.rmsprop_decay(), hyp.epsilon(), batchSize);
+                break;
+            default:
+                m_params->Update(begin, end, learningRate, momentum, batchSize);
+                break;
+        }
+    }
+}
+
 void Model::PrintBackpropOrder(std::ostream& s)
 {
     if (m_nodeList.empty())
@@ -9,10 +9,12 @@
 #define	MODEL_H
 
 #include <boost/noncopyable.hpp>
+#include <boost/unordered_map.hpp>
 #include <vector>
 #include <deeplearn.pb.h>
 #include <Node.h>
 #include <Edge.h>
+#include <ParameterBuffer.h>
 #include <DataHandler.h>
 
 namespace model
@@ -29,6 +31,14 @@ protected:
      */
     std::vector<Node*> m_nodeList;
     
+    /*
+     * The weights and gradients of all the edges, see bindParameters().
+     * m_paramSegments[s] is the first edge of a run of edges with the
+     * same hyper-parameters, starting at that edge's offset.
+     */
+    ParameterBuffer* m_params;
+    std::vector<Edge*> m_paramSegments;
+    
     ModelData m_modelData;
     
 protected:
@@ -71,6 +81,29 @@ protected:
     
     template <typename T>
     static void deleteList(const std::vector<T*>& vList);
+    
+    /*
+     * After a failed topological sort: print one of the cycles
+     * among the nodes whose inDegrees are not 0.
+     */
+    void printCycle(boost::unordered_map<Node*, size_t>& nodeIndices
+            , const std::vector<size_t>& inDegrees);
+    
+    /*
+     * Move the parameters of all the edges to a new m_params, in the order
+     * of the incoming edges of m_nodeList, so that the edges of a node
+     * are contiguous.
+     */
+    void bindParameters();
+    
+    /*
+     * Edge::UpdateParams() on all the edges, as one sweep
+     * per run of edges with the same hyper-parameters.
+     * optimizer: ADAM, ADAGRAD and RMSPROP use their own update,
+     * the others gradient descent with momentum.
+     */
+    void updateParams(int iStep, int batchSize
+            , Operation_Optimizer optimizer = Operation::GRADIENT_DESCENT);
 
 };
 
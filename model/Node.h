@@ -9,6 +9,8 @@
 #define	NODE_H
 
 #include <boost/noncopyable.hpp>
+#include <boost/unordered_set.hpp>
+#include <algorithm>
 #include <string>
 #include <pimatrix.h>
 #include "deeplearn.pb.h"
@@ -98,6 +100,38 @@ public:
         }
     }
     
+    /*
+     * Detach e from this node, whether incoming or outgoing
+     */
+    virtual void RemoveEdge(Edge* e)
+    {
+        m_incomingEdges.erase(std::remove(m_incomingEdges.begin()
+                , m_incomingEdges.end(), e), m_incomingEdges.end());
+        m_outgoingEdges.erase(std::remove(m_outgoingEdges.begin()
+                , m_outgoingEdges.end(), e), m_outgoingEdges.end());
+    }
+    
+    /*
+     * Same as RemoveEdge() for many edges, in one pass
+     */
+    virtual void RemoveEdges(const boost::unordered_set<Edge*>& edges)
+    {
+        std::vector<Edge*> kept;
+        for (size_t i = 0; i < m_incomingEdges.size(); ++i)
+        {
+            if (edges.count(m_incomingEdges[i]) == 0)
+                kept.push_back(m_incomingEdges[i]);
+        }
+        m_incomingEdges.swap(kept);
+        kept.clear();
+        for (size_t i = 0; i < m_outgoingEdges.size(); ++i)
+        {
+            if (edges.count(m_outgoingEdges[i]) == 0)
+                kept.push_back(m_outgoingEdges[i]);
+        }
+        m_outgoingEdges.swap(kept);
+    }
+    
     virtual std::string GetName()
     {
         return m_nodeData.name();
@@ -0,0 +1,126 @@
+/*
+ * File:   ParameterBuffer.cpp
+ * Author: agent
+ *
+ * Created on October 18, 2026, 5:50 PM
+ */
+
+#include <boost/assert.hpp>
+#include <cmath>
+#include "ParameterBuffer.h"
+
+namespace model
+{
+
+ParameterBuffer::ParameterBuffer()
+{
+}
+
+ParameterBuffer::~ParameterBuffer()
+{
+}
+
+size_t ParameterBuffer::Allocate(size_t size)
+{
+    const size_t offset = m_weights.size();
+    m_weights.resize(offset + size, 1.0f);
+    m_gradients.resize(offset + size, 0.0f);
+    m_oldGradients.resize(offset + size, 0.0f);
+    return offset;
+}
+
+void ParameterBuffer::Clear()
+{
+    // swap, to give the memory back
+    std::vector<float>().swap(m_weights);
+    std::vector<float>().swap(m_gradients);
+    std::vector<float>().swap(m_oldGradients);
+    std::vector<float>().swap(m_moments);
+    std::vector<float>().swap(m_squares);
+}
+
+void ParameterBuffer::Update(size_t begin, size_t end
+        , float learningRate, float momentum, int batchSize)
+{
+    BOOST_ASSERT(begin <= end && end <= m_weights.size());
+    const float scale = -learningRate / batchSize;
+    for (size_t i = begin; i < end; ++i)
+        m_weights[i] += scale * (m_gradients[i] + momentum * m_oldGradients[i]);
+}
+
+void ParameterBuffer::UpdateAdam(size_t begin, size_t end, float learningRate
+        , float beta1, float beta2, float epsilon, int t, int batchSize)
+{
+    BOOST_ASSERT(begin <= end && end <= m_weights.size() && t >= 1);
+    if (begin == end)
+        return;
+    allocateAverages(true);
+    
+    // the bias corrections of m and v go into the step size
+    const float step = learningRate * std::sqrt(1 - std::pow(beta2, t))
+                        / (1 - std::pow(beta1, t));
+    const float scale = 1.0f / batchSize;
+    float* w = GetWeights();
+    float* m = &m_moments[0];
+    float* v = &m_squares[0];
+    const float* grad = GetGradients();
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float g = scale * grad[i];
+        m[i] = beta1 * m[i] + (1 - beta1) * g;
+        v[i] = beta2 * v[i] + (1 - beta2) * g * g;
+        w[i] -= step * m[i] / (std::sqrt(v[i]) + epsilon);
+    }
+}
+
+void ParameterBuffer::UpdateAdaGrad(size_t begin, size_t end, float learningRate
+        , float epsilon, int batchSize)
+{
+    BOOST_ASSERT(begin <= end && end <= m_weights.size());
+    if (begin == end)
+        return;
+    allocateAverages(false);
+    
+    const float scale = 1.0f / batchSize;
+    float* w = GetWeights();
+    float* v = &m_squares[0];
+    const float* grad = GetGradients();
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float g = scale * grad[i];
+        v[i] += g * g;
+        w[i] -= learningRate * g / (std::sqrt(v[i]) + epsilon);
+    }
+}
+
+void ParameterBuffer::UpdateRmsProp(size_t begin, size_t end, float learningRate
+        , float decay, float epsilon, int batchSize)
+{
+    BOOST_ASSERT(begin <= end && end <= m_weights.size());
+    if (begin == end)
+        return;
+    allocateAverages(false);
+    
+    const float scale = 1.0f / batchSize;
+    float* w = GetWeights();
+    float* v = &m_squares[0];
+    const float* grad = GetGradients();
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float g = scale * grad[i];
+        v[i] = decay * v[i] + (1 - decay) * g * g;
+        w[i] -= learningRate * g / (std::sqrt(v[i]) + epsilon);
+    }
+}
+
+/*****************************************************************************/
+
+void ParameterBuffer::allocateAverages(bool bMoments)
+{
+    if (bMoments && m_moments.size() != m_weights.size())
+        m_moments.resize(m_weights.size(), 0.0f);
+    if (m_squares.size() != m_weights.size())
+        m_squares.resize(m_weights.size(), 0.0f);
+}
+
+}
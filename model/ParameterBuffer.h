@@ -0,0 +1,101 @@
+/*
+ * File:   ParameterBuffer.h
+ * Author: agent
+ *
+ * Created on October 18, 2026, 5:50 PM
+ */
+
+#ifndef PARAMETERBUFFER_H
+#define	PARAMETERBUFFER_H
+
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace model
+{
+
+/*
+ * The weights of a set of edges, with their gradients and the gradients of
+ * the previous step (for momentum), as 3 contiguous arrays. An edge owns
+ * the range [offset, offset + size) of the 3 arrays.
+ * The adaptive optimizers keep their averages in 2 more arrays, allocated
+ * on their first update: they start over in a new buffer.
+ */
+class ParameterBuffer : boost::noncopyable
+{
+    std::vector<float> m_weights, m_gradients, m_oldGradients;
+    std::vector<float> m_moments, m_squares;   // averages of g and g^2
+
+public:
+    ParameterBuffer();
+    virtual ~ParameterBuffer();
+
+    /*
+     * A new range of size parameters, with weights 1 and gradients 0.
+     * Returns its offset. The arrays might move: keep offsets, not pointers.
+     */
+    size_t Allocate(size_t size);
+
+    /*
+     * Free everything, the offsets are invalid afterwards
+     */
+    void Clear();
+
+    size_t GetSize() const
+    {
+        return m_weights.size();
+    }
+
+    float* GetWeights()
+    {
+        return m_weights.empty() ? NULL : &m_weights[0];
+    }
+
+    float* GetGradients()
+    {
+        return m_gradients.empty() ? NULL : &m_gradients[0];
+    }
+
+    float* GetOldGradients()
+    {
+        return m_oldGradients.empty() ? NULL : &m_oldGradients[0];
+    }
+
+    /*
+     * Gradient descent with momentum on [begin, end):
+     * w -= learningRate / batchSize * (g + momentum * g_old)
+     */
+    void Update(size_t begin, size_t end
+            , float learningRate, float momentum, int batchSize);
+    
+    /*
+     * The adaptive optimizers on [begin, end), with g = gradients / batchSize.
+     * Adam: m = beta1 m + (1 - beta1) g, v = beta2 v + (1 - beta2) g^2,
+     * w -= learningRate * sqrt(1 - beta2^t) / (1 - beta1^t) * m / (sqrt(v) + epsilon)
+     * where t, the number of updates so far, starts at 1.
+     */
+    void UpdateAdam(size_t begin, size_t end, float learningRate
+            , float beta1, float beta2, float epsilon, int t, int batchSize);
+    
+    /*
+     * AdaGrad: v += g^2, w -= learningRate * g / (sqrt(v) + epsilon)
+     */
+    void UpdateAdaGrad(size_t begin, size_t end, float learningRate
+            , float epsilon, int batchSize);
+    
+    /*
+     * RMSProp: v = decay v + (1 - decay) g^2, w -= learningRate * g / (sqrt(v) + epsilon)
+     */
+    void UpdateRmsProp(size_t begin, size_t end, float learningRate
+            , float decay, float epsilon, int batchSize);
+    
+private:
+    /*
+     * m_moments and m_squares, as large as m_weights
+     */
+    void allocateAverages(bool bMoments);
+};
+
+}
+#endif	/* PARAMETERBUFFER_H */
+
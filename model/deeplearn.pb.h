@@ -1,112 +1,176 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: deeplearn.proto
 
-#ifndef PROTOBUF_deeplearn_2eproto__INCLUDED
-#define PROTOBUF_deeplearn_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_deeplearn_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_deeplearn_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_deeplearn_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_deeplearn_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_deeplearn_2eproto;
 namespace model {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_deeplearn_2eproto();
-void protobuf_AssignDesc_deeplearn_2eproto();
-void protobuf_ShutdownFile_deeplearn_2eproto();
-
+class DatabaseInfo;
+struct DatabaseInfoDefaultTypeInternal;
+extern DatabaseInfoDefaultTypeInternal _DatabaseInfo_default_instance_;
+class DatasetInfo;
+struct DatasetInfoDefaultTypeInternal;
+extern DatasetInfoDefaultTypeInternal _DatasetInfo_default_instance_;
+class EdgeData;
+struct EdgeDataDefaultTypeInternal;
+extern EdgeDataDefaultTypeInternal _EdgeData_default_instance_;
+class Hyperparams;
+struct HyperparamsDefaultTypeInternal;
+extern HyperparamsDefaultTypeInternal _Hyperparams_default_instance_;
 class Metric;
+struct MetricDefaultTypeInternal;
+extern MetricDefaultTypeInternal _Metric_default_instance_;
 class Metrics;
-class Hyperparams;
-class NodeData;
-class EdgeData;
-class SpnLayerInit;
-class SpnData;
+struct MetricsDefaultTypeInternal;
+extern MetricsDefaultTypeInternal _Metrics_default_instance_;
 class ModelData;
+struct ModelDataDefaultTypeInternal;
+extern ModelDataDefaultTypeInternal _ModelData_default_instance_;
+class NodeData;
+struct NodeDataDefaultTypeInternal;
+extern NodeDataDefaultTypeInternal _NodeData_default_instance_;
 class Operation;
+struct OperationDefaultTypeInternal;
+extern OperationDefaultTypeInternal _Operation_default_instance_;
 class Operation_StopCondition;
-class DatasetInfo;
-class DatabaseInfo;
+struct Operation_StopConditionDefaultTypeInternal;
+extern Operation_StopConditionDefaultTypeInternal _Operation_StopCondition_default_instance_;
+class SpnData;
+struct SpnDataDefaultTypeInternal;
+extern SpnDataDefaultTypeInternal _SpnData_default_instance_;
+class SpnLayerInit;
+struct SpnLayerInitDefaultTypeInternal;
+extern SpnLayerInitDefaultTypeInternal _SpnLayerInit_default_instance_;
+}  // namespace model
+PROTOBUF_NAMESPACE_OPEN
+template<> ::model::DatabaseInfo* Arena::CreateMaybeMessage<::model::DatabaseInfo>(Arena*);
+template<> ::model::DatasetInfo* Arena::CreateMaybeMessage<::model::DatasetInfo>(Arena*);
+template<> ::model::EdgeData* Arena::CreateMaybeMessage<::model::EdgeData>(Arena*);
+template<> ::model::Hyperparams* Arena::CreateMaybeMessage<::model::Hyperparams>(Arena*);
+template<> ::model::Metric* Arena::CreateMaybeMessage<::model::Metric>(Arena*);
+template<> ::model::Metrics* Arena::CreateMaybeMessage<::model::Metrics>(Arena*);
+template<> ::model::ModelData* Arena::CreateMaybeMessage<::model::ModelData>(Arena*);
+template<> ::model::NodeData* Arena::CreateMaybeMessage<::model::NodeData>(Arena*);
+template<> ::model::Operation* Arena::CreateMaybeMessage<::model::Operation>(Arena*);
+template<> ::model::Operation_StopCondition* Arena::CreateMaybeMessage<::model::Operation_StopCondition>(Arena*);
+template<> ::model::SpnData* Arena::CreateMaybeMessage<::model::SpnData>(Arena*);
+template<> ::model::SpnLayerInit* Arena::CreateMaybeMessage<::model::SpnLayerInit>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace model {
 
-enum Metric_MetricType {
+enum Metric_MetricType : int {
   Metric_MetricType_NLL = 1,
   Metric_MetricType_CLASSIFICATION_ERROR = 2
 };
 bool Metric_MetricType_IsValid(int value);
-const Metric_MetricType Metric_MetricType_MetricType_MIN = Metric_MetricType_NLL;
-const Metric_MetricType Metric_MetricType_MetricType_MAX = Metric_MetricType_CLASSIFICATION_ERROR;
-const int Metric_MetricType_MetricType_ARRAYSIZE = Metric_MetricType_MetricType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Metric_MetricType_descriptor();
-inline const ::std::string& Metric_MetricType_Name(Metric_MetricType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Metric_MetricType_descriptor(), value);
+constexpr Metric_MetricType Metric_MetricType_MetricType_MIN = Metric_MetricType_NLL;
+constexpr Metric_MetricType Metric_MetricType_MetricType_MAX = Metric_MetricType_CLASSIFICATION_ERROR;
+constexpr int Metric_MetricType_MetricType_ARRAYSIZE = Metric_MetricType_MetricType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Metric_MetricType_descriptor();
+template<typename T>
+inline const std::string& Metric_MetricType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Metric_MetricType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Metric_MetricType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Metric_MetricType_descriptor(), enum_t_value);
 }
 inline bool Metric_MetricType_Parse(
-    const ::std::string& name, Metric_MetricType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Metric_MetricType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Metric_MetricType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Metric_MetricType>(
     Metric_MetricType_descriptor(), name, value);
 }
-enum Hyperparams_Decay {
+enum Hyperparams_Decay : int {
   Hyperparams_Decay_DECAY_NONE = 0,
   Hyperparams_Decay_DECAY_INVERSE_T = 1,
   Hyperparams_Decay_DECAY_EXPONENTIAL = 2
 };
 bool Hyperparams_Decay_IsValid(int value);
-const Hyperparams_Decay Hyperparams_Decay_Decay_MIN = Hyperparams_Decay_DECAY_NONE;
-const Hyperparams_Decay Hyperparams_Decay_Decay_MAX = Hyperparams_Decay_DECAY_EXPONENTIAL;
-const int Hyperparams_Decay_Decay_ARRAYSIZE = Hyperparams_Decay_Decay_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Hyperparams_Decay_descriptor();
-inline const ::std::string& Hyperparams_Decay_Name(Hyperparams_Decay value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Hyperparams_Decay_descriptor(), value);
+constexpr Hyperparams_Decay Hyperparams_Decay_Decay_MIN = Hyperparams_Decay_DECAY_NONE;
+constexpr Hyperparams_Decay Hyperparams_Decay_Decay_MAX = Hyperparams_Decay_DECAY_EXPONENTIAL;
+constexpr int Hyperparams_Decay_Decay_ARRAYSIZE = Hyperparams_Decay_Decay_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Hyperparams_Decay_descriptor();
+template<typename T>
+inline const std::string& Hyperparams_Decay_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Hyperparams_Decay>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Hyperparams_Decay_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Hyperparams_Decay_descriptor(), enum_t_value);
 }
 inline bool Hyperparams_Decay_Parse(
-    const ::std::string& name, Hyperparams_Decay* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Hyperparams_Decay>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Hyperparams_Decay* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Hyperparams_Decay>(
     Hyperparams_Decay_descriptor(), name, value);
 }
-enum Hyperparams_BestModelCriterion {
+enum Hyperparams_BestModelCriterion : int {
   Hyperparams_BestModelCriterion_CRITERION_NONE = 0,
   Hyperparams_BestModelCriterion_CRITERION_NLL = 1,
   Hyperparams_BestModelCriterion_CRITERION_ERROR = 2
 };
 bool Hyperparams_BestModelCriterion_IsValid(int value);
-const Hyperparams_BestModelCriterion Hyperparams_BestModelCriterion_BestModelCriterion_MIN = Hyperparams_BestModelCriterion_CRITERION_NONE;
-const Hyperparams_BestModelCriterion Hyperparams_BestModelCriterion_BestModelCriterion_MAX = Hyperparams_BestModelCriterion_CRITERION_ERROR;
-const int Hyperparams_BestModelCriterion_BestModelCriterion_ARRAYSIZE = Hyperparams_BestModelCriterion_BestModelCriterion_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Hyperparams_BestModelCriterion_descriptor();
-inline const ::std::string& Hyperparams_BestModelCriterion_Name(Hyperparams_BestModelCriterion value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Hyperparams_BestModelCriterion_descriptor(), value);
+constexpr Hyperparams_BestModelCriterion Hyperparams_BestModelCriterion_BestModelCriterion_MIN = Hyperparams_BestModelCriterion_CRITERION_NONE;
+constexpr Hyperparams_BestModelCriterion Hyperparams_BestModelCriterion_BestModelCriterion_MAX = Hyperparams_BestModelCriterion_CRITERION_ERROR;
+constexpr int Hyperparams_BestModelCriterion_BestModelCriterion_ARRAYSIZE = Hyperparams_BestModelCriterion_BestModelCriterion_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Hyperparams_BestModelCriterion_descriptor();
+template<typename T>
+inline const std::string& Hyperparams_BestModelCriterion_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Hyperparams_BestModelCriterion>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Hyperparams_BestModelCriterion_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Hyperparams_BestModelCriterion_descriptor(), enum_t_value);
 }
 inline bool Hyperparams_BestModelCriterion_Parse(
-    const ::std::string& name, Hyperparams_BestModelCriterion* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Hyperparams_BestModelCriterion>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Hyperparams_BestModelCriterion* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Hyperparams_BestModelCriterion>(
     Hyperparams_BestModelCriterion_descriptor(), name, value);
 }
-enum NodeData_NodeType {
+enum NodeData_NodeType : int {
   NodeData_NodeType_INPUT = 0,
   NodeData_NodeType_HIDDEN = 1,
   NodeData_NodeType_QUERY = 2,
@@ -115,2139 +179,4024 @@ enum NodeData_NodeType {
   NodeData_NodeType_MAX = 5
 };
 bool NodeData_NodeType_IsValid(int value);
-const NodeData_NodeType NodeData_NodeType_NodeType_MIN = NodeData_NodeType_INPUT;
-const NodeData_NodeType NodeData_NodeType_NodeType_MAX = NodeData_NodeType_MAX;
-const int NodeData_NodeType_NodeType_ARRAYSIZE = NodeData_NodeType_NodeType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* NodeData_NodeType_descriptor();
-inline const ::std::string& NodeData_NodeType_Name(NodeData_NodeType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    NodeData_NodeType_descriptor(), value);
+constexpr NodeData_NodeType NodeData_NodeType_NodeType_MIN = NodeData_NodeType_INPUT;
+constexpr NodeData_NodeType NodeData_NodeType_NodeType_MAX = NodeData_NodeType_MAX;
+constexpr int NodeData_NodeType_NodeType_ARRAYSIZE = NodeData_NodeType_NodeType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NodeData_NodeType_descriptor();
+template<typename T>
+inline const std::string& NodeData_NodeType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, NodeData_NodeType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function NodeData_NodeType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    NodeData_NodeType_descriptor(), enum_t_value);
 }
 inline bool NodeData_NodeType_Parse(
-    const ::std::string& name, NodeData_NodeType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<NodeData_NodeType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NodeData_NodeType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NodeData_NodeType>(
     NodeData_NodeType_descriptor(), name, value);
 }
-enum ModelData_ModelType {
+enum ModelData_ModelType : int {
   ModelData_ModelType_SPN = 0
 };
 bool ModelData_ModelType_IsValid(int value);
-const ModelData_ModelType ModelData_ModelType_ModelType_MIN = ModelData_ModelType_SPN;
-const ModelData_ModelType ModelData_ModelType_ModelType_MAX = ModelData_ModelType_SPN;
-const int ModelData_ModelType_ModelType_ARRAYSIZE = ModelData_ModelType_ModelType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ModelData_ModelType_descriptor();
-inline const ::std::string& ModelData_ModelType_Name(ModelData_ModelType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ModelData_ModelType_descriptor(), value);
+constexpr ModelData_ModelType ModelData_ModelType_ModelType_MIN = ModelData_ModelType_SPN;
+constexpr ModelData_ModelType ModelData_ModelType_ModelType_MAX = ModelData_ModelType_SPN;
+constexpr int ModelData_ModelType_ModelType_ARRAYSIZE = ModelData_ModelType_ModelType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ModelData_ModelType_descriptor();
+template<typename T>
+inline const std::string& ModelData_ModelType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ModelData_ModelType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ModelData_ModelType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ModelData_ModelType_descriptor(), enum_t_value);
 }
 inline bool ModelData_ModelType_Parse(
-    const ::std::string& name, ModelData_ModelType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ModelData_ModelType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ModelData_ModelType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ModelData_ModelType>(
     ModelData_ModelType_descriptor(), name, value);
 }
-enum Operation_Optimizer {
+enum Operation_Optimizer : int {
   Operation_Optimizer_GRADIENT_DESCENT = 0,
   Operation_Optimizer_HARD_GRADIENT_DESCENT = 1,
   Operation_Optimizer_EM = 2,
   Operation_Optimizer_HARD_EM = 3,
   Operation_Optimizer_CD = 4,
-  Operation_Optimizer_PCD = 5
+  Operation_Optimizer_PCD = 5,
+  Operation_Optimizer_ADAM = 6,
+  Operation_Optimizer_ADAGRAD = 7,
+  Operation_Optimizer_RMSPROP = 8
 };
 bool Operation_Optimizer_IsValid(int value);
-const Operation_Optimizer Operation_Optimizer_Optimizer_MIN = Operation_Optimizer_GRADIENT_DESCENT;
-const Operation_Optimizer Operation_Optimizer_Optimizer_MAX = Operation_Optimizer_PCD;
-const int Operation_Optimizer_Optimizer_ARRAYSIZE = Operation_Optimizer_Optimizer_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Operation_Optimizer_descriptor();
-inline const ::std::string& Operation_Optimizer_Name(Operation_Optimizer value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Operation_Optimizer_descriptor(), value);
+constexpr Operation_Optimizer Operation_Optimizer_Optimizer_MIN = Operation_Optimizer_GRADIENT_DESCENT;
+constexpr Operation_Optimizer Operation_Optimizer_Optimizer_MAX = Operation_Optimizer_RMSPROP;
+constexpr int Operation_Optimizer_Optimizer_ARRAYSIZE = Operation_Optimizer_Optimizer_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_Optimizer_descriptor();
+template<typename T>
+inline const std::string& Operation_Optimizer_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Operation_Optimizer>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Operation_Optimizer_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Operation_Optimizer_descriptor(), enum_t_value);
 }
 inline bool Operation_Optimizer_Parse(
-    const ::std::string& name, Operation_Optimizer* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Operation_Optimizer>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation_Optimizer* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation_Optimizer>(
     Operation_Optimizer_descriptor(), name, value);
 }
-enum Operation_OperationType {
+enum Operation_OperationType : int {
   Operation_OperationType_TRAIN = 0,
   Operation_OperationType_TEST = 1
 };
 bool Operation_OperationType_IsValid(int value);
-const Operation_OperationType Operation_OperationType_OperationType_MIN = Operation_OperationType_TRAIN;
-const Operation_OperationType Operation_OperationType_OperationType_MAX = Operation_OperationType_TEST;
-const int Operation_OperationType_OperationType_ARRAYSIZE = Operation_OperationType_OperationType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Operation_OperationType_descriptor();
-inline const ::std::string& Operation_OperationType_Name(Operation_OperationType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Operation_OperationType_descriptor(), value);
+constexpr Operation_OperationType Operation_OperationType_OperationType_MIN = Operation_OperationType_TRAIN;
+constexpr Operation_OperationType Operation_OperationType_OperationType_MAX = Operation_OperationType_TEST;
+constexpr int Operation_OperationType_OperationType_ARRAYSIZE = Operation_OperationType_OperationType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_OperationType_descriptor();
+template<typename T>
+inline const std::string& Operation_OperationType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Operation_OperationType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Operation_OperationType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Operation_OperationType_descriptor(), enum_t_value);
 }
 inline bool Operation_OperationType_Parse(
-    const ::std::string& name, Operation_OperationType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Operation_OperationType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation_OperationType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation_OperationType>(
     Operation_OperationType_descriptor(), name, value);
 }
-enum DatasetInfo_DataType {
+enum Operation_ParallelMode : int {
+  Operation_ParallelMode_NODE_LEVELS = 0,
+  Operation_ParallelMode_BATCH_ROWS = 1
+};
+bool Operation_ParallelMode_IsValid(int value);
+constexpr Operation_ParallelMode Operation_ParallelMode_ParallelMode_MIN = Operation_ParallelMode_NODE_LEVELS;
+constexpr Operation_ParallelMode Operation_ParallelMode_ParallelMode_MAX = Operation_ParallelMode_BATCH_ROWS;
+constexpr int Operation_ParallelMode_ParallelMode_ARRAYSIZE = Operation_ParallelMode_ParallelMode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_ParallelMode_descriptor();
+template<typename T>
+inline const std::string& Operation_ParallelMode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Operation_ParallelMode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Operation_ParallelMode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Operation_ParallelMode_descriptor(), enum_t_value);
+}
+inline bool Operation_ParallelMode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation_ParallelMode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation_ParallelMode>(
+    Operation_ParallelMode_descriptor(), name, value);
+}
+enum DatasetInfo_DataType : int {
   DatasetInfo_DataType_TRAIN_SET = 0,
   DatasetInfo_DataType_EVAL_SET = 1,
   DatasetInfo_DataType_TEST_SET = 2
 };
 bool DatasetInfo_DataType_IsValid(int value);
-const DatasetInfo_DataType DatasetInfo_DataType_DataType_MIN = DatasetInfo_DataType_TRAIN_SET;
-const DatasetInfo_DataType DatasetInfo_DataType_DataType_MAX = DatasetInfo_DataType_TEST_SET;
-const int DatasetInfo_DataType_DataType_ARRAYSIZE = DatasetInfo_DataType_DataType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* DatasetInfo_DataType_descriptor();
-inline const ::std::string& DatasetInfo_DataType_Name(DatasetInfo_DataType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    DatasetInfo_DataType_descriptor(), value);
+constexpr DatasetInfo_DataType DatasetInfo_DataType_DataType_MIN = DatasetInfo_DataType_TRAIN_SET;
+constexpr DatasetInfo_DataType DatasetInfo_DataType_DataType_MAX = DatasetInfo_DataType_TEST_SET;
+constexpr int DatasetInfo_DataType_DataType_ARRAYSIZE = DatasetInfo_DataType_DataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetInfo_DataType_descriptor();
+template<typename T>
+inline const std::string& DatasetInfo_DataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DatasetInfo_DataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DatasetInfo_DataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DatasetInfo_DataType_descriptor(), enum_t_value);
 }
 inline bool DatasetInfo_DataType_Parse(
-    const ::std::string& name, DatasetInfo_DataType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<DatasetInfo_DataType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DatasetInfo_DataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DatasetInfo_DataType>(
     DatasetInfo_DataType_descriptor(), name, value);
 }
-enum DatasetInfo_DataFormat {
+enum DatasetInfo_DataFormat : int {
   DatasetInfo_DataFormat_BOOST_MATRIX = 0,
   DatasetInfo_DataFormat_CSV = 1
 };
 bool DatasetInfo_DataFormat_IsValid(int value);
-const DatasetInfo_DataFormat DatasetInfo_DataFormat_DataFormat_MIN = DatasetInfo_DataFormat_BOOST_MATRIX;
-const DatasetInfo_DataFormat DatasetInfo_DataFormat_DataFormat_MAX = DatasetInfo_DataFormat_CSV;
-const int DatasetInfo_DataFormat_DataFormat_ARRAYSIZE = DatasetInfo_DataFormat_DataFormat_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* DatasetInfo_DataFormat_descriptor();
-inline const ::std::string& DatasetInfo_DataFormat_Name(DatasetInfo_DataFormat value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    DatasetInfo_DataFormat_descriptor(), value);
+constexpr DatasetInfo_DataFormat DatasetInfo_DataFormat_DataFormat_MIN = DatasetInfo_DataFormat_BOOST_MATRIX;
+constexpr DatasetInfo_DataFormat DatasetInfo_DataFormat_DataFormat_MAX = DatasetInfo_DataFormat_CSV;
+constexpr int DatasetInfo_DataFormat_DataFormat_ARRAYSIZE = DatasetInfo_DataFormat_DataFormat_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetInfo_DataFormat_descriptor();
+template<typename T>
+inline const std::string& DatasetInfo_DataFormat_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DatasetInfo_DataFormat>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DatasetInfo_DataFormat_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DatasetInfo_DataFormat_descriptor(), enum_t_value);
 }
 inline bool DatasetInfo_DataFormat_Parse(
-    const ::std::string& name, DatasetInfo_DataFormat* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<DatasetInfo_DataFormat>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DatasetInfo_DataFormat* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DatasetInfo_DataFormat>(
     DatasetInfo_DataFormat_descriptor(), name, value);
 }
+enum DatasetInfo_DiskReader : int {
+  DatasetInfo_DiskReader_STREAM = 0,
+  DatasetInfo_DiskReader_DIRECT_ASYNC = 1
+};
+bool DatasetInfo_DiskReader_IsValid(int value);
+constexpr DatasetInfo_DiskReader DatasetInfo_DiskReader_DiskReader_MIN = DatasetInfo_DiskReader_STREAM;
+constexpr DatasetInfo_DiskReader DatasetInfo_DiskReader_DiskReader_MAX = DatasetInfo_DiskReader_DIRECT_ASYNC;
+constexpr int DatasetInfo_DiskReader_DiskReader_ARRAYSIZE = DatasetInfo_DiskReader_DiskReader_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetInfo_DiskReader_descriptor();
+template<typename T>
+inline const std::string& DatasetInfo_DiskReader_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DatasetInfo_DiskReader>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DatasetInfo_DiskReader_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DatasetInfo_DiskReader_descriptor(), enum_t_value);
+}
+inline bool DatasetInfo_DiskReader_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DatasetInfo_DiskReader* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DatasetInfo_DiskReader>(
+    DatasetInfo_DiskReader_descriptor(), name, value);
+}
 // ===================================================================
 
-class Metric : public ::google::protobuf::Message {
+class Metric final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.Metric) */ {
  public:
-  Metric();
-  virtual ~Metric();
+  inline Metric() : Metric(nullptr) {}
+  ~Metric() override;
+  explicit PROTOBUF_CONSTEXPR Metric(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Metric(const Metric& from);
+  Metric(Metric&& from) noexcept
+    : Metric() {
+    *this = ::std::move(from);
+  }
 
   inline Metric& operator=(const Metric& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Metric& operator=(Metric&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Metric& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metric& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metric* internal_default_instance() {
+    return reinterpret_cast<const Metric*>(
+               &_Metric_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Metric* other);
+  friend void swap(Metric& a, Metric& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metric* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metric* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Metric* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Metric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metric>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Metric& from);
-  void MergeFrom(const Metric& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metric& from) {
+    Metric::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metric* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.Metric";
+  }
+  protected:
+  explicit Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef Metric_MetricType MetricType;
-  static const MetricType NLL = Metric_MetricType_NLL;
-  static const MetricType CLASSIFICATION_ERROR = Metric_MetricType_CLASSIFICATION_ERROR;
+  static constexpr MetricType NLL =
+    Metric_MetricType_NLL;
+  static constexpr MetricType CLASSIFICATION_ERROR =
+    Metric_MetricType_CLASSIFICATION_ERROR;
   static inline bool MetricType_IsValid(int value) {
     return Metric_MetricType_IsValid(value);
   }
-  static const MetricType MetricType_MIN =
+  static constexpr MetricType MetricType_MIN =
     Metric_MetricType_MetricType_MIN;
-  static const MetricType MetricType_MAX =
+  static constexpr MetricType MetricType_MAX =
     Metric_MetricType_MetricType_MAX;
-  static const int MetricType_ARRAYSIZE =
+  static constexpr int MetricType_ARRAYSIZE =
     Metric_MetricType_MetricType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   MetricType_descriptor() {
     return Metric_MetricType_descriptor();
   }
-  static inline const ::std::string& MetricType_Name(MetricType value) {
-    return Metric_MetricType_Name(value);
+  template<typename T>
+  static inline const std::string& MetricType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, MetricType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function MetricType_Name.");
+    return Metric_MetricType_Name(enum_t_value);
   }
-  static inline bool MetricType_Parse(const ::std::string& name,
+  static inline bool MetricType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       MetricType* value) {
     return Metric_MetricType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // required .model.Metric.MetricType type = 1 [default = NLL];
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::model::Metric_MetricType type() const;
-  inline void set_type(::model::Metric_MetricType value);
-
+  enum : int {
+    kStepsFieldNumber = 2,
+    kValuesFieldNumber = 3,
+    kTypeFieldNumber = 1,
+  };
   // repeated int32 steps = 2;
-  inline int steps_size() const;
-  inline void clear_steps();
-  static const int kStepsFieldNumber = 2;
-  inline ::google::protobuf::int32 steps(int index) const;
-  inline void set_steps(int index, ::google::protobuf::int32 value);
-  inline void add_steps(::google::protobuf::int32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+  int steps_size() const;
+  private:
+  int _internal_steps_size() const;
+  public:
+  void clear_steps();
+  private:
+  int32_t _internal_steps(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_steps() const;
+  void _internal_add_steps(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_steps();
+  public:
+  int32_t steps(int index) const;
+  void set_steps(int index, int32_t value);
+  void add_steps(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       steps() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_steps();
 
   // repeated float values = 3;
-  inline int values_size() const;
-  inline void clear_values();
-  static const int kValuesFieldNumber = 3;
-  inline float values(int index) const;
-  inline void set_values(int index, float value);
-  inline void add_values(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  private:
+  float _internal_values(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_values() const;
+  void _internal_add_values(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_values();
+  public:
+  float values(int index) const;
+  void set_values(int index, float value);
+  void add_values(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
       values() const;
-  inline ::google::protobuf::RepeatedField< float >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
       mutable_values();
 
+  // required .model.Metric.MetricType type = 1 [default = NLL];
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::model::Metric_MetricType type() const;
+  void set_type(::model::Metric_MetricType value);
+  private:
+  ::model::Metric_MetricType _internal_type() const;
+  void _internal_set_type(::model::Metric_MetricType value);
+  public:
+
   // @@protoc_insertion_point(class_scope:model.Metric)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > steps_;
-  ::google::protobuf::RepeatedField< float > values_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static Metric* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > steps_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > values_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Metrics : public ::google::protobuf::Message {
+class Metrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.Metrics) */ {
  public:
-  Metrics();
-  virtual ~Metrics();
+  inline Metrics() : Metrics(nullptr) {}
+  ~Metrics() override;
+  explicit PROTOBUF_CONSTEXPR Metrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Metrics(const Metrics& from);
+  Metrics(Metrics&& from) noexcept
+    : Metrics() {
+    *this = ::std::move(from);
+  }
 
   inline Metrics& operator=(const Metrics& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Metrics& operator=(Metrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Metrics& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metrics* internal_default_instance() {
+    return reinterpret_cast<const Metrics*>(
+               &_Metrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Metrics* other);
+  friend void swap(Metrics& a, Metrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Metrics* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Metrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Metrics& from);
-  void MergeFrom(const Metrics& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metrics& from) {
+    Metrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.Metrics";
+  }
+  protected:
+  explicit Metrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMetricsFieldNumber = 1,
+  };
   // repeated .model.Metric metrics = 1;
-  inline int metrics_size() const;
-  inline void clear_metrics();
-  static const int kMetricsFieldNumber = 1;
-  inline const ::model::Metric& metrics(int index) const;
-  inline ::model::Metric* mutable_metrics(int index);
-  inline ::model::Metric* add_metrics();
-  inline const ::google::protobuf::RepeatedPtrField< ::model::Metric >&
-      metrics() const;
-  inline ::google::protobuf::RepeatedPtrField< ::model::Metric >*
+  int metrics_size() const;
+  private:
+  int _internal_metrics_size() const;
+  public:
+  void clear_metrics();
+  ::model::Metric* mutable_metrics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::Metric >*
       mutable_metrics();
+  private:
+  const ::model::Metric& _internal_metrics(int index) const;
+  ::model::Metric* _internal_add_metrics();
+  public:
+  const ::model::Metric& metrics(int index) const;
+  ::model::Metric* add_metrics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::Metric >&
+      metrics() const;
 
   // @@protoc_insertion_point(class_scope:model.Metrics)
  private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::model::Metric > metrics_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static Metrics* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::Metric > metrics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Hyperparams : public ::google::protobuf::Message {
+class Hyperparams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.Hyperparams) */ {
  public:
-  Hyperparams();
-  virtual ~Hyperparams();
+  inline Hyperparams() : Hyperparams(nullptr) {}
+  ~Hyperparams() override;
+  explicit PROTOBUF_CONSTEXPR Hyperparams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Hyperparams(const Hyperparams& from);
+  Hyperparams(Hyperparams&& from) noexcept
+    : Hyperparams() {
+    *this = ::std::move(from);
+  }
 
   inline Hyperparams& operator=(const Hyperparams& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Hyperparams& operator=(Hyperparams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Hyperparams& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Hyperparams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Hyperparams* internal_default_instance() {
+    return reinterpret_cast<const Hyperparams*>(
+               &_Hyperparams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(Hyperparams* other);
+  friend void swap(Hyperparams& a, Hyperparams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Hyperparams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Hyperparams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Hyperparams* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Hyperparams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Hyperparams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Hyperparams& from);
-  void MergeFrom(const Hyperparams& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Hyperparams& from) {
+    Hyperparams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Hyperparams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.Hyperparams";
+  }
+  protected:
+  explicit Hyperparams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef Hyperparams_Decay Decay;
-  static const Decay DECAY_NONE = Hyperparams_Decay_DECAY_NONE;
-  static const Decay DECAY_INVERSE_T = Hyperparams_Decay_DECAY_INVERSE_T;
-  static const Decay DECAY_EXPONENTIAL = Hyperparams_Decay_DECAY_EXPONENTIAL;
+  static constexpr Decay DECAY_NONE =
+    Hyperparams_Decay_DECAY_NONE;
+  static constexpr Decay DECAY_INVERSE_T =
+    Hyperparams_Decay_DECAY_INVERSE_T;
+  static constexpr Decay DECAY_EXPONENTIAL =
+    Hyperparams_Decay_DECAY_EXPONENTIAL;
   static inline bool Decay_IsValid(int value) {
     return Hyperparams_Decay_IsValid(value);
   }
-  static const Decay Decay_MIN =
+  static constexpr Decay Decay_MIN =
     Hyperparams_Decay_Decay_MIN;
-  static const Decay Decay_MAX =
+  static constexpr Decay Decay_MAX =
     Hyperparams_Decay_Decay_MAX;
-  static const int Decay_ARRAYSIZE =
+  static constexpr int Decay_ARRAYSIZE =
     Hyperparams_Decay_Decay_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Decay_descriptor() {
     return Hyperparams_Decay_descriptor();
   }
-  static inline const ::std::string& Decay_Name(Decay value) {
-    return Hyperparams_Decay_Name(value);
+  template<typename T>
+  static inline const std::string& Decay_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Decay>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Decay_Name.");
+    return Hyperparams_Decay_Name(enum_t_value);
   }
-  static inline bool Decay_Parse(const ::std::string& name,
+  static inline bool Decay_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Decay* value) {
     return Hyperparams_Decay_Parse(name, value);
   }
 
   typedef Hyperparams_BestModelCriterion BestModelCriterion;
-  static const BestModelCriterion CRITERION_NONE = Hyperparams_BestModelCriterion_CRITERION_NONE;
-  static const BestModelCriterion CRITERION_NLL = Hyperparams_BestModelCriterion_CRITERION_NLL;
-  static const BestModelCriterion CRITERION_ERROR = Hyperparams_BestModelCriterion_CRITERION_ERROR;
+  static constexpr BestModelCriterion CRITERION_NONE =
+    Hyperparams_BestModelCriterion_CRITERION_NONE;
+  static constexpr BestModelCriterion CRITERION_NLL =
+    Hyperparams_BestModelCriterion_CRITERION_NLL;
+  static constexpr BestModelCriterion CRITERION_ERROR =
+    Hyperparams_BestModelCriterion_CRITERION_ERROR;
   static inline bool BestModelCriterion_IsValid(int value) {
     return Hyperparams_BestModelCriterion_IsValid(value);
   }
-  static const BestModelCriterion BestModelCriterion_MIN =
+  static constexpr BestModelCriterion BestModelCriterion_MIN =
     Hyperparams_BestModelCriterion_BestModelCriterion_MIN;
-  static const BestModelCriterion BestModelCriterion_MAX =
+  static constexpr BestModelCriterion BestModelCriterion_MAX =
     Hyperparams_BestModelCriterion_BestModelCriterion_MAX;
-  static const int BestModelCriterion_ARRAYSIZE =
+  static constexpr int BestModelCriterion_ARRAYSIZE =
     Hyperparams_BestModelCriterion_BestModelCriterion_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   BestModelCriterion_descriptor() {
     return Hyperparams_BestModelCriterion_descriptor();
   }
-  static inline const ::std::string& BestModelCriterion_Name(BestModelCriterion value) {
-    return Hyperparams_BestModelCriterion_Name(value);
+  template<typename T>
+  static inline const std::string& BestModelCriterion_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, BestModelCriterion>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function BestModelCriterion_Name.");
+    return Hyperparams_BestModelCriterion_Name(enum_t_value);
   }
-  static inline bool BestModelCriterion_Parse(const ::std::string& name,
+  static inline bool BestModelCriterion_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       BestModelCriterion* value) {
     return Hyperparams_BestModelCriterion_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // optional float base_learningrate = 1 [default = 0.01];
-  inline bool has_base_learningrate() const;
-  inline void clear_base_learningrate();
-  static const int kBaseLearningrateFieldNumber = 1;
-  inline float base_learningrate() const;
-  inline void set_base_learningrate(float value);
-
+  enum : int {
+    kLearningrateDecayFieldNumber = 2,
+    kInitialMomentumFieldNumber = 4,
+    kFinalMomentumFieldNumber = 5,
+    kSelectModelCriterionFieldNumber = 7,
+    kEpsilonFieldNumber = 11,
+    kBaseLearningrateFieldNumber = 1,
+    kLearningrateDecayHalfLifeFieldNumber = 3,
+    kMomentumChangeStepsFieldNumber = 6,
+    kAdamBeta1FieldNumber = 8,
+    kAdamBeta2FieldNumber = 9,
+    kRmspropDecayFieldNumber = 10,
+  };
   // optional .model.Hyperparams.Decay learningrate_decay = 2 [default = DECAY_NONE];
-  inline bool has_learningrate_decay() const;
-  inline void clear_learningrate_decay();
-  static const int kLearningrateDecayFieldNumber = 2;
-  inline ::model::Hyperparams_Decay learningrate_decay() const;
-  inline void set_learningrate_decay(::model::Hyperparams_Decay value);
-
-  // optional int32 learningrate_decay_half_life = 3 [default = 1000];
-  inline bool has_learningrate_decay_half_life() const;
-  inline void clear_learningrate_decay_half_life();
-  static const int kLearningrateDecayHalfLifeFieldNumber = 3;
-  inline ::google::protobuf::int32 learningrate_decay_half_life() const;
-  inline void set_learningrate_decay_half_life(::google::protobuf::int32 value);
+  bool has_learningrate_decay() const;
+  private:
+  bool _internal_has_learningrate_decay() const;
+  public:
+  void clear_learningrate_decay();
+  ::model::Hyperparams_Decay learningrate_decay() const;
+  void set_learningrate_decay(::model::Hyperparams_Decay value);
+  private:
+  ::model::Hyperparams_Decay _internal_learningrate_decay() const;
+  void _internal_set_learningrate_decay(::model::Hyperparams_Decay value);
+  public:
 
   // optional float initial_momentum = 4 [default = 0];
-  inline bool has_initial_momentum() const;
-  inline void clear_initial_momentum();
-  static const int kInitialMomentumFieldNumber = 4;
-  inline float initial_momentum() const;
-  inline void set_initial_momentum(float value);
+  bool has_initial_momentum() const;
+  private:
+  bool _internal_has_initial_momentum() const;
+  public:
+  void clear_initial_momentum();
+  float initial_momentum() const;
+  void set_initial_momentum(float value);
+  private:
+  float _internal_initial_momentum() const;
+  void _internal_set_initial_momentum(float value);
+  public:
 
   // optional float final_momentum = 5 [default = 0];
-  inline bool has_final_momentum() const;
-  inline void clear_final_momentum();
-  static const int kFinalMomentumFieldNumber = 5;
-  inline float final_momentum() const;
-  inline void set_final_momentum(float value);
+  bool has_final_momentum() const;
+  private:
+  bool _internal_has_final_momentum() const;
+  public:
+  void clear_final_momentum();
+  float final_momentum() const;
+  void set_final_momentum(float value);
+  private:
+  float _internal_final_momentum() const;
+  void _internal_set_final_momentum(float value);
+  public:
+
+  // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
+  bool has_select_model_criterion() const;
+  private:
+  bool _internal_has_select_model_criterion() const;
+  public:
+  void clear_select_model_criterion();
+  ::model::Hyperparams_BestModelCriterion select_model_criterion() const;
+  void set_select_model_criterion(::model::Hyperparams_BestModelCriterion value);
+  private:
+  ::model::Hyperparams_BestModelCriterion _internal_select_model_criterion() const;
+  void _internal_set_select_model_criterion(::model::Hyperparams_BestModelCriterion value);
+  public:
+
+  // optional float epsilon = 11 [default = 1e-08];
+  bool has_epsilon() const;
+  private:
+  bool _internal_has_epsilon() const;
+  public:
+  void clear_epsilon();
+  float epsilon() const;
+  void set_epsilon(float value);
+  private:
+  float _internal_epsilon() const;
+  void _internal_set_epsilon(float value);
+  public:
+
+  // optional float base_learningrate = 1 [default = 0.01];
+  bool has_base_learningrate() const;
+  private:
+  bool _internal_has_base_learningrate() const;
+  public:
+  void clear_base_learningrate();
+  float base_learningrate() const;
+  void set_base_learningrate(float value);
+  private:
+  float _internal_base_learningrate() const;
+  void _internal_set_base_learningrate(float value);
+  public:
+
+  // optional int32 learningrate_decay_half_life = 3 [default = 1000];
+  bool has_learningrate_decay_half_life() const;
+  private:
+  bool _internal_has_learningrate_decay_half_life() const;
+  public:
+  void clear_learningrate_decay_half_life();
+  int32_t learningrate_decay_half_life() const;
+  void set_learningrate_decay_half_life(int32_t value);
+  private:
+  int32_t _internal_learningrate_decay_half_life() const;
+  void _internal_set_learningrate_decay_half_life(int32_t value);
+  public:
 
   // optional int32 momentum_change_steps = 6 [default = 10];
-  inline bool has_momentum_change_steps() const;
-  inline void clear_momentum_change_steps();
-  static const int kMomentumChangeStepsFieldNumber = 6;
-  inline ::google::protobuf::int32 momentum_change_steps() const;
-  inline void set_momentum_change_steps(::google::protobuf::int32 value);
+  bool has_momentum_change_steps() const;
+  private:
+  bool _internal_has_momentum_change_steps() const;
+  public:
+  void clear_momentum_change_steps();
+  int32_t momentum_change_steps() const;
+  void set_momentum_change_steps(int32_t value);
+  private:
+  int32_t _internal_momentum_change_steps() const;
+  void _internal_set_momentum_change_steps(int32_t value);
+  public:
 
-  // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
-  inline bool has_select_model_criterion() const;
-  inline void clear_select_model_criterion();
-  static const int kSelectModelCriterionFieldNumber = 7;
-  inline ::model::Hyperparams_BestModelCriterion select_model_criterion() const;
-  inline void set_select_model_criterion(::model::Hyperparams_BestModelCriterion value);
+  // optional float adam_beta1 = 8 [default = 0.9];
+  bool has_adam_beta1() const;
+  private:
+  bool _internal_has_adam_beta1() const;
+  public:
+  void clear_adam_beta1();
+  float adam_beta1() const;
+  void set_adam_beta1(float value);
+  private:
+  float _internal_adam_beta1() const;
+  void _internal_set_adam_beta1(float value);
+  public:
+
+  // optional float adam_beta2 = 9 [default = 0.999];
+  bool has_adam_beta2() const;
+  private:
+  bool _internal_has_adam_beta2() const;
+  public:
+  void clear_adam_beta2();
+  float adam_beta2() const;
+  void set_adam_beta2(float value);
+  private:
+  float _internal_adam_beta2() const;
+  void _internal_set_adam_beta2(float value);
+  public:
+
+  // optional float rmsprop_decay = 10 [default = 0.9];
+  bool has_rmsprop_decay() const;
+  private:
+  bool _internal_has_rmsprop_decay() const;
+  public:
+  void clear_rmsprop_decay();
+  float rmsprop_decay() const;
+  void set_rmsprop_decay(float value);
+  private:
+  float _internal_rmsprop_decay() const;
+  void _internal_set_rmsprop_decay(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.Hyperparams)
  private:
-  inline void set_has_base_learningrate();
-  inline void clear_has_base_learningrate();
-  inline void set_has_learningrate_decay();
-  inline void clear_has_learningrate_decay();
-  inline void set_has_learningrate_decay_half_life();
-  inline void clear_has_learningrate_decay_half_life();
-  inline void set_has_initial_momentum();
-  inline void clear_has_initial_momentum();
-  inline void set_has_final_momentum();
-  inline void clear_has_final_momentum();
-  inline void set_has_momentum_change_steps();
-  inline void clear_has_momentum_change_steps();
-  inline void set_has_select_model_criterion();
-  inline void clear_has_select_model_criterion();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  float base_learningrate_;
-  int learningrate_decay_;
-  ::google::protobuf::int32 learningrate_decay_half_life_;
-  float initial_momentum_;
-  float final_momentum_;
-  ::google::protobuf::int32 momentum_change_steps_;
-  int select_model_criterion_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(7 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static Hyperparams* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int learningrate_decay_;
+    float initial_momentum_;
+    float final_momentum_;
+    int select_model_criterion_;
+    float epsilon_;
+    float base_learningrate_;
+    int32_t learningrate_decay_half_life_;
+    int32_t momentum_change_steps_;
+    float adam_beta1_;
+    float adam_beta2_;
+    float rmsprop_decay_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NodeData : public ::google::protobuf::Message {
+class NodeData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.NodeData) */ {
  public:
-  NodeData();
-  virtual ~NodeData();
+  inline NodeData() : NodeData(nullptr) {}
+  ~NodeData() override;
+  explicit PROTOBUF_CONSTEXPR NodeData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NodeData(const NodeData& from);
+  NodeData(NodeData&& from) noexcept
+    : NodeData() {
+    *this = ::std::move(from);
+  }
 
   inline NodeData& operator=(const NodeData& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline NodeData& operator=(NodeData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NodeData& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeData* internal_default_instance() {
+    return reinterpret_cast<const NodeData*>(
+               &_NodeData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(NodeData* other);
+  friend void swap(NodeData& a, NodeData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  NodeData* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  NodeData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NodeData& from);
-  void MergeFrom(const NodeData& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeData& from) {
+    NodeData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.NodeData";
+  }
+  protected:
+  explicit NodeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef NodeData_NodeType NodeType;
-  static const NodeType INPUT = NodeData_NodeType_INPUT;
-  static const NodeType HIDDEN = NodeData_NodeType_HIDDEN;
-  static const NodeType QUERY = NodeData_NodeType_QUERY;
-  static const NodeType PRODUCT = NodeData_NodeType_PRODUCT;
-  static const NodeType SUM = NodeData_NodeType_SUM;
-  static const NodeType MAX = NodeData_NodeType_MAX;
+  static constexpr NodeType INPUT =
+    NodeData_NodeType_INPUT;
+  static constexpr NodeType HIDDEN =
+    NodeData_NodeType_HIDDEN;
+  static constexpr NodeType QUERY =
+    NodeData_NodeType_QUERY;
+  static constexpr NodeType PRODUCT =
+    NodeData_NodeType_PRODUCT;
+  static constexpr NodeType SUM =
+    NodeData_NodeType_SUM;
+  static constexpr NodeType MAX =
+    NodeData_NodeType_MAX;
   static inline bool NodeType_IsValid(int value) {
     return NodeData_NodeType_IsValid(value);
   }
-  static const NodeType NodeType_MIN =
+  static constexpr NodeType NodeType_MIN =
     NodeData_NodeType_NodeType_MIN;
-  static const NodeType NodeType_MAX =
+  static constexpr NodeType NodeType_MAX =
     NodeData_NodeType_NodeType_MAX;
-  static const int NodeType_ARRAYSIZE =
+  static constexpr int NodeType_ARRAYSIZE =
     NodeData_NodeType_NodeType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   NodeType_descriptor() {
     return NodeData_NodeType_descriptor();
   }
-  static inline const ::std::string& NodeType_Name(NodeType value) {
-    return NodeData_NodeType_Name(value);
+  template<typename T>
+  static inline const std::string& NodeType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, NodeType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function NodeType_Name.");
+    return NodeData_NodeType_Name(enum_t_value);
   }
-  static inline bool NodeType_Parse(const ::std::string& name,
+  static inline bool NodeType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       NodeType* value) {
     return NodeData_NodeType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kBiasFieldNumber = 5,
+    kHyperParamsFieldNumber = 6,
+    kTypeFieldNumber = 2,
+    kDimensionFieldNumber = 3,
+    kInputStartIndexFieldNumber = 4,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional bytes bias = 5;
+  bool has_bias() const;
+  private:
+  bool _internal_has_bias() const;
+  public:
+  void clear_bias();
+  const std::string& bias() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bias(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bias();
+  PROTOBUF_NODISCARD std::string* release_bias();
+  void set_allocated_bias(std::string* bias);
+  private:
+  const std::string& _internal_bias() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bias(const std::string& value);
+  std::string* _internal_mutable_bias();
+  public:
+
+  // optional .model.Hyperparams hyper_params = 6;
+  bool has_hyper_params() const;
+  private:
+  bool _internal_has_hyper_params() const;
+  public:
+  void clear_hyper_params();
+  const ::model::Hyperparams& hyper_params() const;
+  PROTOBUF_NODISCARD ::model::Hyperparams* release_hyper_params();
+  ::model::Hyperparams* mutable_hyper_params();
+  void set_allocated_hyper_params(::model::Hyperparams* hyper_params);
+  private:
+  const ::model::Hyperparams& _internal_hyper_params() const;
+  ::model::Hyperparams* _internal_mutable_hyper_params();
+  public:
+  void unsafe_arena_set_allocated_hyper_params(
+      ::model::Hyperparams* hyper_params);
+  ::model::Hyperparams* unsafe_arena_release_hyper_params();
 
   // required .model.NodeData.NodeType type = 2;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 2;
-  inline ::model::NodeData_NodeType type() const;
-  inline void set_type(::model::NodeData_NodeType value);
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::model::NodeData_NodeType type() const;
+  void set_type(::model::NodeData_NodeType value);
+  private:
+  ::model::NodeData_NodeType _internal_type() const;
+  void _internal_set_type(::model::NodeData_NodeType value);
+  public:
 
   // required int32 dimension = 3;
-  inline bool has_dimension() const;
-  inline void clear_dimension();
-  static const int kDimensionFieldNumber = 3;
-  inline ::google::protobuf::int32 dimension() const;
-  inline void set_dimension(::google::protobuf::int32 value);
+  bool has_dimension() const;
+  private:
+  bool _internal_has_dimension() const;
+  public:
+  void clear_dimension();
+  int32_t dimension() const;
+  void set_dimension(int32_t value);
+  private:
+  int32_t _internal_dimension() const;
+  void _internal_set_dimension(int32_t value);
+  public:
 
   // optional int32 input_start_index = 4;
-  inline bool has_input_start_index() const;
-  inline void clear_input_start_index();
-  static const int kInputStartIndexFieldNumber = 4;
-  inline ::google::protobuf::int32 input_start_index() const;
-  inline void set_input_start_index(::google::protobuf::int32 value);
-
-  // optional bytes bias = 5;
-  inline bool has_bias() const;
-  inline void clear_bias();
-  static const int kBiasFieldNumber = 5;
-  inline const ::std::string& bias() const;
-  inline void set_bias(const ::std::string& value);
-  inline void set_bias(const char* value);
-  inline void set_bias(const void* value, size_t size);
-  inline ::std::string* mutable_bias();
-  inline ::std::string* release_bias();
-  inline void set_allocated_bias(::std::string* bias);
-
-  // optional .model.Hyperparams hyper_params = 6;
-  inline bool has_hyper_params() const;
-  inline void clear_hyper_params();
-  static const int kHyperParamsFieldNumber = 6;
-  inline const ::model::Hyperparams& hyper_params() const;
-  inline ::model::Hyperparams* mutable_hyper_params();
-  inline ::model::Hyperparams* release_hyper_params();
-  inline void set_allocated_hyper_params(::model::Hyperparams* hyper_params);
+  bool has_input_start_index() const;
+  private:
+  bool _internal_has_input_start_index() const;
+  public:
+  void clear_input_start_index();
+  int32_t input_start_index() const;
+  void set_input_start_index(int32_t value);
+  private:
+  int32_t _internal_input_start_index() const;
+  void _internal_set_input_start_index(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.NodeData)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_dimension();
-  inline void clear_has_dimension();
-  inline void set_has_input_start_index();
-  inline void clear_has_input_start_index();
-  inline void set_has_bias();
-  inline void clear_has_bias();
-  inline void set_has_hyper_params();
-  inline void clear_has_hyper_params();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  int type_;
-  ::google::protobuf::int32 dimension_;
-  ::std::string* bias_;
-  ::model::Hyperparams* hyper_params_;
-  ::google::protobuf::int32 input_start_index_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static NodeData* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bias_;
+    ::model::Hyperparams* hyper_params_;
+    int type_;
+    int32_t dimension_;
+    int32_t input_start_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EdgeData : public ::google::protobuf::Message {
+class EdgeData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.EdgeData) */ {
  public:
-  EdgeData();
-  virtual ~EdgeData();
+  inline EdgeData() : EdgeData(nullptr) {}
+  ~EdgeData() override;
+  explicit PROTOBUF_CONSTEXPR EdgeData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EdgeData(const EdgeData& from);
+  EdgeData(EdgeData&& from) noexcept
+    : EdgeData() {
+    *this = ::std::move(from);
+  }
 
   inline EdgeData& operator=(const EdgeData& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline EdgeData& operator=(EdgeData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const EdgeData& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EdgeData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EdgeData* internal_default_instance() {
+    return reinterpret_cast<const EdgeData*>(
+               &_EdgeData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(EdgeData* other);
+  friend void swap(EdgeData& a, EdgeData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EdgeData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EdgeData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  EdgeData* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  EdgeData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EdgeData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EdgeData& from);
-  void MergeFrom(const EdgeData& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EdgeData& from) {
+    EdgeData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EdgeData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.EdgeData";
+  }
+  protected:
+  explicit EdgeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool directed = 1 [default = true];
-  inline bool has_directed() const;
-  inline void clear_directed();
-  static const int kDirectedFieldNumber = 1;
-  inline bool directed() const;
-  inline void set_directed(bool value);
-
+  enum : int {
+    kWeightFieldNumber = 2,
+    kNode1FieldNumber = 3,
+    kNode2FieldNumber = 4,
+    kHyperParamsFieldNumber = 5,
+    kDirectedFieldNumber = 1,
+  };
   // optional bytes weight = 2;
-  inline bool has_weight() const;
-  inline void clear_weight();
-  static const int kWeightFieldNumber = 2;
-  inline const ::std::string& weight() const;
-  inline void set_weight(const ::std::string& value);
-  inline void set_weight(const char* value);
-  inline void set_weight(const void* value, size_t size);
-  inline ::std::string* mutable_weight();
-  inline ::std::string* release_weight();
-  inline void set_allocated_weight(::std::string* weight);
+  bool has_weight() const;
+  private:
+  bool _internal_has_weight() const;
+  public:
+  void clear_weight();
+  const std::string& weight() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_weight(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_weight();
+  PROTOBUF_NODISCARD std::string* release_weight();
+  void set_allocated_weight(std::string* weight);
+  private:
+  const std::string& _internal_weight() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_weight(const std::string& value);
+  std::string* _internal_mutable_weight();
+  public:
 
   // optional string node1 = 3;
-  inline bool has_node1() const;
-  inline void clear_node1();
-  static const int kNode1FieldNumber = 3;
-  inline const ::std::string& node1() const;
-  inline void set_node1(const ::std::string& value);
-  inline void set_node1(const char* value);
-  inline void set_node1(const char* value, size_t size);
-  inline ::std::string* mutable_node1();
-  inline ::std::string* release_node1();
-  inline void set_allocated_node1(::std::string* node1);
+  bool has_node1() const;
+  private:
+  bool _internal_has_node1() const;
+  public:
+  void clear_node1();
+  const std::string& node1() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node1(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node1();
+  PROTOBUF_NODISCARD std::string* release_node1();
+  void set_allocated_node1(std::string* node1);
+  private:
+  const std::string& _internal_node1() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node1(const std::string& value);
+  std::string* _internal_mutable_node1();
+  public:
 
   // optional string node2 = 4;
-  inline bool has_node2() const;
-  inline void clear_node2();
-  static const int kNode2FieldNumber = 4;
-  inline const ::std::string& node2() const;
-  inline void set_node2(const ::std::string& value);
-  inline void set_node2(const char* value);
-  inline void set_node2(const char* value, size_t size);
-  inline ::std::string* mutable_node2();
-  inline ::std::string* release_node2();
-  inline void set_allocated_node2(::std::string* node2);
+  bool has_node2() const;
+  private:
+  bool _internal_has_node2() const;
+  public:
+  void clear_node2();
+  const std::string& node2() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node2(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node2();
+  PROTOBUF_NODISCARD std::string* release_node2();
+  void set_allocated_node2(std::string* node2);
+  private:
+  const std::string& _internal_node2() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node2(const std::string& value);
+  std::string* _internal_mutable_node2();
+  public:
 
   // optional .model.Hyperparams hyper_params = 5;
-  inline bool has_hyper_params() const;
-  inline void clear_hyper_params();
-  static const int kHyperParamsFieldNumber = 5;
-  inline const ::model::Hyperparams& hyper_params() const;
-  inline ::model::Hyperparams* mutable_hyper_params();
-  inline ::model::Hyperparams* release_hyper_params();
-  inline void set_allocated_hyper_params(::model::Hyperparams* hyper_params);
+  bool has_hyper_params() const;
+  private:
+  bool _internal_has_hyper_params() const;
+  public:
+  void clear_hyper_params();
+  const ::model::Hyperparams& hyper_params() const;
+  PROTOBUF_NODISCARD ::model::Hyperparams* release_hyper_params();
+  ::model::Hyperparams* mutable_hyper_params();
+  void set_allocated_hyper_params(::model::Hyperparams* hyper_params);
+  private:
+  const ::model::Hyperparams& _internal_hyper_params() const;
+  ::model::Hyperparams* _internal_mutable_hyper_params();
+  public:
+  void unsafe_arena_set_allocated_hyper_params(
+      ::model::Hyperparams* hyper_params);
+  ::model::Hyperparams* unsafe_arena_release_hyper_params();
+
+  // optional bool directed = 1 [default = true];
+  bool has_directed() const;
+  private:
+  bool _internal_has_directed() const;
+  public:
+  void clear_directed();
+  bool directed() const;
+  void set_directed(bool value);
+  private:
+  bool _internal_directed() const;
+  void _internal_set_directed(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.EdgeData)
  private:
-  inline void set_has_directed();
-  inline void clear_has_directed();
-  inline void set_has_weight();
-  inline void clear_has_weight();
-  inline void set_has_node1();
-  inline void clear_has_node1();
-  inline void set_has_node2();
-  inline void clear_has_node2();
-  inline void set_has_hyper_params();
-  inline void clear_has_hyper_params();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* weight_;
-  ::std::string* node1_;
-  ::std::string* node2_;
-  ::model::Hyperparams* hyper_params_;
-  bool directed_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static EdgeData* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weight_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node1_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node2_;
+    ::model::Hyperparams* hyper_params_;
+    bool directed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SpnLayerInit : public ::google::protobuf::Message {
+class SpnLayerInit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.SpnLayerInit) */ {
  public:
-  SpnLayerInit();
-  virtual ~SpnLayerInit();
+  inline SpnLayerInit() : SpnLayerInit(nullptr) {}
+  ~SpnLayerInit() override;
+  explicit PROTOBUF_CONSTEXPR SpnLayerInit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SpnLayerInit(const SpnLayerInit& from);
+  SpnLayerInit(SpnLayerInit&& from) noexcept
+    : SpnLayerInit() {
+    *this = ::std::move(from);
+  }
 
   inline SpnLayerInit& operator=(const SpnLayerInit& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SpnLayerInit& operator=(SpnLayerInit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SpnLayerInit& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpnLayerInit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpnLayerInit* internal_default_instance() {
+    return reinterpret_cast<const SpnLayerInit*>(
+               &_SpnLayerInit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(SpnLayerInit* other);
+  friend void swap(SpnLayerInit& a, SpnLayerInit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpnLayerInit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpnLayerInit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SpnLayerInit* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SpnLayerInit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpnLayerInit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SpnLayerInit& from);
-  void MergeFrom(const SpnLayerInit& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpnLayerInit& from) {
+    SpnLayerInit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpnLayerInit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.SpnLayerInit";
+  }
+  protected:
+  explicit SpnLayerInit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kInputIndicesFieldNumber = 5,
+    kNodeListFieldNumber = 6,
+    kTypeFieldNumber = 2,
+    kSizeFieldNumber = 3,
+    kProductCombinationsFieldNumber = 4,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string input_indices = 5;
+  bool has_input_indices() const;
+  private:
+  bool _internal_has_input_indices() const;
+  public:
+  void clear_input_indices();
+  const std::string& input_indices() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_input_indices(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_input_indices();
+  PROTOBUF_NODISCARD std::string* release_input_indices();
+  void set_allocated_input_indices(std::string* input_indices);
+  private:
+  const std::string& _internal_input_indices() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_input_indices(const std::string& value);
+  std::string* _internal_mutable_input_indices();
+  public:
+
+  // optional string node_list = 6;
+  bool has_node_list() const;
+  private:
+  bool _internal_has_node_list() const;
+  public:
+  void clear_node_list();
+  const std::string& node_list() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_list(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_list();
+  PROTOBUF_NODISCARD std::string* release_node_list();
+  void set_allocated_node_list(std::string* node_list);
+  private:
+  const std::string& _internal_node_list() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_list(const std::string& value);
+  std::string* _internal_mutable_node_list();
+  public:
 
   // optional .model.NodeData.NodeType type = 2;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 2;
-  inline ::model::NodeData_NodeType type() const;
-  inline void set_type(::model::NodeData_NodeType value);
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::model::NodeData_NodeType type() const;
+  void set_type(::model::NodeData_NodeType value);
+  private:
+  ::model::NodeData_NodeType _internal_type() const;
+  void _internal_set_type(::model::NodeData_NodeType value);
+  public:
 
   // optional int32 size = 3;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 3;
-  inline ::google::protobuf::int32 size() const;
-  inline void set_size(::google::protobuf::int32 value);
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
 
   // optional int32 product_combinations = 4 [default = 3];
-  inline bool has_product_combinations() const;
-  inline void clear_product_combinations();
-  static const int kProductCombinationsFieldNumber = 4;
-  inline ::google::protobuf::int32 product_combinations() const;
-  inline void set_product_combinations(::google::protobuf::int32 value);
-
-  // optional string input_indices = 5;
-  inline bool has_input_indices() const;
-  inline void clear_input_indices();
-  static const int kInputIndicesFieldNumber = 5;
-  inline const ::std::string& input_indices() const;
-  inline void set_input_indices(const ::std::string& value);
-  inline void set_input_indices(const char* value);
-  inline void set_input_indices(const char* value, size_t size);
-  inline ::std::string* mutable_input_indices();
-  inline ::std::string* release_input_indices();
-  inline void set_allocated_input_indices(::std::string* input_indices);
-
-  // optional string node_list = 6;
-  inline bool has_node_list() const;
-  inline void clear_node_list();
-  static const int kNodeListFieldNumber = 6;
-  inline const ::std::string& node_list() const;
-  inline void set_node_list(const ::std::string& value);
-  inline void set_node_list(const char* value);
-  inline void set_node_list(const char* value, size_t size);
-  inline ::std::string* mutable_node_list();
-  inline ::std::string* release_node_list();
-  inline void set_allocated_node_list(::std::string* node_list);
+  bool has_product_combinations() const;
+  private:
+  bool _internal_has_product_combinations() const;
+  public:
+  void clear_product_combinations();
+  int32_t product_combinations() const;
+  void set_product_combinations(int32_t value);
+  private:
+  int32_t _internal_product_combinations() const;
+  void _internal_set_product_combinations(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.SpnLayerInit)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_size();
-  inline void clear_has_size();
-  inline void set_has_product_combinations();
-  inline void clear_has_product_combinations();
-  inline void set_has_input_indices();
-  inline void clear_has_input_indices();
-  inline void set_has_node_list();
-  inline void clear_has_node_list();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  int type_;
-  ::google::protobuf::int32 size_;
-  ::std::string* input_indices_;
-  ::std::string* node_list_;
-  ::google::protobuf::int32 product_combinations_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static SpnLayerInit* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr input_indices_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_list_;
+    int type_;
+    int32_t size_;
+    int32_t product_combinations_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SpnData : public ::google::protobuf::Message {
+class SpnData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.SpnData) */ {
  public:
-  SpnData();
-  virtual ~SpnData();
+  inline SpnData() : SpnData(nullptr) {}
+  ~SpnData() override;
+  explicit PROTOBUF_CONSTEXPR SpnData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SpnData(const SpnData& from);
+  SpnData(SpnData&& from) noexcept
+    : SpnData() {
+    *this = ::std::move(from);
+  }
 
   inline SpnData& operator=(const SpnData& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SpnData& operator=(SpnData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SpnData& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpnData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpnData* internal_default_instance() {
+    return reinterpret_cast<const SpnData*>(
+               &_SpnData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(SpnData* other);
+  friend void swap(SpnData& a, SpnData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpnData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpnData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SpnData* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SpnData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpnData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SpnData& from);
-  void MergeFrom(const SpnData& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpnData& from) {
+    SpnData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpnData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.SpnData";
+  }
+  protected:
+  explicit SpnData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLayersFieldNumber = 4,
+    kNodeTypesFieldNumber = 6,
+    kNodeInputsFieldNumber = 7,
+    kEdgeChildrenFieldNumber = 8,
+    kEdgeParentsFieldNumber = 9,
+    kEdgeWeightsFieldNumber = 10,
+    kNodeListFieldNumber = 1,
+    kAdjacencyMatrixFieldNumber = 2,
+    kInputIndicesFieldNumber = 3,
+    kLogSpaceFieldNumber = 5,
+  };
+  // repeated .model.SpnLayerInit layers = 4;
+  int layers_size() const;
+  private:
+  int _internal_layers_size() const;
+  public:
+  void clear_layers();
+  ::model::SpnLayerInit* mutable_layers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::SpnLayerInit >*
+      mutable_layers();
+  private:
+  const ::model::SpnLayerInit& _internal_layers(int index) const;
+  ::model::SpnLayerInit* _internal_add_layers();
+  public:
+  const ::model::SpnLayerInit& layers(int index) const;
+  ::model::SpnLayerInit* add_layers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::SpnLayerInit >&
+      layers() const;
+
+  // repeated int32 node_types = 6 [packed = true];
+  int node_types_size() const;
+  private:
+  int _internal_node_types_size() const;
+  public:
+  void clear_node_types();
+  private:
+  int32_t _internal_node_types(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_node_types() const;
+  void _internal_add_node_types(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_node_types();
+  public:
+  int32_t node_types(int index) const;
+  void set_node_types(int index, int32_t value);
+  void add_node_types(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      node_types() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_node_types();
+
+  // repeated int32 node_inputs = 7 [packed = true];
+  int node_inputs_size() const;
+  private:
+  int _internal_node_inputs_size() const;
+  public:
+  void clear_node_inputs();
+  private:
+  int32_t _internal_node_inputs(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_node_inputs() const;
+  void _internal_add_node_inputs(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_node_inputs();
+  public:
+  int32_t node_inputs(int index) const;
+  void set_node_inputs(int index, int32_t value);
+  void add_node_inputs(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      node_inputs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_node_inputs();
+
+  // repeated int32 edge_children = 8 [packed = true];
+  int edge_children_size() const;
+  private:
+  int _internal_edge_children_size() const;
+  public:
+  void clear_edge_children();
+  private:
+  int32_t _internal_edge_children(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_edge_children() const;
+  void _internal_add_edge_children(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_edge_children();
+  public:
+  int32_t edge_children(int index) const;
+  void set_edge_children(int index, int32_t value);
+  void add_edge_children(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      edge_children() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_edge_children();
+
+  // repeated int32 edge_parents = 9 [packed = true];
+  int edge_parents_size() const;
+  private:
+  int _internal_edge_parents_size() const;
+  public:
+  void clear_edge_parents();
+  private:
+  int32_t _internal_edge_parents(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_edge_parents() const;
+  void _internal_add_edge_parents(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_edge_parents();
+  public:
+  int32_t edge_parents(int index) const;
+  void set_edge_parents(int index, int32_t value);
+  void add_edge_parents(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      edge_parents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_edge_parents();
+
+  // repeated float edge_weights = 10 [packed = true];
+  int edge_weights_size() const;
+  private:
+  int _internal_edge_weights_size() const;
+  public:
+  void clear_edge_weights();
+  private:
+  float _internal_edge_weights(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_edge_weights() const;
+  void _internal_add_edge_weights(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_edge_weights();
+  public:
+  float edge_weights(int index) const;
+  void set_edge_weights(int index, float value);
+  void add_edge_weights(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      edge_weights() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_edge_weights();
+
   // optional string node_list = 1;
-  inline bool has_node_list() const;
-  inline void clear_node_list();
-  static const int kNodeListFieldNumber = 1;
-  inline const ::std::string& node_list() const;
-  inline void set_node_list(const ::std::string& value);
-  inline void set_node_list(const char* value);
-  inline void set_node_list(const char* value, size_t size);
-  inline ::std::string* mutable_node_list();
-  inline ::std::string* release_node_list();
-  inline void set_allocated_node_list(::std::string* node_list);
+  bool has_node_list() const;
+  private:
+  bool _internal_has_node_list() const;
+  public:
+  void clear_node_list();
+  const std::string& node_list() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_list(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_list();
+  PROTOBUF_NODISCARD std::string* release_node_list();
+  void set_allocated_node_list(std::string* node_list);
+  private:
+  const std::string& _internal_node_list() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_list(const std::string& value);
+  std::string* _internal_mutable_node_list();
+  public:
 
   // optional string adjacency_matrix = 2;
-  inline bool has_adjacency_matrix() const;
-  inline void clear_adjacency_matrix();
-  static const int kAdjacencyMatrixFieldNumber = 2;
-  inline const ::std::string& adjacency_matrix() const;
-  inline void set_adjacency_matrix(const ::std::string& value);
-  inline void set_adjacency_matrix(const char* value);
-  inline void set_adjacency_matrix(const char* value, size_t size);
-  inline ::std::string* mutable_adjacency_matrix();
-  inline ::std::string* release_adjacency_matrix();
-  inline void set_allocated_adjacency_matrix(::std::string* adjacency_matrix);
+  bool has_adjacency_matrix() const;
+  private:
+  bool _internal_has_adjacency_matrix() const;
+  public:
+  void clear_adjacency_matrix();
+  const std::string& adjacency_matrix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_adjacency_matrix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_adjacency_matrix();
+  PROTOBUF_NODISCARD std::string* release_adjacency_matrix();
+  void set_allocated_adjacency_matrix(std::string* adjacency_matrix);
+  private:
+  const std::string& _internal_adjacency_matrix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_adjacency_matrix(const std::string& value);
+  std::string* _internal_mutable_adjacency_matrix();
+  public:
 
   // optional string input_indices = 3;
-  inline bool has_input_indices() const;
-  inline void clear_input_indices();
-  static const int kInputIndicesFieldNumber = 3;
-  inline const ::std::string& input_indices() const;
-  inline void set_input_indices(const ::std::string& value);
-  inline void set_input_indices(const char* value);
-  inline void set_input_indices(const char* value, size_t size);
-  inline ::std::string* mutable_input_indices();
-  inline ::std::string* release_input_indices();
-  inline void set_allocated_input_indices(::std::string* input_indices);
+  bool has_input_indices() const;
+  private:
+  bool _internal_has_input_indices() const;
+  public:
+  void clear_input_indices();
+  const std::string& input_indices() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_input_indices(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_input_indices();
+  PROTOBUF_NODISCARD std::string* release_input_indices();
+  void set_allocated_input_indices(std::string* input_indices);
+  private:
+  const std::string& _internal_input_indices() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_input_indices(const std::string& value);
+  std::string* _internal_mutable_input_indices();
+  public:
 
-  // repeated .model.SpnLayerInit layers = 4;
-  inline int layers_size() const;
-  inline void clear_layers();
-  static const int kLayersFieldNumber = 4;
-  inline const ::model::SpnLayerInit& layers(int index) const;
-  inline ::model::SpnLayerInit* mutable_layers(int index);
-  inline ::model::SpnLayerInit* add_layers();
-  inline const ::google::protobuf::RepeatedPtrField< ::model::SpnLayerInit >&
-      layers() const;
-  inline ::google::protobuf::RepeatedPtrField< ::model::SpnLayerInit >*
-      mutable_layers();
+  // optional bool log_space = 5 [default = false];
+  bool has_log_space() const;
+  private:
+  bool _internal_has_log_space() const;
+  public:
+  void clear_log_space();
+  bool log_space() const;
+  void set_log_space(bool value);
+  private:
+  bool _internal_log_space() const;
+  void _internal_set_log_space(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.SpnData)
  private:
-  inline void set_has_node_list();
-  inline void clear_has_node_list();
-  inline void set_has_adjacency_matrix();
-  inline void clear_has_adjacency_matrix();
-  inline void set_has_input_indices();
-  inline void clear_has_input_indices();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* node_list_;
-  ::std::string* adjacency_matrix_;
-  ::std::string* input_indices_;
-  ::google::protobuf::RepeatedPtrField< ::model::SpnLayerInit > layers_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static SpnData* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::SpnLayerInit > layers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > node_types_;
+    mutable std::atomic<int> _node_types_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > node_inputs_;
+    mutable std::atomic<int> _node_inputs_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > edge_children_;
+    mutable std::atomic<int> _edge_children_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > edge_parents_;
+    mutable std::atomic<int> _edge_parents_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > edge_weights_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_list_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr adjacency_matrix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr input_indices_;
+    bool log_space_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ModelData : public ::google::protobuf::Message {
+class ModelData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.ModelData) */ {
  public:
-  ModelData();
-  virtual ~ModelData();
+  inline ModelData() : ModelData(nullptr) {}
+  ~ModelData() override;
+  explicit PROTOBUF_CONSTEXPR ModelData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ModelData(const ModelData& from);
+  ModelData(ModelData&& from) noexcept
+    : ModelData() {
+    *this = ::std::move(from);
+  }
 
   inline ModelData& operator=(const ModelData& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ModelData& operator=(ModelData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ModelData& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ModelData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ModelData* internal_default_instance() {
+    return reinterpret_cast<const ModelData*>(
+               &_ModelData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(ModelData* other);
+  friend void swap(ModelData& a, ModelData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ModelData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ModelData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ModelData* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ModelData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModelData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ModelData& from);
-  void MergeFrom(const ModelData& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ModelData& from) {
+    ModelData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ModelData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.ModelData";
+  }
+  protected:
+  explicit ModelData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef ModelData_ModelType ModelType;
-  static const ModelType SPN = ModelData_ModelType_SPN;
+  static constexpr ModelType SPN =
+    ModelData_ModelType_SPN;
   static inline bool ModelType_IsValid(int value) {
     return ModelData_ModelType_IsValid(value);
   }
-  static const ModelType ModelType_MIN =
+  static constexpr ModelType ModelType_MIN =
     ModelData_ModelType_ModelType_MIN;
-  static const ModelType ModelType_MAX =
+  static constexpr ModelType ModelType_MAX =
     ModelData_ModelType_ModelType_MAX;
-  static const int ModelType_ARRAYSIZE =
+  static constexpr int ModelType_ARRAYSIZE =
     ModelData_ModelType_ModelType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   ModelType_descriptor() {
     return ModelData_ModelType_descriptor();
   }
-  static inline const ::std::string& ModelType_Name(ModelType value) {
-    return ModelData_ModelType_Name(value);
+  template<typename T>
+  static inline const std::string& ModelType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ModelType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ModelType_Name.");
+    return ModelData_ModelType_Name(enum_t_value);
   }
-  static inline bool ModelType_Parse(const ::std::string& name,
+  static inline bool ModelType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ModelType* value) {
     return ModelData_ModelType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // required .model.ModelData.ModelType model_type = 2;
-  inline bool has_model_type() const;
-  inline void clear_model_type();
-  static const int kModelTypeFieldNumber = 2;
-  inline ::model::ModelData_ModelType model_type() const;
-  inline void set_model_type(::model::ModelData_ModelType value);
-
-  // optional .model.SpnData spn_data = 3;
-  inline bool has_spn_data() const;
-  inline void clear_spn_data();
-  static const int kSpnDataFieldNumber = 3;
-  inline const ::model::SpnData& spn_data() const;
-  inline ::model::SpnData* mutable_spn_data();
-  inline ::model::SpnData* release_spn_data();
-  inline void set_allocated_spn_data(::model::SpnData* spn_data);
-
-  // optional .model.Hyperparams hyper_params = 4;
-  inline bool has_hyper_params() const;
-  inline void clear_hyper_params();
-  static const int kHyperParamsFieldNumber = 4;
-  inline const ::model::Hyperparams& hyper_params() const;
-  inline ::model::Hyperparams* mutable_hyper_params();
-  inline ::model::Hyperparams* release_hyper_params();
-  inline void set_allocated_hyper_params(::model::Hyperparams* hyper_params);
-
+  enum : int {
+    kNodesFieldNumber = 5,
+    kEdgesFieldNumber = 6,
+    kNameFieldNumber = 1,
+    kSpnDataFieldNumber = 3,
+    kHyperParamsFieldNumber = 4,
+    kTrainMetricsFieldNumber = 7,
+    kValidMetricsFieldNumber = 8,
+    kTestMetricsFieldNumber = 9,
+    kValidMetricBestFieldNumber = 10,
+    kTrainMetricEsFieldNumber = 11,
+    kTestMetricEsFieldNumber = 12,
+    kModelTypeFieldNumber = 2,
+  };
   // repeated .model.NodeData nodes = 5;
-  inline int nodes_size() const;
-  inline void clear_nodes();
-  static const int kNodesFieldNumber = 5;
-  inline const ::model::NodeData& nodes(int index) const;
-  inline ::model::NodeData* mutable_nodes(int index);
-  inline ::model::NodeData* add_nodes();
-  inline const ::google::protobuf::RepeatedPtrField< ::model::NodeData >&
-      nodes() const;
-  inline ::google::protobuf::RepeatedPtrField< ::model::NodeData >*
+  int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
+  void clear_nodes();
+  ::model::NodeData* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::NodeData >*
       mutable_nodes();
+  private:
+  const ::model::NodeData& _internal_nodes(int index) const;
+  ::model::NodeData* _internal_add_nodes();
+  public:
+  const ::model::NodeData& nodes(int index) const;
+  ::model::NodeData* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::NodeData >&
+      nodes() const;
 
   // repeated .model.EdgeData edges = 6;
-  inline int edges_size() const;
-  inline void clear_edges();
-  static const int kEdgesFieldNumber = 6;
-  inline const ::model::EdgeData& edges(int index) const;
-  inline ::model::EdgeData* mutable_edges(int index);
-  inline ::model::EdgeData* add_edges();
-  inline const ::google::protobuf::RepeatedPtrField< ::model::EdgeData >&
-      edges() const;
-  inline ::google::protobuf::RepeatedPtrField< ::model::EdgeData >*
+  int edges_size() const;
+  private:
+  int _internal_edges_size() const;
+  public:
+  void clear_edges();
+  ::model::EdgeData* mutable_edges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::EdgeData >*
       mutable_edges();
+  private:
+  const ::model::EdgeData& _internal_edges(int index) const;
+  ::model::EdgeData* _internal_add_edges();
+  public:
+  const ::model::EdgeData& edges(int index) const;
+  ::model::EdgeData* add_edges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::EdgeData >&
+      edges() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional .model.SpnData spn_data = 3;
+  bool has_spn_data() const;
+  private:
+  bool _internal_has_spn_data() const;
+  public:
+  void clear_spn_data();
+  const ::model::SpnData& spn_data() const;
+  PROTOBUF_NODISCARD ::model::SpnData* release_spn_data();
+  ::model::SpnData* mutable_spn_data();
+  void set_allocated_spn_data(::model::SpnData* spn_data);
+  private:
+  const ::model::SpnData& _internal_spn_data() const;
+  ::model::SpnData* _internal_mutable_spn_data();
+  public:
+  void unsafe_arena_set_allocated_spn_data(
+      ::model::SpnData* spn_data);
+  ::model::SpnData* unsafe_arena_release_spn_data();
+
+  // optional .model.Hyperparams hyper_params = 4;
+  bool has_hyper_params() const;
+  private:
+  bool _internal_has_hyper_params() const;
+  public:
+  void clear_hyper_params();
+  const ::model::Hyperparams& hyper_params() const;
+  PROTOBUF_NODISCARD ::model::Hyperparams* release_hyper_params();
+  ::model::Hyperparams* mutable_hyper_params();
+  void set_allocated_hyper_params(::model::Hyperparams* hyper_params);
+  private:
+  const ::model::Hyperparams& _internal_hyper_params() const;
+  ::model::Hyperparams* _internal_mutable_hyper_params();
+  public:
+  void unsafe_arena_set_allocated_hyper_params(
+      ::model::Hyperparams* hyper_params);
+  ::model::Hyperparams* unsafe_arena_release_hyper_params();
 
   // optional .model.Metrics train_metrics = 7;
-  inline bool has_train_metrics() const;
-  inline void clear_train_metrics();
-  static const int kTrainMetricsFieldNumber = 7;
-  inline const ::model::Metrics& train_metrics() const;
-  inline ::model::Metrics* mutable_train_metrics();
-  inline ::model::Metrics* release_train_metrics();
-  inline void set_allocated_train_metrics(::model::Metrics* train_metrics);
+  bool has_train_metrics() const;
+  private:
+  bool _internal_has_train_metrics() const;
+  public:
+  void clear_train_metrics();
+  const ::model::Metrics& train_metrics() const;
+  PROTOBUF_NODISCARD ::model::Metrics* release_train_metrics();
+  ::model::Metrics* mutable_train_metrics();
+  void set_allocated_train_metrics(::model::Metrics* train_metrics);
+  private:
+  const ::model::Metrics& _internal_train_metrics() const;
+  ::model::Metrics* _internal_mutable_train_metrics();
+  public:
+  void unsafe_arena_set_allocated_train_metrics(
+      ::model::Metrics* train_metrics);
+  ::model::Metrics* unsafe_arena_release_train_metrics();
 
   // optional .model.Metrics valid_metrics = 8;
-  inline bool has_valid_metrics() const;
-  inline void clear_valid_metrics();
-  static const int kValidMetricsFieldNumber = 8;
-  inline const ::model::Metrics& valid_metrics() const;
-  inline ::model::Metrics* mutable_valid_metrics();
-  inline ::model::Metrics* release_valid_metrics();
-  inline void set_allocated_valid_metrics(::model::Metrics* valid_metrics);
+  bool has_valid_metrics() const;
+  private:
+  bool _internal_has_valid_metrics() const;
+  public:
+  void clear_valid_metrics();
+  const ::model::Metrics& valid_metrics() const;
+  PROTOBUF_NODISCARD ::model::Metrics* release_valid_metrics();
+  ::model::Metrics* mutable_valid_metrics();
+  void set_allocated_valid_metrics(::model::Metrics* valid_metrics);
+  private:
+  const ::model::Metrics& _internal_valid_metrics() const;
+  ::model::Metrics* _internal_mutable_valid_metrics();
+  public:
+  void unsafe_arena_set_allocated_valid_metrics(
+      ::model::Metrics* valid_metrics);
+  ::model::Metrics* unsafe_arena_release_valid_metrics();
 
   // optional .model.Metrics test_metrics = 9;
-  inline bool has_test_metrics() const;
-  inline void clear_test_metrics();
-  static const int kTestMetricsFieldNumber = 9;
-  inline const ::model::Metrics& test_metrics() const;
-  inline ::model::Metrics* mutable_test_metrics();
-  inline ::model::Metrics* release_test_metrics();
-  inline void set_allocated_test_metrics(::model::Metrics* test_metrics);
+  bool has_test_metrics() const;
+  private:
+  bool _internal_has_test_metrics() const;
+  public:
+  void clear_test_metrics();
+  const ::model::Metrics& test_metrics() const;
+  PROTOBUF_NODISCARD ::model::Metrics* release_test_metrics();
+  ::model::Metrics* mutable_test_metrics();
+  void set_allocated_test_metrics(::model::Metrics* test_metrics);
+  private:
+  const ::model::Metrics& _internal_test_metrics() const;
+  ::model::Metrics* _internal_mutable_test_metrics();
+  public:
+  void unsafe_arena_set_allocated_test_metrics(
+      ::model::Metrics* test_metrics);
+  ::model::Metrics* unsafe_arena_release_test_metrics();
 
   // optional .model.Metrics valid_metric_best = 10;
-  inline bool has_valid_metric_best() const;
-  inline void clear_valid_metric_best();
-  static const int kValidMetricBestFieldNumber = 10;
-  inline const ::model::Metrics& valid_metric_best() const;
-  inline ::model::Metrics* mutable_valid_metric_best();
-  inline ::model::Metrics* release_valid_metric_best();
-  inline void set_allocated_valid_metric_best(::model::Metrics* valid_metric_best);
+  bool has_valid_metric_best() const;
+  private:
+  bool _internal_has_valid_metric_best() const;
+  public:
+  void clear_valid_metric_best();
+  const ::model::Metrics& valid_metric_best() const;
+  PROTOBUF_NODISCARD ::model::Metrics* release_valid_metric_best();
+  ::model::Metrics* mutable_valid_metric_best();
+  void set_allocated_valid_metric_best(::model::Metrics* valid_metric_best);
+  private:
+  const ::model::Metrics& _internal_valid_metric_best() const;
+  ::model::Metrics* _internal_mutable_valid_metric_best();
+  public:
+  void unsafe_arena_set_allocated_valid_metric_best(
+      ::model::Metrics* valid_metric_best);
+  ::model::Metrics* unsafe_arena_release_valid_metric_best();
 
   // optional .model.Metrics train_metric_es = 11;
-  inline bool has_train_metric_es() const;
-  inline void clear_train_metric_es();
-  static const int kTrainMetricEsFieldNumber = 11;
-  inline const ::model::Metrics& train_metric_es() const;
-  inline ::model::Metrics* mutable_train_metric_es();
-  inline ::model::Metrics* release_train_metric_es();
-  inline void set_allocated_train_metric_es(::model::Metrics* train_metric_es);
+  bool has_train_metric_es() const;
+  private:
+  bool _internal_has_train_metric_es() const;
+  public:
+  void clear_train_metric_es();
+  const ::model::Metrics& train_metric_es() const;
+  PROTOBUF_NODISCARD ::model::Metrics* release_train_metric_es();
+  ::model::Metrics* mutable_train_metric_es();
+  void set_allocated_train_metric_es(::model::Metrics* train_metric_es);
+  private:
+  const ::model::Metrics& _internal_train_metric_es() const;
+  ::model::Metrics* _internal_mutable_train_metric_es();
+  public:
+  void unsafe_arena_set_allocated_train_metric_es(
+      ::model::Metrics* train_metric_es);
+  ::model::Metrics* unsafe_arena_release_train_metric_es();
 
   // optional .model.Metrics test_metric_es = 12;
-  inline bool has_test_metric_es() const;
-  inline void clear_test_metric_es();
-  static const int kTestMetricEsFieldNumber = 12;
-  inline const ::model::Metrics& test_metric_es() const;
-  inline ::model::Metrics* mutable_test_metric_es();
-  inline ::model::Metrics* release_test_metric_es();
-  inline void set_allocated_test_metric_es(::model::Metrics* test_metric_es);
+  bool has_test_metric_es() const;
+  private:
+  bool _internal_has_test_metric_es() const;
+  public:
+  void clear_test_metric_es();
+  const ::model::Metrics& test_metric_es() const;
+  PROTOBUF_NODISCARD ::model::Metrics* release_test_metric_es();
+  ::model::Metrics* mutable_test_metric_es();
+  void set_allocated_test_metric_es(::model::Metrics* test_metric_es);
+  private:
+  const ::model::Metrics& _internal_test_metric_es() const;
+  ::model::Metrics* _internal_mutable_test_metric_es();
+  public:
+  void unsafe_arena_set_allocated_test_metric_es(
+      ::model::Metrics* test_metric_es);
+  ::model::Metrics* unsafe_arena_release_test_metric_es();
+
+  // required .model.ModelData.ModelType model_type = 2;
+  bool has_model_type() const;
+  private:
+  bool _internal_has_model_type() const;
+  public:
+  void clear_model_type();
+  ::model::ModelData_ModelType model_type() const;
+  void set_model_type(::model::ModelData_ModelType value);
+  private:
+  ::model::ModelData_ModelType _internal_model_type() const;
+  void _internal_set_model_type(::model::ModelData_ModelType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.ModelData)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_model_type();
-  inline void clear_has_model_type();
-  inline void set_has_spn_data();
-  inline void clear_has_spn_data();
-  inline void set_has_hyper_params();
-  inline void clear_has_hyper_params();
-  inline void set_has_train_metrics();
-  inline void clear_has_train_metrics();
-  inline void set_has_valid_metrics();
-  inline void clear_has_valid_metrics();
-  inline void set_has_test_metrics();
-  inline void clear_has_test_metrics();
-  inline void set_has_valid_metric_best();
-  inline void clear_has_valid_metric_best();
-  inline void set_has_train_metric_es();
-  inline void clear_has_train_metric_es();
-  inline void set_has_test_metric_es();
-  inline void clear_has_test_metric_es();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::model::SpnData* spn_data_;
-  ::model::Hyperparams* hyper_params_;
-  ::google::protobuf::RepeatedPtrField< ::model::NodeData > nodes_;
-  ::google::protobuf::RepeatedPtrField< ::model::EdgeData > edges_;
-  ::model::Metrics* train_metrics_;
-  ::model::Metrics* valid_metrics_;
-  ::model::Metrics* test_metrics_;
-  ::model::Metrics* valid_metric_best_;
-  ::model::Metrics* train_metric_es_;
-  ::model::Metrics* test_metric_es_;
-  int model_type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(12 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static ModelData* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::NodeData > nodes_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::EdgeData > edges_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::model::SpnData* spn_data_;
+    ::model::Hyperparams* hyper_params_;
+    ::model::Metrics* train_metrics_;
+    ::model::Metrics* valid_metrics_;
+    ::model::Metrics* test_metrics_;
+    ::model::Metrics* valid_metric_best_;
+    ::model::Metrics* train_metric_es_;
+    ::model::Metrics* test_metric_es_;
+    int model_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Operation_StopCondition : public ::google::protobuf::Message {
+class Operation_StopCondition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.Operation.StopCondition) */ {
  public:
-  Operation_StopCondition();
-  virtual ~Operation_StopCondition();
+  inline Operation_StopCondition() : Operation_StopCondition(nullptr) {}
+  ~Operation_StopCondition() override;
+  explicit PROTOBUF_CONSTEXPR Operation_StopCondition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Operation_StopCondition(const Operation_StopCondition& from);
+  Operation_StopCondition(Operation_StopCondition&& from) noexcept
+    : Operation_StopCondition() {
+    *this = ::std::move(from);
+  }
 
   inline Operation_StopCondition& operator=(const Operation_StopCondition& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Operation_StopCondition& operator=(Operation_StopCondition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Operation_StopCondition& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Operation_StopCondition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Operation_StopCondition* internal_default_instance() {
+    return reinterpret_cast<const Operation_StopCondition*>(
+               &_Operation_StopCondition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(Operation_StopCondition* other);
+  friend void swap(Operation_StopCondition& a, Operation_StopCondition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Operation_StopCondition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Operation_StopCondition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Operation_StopCondition* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Operation_StopCondition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Operation_StopCondition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Operation_StopCondition& from);
-  void MergeFrom(const Operation_StopCondition& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Operation_StopCondition& from) {
+    Operation_StopCondition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Operation_StopCondition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.Operation.StopCondition";
+  }
+  protected:
+  explicit Operation_StopCondition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAllProcessedFieldNumber = 1,
+    kStepsFieldNumber = 2,
+  };
   // optional bool all_processed = 1 [default = true];
-  inline bool has_all_processed() const;
-  inline void clear_all_processed();
-  static const int kAllProcessedFieldNumber = 1;
-  inline bool all_processed() const;
-  inline void set_all_processed(bool value);
+  bool has_all_processed() const;
+  private:
+  bool _internal_has_all_processed() const;
+  public:
+  void clear_all_processed();
+  bool all_processed() const;
+  void set_all_processed(bool value);
+  private:
+  bool _internal_all_processed() const;
+  void _internal_set_all_processed(bool value);
+  public:
 
   // optional int32 steps = 2 [default = 10000];
-  inline bool has_steps() const;
-  inline void clear_steps();
-  static const int kStepsFieldNumber = 2;
-  inline ::google::protobuf::int32 steps() const;
-  inline void set_steps(::google::protobuf::int32 value);
+  bool has_steps() const;
+  private:
+  bool _internal_has_steps() const;
+  public:
+  void clear_steps();
+  int32_t steps() const;
+  void set_steps(int32_t value);
+  private:
+  int32_t _internal_steps() const;
+  void _internal_set_steps(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.Operation.StopCondition)
  private:
-  inline void set_has_all_processed();
-  inline void clear_has_all_processed();
-  inline void set_has_steps();
-  inline void clear_has_steps();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  bool all_processed_;
-  ::google::protobuf::int32 steps_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static Operation_StopCondition* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool all_processed_;
+    int32_t steps_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Operation : public ::google::protobuf::Message {
+class Operation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.Operation) */ {
  public:
-  Operation();
-  virtual ~Operation();
+  inline Operation() : Operation(nullptr) {}
+  ~Operation() override;
+  explicit PROTOBUF_CONSTEXPR Operation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Operation(const Operation& from);
+  Operation(Operation&& from) noexcept
+    : Operation() {
+    *this = ::std::move(from);
+  }
 
   inline Operation& operator=(const Operation& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Operation& operator=(Operation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Operation& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Operation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Operation* internal_default_instance() {
+    return reinterpret_cast<const Operation*>(
+               &_Operation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(Operation* other);
+  friend void swap(Operation& a, Operation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Operation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Operation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Operation* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Operation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Operation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Operation& from);
-  void MergeFrom(const Operation& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Operation& from) {
+    Operation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Operation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.Operation";
+  }
+  protected:
+  explicit Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef Operation_StopCondition StopCondition;
 
   typedef Operation_Optimizer Optimizer;
-  static const Optimizer GRADIENT_DESCENT = Operation_Optimizer_GRADIENT_DESCENT;
-  static const Optimizer HARD_GRADIENT_DESCENT = Operation_Optimizer_HARD_GRADIENT_DESCENT;
-  static const Optimizer EM = Operation_Optimizer_EM;
-  static const Optimizer HARD_EM = Operation_Optimizer_HARD_EM;
-  static const Optimizer CD = Operation_Optimizer_CD;
-  static const Optimizer PCD = Operation_Optimizer_PCD;
+  static constexpr Optimizer GRADIENT_DESCENT =
+    Operation_Optimizer_GRADIENT_DESCENT;
+  static constexpr Optimizer HARD_GRADIENT_DESCENT =
+    Operation_Optimizer_HARD_GRADIENT_DESCENT;
+  static constexpr Optimizer EM =
+    Operation_Optimizer_EM;
+  static constexpr Optimizer HARD_EM =
+    Operation_Optimizer_HARD_EM;
+  static constexpr Optimizer CD =
+    Operation_Optimizer_CD;
+  static constexpr Optimizer PCD =
+    Operation_Optimizer_PCD;
+  static constexpr Optimizer ADAM =
+    Operation_Optimizer_ADAM;
+  static constexpr Optimizer ADAGRAD =
+    Operation_Optimizer_ADAGRAD;
+  static constexpr Optimizer RMSPROP =
+    Operation_Optimizer_RMSPROP;
   static inline bool Optimizer_IsValid(int value) {
     return Operation_Optimizer_IsValid(value);
   }
-  static const Optimizer Optimizer_MIN =
+  static constexpr Optimizer Optimizer_MIN =
     Operation_Optimizer_Optimizer_MIN;
-  static const Optimizer Optimizer_MAX =
+  static constexpr Optimizer Optimizer_MAX =
     Operation_Optimizer_Optimizer_MAX;
-  static const int Optimizer_ARRAYSIZE =
+  static constexpr int Optimizer_ARRAYSIZE =
     Operation_Optimizer_Optimizer_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Optimizer_descriptor() {
     return Operation_Optimizer_descriptor();
   }
-  static inline const ::std::string& Optimizer_Name(Optimizer value) {
-    return Operation_Optimizer_Name(value);
+  template<typename T>
+  static inline const std::string& Optimizer_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Optimizer>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Optimizer_Name.");
+    return Operation_Optimizer_Name(enum_t_value);
   }
-  static inline bool Optimizer_Parse(const ::std::string& name,
+  static inline bool Optimizer_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Optimizer* value) {
     return Operation_Optimizer_Parse(name, value);
   }
 
   typedef Operation_OperationType OperationType;
-  static const OperationType TRAIN = Operation_OperationType_TRAIN;
-  static const OperationType TEST = Operation_OperationType_TEST;
+  static constexpr OperationType TRAIN =
+    Operation_OperationType_TRAIN;
+  static constexpr OperationType TEST =
+    Operation_OperationType_TEST;
   static inline bool OperationType_IsValid(int value) {
     return Operation_OperationType_IsValid(value);
   }
-  static const OperationType OperationType_MIN =
+  static constexpr OperationType OperationType_MIN =
     Operation_OperationType_OperationType_MIN;
-  static const OperationType OperationType_MAX =
+  static constexpr OperationType OperationType_MAX =
     Operation_OperationType_OperationType_MAX;
-  static const int OperationType_ARRAYSIZE =
+  static constexpr int OperationType_ARRAYSIZE =
     Operation_OperationType_OperationType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   OperationType_descriptor() {
     return Operation_OperationType_descriptor();
   }
-  static inline const ::std::string& OperationType_Name(OperationType value) {
-    return Operation_OperationType_Name(value);
+  template<typename T>
+  static inline const std::string& OperationType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OperationType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OperationType_Name.");
+    return Operation_OperationType_Name(enum_t_value);
   }
-  static inline bool OperationType_Parse(const ::std::string& name,
+  static inline bool OperationType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       OperationType* value) {
     return Operation_OperationType_Parse(name, value);
   }
 
+  typedef Operation_ParallelMode ParallelMode;
+  static constexpr ParallelMode NODE_LEVELS =
+    Operation_ParallelMode_NODE_LEVELS;
+  static constexpr ParallelMode BATCH_ROWS =
+    Operation_ParallelMode_BATCH_ROWS;
+  static inline bool ParallelMode_IsValid(int value) {
+    return Operation_ParallelMode_IsValid(value);
+  }
+  static constexpr ParallelMode ParallelMode_MIN =
+    Operation_ParallelMode_ParallelMode_MIN;
+  static constexpr ParallelMode ParallelMode_MAX =
+    Operation_ParallelMode_ParallelMode_MAX;
+  static constexpr int ParallelMode_ARRAYSIZE =
+    Operation_ParallelMode_ParallelMode_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ParallelMode_descriptor() {
+    return Operation_ParallelMode_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ParallelMode_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ParallelMode>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ParallelMode_Name.");
+    return Operation_ParallelMode_Name(enum_t_value);
+  }
+  static inline bool ParallelMode_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ParallelMode* value) {
+    return Operation_ParallelMode_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kDataProtoFieldNumber = 6,
+    kCheckpointDirectoryFieldNumber = 9,
+    kStopConditionFieldNumber = 3,
+    kOptimizerFieldNumber = 2,
+    kOperationTypeFieldNumber = 4,
+    kShardRankFieldNumber = 14,
+    kRandomizeFieldNumber = 10,
+    kSimplifyFieldNumber = 19,
+    kParallelModeFieldNumber = 17,
+    kPruneThresholdFieldNumber = 18,
+    kThreadCountFieldNumber = 16,
+    kBatchSizeFieldNumber = 5,
+    kEvalAfterFieldNumber = 7,
+    kCheckpointAfterFieldNumber = 8,
+    kRandomSeedFieldNumber = 11,
+    kVerboseFieldNumber = 12,
+    kNormalizeEachTrainStepFieldNumber = 13,
+    kShardCountFieldNumber = 15,
+  };
   // required string name = 1 [default = "operation"];
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
-  // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
-  inline bool has_optimizer() const;
-  inline void clear_optimizer();
-  static const int kOptimizerFieldNumber = 2;
-  inline ::model::Operation_Optimizer optimizer() const;
-  inline void set_optimizer(::model::Operation_Optimizer value);
+  // optional string data_proto = 6;
+  bool has_data_proto() const;
+  private:
+  bool _internal_has_data_proto() const;
+  public:
+  void clear_data_proto();
+  const std::string& data_proto() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data_proto(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data_proto();
+  PROTOBUF_NODISCARD std::string* release_data_proto();
+  void set_allocated_data_proto(std::string* data_proto);
+  private:
+  const std::string& _internal_data_proto() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data_proto(const std::string& value);
+  std::string* _internal_mutable_data_proto();
+  public:
+
+  // optional string checkpoint_directory = 9;
+  bool has_checkpoint_directory() const;
+  private:
+  bool _internal_has_checkpoint_directory() const;
+  public:
+  void clear_checkpoint_directory();
+  const std::string& checkpoint_directory() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_checkpoint_directory(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_checkpoint_directory();
+  PROTOBUF_NODISCARD std::string* release_checkpoint_directory();
+  void set_allocated_checkpoint_directory(std::string* checkpoint_directory);
+  private:
+  const std::string& _internal_checkpoint_directory() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_checkpoint_directory(const std::string& value);
+  std::string* _internal_mutable_checkpoint_directory();
+  public:
 
   // optional .model.Operation.StopCondition stop_condition = 3;
-  inline bool has_stop_condition() const;
-  inline void clear_stop_condition();
-  static const int kStopConditionFieldNumber = 3;
-  inline const ::model::Operation_StopCondition& stop_condition() const;
-  inline ::model::Operation_StopCondition* mutable_stop_condition();
-  inline ::model::Operation_StopCondition* release_stop_condition();
-  inline void set_allocated_stop_condition(::model::Operation_StopCondition* stop_condition);
+  bool has_stop_condition() const;
+  private:
+  bool _internal_has_stop_condition() const;
+  public:
+  void clear_stop_condition();
+  const ::model::Operation_StopCondition& stop_condition() const;
+  PROTOBUF_NODISCARD ::model::Operation_StopCondition* release_stop_condition();
+  ::model::Operation_StopCondition* mutable_stop_condition();
+  void set_allocated_stop_condition(::model::Operation_StopCondition* stop_condition);
+  private:
+  const ::model::Operation_StopCondition& _internal_stop_condition() const;
+  ::model::Operation_StopCondition* _internal_mutable_stop_condition();
+  public:
+  void unsafe_arena_set_allocated_stop_condition(
+      ::model::Operation_StopCondition* stop_condition);
+  ::model::Operation_StopCondition* unsafe_arena_release_stop_condition();
+
+  // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
+  bool has_optimizer() const;
+  private:
+  bool _internal_has_optimizer() const;
+  public:
+  void clear_optimizer();
+  ::model::Operation_Optimizer optimizer() const;
+  void set_optimizer(::model::Operation_Optimizer value);
+  private:
+  ::model::Operation_Optimizer _internal_optimizer() const;
+  void _internal_set_optimizer(::model::Operation_Optimizer value);
+  public:
 
   // optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
-  inline bool has_operation_type() const;
-  inline void clear_operation_type();
-  static const int kOperationTypeFieldNumber = 4;
-  inline ::model::Operation_OperationType operation_type() const;
-  inline void set_operation_type(::model::Operation_OperationType value);
+  bool has_operation_type() const;
+  private:
+  bool _internal_has_operation_type() const;
+  public:
+  void clear_operation_type();
+  ::model::Operation_OperationType operation_type() const;
+  void set_operation_type(::model::Operation_OperationType value);
+  private:
+  ::model::Operation_OperationType _internal_operation_type() const;
+  void _internal_set_operation_type(::model::Operation_OperationType value);
+  public:
 
-  // optional int32 batch_size = 5 [default = 100];
-  inline bool has_batch_size() const;
-  inline void clear_batch_size();
-  static const int kBatchSizeFieldNumber = 5;
-  inline ::google::protobuf::int32 batch_size() const;
-  inline void set_batch_size(::google::protobuf::int32 value);
+  // optional int32 shard_rank = 14 [default = 0];
+  bool has_shard_rank() const;
+  private:
+  bool _internal_has_shard_rank() const;
+  public:
+  void clear_shard_rank();
+  int32_t shard_rank() const;
+  void set_shard_rank(int32_t value);
+  private:
+  int32_t _internal_shard_rank() const;
+  void _internal_set_shard_rank(int32_t value);
+  public:
 
-  // optional string data_proto = 6;
-  inline bool has_data_proto() const;
-  inline void clear_data_proto();
-  static const int kDataProtoFieldNumber = 6;
-  inline const ::std::string& data_proto() const;
-  inline void set_data_proto(const ::std::string& value);
-  inline void set_data_proto(const char* value);
-  inline void set_data_proto(const char* value, size_t size);
-  inline ::std::string* mutable_data_proto();
-  inline ::std::string* release_data_proto();
-  inline void set_allocated_data_proto(::std::string* data_proto);
+  // optional bool randomize = 10 [default = false];
+  bool has_randomize() const;
+  private:
+  bool _internal_has_randomize() const;
+  public:
+  void clear_randomize();
+  bool randomize() const;
+  void set_randomize(bool value);
+  private:
+  bool _internal_randomize() const;
+  void _internal_set_randomize(bool value);
+  public:
 
-  // optional int32 eval_after = 7 [default = 500];
-  inline bool has_eval_after() const;
-  inline void clear_eval_after();
-  static const int kEvalAfterFieldNumber = 7;
-  inline ::google::protobuf::int32 eval_after() const;
-  inline void set_eval_after(::google::protobuf::int32 value);
+  // optional bool simplify = 19 [default = false];
+  bool has_simplify() const;
+  private:
+  bool _internal_has_simplify() const;
+  public:
+  void clear_simplify();
+  bool simplify() const;
+  void set_simplify(bool value);
+  private:
+  bool _internal_simplify() const;
+  void _internal_set_simplify(bool value);
+  public:
 
-  // optional int32 checkpoint_after = 8 [default = 1000];
-  inline bool has_checkpoint_after() const;
-  inline void clear_checkpoint_after();
-  static const int kCheckpointAfterFieldNumber = 8;
-  inline ::google::protobuf::int32 checkpoint_after() const;
-  inline void set_checkpoint_after(::google::protobuf::int32 value);
+  // optional .model.Operation.ParallelMode parallel_mode = 17 [default = NODE_LEVELS];
+  bool has_parallel_mode() const;
+  private:
+  bool _internal_has_parallel_mode() const;
+  public:
+  void clear_parallel_mode();
+  ::model::Operation_ParallelMode parallel_mode() const;
+  void set_parallel_mode(::model::Operation_ParallelMode value);
+  private:
+  ::model::Operation_ParallelMode _internal_parallel_mode() const;
+  void _internal_set_parallel_mode(::model::Operation_ParallelMode value);
+  public:
 
-  // optional string checkpoint_directory = 9;
-  inline bool has_checkpoint_directory() const;
-  inline void clear_checkpoint_directory();
-  static const int kCheckpointDirectoryFieldNumber = 9;
-  inline const ::std::string& checkpoint_directory() const;
-  inline void set_checkpoint_directory(const ::std::string& value);
-  inline void set_checkpoint_directory(const char* value);
-  inline void set_checkpoint_directory(const char* value, size_t size);
-  inline ::std::string* mutable_checkpoint_directory();
-  inline ::std::string* release_checkpoint_directory();
-  inline void set_allocated_checkpoint_directory(::std::string* checkpoint_directory);
+  // optional float prune_threshold = 18 [default = 0];
+  bool has_prune_threshold() const;
+  private:
+  bool _internal_has_prune_threshold() const;
+  public:
+  void clear_prune_threshold();
+  float prune_threshold() const;
+  void set_prune_threshold(float value);
+  private:
+  float _internal_prune_threshold() const;
+  void _internal_set_prune_threshold(float value);
+  public:
 
-  // optional bool randomize = 10 [default = false];
-  inline bool has_randomize() const;
-  inline void clear_randomize();
-  static const int kRandomizeFieldNumber = 10;
-  inline bool randomize() const;
-  inline void set_randomize(bool value);
+  // optional int32 thread_count = 16 [default = 1];
+  bool has_thread_count() const;
+  private:
+  bool _internal_has_thread_count() const;
+  public:
+  void clear_thread_count();
+  int32_t thread_count() const;
+  void set_thread_count(int32_t value);
+  private:
+  int32_t _internal_thread_count() const;
+  void _internal_set_thread_count(int32_t value);
+  public:
+
+  // optional int32 batch_size = 5 [default = 100];
+  bool has_batch_size() const;
+  private:
+  bool _internal_has_batch_size() const;
+  public:
+  void clear_batch_size();
+  int32_t batch_size() const;
+  void set_batch_size(int32_t value);
+  private:
+  int32_t _internal_batch_size() const;
+  void _internal_set_batch_size(int32_t value);
+  public:
+
+  // optional int32 eval_after = 7 [default = 500];
+  bool has_eval_after() const;
+  private:
+  bool _internal_has_eval_after() const;
+  public:
+  void clear_eval_after();
+  int32_t eval_after() const;
+  void set_eval_after(int32_t value);
+  private:
+  int32_t _internal_eval_after() const;
+  void _internal_set_eval_after(int32_t value);
+  public:
+
+  // optional int32 checkpoint_after = 8 [default = 1000];
+  bool has_checkpoint_after() const;
+  private:
+  bool _internal_has_checkpoint_after() const;
+  public:
+  void clear_checkpoint_after();
+  int32_t checkpoint_after() const;
+  void set_checkpoint_after(int32_t value);
+  private:
+  int32_t _internal_checkpoint_after() const;
+  void _internal_set_checkpoint_after(int32_t value);
+  public:
 
   // optional int32 random_seed = 11 [default = 42];
-  inline bool has_random_seed() const;
-  inline void clear_random_seed();
-  static const int kRandomSeedFieldNumber = 11;
-  inline ::google::protobuf::int32 random_seed() const;
-  inline void set_random_seed(::google::protobuf::int32 value);
+  bool has_random_seed() const;
+  private:
+  bool _internal_has_random_seed() const;
+  public:
+  void clear_random_seed();
+  int32_t random_seed() const;
+  void set_random_seed(int32_t value);
+  private:
+  int32_t _internal_random_seed() const;
+  void _internal_set_random_seed(int32_t value);
+  public:
 
   // optional bool verbose = 12 [default = true];
-  inline bool has_verbose() const;
-  inline void clear_verbose();
-  static const int kVerboseFieldNumber = 12;
-  inline bool verbose() const;
-  inline void set_verbose(bool value);
+  bool has_verbose() const;
+  private:
+  bool _internal_has_verbose() const;
+  public:
+  void clear_verbose();
+  bool verbose() const;
+  void set_verbose(bool value);
+  private:
+  bool _internal_verbose() const;
+  void _internal_set_verbose(bool value);
+  public:
 
   // optional bool normalize_each_train_step = 13 [default = true];
-  inline bool has_normalize_each_train_step() const;
-  inline void clear_normalize_each_train_step();
-  static const int kNormalizeEachTrainStepFieldNumber = 13;
-  inline bool normalize_each_train_step() const;
-  inline void set_normalize_each_train_step(bool value);
+  bool has_normalize_each_train_step() const;
+  private:
+  bool _internal_has_normalize_each_train_step() const;
+  public:
+  void clear_normalize_each_train_step();
+  bool normalize_each_train_step() const;
+  void set_normalize_each_train_step(bool value);
+  private:
+  bool _internal_normalize_each_train_step() const;
+  void _internal_set_normalize_each_train_step(bool value);
+  public:
+
+  // optional int32 shard_count = 15 [default = 1];
+  bool has_shard_count() const;
+  private:
+  bool _internal_has_shard_count() const;
+  public:
+  void clear_shard_count();
+  int32_t shard_count() const;
+  void set_shard_count(int32_t value);
+  private:
+  int32_t _internal_shard_count() const;
+  void _internal_set_shard_count(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.Operation)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_optimizer();
-  inline void clear_has_optimizer();
-  inline void set_has_stop_condition();
-  inline void clear_has_stop_condition();
-  inline void set_has_operation_type();
-  inline void clear_has_operation_type();
-  inline void set_has_batch_size();
-  inline void clear_has_batch_size();
-  inline void set_has_data_proto();
-  inline void clear_has_data_proto();
-  inline void set_has_eval_after();
-  inline void clear_has_eval_after();
-  inline void set_has_checkpoint_after();
-  inline void clear_has_checkpoint_after();
-  inline void set_has_checkpoint_directory();
-  inline void clear_has_checkpoint_directory();
-  inline void set_has_randomize();
-  inline void clear_has_randomize();
-  inline void set_has_random_seed();
-  inline void clear_has_random_seed();
-  inline void set_has_verbose();
-  inline void clear_has_verbose();
-  inline void set_has_normalize_each_train_step();
-  inline void clear_has_normalize_each_train_step();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  static ::std::string* _default_name_;
-  ::model::Operation_StopCondition* stop_condition_;
-  int optimizer_;
-  int operation_type_;
-  ::std::string* data_proto_;
-  ::google::protobuf::int32 batch_size_;
-  ::google::protobuf::int32 eval_after_;
-  ::std::string* checkpoint_directory_;
-  ::google::protobuf::int32 checkpoint_after_;
-  ::google::protobuf::int32 random_seed_;
-  bool randomize_;
-  bool verbose_;
-  bool normalize_each_train_step_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(13 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static Operation* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_proto_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr checkpoint_directory_;
+    ::model::Operation_StopCondition* stop_condition_;
+    int optimizer_;
+    int operation_type_;
+    int32_t shard_rank_;
+    bool randomize_;
+    bool simplify_;
+    int parallel_mode_;
+    float prune_threshold_;
+    int32_t thread_count_;
+    int32_t batch_size_;
+    int32_t eval_after_;
+    int32_t checkpoint_after_;
+    int32_t random_seed_;
+    bool verbose_;
+    bool normalize_each_train_step_;
+    int32_t shard_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DatasetInfo : public ::google::protobuf::Message {
+class DatasetInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.DatasetInfo) */ {
  public:
-  DatasetInfo();
-  virtual ~DatasetInfo();
+  inline DatasetInfo() : DatasetInfo(nullptr) {}
+  ~DatasetInfo() override;
+  explicit PROTOBUF_CONSTEXPR DatasetInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DatasetInfo(const DatasetInfo& from);
+  DatasetInfo(DatasetInfo&& from) noexcept
+    : DatasetInfo() {
+    *this = ::std::move(from);
+  }
 
   inline DatasetInfo& operator=(const DatasetInfo& from) {
     CopyFrom(from);
     return *this;
   }
+  inline DatasetInfo& operator=(DatasetInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DatasetInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DatasetInfo* internal_default_instance() {
+    return reinterpret_cast<const DatasetInfo*>(
+               &_DatasetInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(DatasetInfo& a, DatasetInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DatasetInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DatasetInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DatasetInfo& default_instance();
-
-  void Swap(DatasetInfo* other);
-
   // implements Message ----------------------------------------------
 
-  DatasetInfo* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  DatasetInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DatasetInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DatasetInfo& from);
-  void MergeFrom(const DatasetInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DatasetInfo& from) {
+    DatasetInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DatasetInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.DatasetInfo";
+  }
+  protected:
+  explicit DatasetInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef DatasetInfo_DataType DataType;
-  static const DataType TRAIN_SET = DatasetInfo_DataType_TRAIN_SET;
-  static const DataType EVAL_SET = DatasetInfo_DataType_EVAL_SET;
-  static const DataType TEST_SET = DatasetInfo_DataType_TEST_SET;
+  static constexpr DataType TRAIN_SET =
+    DatasetInfo_DataType_TRAIN_SET;
+  static constexpr DataType EVAL_SET =
+    DatasetInfo_DataType_EVAL_SET;
+  static constexpr DataType TEST_SET =
+    DatasetInfo_DataType_TEST_SET;
   static inline bool DataType_IsValid(int value) {
     return DatasetInfo_DataType_IsValid(value);
   }
-  static const DataType DataType_MIN =
+  static constexpr DataType DataType_MIN =
     DatasetInfo_DataType_DataType_MIN;
-  static const DataType DataType_MAX =
+  static constexpr DataType DataType_MAX =
     DatasetInfo_DataType_DataType_MAX;
-  static const int DataType_ARRAYSIZE =
+  static constexpr int DataType_ARRAYSIZE =
     DatasetInfo_DataType_DataType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   DataType_descriptor() {
     return DatasetInfo_DataType_descriptor();
   }
-  static inline const ::std::string& DataType_Name(DataType value) {
-    return DatasetInfo_DataType_Name(value);
+  template<typename T>
+  static inline const std::string& DataType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DataType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DataType_Name.");
+    return DatasetInfo_DataType_Name(enum_t_value);
   }
-  static inline bool DataType_Parse(const ::std::string& name,
+  static inline bool DataType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       DataType* value) {
     return DatasetInfo_DataType_Parse(name, value);
   }
 
   typedef DatasetInfo_DataFormat DataFormat;
-  static const DataFormat BOOST_MATRIX = DatasetInfo_DataFormat_BOOST_MATRIX;
-  static const DataFormat CSV = DatasetInfo_DataFormat_CSV;
+  static constexpr DataFormat BOOST_MATRIX =
+    DatasetInfo_DataFormat_BOOST_MATRIX;
+  static constexpr DataFormat CSV =
+    DatasetInfo_DataFormat_CSV;
   static inline bool DataFormat_IsValid(int value) {
     return DatasetInfo_DataFormat_IsValid(value);
   }
-  static const DataFormat DataFormat_MIN =
+  static constexpr DataFormat DataFormat_MIN =
     DatasetInfo_DataFormat_DataFormat_MIN;
-  static const DataFormat DataFormat_MAX =
+  static constexpr DataFormat DataFormat_MAX =
     DatasetInfo_DataFormat_DataFormat_MAX;
-  static const int DataFormat_ARRAYSIZE =
+  static constexpr int DataFormat_ARRAYSIZE =
     DatasetInfo_DataFormat_DataFormat_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   DataFormat_descriptor() {
     return DatasetInfo_DataFormat_descriptor();
   }
-  static inline const ::std::string& DataFormat_Name(DataFormat value) {
-    return DatasetInfo_DataFormat_Name(value);
+  template<typename T>
+  static inline const std::string& DataFormat_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DataFormat>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DataFormat_Name.");
+    return DatasetInfo_DataFormat_Name(enum_t_value);
   }
-  static inline bool DataFormat_Parse(const ::std::string& name,
+  static inline bool DataFormat_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       DataFormat* value) {
     return DatasetInfo_DataFormat_Parse(name, value);
   }
 
-  // accessors -------------------------------------------------------
+  typedef DatasetInfo_DiskReader DiskReader;
+  static constexpr DiskReader STREAM =
+    DatasetInfo_DiskReader_STREAM;
+  static constexpr DiskReader DIRECT_ASYNC =
+    DatasetInfo_DiskReader_DIRECT_ASYNC;
+  static inline bool DiskReader_IsValid(int value) {
+    return DatasetInfo_DiskReader_IsValid(value);
+  }
+  static constexpr DiskReader DiskReader_MIN =
+    DatasetInfo_DiskReader_DiskReader_MIN;
+  static constexpr DiskReader DiskReader_MAX =
+    DatasetInfo_DiskReader_DiskReader_MAX;
+  static constexpr int DiskReader_ARRAYSIZE =
+    DatasetInfo_DiskReader_DiskReader_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  DiskReader_descriptor() {
+    return DatasetInfo_DiskReader_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& DiskReader_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DiskReader>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DiskReader_Name.");
+    return DatasetInfo_DiskReader_Name(enum_t_value);
+  }
+  static inline bool DiskReader_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      DiskReader* value) {
+    return DatasetInfo_DiskReader_Parse(name, value);
+  }
 
-  // required .model.DatasetInfo.DataType type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::model::DatasetInfo_DataType type() const;
-  inline void set_type(::model::DatasetInfo_DataType value);
+  // accessors -------------------------------------------------------
 
+  enum : int {
+    kFilePatternFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kSizeFieldNumber = 3,
+    kDimensionsFieldNumber = 4,
+    kDataFormatFieldNumber = 6,
+    kDiskReaderFieldNumber = 7,
+    kTypeSizeFieldNumber = 5,
+  };
   // required string file_pattern = 2;
-  inline bool has_file_pattern() const;
-  inline void clear_file_pattern();
-  static const int kFilePatternFieldNumber = 2;
-  inline const ::std::string& file_pattern() const;
-  inline void set_file_pattern(const ::std::string& value);
-  inline void set_file_pattern(const char* value);
-  inline void set_file_pattern(const char* value, size_t size);
-  inline ::std::string* mutable_file_pattern();
-  inline ::std::string* release_file_pattern();
-  inline void set_allocated_file_pattern(::std::string* file_pattern);
+  bool has_file_pattern() const;
+  private:
+  bool _internal_has_file_pattern() const;
+  public:
+  void clear_file_pattern();
+  const std::string& file_pattern() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_pattern(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_pattern();
+  PROTOBUF_NODISCARD std::string* release_file_pattern();
+  void set_allocated_file_pattern(std::string* file_pattern);
+  private:
+  const std::string& _internal_file_pattern() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_pattern(const std::string& value);
+  std::string* _internal_mutable_file_pattern();
+  public:
+
+  // required .model.DatasetInfo.DataType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::model::DatasetInfo_DataType type() const;
+  void set_type(::model::DatasetInfo_DataType value);
+  private:
+  ::model::DatasetInfo_DataType _internal_type() const;
+  void _internal_set_type(::model::DatasetInfo_DataType value);
+  public:
 
   // required int32 size = 3;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 3;
-  inline ::google::protobuf::int32 size() const;
-  inline void set_size(::google::protobuf::int32 value);
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
 
   // required int32 dimensions = 4;
-  inline bool has_dimensions() const;
-  inline void clear_dimensions();
-  static const int kDimensionsFieldNumber = 4;
-  inline ::google::protobuf::int32 dimensions() const;
-  inline void set_dimensions(::google::protobuf::int32 value);
-
-  // optional int32 type_size = 5 [default = 4];
-  inline bool has_type_size() const;
-  inline void clear_type_size();
-  static const int kTypeSizeFieldNumber = 5;
-  inline ::google::protobuf::int32 type_size() const;
-  inline void set_type_size(::google::protobuf::int32 value);
+  bool has_dimensions() const;
+  private:
+  bool _internal_has_dimensions() const;
+  public:
+  void clear_dimensions();
+  int32_t dimensions() const;
+  void set_dimensions(int32_t value);
+  private:
+  int32_t _internal_dimensions() const;
+  void _internal_set_dimensions(int32_t value);
+  public:
 
   // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
-  inline bool has_data_format() const;
-  inline void clear_data_format();
-  static const int kDataFormatFieldNumber = 6;
-  inline ::model::DatasetInfo_DataFormat data_format() const;
-  inline void set_data_format(::model::DatasetInfo_DataFormat value);
+  bool has_data_format() const;
+  private:
+  bool _internal_has_data_format() const;
+  public:
+  void clear_data_format();
+  ::model::DatasetInfo_DataFormat data_format() const;
+  void set_data_format(::model::DatasetInfo_DataFormat value);
+  private:
+  ::model::DatasetInfo_DataFormat _internal_data_format() const;
+  void _internal_set_data_format(::model::DatasetInfo_DataFormat value);
+  public:
+
+  // optional .model.DatasetInfo.DiskReader disk_reader = 7 [default = STREAM];
+  bool has_disk_reader() const;
+  private:
+  bool _internal_has_disk_reader() const;
+  public:
+  void clear_disk_reader();
+  ::model::DatasetInfo_DiskReader disk_reader() const;
+  void set_disk_reader(::model::DatasetInfo_DiskReader value);
+  private:
+  ::model::DatasetInfo_DiskReader _internal_disk_reader() const;
+  void _internal_set_disk_reader(::model::DatasetInfo_DiskReader value);
+  public:
+
+  // optional int32 type_size = 5 [default = 4];
+  bool has_type_size() const;
+  private:
+  bool _internal_has_type_size() const;
+  public:
+  void clear_type_size();
+  int32_t type_size() const;
+  void set_type_size(int32_t value);
+  private:
+  int32_t _internal_type_size() const;
+  void _internal_set_type_size(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.DatasetInfo)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_file_pattern();
-  inline void clear_has_file_pattern();
-  inline void set_has_size();
-  inline void clear_has_size();
-  inline void set_has_dimensions();
-  inline void clear_has_dimensions();
-  inline void set_has_type_size();
-  inline void clear_has_type_size();
-  inline void set_has_data_format();
-  inline void clear_has_data_format();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* file_pattern_;
-  int type_;
-  ::google::protobuf::int32 size_;
-  ::google::protobuf::int32 dimensions_;
-  ::google::protobuf::int32 type_size_;
-  int data_format_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static DatasetInfo* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_pattern_;
+    int type_;
+    int32_t size_;
+    int32_t dimensions_;
+    int data_format_;
+    int disk_reader_;
+    int32_t type_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DatabaseInfo : public ::google::protobuf::Message {
+class DatabaseInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:model.DatabaseInfo) */ {
  public:
-  DatabaseInfo();
-  virtual ~DatabaseInfo();
+  inline DatabaseInfo() : DatabaseInfo(nullptr) {}
+  ~DatabaseInfo() override;
+  explicit PROTOBUF_CONSTEXPR DatabaseInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DatabaseInfo(const DatabaseInfo& from);
+  DatabaseInfo(DatabaseInfo&& from) noexcept
+    : DatabaseInfo() {
+    *this = ::std::move(from);
+  }
 
   inline DatabaseInfo& operator=(const DatabaseInfo& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline DatabaseInfo& operator=(DatabaseInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DatabaseInfo& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DatabaseInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DatabaseInfo* internal_default_instance() {
+    return reinterpret_cast<const DatabaseInfo*>(
+               &_DatabaseInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(DatabaseInfo* other);
+  friend void swap(DatabaseInfo& a, DatabaseInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DatabaseInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DatabaseInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  DatabaseInfo* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  DatabaseInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DatabaseInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DatabaseInfo& from);
-  void MergeFrom(const DatabaseInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DatabaseInfo& from) {
+    DatabaseInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DatabaseInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "model.DatabaseInfo";
+  }
+  protected:
+  explicit DatabaseInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
+  enum : int {
+    kDataFieldNumber = 2,
+    kNameFieldNumber = 1,
+    kDataHandlerFieldNumber = 3,
+    kPathPrefixFieldNumber = 6,
+    kShardRankFieldNumber = 7,
+    kShardCountFieldNumber = 8,
+    kMainMemoryFieldNumber = 4,
+    kGpuMemoryFieldNumber = 5,
+  };
   // repeated .model.DatasetInfo data = 2;
-  inline int data_size() const;
-  inline void clear_data();
-  static const int kDataFieldNumber = 2;
-  inline const ::model::DatasetInfo& data(int index) const;
-  inline ::model::DatasetInfo* mutable_data(int index);
-  inline ::model::DatasetInfo* add_data();
-  inline const ::google::protobuf::RepeatedPtrField< ::model::DatasetInfo >&
-      data() const;
-  inline ::google::protobuf::RepeatedPtrField< ::model::DatasetInfo >*
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  ::model::DatasetInfo* mutable_data(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::DatasetInfo >*
       mutable_data();
+  private:
+  const ::model::DatasetInfo& _internal_data(int index) const;
+  ::model::DatasetInfo* _internal_add_data();
+  public:
+  const ::model::DatasetInfo& data(int index) const;
+  ::model::DatasetInfo* add_data();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::DatasetInfo >&
+      data() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // optional string data_handler = 3 [default = "deeplearn"];
-  inline bool has_data_handler() const;
-  inline void clear_data_handler();
-  static const int kDataHandlerFieldNumber = 3;
-  inline const ::std::string& data_handler() const;
-  inline void set_data_handler(const ::std::string& value);
-  inline void set_data_handler(const char* value);
-  inline void set_data_handler(const char* value, size_t size);
-  inline ::std::string* mutable_data_handler();
-  inline ::std::string* release_data_handler();
-  inline void set_allocated_data_handler(::std::string* data_handler);
+  bool has_data_handler() const;
+  private:
+  bool _internal_has_data_handler() const;
+  public:
+  void clear_data_handler();
+  const std::string& data_handler() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data_handler(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data_handler();
+  PROTOBUF_NODISCARD std::string* release_data_handler();
+  void set_allocated_data_handler(std::string* data_handler);
+  private:
+  const std::string& _internal_data_handler() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data_handler(const std::string& value);
+  std::string* _internal_mutable_data_handler();
+  public:
+
+  // optional string path_prefix = 6 [default = ""];
+  bool has_path_prefix() const;
+  private:
+  bool _internal_has_path_prefix() const;
+  public:
+  void clear_path_prefix();
+  const std::string& path_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path_prefix();
+  PROTOBUF_NODISCARD std::string* release_path_prefix();
+  void set_allocated_path_prefix(std::string* path_prefix);
+  private:
+  const std::string& _internal_path_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path_prefix(const std::string& value);
+  std::string* _internal_mutable_path_prefix();
+  public:
+
+  // optional int32 shard_rank = 7 [default = 0];
+  bool has_shard_rank() const;
+  private:
+  bool _internal_has_shard_rank() const;
+  public:
+  void clear_shard_rank();
+  int32_t shard_rank() const;
+  void set_shard_rank(int32_t value);
+  private:
+  int32_t _internal_shard_rank() const;
+  void _internal_set_shard_rank(int32_t value);
+  public:
+
+  // optional int32 shard_count = 8 [default = 1];
+  bool has_shard_count() const;
+  private:
+  bool _internal_has_shard_count() const;
+  public:
+  void clear_shard_count();
+  int32_t shard_count() const;
+  void set_shard_count(int32_t value);
+  private:
+  int32_t _internal_shard_count() const;
+  void _internal_set_shard_count(int32_t value);
+  public:
 
   // optional float main_memory = 4 [default = 2];
-  inline bool has_main_memory() const;
-  inline void clear_main_memory();
-  static const int kMainMemoryFieldNumber = 4;
-  inline float main_memory() const;
-  inline void set_main_memory(float value);
+  bool has_main_memory() const;
+  private:
+  bool _internal_has_main_memory() const;
+  public:
+  void clear_main_memory();
+  float main_memory() const;
+  void set_main_memory(float value);
+  private:
+  float _internal_main_memory() const;
+  void _internal_set_main_memory(float value);
+  public:
 
   // optional float gpu_memory = 5 [default = 1.5];
-  inline bool has_gpu_memory() const;
-  inline void clear_gpu_memory();
-  static const int kGpuMemoryFieldNumber = 5;
-  inline float gpu_memory() const;
-  inline void set_gpu_memory(float value);
-
-  // optional string path_prefix = 6 [default = ""];
-  inline bool has_path_prefix() const;
-  inline void clear_path_prefix();
-  static const int kPathPrefixFieldNumber = 6;
-  inline const ::std::string& path_prefix() const;
-  inline void set_path_prefix(const ::std::string& value);
-  inline void set_path_prefix(const char* value);
-  inline void set_path_prefix(const char* value, size_t size);
-  inline ::std::string* mutable_path_prefix();
-  inline ::std::string* release_path_prefix();
-  inline void set_allocated_path_prefix(::std::string* path_prefix);
+  bool has_gpu_memory() const;
+  private:
+  bool _internal_has_gpu_memory() const;
+  public:
+  void clear_gpu_memory();
+  float gpu_memory() const;
+  void set_gpu_memory(float value);
+  private:
+  float _internal_gpu_memory() const;
+  void _internal_set_gpu_memory(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:model.DatabaseInfo)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_data_handler();
-  inline void clear_has_data_handler();
-  inline void set_has_main_memory();
-  inline void clear_has_main_memory();
-  inline void set_has_gpu_memory();
-  inline void clear_has_gpu_memory();
-  inline void set_has_path_prefix();
-  inline void clear_has_path_prefix();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::google::protobuf::RepeatedPtrField< ::model::DatasetInfo > data_;
-  ::std::string* data_handler_;
-  static ::std::string* _default_data_handler_;
-  float main_memory_;
-  float gpu_memory_;
-  ::std::string* path_prefix_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_deeplearn_2eproto();
-  friend void protobuf_AssignDesc_deeplearn_2eproto();
-  friend void protobuf_ShutdownFile_deeplearn_2eproto();
-
-  void InitAsDefaultInstance();
-  static DatabaseInfo* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::DatasetInfo > data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_data_handler_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_handler_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_prefix_;
+    int32_t shard_rank_;
+    int32_t shard_count_;
+    float main_memory_;
+    float gpu_memory_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deeplearn_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Metric
 
 // required .model.Metric.MetricType type = 1 [default = NLL];
-inline bool Metric::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Metric::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Metric::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Metric::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Metric::has_type() const {
+  return _internal_has_type();
 }
 inline void Metric::clear_type() {
-  type_ = 1;
-  clear_has_type();
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::model::Metric_MetricType Metric::_internal_type() const {
+  return static_cast< ::model::Metric_MetricType >(_impl_.type_);
 }
 inline ::model::Metric_MetricType Metric::type() const {
-  return static_cast< ::model::Metric_MetricType >(type_);
+  // @@protoc_insertion_point(field_get:model.Metric.type)
+  return _internal_type();
 }
-inline void Metric::set_type(::model::Metric_MetricType value) {
+inline void Metric::_internal_set_type(::model::Metric_MetricType value) {
   assert(::model::Metric_MetricType_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_ = value;
+}
+inline void Metric::set_type(::model::Metric_MetricType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:model.Metric.type)
 }
 
 // repeated int32 steps = 2;
+inline int Metric::_internal_steps_size() const {
+  return _impl_.steps_.size();
+}
 inline int Metric::steps_size() const {
-  return steps_.size();
+  return _internal_steps_size();
 }
 inline void Metric::clear_steps() {
-  steps_.Clear();
+  _impl_.steps_.Clear();
+}
+inline int32_t Metric::_internal_steps(int index) const {
+  return _impl_.steps_.Get(index);
 }
-inline ::google::protobuf::int32 Metric::steps(int index) const {
-  return steps_.Get(index);
+inline int32_t Metric::steps(int index) const {
+  // @@protoc_insertion_point(field_get:model.Metric.steps)
+  return _internal_steps(index);
 }
-inline void Metric::set_steps(int index, ::google::protobuf::int32 value) {
-  steps_.Set(index, value);
+inline void Metric::set_steps(int index, int32_t value) {
+  _impl_.steps_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.Metric.steps)
 }
-inline void Metric::add_steps(::google::protobuf::int32 value) {
-  steps_.Add(value);
+inline void Metric::_internal_add_steps(int32_t value) {
+  _impl_.steps_.Add(value);
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline void Metric::add_steps(int32_t value) {
+  _internal_add_steps(value);
+  // @@protoc_insertion_point(field_add:model.Metric.steps)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Metric::_internal_steps() const {
+  return _impl_.steps_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 Metric::steps() const {
-  return steps_;
+  // @@protoc_insertion_point(field_list:model.Metric.steps)
+  return _internal_steps();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Metric::_internal_mutable_steps() {
+  return &_impl_.steps_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 Metric::mutable_steps() {
-  return &steps_;
+  // @@protoc_insertion_point(field_mutable_list:model.Metric.steps)
+  return _internal_mutable_steps();
 }
 
 // repeated float values = 3;
+inline int Metric::_internal_values_size() const {
+  return _impl_.values_.size();
+}
 inline int Metric::values_size() const {
-  return values_.size();
+  return _internal_values_size();
 }
 inline void Metric::clear_values() {
-  values_.Clear();
+  _impl_.values_.Clear();
+}
+inline float Metric::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
 }
 inline float Metric::values(int index) const {
-  return values_.Get(index);
+  // @@protoc_insertion_point(field_get:model.Metric.values)
+  return _internal_values(index);
 }
 inline void Metric::set_values(int index, float value) {
-  values_.Set(index, value);
+  _impl_.values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.Metric.values)
+}
+inline void Metric::_internal_add_values(float value) {
+  _impl_.values_.Add(value);
 }
 inline void Metric::add_values(float value) {
-  values_.Add(value);
+  _internal_add_values(value);
+  // @@protoc_insertion_point(field_add:model.Metric.values)
 }
-inline const ::google::protobuf::RepeatedField< float >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Metric::_internal_values() const {
+  return _impl_.values_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 Metric::values() const {
-  return values_;
+  // @@protoc_insertion_point(field_list:model.Metric.values)
+  return _internal_values();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Metric::_internal_mutable_values() {
+  return &_impl_.values_;
 }
-inline ::google::protobuf::RepeatedField< float >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 Metric::mutable_values() {
-  return &values_;
+  // @@protoc_insertion_point(field_mutable_list:model.Metric.values)
+  return _internal_mutable_values();
 }
 
 // -------------------------------------------------------------------
@@ -2255,28 +4204,43 @@ Metric::mutable_values() {
 // Metrics
 
 // repeated .model.Metric metrics = 1;
+inline int Metrics::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
+}
 inline int Metrics::metrics_size() const {
-  return metrics_.size();
+  return _internal_metrics_size();
 }
 inline void Metrics::clear_metrics() {
-  metrics_.Clear();
+  _impl_.metrics_.Clear();
+}
+inline ::model::Metric* Metrics::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:model.Metrics.metrics)
+  return _impl_.metrics_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::Metric >*
+Metrics::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:model.Metrics.metrics)
+  return &_impl_.metrics_;
+}
+inline const ::model::Metric& Metrics::_internal_metrics(int index) const {
+  return _impl_.metrics_.Get(index);
 }
 inline const ::model::Metric& Metrics::metrics(int index) const {
-  return metrics_.Get(index);
+  // @@protoc_insertion_point(field_get:model.Metrics.metrics)
+  return _internal_metrics(index);
 }
-inline ::model::Metric* Metrics::mutable_metrics(int index) {
-  return metrics_.Mutable(index);
+inline ::model::Metric* Metrics::_internal_add_metrics() {
+  return _impl_.metrics_.Add();
 }
 inline ::model::Metric* Metrics::add_metrics() {
-  return metrics_.Add();
+  ::model::Metric* _add = _internal_add_metrics();
+  // @@protoc_insertion_point(field_add:model.Metrics.metrics)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::model::Metric >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::Metric >&
 Metrics::metrics() const {
-  return metrics_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::model::Metric >*
-Metrics::mutable_metrics() {
-  return &metrics_;
+  // @@protoc_insertion_point(field_list:model.Metrics.metrics)
+  return _impl_.metrics_;
 }
 
 // -------------------------------------------------------------------
@@ -2284,408 +4248,628 @@ Metrics::mutable_metrics() {
 // Hyperparams
 
 // optional float base_learningrate = 1 [default = 0.01];
-inline bool Hyperparams::has_base_learningrate() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Hyperparams::_internal_has_base_learningrate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void Hyperparams::set_has_base_learningrate() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Hyperparams::clear_has_base_learningrate() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Hyperparams::has_base_learningrate() const {
+  return _internal_has_base_learningrate();
 }
 inline void Hyperparams::clear_base_learningrate() {
-  base_learningrate_ = 0.01f;
-  clear_has_base_learningrate();
+  _impl_.base_learningrate_ = 0.01f;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float Hyperparams::_internal_base_learningrate() const {
+  return _impl_.base_learningrate_;
 }
 inline float Hyperparams::base_learningrate() const {
-  return base_learningrate_;
+  // @@protoc_insertion_point(field_get:model.Hyperparams.base_learningrate)
+  return _internal_base_learningrate();
+}
+inline void Hyperparams::_internal_set_base_learningrate(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.base_learningrate_ = value;
 }
 inline void Hyperparams::set_base_learningrate(float value) {
-  set_has_base_learningrate();
-  base_learningrate_ = value;
+  _internal_set_base_learningrate(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.base_learningrate)
 }
 
 // optional .model.Hyperparams.Decay learningrate_decay = 2 [default = DECAY_NONE];
-inline bool Hyperparams::has_learningrate_decay() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Hyperparams::set_has_learningrate_decay() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Hyperparams::_internal_has_learningrate_decay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Hyperparams::clear_has_learningrate_decay() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Hyperparams::has_learningrate_decay() const {
+  return _internal_has_learningrate_decay();
 }
 inline void Hyperparams::clear_learningrate_decay() {
-  learningrate_decay_ = 0;
-  clear_has_learningrate_decay();
+  _impl_.learningrate_decay_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::model::Hyperparams_Decay Hyperparams::_internal_learningrate_decay() const {
+  return static_cast< ::model::Hyperparams_Decay >(_impl_.learningrate_decay_);
 }
 inline ::model::Hyperparams_Decay Hyperparams::learningrate_decay() const {
-  return static_cast< ::model::Hyperparams_Decay >(learningrate_decay_);
+  // @@protoc_insertion_point(field_get:model.Hyperparams.learningrate_decay)
+  return _internal_learningrate_decay();
 }
-inline void Hyperparams::set_learningrate_decay(::model::Hyperparams_Decay value) {
+inline void Hyperparams::_internal_set_learningrate_decay(::model::Hyperparams_Decay value) {
   assert(::model::Hyperparams_Decay_IsValid(value));
-  set_has_learningrate_decay();
-  learningrate_decay_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.learningrate_decay_ = value;
+}
+inline void Hyperparams::set_learningrate_decay(::model::Hyperparams_Decay value) {
+  _internal_set_learningrate_decay(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.learningrate_decay)
 }
 
 // optional int32 learningrate_decay_half_life = 3 [default = 1000];
+inline bool Hyperparams::_internal_has_learningrate_decay_half_life() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool Hyperparams::has_learningrate_decay_half_life() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_learningrate_decay_half_life();
 }
-inline void Hyperparams::set_has_learningrate_decay_half_life() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Hyperparams::clear_learningrate_decay_half_life() {
+  _impl_.learningrate_decay_half_life_ = 1000;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void Hyperparams::clear_has_learningrate_decay_half_life() {
-  _has_bits_[0] &= ~0x00000004u;
+inline int32_t Hyperparams::_internal_learningrate_decay_half_life() const {
+  return _impl_.learningrate_decay_half_life_;
 }
-inline void Hyperparams::clear_learningrate_decay_half_life() {
-  learningrate_decay_half_life_ = 1000;
-  clear_has_learningrate_decay_half_life();
+inline int32_t Hyperparams::learningrate_decay_half_life() const {
+  // @@protoc_insertion_point(field_get:model.Hyperparams.learningrate_decay_half_life)
+  return _internal_learningrate_decay_half_life();
 }
-inline ::google::protobuf::int32 Hyperparams::learningrate_decay_half_life() const {
-  return learningrate_decay_half_life_;
+inline void Hyperparams::_internal_set_learningrate_decay_half_life(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.learningrate_decay_half_life_ = value;
 }
-inline void Hyperparams::set_learningrate_decay_half_life(::google::protobuf::int32 value) {
-  set_has_learningrate_decay_half_life();
-  learningrate_decay_half_life_ = value;
+inline void Hyperparams::set_learningrate_decay_half_life(int32_t value) {
+  _internal_set_learningrate_decay_half_life(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.learningrate_decay_half_life)
 }
 
 // optional float initial_momentum = 4 [default = 0];
-inline bool Hyperparams::has_initial_momentum() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void Hyperparams::set_has_initial_momentum() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Hyperparams::_internal_has_initial_momentum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Hyperparams::clear_has_initial_momentum() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool Hyperparams::has_initial_momentum() const {
+  return _internal_has_initial_momentum();
 }
 inline void Hyperparams::clear_initial_momentum() {
-  initial_momentum_ = 0;
-  clear_has_initial_momentum();
+  _impl_.initial_momentum_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float Hyperparams::_internal_initial_momentum() const {
+  return _impl_.initial_momentum_;
 }
 inline float Hyperparams::initial_momentum() const {
-  return initial_momentum_;
+  // @@protoc_insertion_point(field_get:model.Hyperparams.initial_momentum)
+  return _internal_initial_momentum();
+}
+inline void Hyperparams::_internal_set_initial_momentum(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.initial_momentum_ = value;
 }
 inline void Hyperparams::set_initial_momentum(float value) {
-  set_has_initial_momentum();
-  initial_momentum_ = value;
+  _internal_set_initial_momentum(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.initial_momentum)
 }
 
 // optional float final_momentum = 5 [default = 0];
-inline bool Hyperparams::has_final_momentum() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool Hyperparams::_internal_has_final_momentum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Hyperparams::set_has_final_momentum() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void Hyperparams::clear_has_final_momentum() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool Hyperparams::has_final_momentum() const {
+  return _internal_has_final_momentum();
 }
 inline void Hyperparams::clear_final_momentum() {
-  final_momentum_ = 0;
-  clear_has_final_momentum();
+  _impl_.final_momentum_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Hyperparams::_internal_final_momentum() const {
+  return _impl_.final_momentum_;
 }
 inline float Hyperparams::final_momentum() const {
-  return final_momentum_;
+  // @@protoc_insertion_point(field_get:model.Hyperparams.final_momentum)
+  return _internal_final_momentum();
+}
+inline void Hyperparams::_internal_set_final_momentum(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.final_momentum_ = value;
 }
 inline void Hyperparams::set_final_momentum(float value) {
-  set_has_final_momentum();
-  final_momentum_ = value;
+  _internal_set_final_momentum(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.final_momentum)
 }
 
 // optional int32 momentum_change_steps = 6 [default = 10];
+inline bool Hyperparams::_internal_has_momentum_change_steps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
 inline bool Hyperparams::has_momentum_change_steps() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_momentum_change_steps();
 }
-inline void Hyperparams::set_has_momentum_change_steps() {
-  _has_bits_[0] |= 0x00000020u;
+inline void Hyperparams::clear_momentum_change_steps() {
+  _impl_.momentum_change_steps_ = 10;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void Hyperparams::clear_has_momentum_change_steps() {
-  _has_bits_[0] &= ~0x00000020u;
+inline int32_t Hyperparams::_internal_momentum_change_steps() const {
+  return _impl_.momentum_change_steps_;
 }
-inline void Hyperparams::clear_momentum_change_steps() {
-  momentum_change_steps_ = 10;
-  clear_has_momentum_change_steps();
+inline int32_t Hyperparams::momentum_change_steps() const {
+  // @@protoc_insertion_point(field_get:model.Hyperparams.momentum_change_steps)
+  return _internal_momentum_change_steps();
 }
-inline ::google::protobuf::int32 Hyperparams::momentum_change_steps() const {
-  return momentum_change_steps_;
+inline void Hyperparams::_internal_set_momentum_change_steps(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.momentum_change_steps_ = value;
 }
-inline void Hyperparams::set_momentum_change_steps(::google::protobuf::int32 value) {
-  set_has_momentum_change_steps();
-  momentum_change_steps_ = value;
+inline void Hyperparams::set_momentum_change_steps(int32_t value) {
+  _internal_set_momentum_change_steps(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.momentum_change_steps)
 }
 
 // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
-inline bool Hyperparams::has_select_model_criterion() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool Hyperparams::_internal_has_select_model_criterion() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Hyperparams::set_has_select_model_criterion() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void Hyperparams::clear_has_select_model_criterion() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool Hyperparams::has_select_model_criterion() const {
+  return _internal_has_select_model_criterion();
 }
 inline void Hyperparams::clear_select_model_criterion() {
-  select_model_criterion_ = 0;
-  clear_has_select_model_criterion();
+  _impl_.select_model_criterion_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::model::Hyperparams_BestModelCriterion Hyperparams::_internal_select_model_criterion() const {
+  return static_cast< ::model::Hyperparams_BestModelCriterion >(_impl_.select_model_criterion_);
 }
 inline ::model::Hyperparams_BestModelCriterion Hyperparams::select_model_criterion() const {
-  return static_cast< ::model::Hyperparams_BestModelCriterion >(select_model_criterion_);
+  // @@protoc_insertion_point(field_get:model.Hyperparams.select_model_criterion)
+  return _internal_select_model_criterion();
 }
-inline void Hyperparams::set_select_model_criterion(::model::Hyperparams_BestModelCriterion value) {
+inline void Hyperparams::_internal_set_select_model_criterion(::model::Hyperparams_BestModelCriterion value) {
   assert(::model::Hyperparams_BestModelCriterion_IsValid(value));
-  set_has_select_model_criterion();
-  select_model_criterion_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.select_model_criterion_ = value;
+}
+inline void Hyperparams::set_select_model_criterion(::model::Hyperparams_BestModelCriterion value) {
+  _internal_set_select_model_criterion(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.select_model_criterion)
 }
 
-// -------------------------------------------------------------------
+// optional float adam_beta1 = 8 [default = 0.9];
+inline bool Hyperparams::_internal_has_adam_beta1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Hyperparams::has_adam_beta1() const {
+  return _internal_has_adam_beta1();
+}
+inline void Hyperparams::clear_adam_beta1() {
+  _impl_.adam_beta1_ = 0.9f;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline float Hyperparams::_internal_adam_beta1() const {
+  return _impl_.adam_beta1_;
+}
+inline float Hyperparams::adam_beta1() const {
+  // @@protoc_insertion_point(field_get:model.Hyperparams.adam_beta1)
+  return _internal_adam_beta1();
+}
+inline void Hyperparams::_internal_set_adam_beta1(float value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.adam_beta1_ = value;
+}
+inline void Hyperparams::set_adam_beta1(float value) {
+  _internal_set_adam_beta1(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.adam_beta1)
+}
 
-// NodeData
+// optional float adam_beta2 = 9 [default = 0.999];
+inline bool Hyperparams::_internal_has_adam_beta2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Hyperparams::has_adam_beta2() const {
+  return _internal_has_adam_beta2();
+}
+inline void Hyperparams::clear_adam_beta2() {
+  _impl_.adam_beta2_ = 0.999f;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline float Hyperparams::_internal_adam_beta2() const {
+  return _impl_.adam_beta2_;
+}
+inline float Hyperparams::adam_beta2() const {
+  // @@protoc_insertion_point(field_get:model.Hyperparams.adam_beta2)
+  return _internal_adam_beta2();
+}
+inline void Hyperparams::_internal_set_adam_beta2(float value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.adam_beta2_ = value;
+}
+inline void Hyperparams::set_adam_beta2(float value) {
+  _internal_set_adam_beta2(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.adam_beta2)
+}
 
-// required string name = 1;
-inline bool NodeData::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional float rmsprop_decay = 10 [default = 0.9];
+inline bool Hyperparams::_internal_has_rmsprop_decay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
 }
-inline void NodeData::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Hyperparams::has_rmsprop_decay() const {
+  return _internal_has_rmsprop_decay();
 }
-inline void NodeData::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Hyperparams::clear_rmsprop_decay() {
+  _impl_.rmsprop_decay_ = 0.9f;
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
-inline void NodeData::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
+inline float Hyperparams::_internal_rmsprop_decay() const {
+  return _impl_.rmsprop_decay_;
 }
-inline const ::std::string& NodeData::name() const {
-  return *name_;
+inline float Hyperparams::rmsprop_decay() const {
+  // @@protoc_insertion_point(field_get:model.Hyperparams.rmsprop_decay)
+  return _internal_rmsprop_decay();
 }
-inline void NodeData::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void Hyperparams::_internal_set_rmsprop_decay(float value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.rmsprop_decay_ = value;
 }
-inline void NodeData::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void Hyperparams::set_rmsprop_decay(float value) {
+  _internal_set_rmsprop_decay(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.rmsprop_decay)
 }
-inline void NodeData::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional float epsilon = 11 [default = 1e-08];
+inline bool Hyperparams::_internal_has_epsilon() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline ::std::string* NodeData::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline bool Hyperparams::has_epsilon() const {
+  return _internal_has_epsilon();
 }
-inline ::std::string* NodeData::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void Hyperparams::clear_epsilon() {
+  _impl_.epsilon_ = 1e-08f;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void NodeData::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
+inline float Hyperparams::_internal_epsilon() const {
+  return _impl_.epsilon_;
+}
+inline float Hyperparams::epsilon() const {
+  // @@protoc_insertion_point(field_get:model.Hyperparams.epsilon)
+  return _internal_epsilon();
+}
+inline void Hyperparams::_internal_set_epsilon(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.epsilon_ = value;
+}
+inline void Hyperparams::set_epsilon(float value) {
+  _internal_set_epsilon(value);
+  // @@protoc_insertion_point(field_set:model.Hyperparams.epsilon)
+}
+
+// -------------------------------------------------------------------
+
+// NodeData
+
+// required string name = 1;
+inline bool NodeData::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool NodeData::has_name() const {
+  return _internal_has_name();
+}
+inline void NodeData::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& NodeData::name() const {
+  // @@protoc_insertion_point(field_get:model.NodeData.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeData::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.NodeData.name)
+}
+inline std::string* NodeData::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:model.NodeData.name)
+  return _s;
+}
+inline const std::string& NodeData::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void NodeData::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeData::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeData::release_name() {
+  // @@protoc_insertion_point(field_release:model.NodeData.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void NodeData::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.NodeData.name)
 }
 
 // required .model.NodeData.NodeType type = 2;
-inline bool NodeData::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool NodeData::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void NodeData::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void NodeData::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool NodeData::has_type() const {
+  return _internal_has_type();
 }
 inline void NodeData::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::model::NodeData_NodeType NodeData::_internal_type() const {
+  return static_cast< ::model::NodeData_NodeType >(_impl_.type_);
 }
 inline ::model::NodeData_NodeType NodeData::type() const {
-  return static_cast< ::model::NodeData_NodeType >(type_);
+  // @@protoc_insertion_point(field_get:model.NodeData.type)
+  return _internal_type();
 }
-inline void NodeData::set_type(::model::NodeData_NodeType value) {
+inline void NodeData::_internal_set_type(::model::NodeData_NodeType value) {
   assert(::model::NodeData_NodeType_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.type_ = value;
+}
+inline void NodeData::set_type(::model::NodeData_NodeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:model.NodeData.type)
 }
 
 // required int32 dimension = 3;
+inline bool NodeData::_internal_has_dimension() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool NodeData::has_dimension() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_dimension();
 }
-inline void NodeData::set_has_dimension() {
-  _has_bits_[0] |= 0x00000004u;
+inline void NodeData::clear_dimension() {
+  _impl_.dimension_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void NodeData::clear_has_dimension() {
-  _has_bits_[0] &= ~0x00000004u;
+inline int32_t NodeData::_internal_dimension() const {
+  return _impl_.dimension_;
 }
-inline void NodeData::clear_dimension() {
-  dimension_ = 0;
-  clear_has_dimension();
+inline int32_t NodeData::dimension() const {
+  // @@protoc_insertion_point(field_get:model.NodeData.dimension)
+  return _internal_dimension();
 }
-inline ::google::protobuf::int32 NodeData::dimension() const {
-  return dimension_;
+inline void NodeData::_internal_set_dimension(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.dimension_ = value;
 }
-inline void NodeData::set_dimension(::google::protobuf::int32 value) {
-  set_has_dimension();
-  dimension_ = value;
+inline void NodeData::set_dimension(int32_t value) {
+  _internal_set_dimension(value);
+  // @@protoc_insertion_point(field_set:model.NodeData.dimension)
 }
 
 // optional int32 input_start_index = 4;
+inline bool NodeData::_internal_has_input_start_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool NodeData::has_input_start_index() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_input_start_index();
 }
-inline void NodeData::set_has_input_start_index() {
-  _has_bits_[0] |= 0x00000008u;
+inline void NodeData::clear_input_start_index() {
+  _impl_.input_start_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void NodeData::clear_has_input_start_index() {
-  _has_bits_[0] &= ~0x00000008u;
+inline int32_t NodeData::_internal_input_start_index() const {
+  return _impl_.input_start_index_;
 }
-inline void NodeData::clear_input_start_index() {
-  input_start_index_ = 0;
-  clear_has_input_start_index();
+inline int32_t NodeData::input_start_index() const {
+  // @@protoc_insertion_point(field_get:model.NodeData.input_start_index)
+  return _internal_input_start_index();
 }
-inline ::google::protobuf::int32 NodeData::input_start_index() const {
-  return input_start_index_;
+inline void NodeData::_internal_set_input_start_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.input_start_index_ = value;
 }
-inline void NodeData::set_input_start_index(::google::protobuf::int32 value) {
-  set_has_input_start_index();
-  input_start_index_ = value;
+inline void NodeData::set_input_start_index(int32_t value) {
+  _internal_set_input_start_index(value);
+  // @@protoc_insertion_point(field_set:model.NodeData.input_start_index)
 }
 
 // optional bytes bias = 5;
-inline bool NodeData::has_bias() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void NodeData::set_has_bias() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool NodeData::_internal_has_bias() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void NodeData::clear_has_bias() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool NodeData::has_bias() const {
+  return _internal_has_bias();
 }
 inline void NodeData::clear_bias() {
-  if (bias_ != &::google::protobuf::internal::kEmptyString) {
-    bias_->clear();
-  }
-  clear_has_bias();
-}
-inline const ::std::string& NodeData::bias() const {
-  return *bias_;
-}
-inline void NodeData::set_bias(const ::std::string& value) {
-  set_has_bias();
-  if (bias_ == &::google::protobuf::internal::kEmptyString) {
-    bias_ = new ::std::string;
-  }
-  bias_->assign(value);
-}
-inline void NodeData::set_bias(const char* value) {
-  set_has_bias();
-  if (bias_ == &::google::protobuf::internal::kEmptyString) {
-    bias_ = new ::std::string;
-  }
-  bias_->assign(value);
-}
-inline void NodeData::set_bias(const void* value, size_t size) {
-  set_has_bias();
-  if (bias_ == &::google::protobuf::internal::kEmptyString) {
-    bias_ = new ::std::string;
-  }
-  bias_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* NodeData::mutable_bias() {
-  set_has_bias();
-  if (bias_ == &::google::protobuf::internal::kEmptyString) {
-    bias_ = new ::std::string;
-  }
-  return bias_;
-}
-inline ::std::string* NodeData::release_bias() {
-  clear_has_bias();
-  if (bias_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.bias_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& NodeData::bias() const {
+  // @@protoc_insertion_point(field_get:model.NodeData.bias)
+  return _internal_bias();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeData::set_bias(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.bias_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.NodeData.bias)
+}
+inline std::string* NodeData::mutable_bias() {
+  std::string* _s = _internal_mutable_bias();
+  // @@protoc_insertion_point(field_mutable:model.NodeData.bias)
+  return _s;
+}
+inline const std::string& NodeData::_internal_bias() const {
+  return _impl_.bias_.Get();
+}
+inline void NodeData::_internal_set_bias(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bias_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeData::_internal_mutable_bias() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.bias_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeData::release_bias() {
+  // @@protoc_insertion_point(field_release:model.NodeData.bias)
+  if (!_internal_has_bias()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.bias_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bias_.IsDefault()) {
+    _impl_.bias_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void NodeData::set_allocated_bias(std::string* bias) {
+  if (bias != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = bias_;
-    bias_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void NodeData::set_allocated_bias(::std::string* bias) {
-  if (bias_ != &::google::protobuf::internal::kEmptyString) {
-    delete bias_;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  if (bias) {
-    set_has_bias();
-    bias_ = bias;
-  } else {
-    clear_has_bias();
-    bias_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.bias_.SetAllocated(bias, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bias_.IsDefault()) {
+    _impl_.bias_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.NodeData.bias)
 }
 
-// optional .model.Hyperparams hyper_params = 6;
-inline bool NodeData::has_hyper_params() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void NodeData::set_has_hyper_params() {
-  _has_bits_[0] |= 0x00000020u;
+// optional .model.Hyperparams hyper_params = 6;
+inline bool NodeData::_internal_has_hyper_params() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hyper_params_ != nullptr);
+  return value;
 }
-inline void NodeData::clear_has_hyper_params() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool NodeData::has_hyper_params() const {
+  return _internal_has_hyper_params();
 }
 inline void NodeData::clear_hyper_params() {
-  if (hyper_params_ != NULL) hyper_params_->::model::Hyperparams::Clear();
-  clear_has_hyper_params();
+  if (_impl_.hyper_params_ != nullptr) _impl_.hyper_params_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::model::Hyperparams& NodeData::_internal_hyper_params() const {
+  const ::model::Hyperparams* p = _impl_.hyper_params_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Hyperparams&>(
+      ::model::_Hyperparams_default_instance_);
 }
 inline const ::model::Hyperparams& NodeData::hyper_params() const {
-  return hyper_params_ != NULL ? *hyper_params_ : *default_instance_->hyper_params_;
+  // @@protoc_insertion_point(field_get:model.NodeData.hyper_params)
+  return _internal_hyper_params();
 }
-inline ::model::Hyperparams* NodeData::mutable_hyper_params() {
-  set_has_hyper_params();
-  if (hyper_params_ == NULL) hyper_params_ = new ::model::Hyperparams;
-  return hyper_params_;
+inline void NodeData::unsafe_arena_set_allocated_hyper_params(
+    ::model::Hyperparams* hyper_params) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hyper_params_);
+  }
+  _impl_.hyper_params_ = hyper_params;
+  if (hyper_params) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.NodeData.hyper_params)
 }
 inline ::model::Hyperparams* NodeData::release_hyper_params() {
-  clear_has_hyper_params();
-  ::model::Hyperparams* temp = hyper_params_;
-  hyper_params_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::model::Hyperparams* temp = _impl_.hyper_params_;
+  _impl_.hyper_params_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::model::Hyperparams* NodeData::unsafe_arena_release_hyper_params() {
+  // @@protoc_insertion_point(field_release:model.NodeData.hyper_params)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::model::Hyperparams* temp = _impl_.hyper_params_;
+  _impl_.hyper_params_ = nullptr;
+  return temp;
+}
+inline ::model::Hyperparams* NodeData::_internal_mutable_hyper_params() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.hyper_params_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Hyperparams>(GetArenaForAllocation());
+    _impl_.hyper_params_ = p;
+  }
+  return _impl_.hyper_params_;
+}
+inline ::model::Hyperparams* NodeData::mutable_hyper_params() {
+  ::model::Hyperparams* _msg = _internal_mutable_hyper_params();
+  // @@protoc_insertion_point(field_mutable:model.NodeData.hyper_params)
+  return _msg;
+}
 inline void NodeData::set_allocated_hyper_params(::model::Hyperparams* hyper_params) {
-  delete hyper_params_;
-  hyper_params_ = hyper_params;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hyper_params_;
+  }
   if (hyper_params) {
-    set_has_hyper_params();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hyper_params);
+    if (message_arena != submessage_arena) {
+      hyper_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hyper_params, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_hyper_params();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.hyper_params_ = hyper_params;
+  // @@protoc_insertion_point(field_set_allocated:model.NodeData.hyper_params)
 }
 
 // -------------------------------------------------------------------
@@ -2693,273 +4877,325 @@ inline void NodeData::set_allocated_hyper_params(::model::Hyperparams* hyper_par
 // EdgeData
 
 // optional bool directed = 1 [default = true];
-inline bool EdgeData::has_directed() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool EdgeData::_internal_has_directed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void EdgeData::set_has_directed() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void EdgeData::clear_has_directed() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool EdgeData::has_directed() const {
+  return _internal_has_directed();
 }
 inline void EdgeData::clear_directed() {
-  directed_ = true;
-  clear_has_directed();
+  _impl_.directed_ = true;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool EdgeData::_internal_directed() const {
+  return _impl_.directed_;
 }
 inline bool EdgeData::directed() const {
-  return directed_;
+  // @@protoc_insertion_point(field_get:model.EdgeData.directed)
+  return _internal_directed();
+}
+inline void EdgeData::_internal_set_directed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.directed_ = value;
 }
 inline void EdgeData::set_directed(bool value) {
-  set_has_directed();
-  directed_ = value;
+  _internal_set_directed(value);
+  // @@protoc_insertion_point(field_set:model.EdgeData.directed)
 }
 
 // optional bytes weight = 2;
-inline bool EdgeData::has_weight() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void EdgeData::set_has_weight() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool EdgeData::_internal_has_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void EdgeData::clear_has_weight() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool EdgeData::has_weight() const {
+  return _internal_has_weight();
 }
 inline void EdgeData::clear_weight() {
-  if (weight_ != &::google::protobuf::internal::kEmptyString) {
-    weight_->clear();
-  }
-  clear_has_weight();
-}
-inline const ::std::string& EdgeData::weight() const {
-  return *weight_;
-}
-inline void EdgeData::set_weight(const ::std::string& value) {
-  set_has_weight();
-  if (weight_ == &::google::protobuf::internal::kEmptyString) {
-    weight_ = new ::std::string;
-  }
-  weight_->assign(value);
-}
-inline void EdgeData::set_weight(const char* value) {
-  set_has_weight();
-  if (weight_ == &::google::protobuf::internal::kEmptyString) {
-    weight_ = new ::std::string;
-  }
-  weight_->assign(value);
-}
-inline void EdgeData::set_weight(const void* value, size_t size) {
-  set_has_weight();
-  if (weight_ == &::google::protobuf::internal::kEmptyString) {
-    weight_ = new ::std::string;
-  }
-  weight_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* EdgeData::mutable_weight() {
-  set_has_weight();
-  if (weight_ == &::google::protobuf::internal::kEmptyString) {
-    weight_ = new ::std::string;
-  }
-  return weight_;
-}
-inline ::std::string* EdgeData::release_weight() {
-  clear_has_weight();
-  if (weight_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.weight_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EdgeData::weight() const {
+  // @@protoc_insertion_point(field_get:model.EdgeData.weight)
+  return _internal_weight();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EdgeData::set_weight(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.weight_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.EdgeData.weight)
+}
+inline std::string* EdgeData::mutable_weight() {
+  std::string* _s = _internal_mutable_weight();
+  // @@protoc_insertion_point(field_mutable:model.EdgeData.weight)
+  return _s;
+}
+inline const std::string& EdgeData::_internal_weight() const {
+  return _impl_.weight_.Get();
+}
+inline void EdgeData::_internal_set_weight(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.weight_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EdgeData::_internal_mutable_weight() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.weight_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EdgeData::release_weight() {
+  // @@protoc_insertion_point(field_release:model.EdgeData.weight)
+  if (!_internal_has_weight()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.weight_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weight_.IsDefault()) {
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EdgeData::set_allocated_weight(std::string* weight) {
+  if (weight != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = weight_;
-    weight_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void EdgeData::set_allocated_weight(::std::string* weight) {
-  if (weight_ != &::google::protobuf::internal::kEmptyString) {
-    delete weight_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (weight) {
-    set_has_weight();
-    weight_ = weight;
-  } else {
-    clear_has_weight();
-    weight_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.weight_.SetAllocated(weight, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weight_.IsDefault()) {
+    _impl_.weight_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.EdgeData.weight)
 }
 
 // optional string node1 = 3;
-inline bool EdgeData::has_node1() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool EdgeData::_internal_has_node1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void EdgeData::set_has_node1() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void EdgeData::clear_has_node1() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool EdgeData::has_node1() const {
+  return _internal_has_node1();
 }
 inline void EdgeData::clear_node1() {
-  if (node1_ != &::google::protobuf::internal::kEmptyString) {
-    node1_->clear();
-  }
-  clear_has_node1();
-}
-inline const ::std::string& EdgeData::node1() const {
-  return *node1_;
-}
-inline void EdgeData::set_node1(const ::std::string& value) {
-  set_has_node1();
-  if (node1_ == &::google::protobuf::internal::kEmptyString) {
-    node1_ = new ::std::string;
-  }
-  node1_->assign(value);
-}
-inline void EdgeData::set_node1(const char* value) {
-  set_has_node1();
-  if (node1_ == &::google::protobuf::internal::kEmptyString) {
-    node1_ = new ::std::string;
-  }
-  node1_->assign(value);
-}
-inline void EdgeData::set_node1(const char* value, size_t size) {
-  set_has_node1();
-  if (node1_ == &::google::protobuf::internal::kEmptyString) {
-    node1_ = new ::std::string;
-  }
-  node1_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* EdgeData::mutable_node1() {
-  set_has_node1();
-  if (node1_ == &::google::protobuf::internal::kEmptyString) {
-    node1_ = new ::std::string;
-  }
-  return node1_;
-}
-inline ::std::string* EdgeData::release_node1() {
-  clear_has_node1();
-  if (node1_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.node1_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& EdgeData::node1() const {
+  // @@protoc_insertion_point(field_get:model.EdgeData.node1)
+  return _internal_node1();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EdgeData::set_node1(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.node1_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.EdgeData.node1)
+}
+inline std::string* EdgeData::mutable_node1() {
+  std::string* _s = _internal_mutable_node1();
+  // @@protoc_insertion_point(field_mutable:model.EdgeData.node1)
+  return _s;
+}
+inline const std::string& EdgeData::_internal_node1() const {
+  return _impl_.node1_.Get();
+}
+inline void EdgeData::_internal_set_node1(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.node1_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EdgeData::_internal_mutable_node1() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.node1_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EdgeData::release_node1() {
+  // @@protoc_insertion_point(field_release:model.EdgeData.node1)
+  if (!_internal_has_node1()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.node1_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node1_.IsDefault()) {
+    _impl_.node1_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EdgeData::set_allocated_node1(std::string* node1) {
+  if (node1 != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = node1_;
-    node1_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void EdgeData::set_allocated_node1(::std::string* node1) {
-  if (node1_ != &::google::protobuf::internal::kEmptyString) {
-    delete node1_;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  if (node1) {
-    set_has_node1();
-    node1_ = node1;
-  } else {
-    clear_has_node1();
-    node1_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.node1_.SetAllocated(node1, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node1_.IsDefault()) {
+    _impl_.node1_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.EdgeData.node1)
 }
 
 // optional string node2 = 4;
-inline bool EdgeData::has_node2() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void EdgeData::set_has_node2() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool EdgeData::_internal_has_node2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void EdgeData::clear_has_node2() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool EdgeData::has_node2() const {
+  return _internal_has_node2();
 }
 inline void EdgeData::clear_node2() {
-  if (node2_ != &::google::protobuf::internal::kEmptyString) {
-    node2_->clear();
-  }
-  clear_has_node2();
-}
-inline const ::std::string& EdgeData::node2() const {
-  return *node2_;
-}
-inline void EdgeData::set_node2(const ::std::string& value) {
-  set_has_node2();
-  if (node2_ == &::google::protobuf::internal::kEmptyString) {
-    node2_ = new ::std::string;
-  }
-  node2_->assign(value);
-}
-inline void EdgeData::set_node2(const char* value) {
-  set_has_node2();
-  if (node2_ == &::google::protobuf::internal::kEmptyString) {
-    node2_ = new ::std::string;
-  }
-  node2_->assign(value);
-}
-inline void EdgeData::set_node2(const char* value, size_t size) {
-  set_has_node2();
-  if (node2_ == &::google::protobuf::internal::kEmptyString) {
-    node2_ = new ::std::string;
-  }
-  node2_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* EdgeData::mutable_node2() {
-  set_has_node2();
-  if (node2_ == &::google::protobuf::internal::kEmptyString) {
-    node2_ = new ::std::string;
-  }
-  return node2_;
-}
-inline ::std::string* EdgeData::release_node2() {
-  clear_has_node2();
-  if (node2_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.node2_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& EdgeData::node2() const {
+  // @@protoc_insertion_point(field_get:model.EdgeData.node2)
+  return _internal_node2();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EdgeData::set_node2(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.node2_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.EdgeData.node2)
+}
+inline std::string* EdgeData::mutable_node2() {
+  std::string* _s = _internal_mutable_node2();
+  // @@protoc_insertion_point(field_mutable:model.EdgeData.node2)
+  return _s;
+}
+inline const std::string& EdgeData::_internal_node2() const {
+  return _impl_.node2_.Get();
+}
+inline void EdgeData::_internal_set_node2(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.node2_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EdgeData::_internal_mutable_node2() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.node2_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EdgeData::release_node2() {
+  // @@protoc_insertion_point(field_release:model.EdgeData.node2)
+  if (!_internal_has_node2()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.node2_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node2_.IsDefault()) {
+    _impl_.node2_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EdgeData::set_allocated_node2(std::string* node2) {
+  if (node2 != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    ::std::string* temp = node2_;
-    node2_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-}
-inline void EdgeData::set_allocated_node2(::std::string* node2) {
-  if (node2_ != &::google::protobuf::internal::kEmptyString) {
-    delete node2_;
-  }
-  if (node2) {
-    set_has_node2();
-    node2_ = node2;
-  } else {
-    clear_has_node2();
-    node2_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.node2_.SetAllocated(node2, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node2_.IsDefault()) {
+    _impl_.node2_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.EdgeData.node2)
 }
 
 // optional .model.Hyperparams hyper_params = 5;
-inline bool EdgeData::has_hyper_params() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool EdgeData::_internal_has_hyper_params() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hyper_params_ != nullptr);
+  return value;
 }
-inline void EdgeData::set_has_hyper_params() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void EdgeData::clear_has_hyper_params() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool EdgeData::has_hyper_params() const {
+  return _internal_has_hyper_params();
 }
 inline void EdgeData::clear_hyper_params() {
-  if (hyper_params_ != NULL) hyper_params_->::model::Hyperparams::Clear();
-  clear_has_hyper_params();
+  if (_impl_.hyper_params_ != nullptr) _impl_.hyper_params_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::model::Hyperparams& EdgeData::_internal_hyper_params() const {
+  const ::model::Hyperparams* p = _impl_.hyper_params_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Hyperparams&>(
+      ::model::_Hyperparams_default_instance_);
 }
 inline const ::model::Hyperparams& EdgeData::hyper_params() const {
-  return hyper_params_ != NULL ? *hyper_params_ : *default_instance_->hyper_params_;
+  // @@protoc_insertion_point(field_get:model.EdgeData.hyper_params)
+  return _internal_hyper_params();
 }
-inline ::model::Hyperparams* EdgeData::mutable_hyper_params() {
-  set_has_hyper_params();
-  if (hyper_params_ == NULL) hyper_params_ = new ::model::Hyperparams;
-  return hyper_params_;
+inline void EdgeData::unsafe_arena_set_allocated_hyper_params(
+    ::model::Hyperparams* hyper_params) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hyper_params_);
+  }
+  _impl_.hyper_params_ = hyper_params;
+  if (hyper_params) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.EdgeData.hyper_params)
 }
 inline ::model::Hyperparams* EdgeData::release_hyper_params() {
-  clear_has_hyper_params();
-  ::model::Hyperparams* temp = hyper_params_;
-  hyper_params_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::model::Hyperparams* temp = _impl_.hyper_params_;
+  _impl_.hyper_params_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::model::Hyperparams* EdgeData::unsafe_arena_release_hyper_params() {
+  // @@protoc_insertion_point(field_release:model.EdgeData.hyper_params)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::model::Hyperparams* temp = _impl_.hyper_params_;
+  _impl_.hyper_params_ = nullptr;
+  return temp;
+}
+inline ::model::Hyperparams* EdgeData::_internal_mutable_hyper_params() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.hyper_params_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Hyperparams>(GetArenaForAllocation());
+    _impl_.hyper_params_ = p;
+  }
+  return _impl_.hyper_params_;
+}
+inline ::model::Hyperparams* EdgeData::mutable_hyper_params() {
+  ::model::Hyperparams* _msg = _internal_mutable_hyper_params();
+  // @@protoc_insertion_point(field_mutable:model.EdgeData.hyper_params)
+  return _msg;
+}
 inline void EdgeData::set_allocated_hyper_params(::model::Hyperparams* hyper_params) {
-  delete hyper_params_;
-  hyper_params_ = hyper_params;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hyper_params_;
+  }
   if (hyper_params) {
-    set_has_hyper_params();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hyper_params);
+    if (message_arena != submessage_arena) {
+      hyper_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hyper_params, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_hyper_params();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.hyper_params_ = hyper_params;
+  // @@protoc_insertion_point(field_set_allocated:model.EdgeData.hyper_params)
 }
 
 // -------------------------------------------------------------------
@@ -2967,970 +5203,1704 @@ inline void EdgeData::set_allocated_hyper_params(::model::Hyperparams* hyper_par
 // SpnLayerInit
 
 // required string name = 1;
-inline bool SpnLayerInit::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool SpnLayerInit::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void SpnLayerInit::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SpnLayerInit::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SpnLayerInit::has_name() const {
+  return _internal_has_name();
 }
 inline void SpnLayerInit::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& SpnLayerInit::name() const {
-  return *name_;
-}
-inline void SpnLayerInit::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void SpnLayerInit::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void SpnLayerInit::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* SpnLayerInit::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
-}
-inline ::std::string* SpnLayerInit::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SpnLayerInit::name() const {
+  // @@protoc_insertion_point(field_get:model.SpnLayerInit.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpnLayerInit::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.SpnLayerInit.name)
+}
+inline std::string* SpnLayerInit::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:model.SpnLayerInit.name)
+  return _s;
+}
+inline const std::string& SpnLayerInit::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SpnLayerInit::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpnLayerInit::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpnLayerInit::release_name() {
+  // @@protoc_insertion_point(field_release:model.SpnLayerInit.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpnLayerInit::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void SpnLayerInit::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.SpnLayerInit.name)
 }
 
 // optional .model.NodeData.NodeType type = 2;
-inline bool SpnLayerInit::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SpnLayerInit::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool SpnLayerInit::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void SpnLayerInit::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool SpnLayerInit::has_type() const {
+  return _internal_has_type();
 }
 inline void SpnLayerInit::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::model::NodeData_NodeType SpnLayerInit::_internal_type() const {
+  return static_cast< ::model::NodeData_NodeType >(_impl_.type_);
 }
 inline ::model::NodeData_NodeType SpnLayerInit::type() const {
-  return static_cast< ::model::NodeData_NodeType >(type_);
+  // @@protoc_insertion_point(field_get:model.SpnLayerInit.type)
+  return _internal_type();
 }
-inline void SpnLayerInit::set_type(::model::NodeData_NodeType value) {
+inline void SpnLayerInit::_internal_set_type(::model::NodeData_NodeType value) {
   assert(::model::NodeData_NodeType_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.type_ = value;
+}
+inline void SpnLayerInit::set_type(::model::NodeData_NodeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:model.SpnLayerInit.type)
 }
 
 // optional int32 size = 3;
+inline bool SpnLayerInit::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool SpnLayerInit::has_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_size();
 }
-inline void SpnLayerInit::set_has_size() {
-  _has_bits_[0] |= 0x00000004u;
+inline void SpnLayerInit::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void SpnLayerInit::clear_has_size() {
-  _has_bits_[0] &= ~0x00000004u;
+inline int32_t SpnLayerInit::_internal_size() const {
+  return _impl_.size_;
 }
-inline void SpnLayerInit::clear_size() {
-  size_ = 0;
-  clear_has_size();
+inline int32_t SpnLayerInit::size() const {
+  // @@protoc_insertion_point(field_get:model.SpnLayerInit.size)
+  return _internal_size();
 }
-inline ::google::protobuf::int32 SpnLayerInit::size() const {
-  return size_;
+inline void SpnLayerInit::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.size_ = value;
 }
-inline void SpnLayerInit::set_size(::google::protobuf::int32 value) {
-  set_has_size();
-  size_ = value;
+inline void SpnLayerInit::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:model.SpnLayerInit.size)
 }
 
 // optional int32 product_combinations = 4 [default = 3];
+inline bool SpnLayerInit::_internal_has_product_combinations() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool SpnLayerInit::has_product_combinations() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_product_combinations();
 }
-inline void SpnLayerInit::set_has_product_combinations() {
-  _has_bits_[0] |= 0x00000008u;
+inline void SpnLayerInit::clear_product_combinations() {
+  _impl_.product_combinations_ = 3;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void SpnLayerInit::clear_has_product_combinations() {
-  _has_bits_[0] &= ~0x00000008u;
+inline int32_t SpnLayerInit::_internal_product_combinations() const {
+  return _impl_.product_combinations_;
 }
-inline void SpnLayerInit::clear_product_combinations() {
-  product_combinations_ = 3;
-  clear_has_product_combinations();
+inline int32_t SpnLayerInit::product_combinations() const {
+  // @@protoc_insertion_point(field_get:model.SpnLayerInit.product_combinations)
+  return _internal_product_combinations();
 }
-inline ::google::protobuf::int32 SpnLayerInit::product_combinations() const {
-  return product_combinations_;
+inline void SpnLayerInit::_internal_set_product_combinations(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.product_combinations_ = value;
 }
-inline void SpnLayerInit::set_product_combinations(::google::protobuf::int32 value) {
-  set_has_product_combinations();
-  product_combinations_ = value;
+inline void SpnLayerInit::set_product_combinations(int32_t value) {
+  _internal_set_product_combinations(value);
+  // @@protoc_insertion_point(field_set:model.SpnLayerInit.product_combinations)
 }
 
 // optional string input_indices = 5;
-inline bool SpnLayerInit::has_input_indices() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool SpnLayerInit::_internal_has_input_indices() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void SpnLayerInit::set_has_input_indices() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void SpnLayerInit::clear_has_input_indices() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool SpnLayerInit::has_input_indices() const {
+  return _internal_has_input_indices();
 }
 inline void SpnLayerInit::clear_input_indices() {
-  if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-    input_indices_->clear();
+  _impl_.input_indices_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SpnLayerInit::input_indices() const {
+  // @@protoc_insertion_point(field_get:model.SpnLayerInit.input_indices)
+  return _internal_input_indices();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpnLayerInit::set_input_indices(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.input_indices_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.SpnLayerInit.input_indices)
+}
+inline std::string* SpnLayerInit::mutable_input_indices() {
+  std::string* _s = _internal_mutable_input_indices();
+  // @@protoc_insertion_point(field_mutable:model.SpnLayerInit.input_indices)
+  return _s;
+}
+inline const std::string& SpnLayerInit::_internal_input_indices() const {
+  return _impl_.input_indices_.Get();
+}
+inline void SpnLayerInit::_internal_set_input_indices(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.input_indices_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpnLayerInit::_internal_mutable_input_indices() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.input_indices_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpnLayerInit::release_input_indices() {
+  // @@protoc_insertion_point(field_release:model.SpnLayerInit.input_indices)
+  if (!_internal_has_input_indices()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.input_indices_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.input_indices_.IsDefault()) {
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpnLayerInit::set_allocated_input_indices(std::string* input_indices) {
+  if (input_indices != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.input_indices_.SetAllocated(input_indices, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.input_indices_.IsDefault()) {
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
   }
-  clear_has_input_indices();
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.SpnLayerInit.input_indices)
 }
-inline const ::std::string& SpnLayerInit::input_indices() const {
-  return *input_indices_;
+
+// optional string node_list = 6;
+inline bool SpnLayerInit::_internal_has_node_list() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void SpnLayerInit::set_input_indices(const ::std::string& value) {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
-  }
-  input_indices_->assign(value);
+inline bool SpnLayerInit::has_node_list() const {
+  return _internal_has_node_list();
 }
-inline void SpnLayerInit::set_input_indices(const char* value) {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
+inline void SpnLayerInit::clear_node_list() {
+  _impl_.node_list_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& SpnLayerInit::node_list() const {
+  // @@protoc_insertion_point(field_get:model.SpnLayerInit.node_list)
+  return _internal_node_list();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpnLayerInit::set_node_list(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.node_list_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.SpnLayerInit.node_list)
+}
+inline std::string* SpnLayerInit::mutable_node_list() {
+  std::string* _s = _internal_mutable_node_list();
+  // @@protoc_insertion_point(field_mutable:model.SpnLayerInit.node_list)
+  return _s;
+}
+inline const std::string& SpnLayerInit::_internal_node_list() const {
+  return _impl_.node_list_.Get();
+}
+inline void SpnLayerInit::_internal_set_node_list(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.node_list_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpnLayerInit::_internal_mutable_node_list() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.node_list_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpnLayerInit::release_node_list() {
+  // @@protoc_insertion_point(field_release:model.SpnLayerInit.node_list)
+  if (!_internal_has_node_list()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.node_list_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_list_.IsDefault()) {
+    _impl_.node_list_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpnLayerInit::set_allocated_node_list(std::string* node_list) {
+  if (node_list != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  input_indices_->assign(value);
-}
-inline void SpnLayerInit::set_input_indices(const char* value, size_t size) {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
+  _impl_.node_list_.SetAllocated(node_list, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_list_.IsDefault()) {
+    _impl_.node_list_.Set("", GetArenaForAllocation());
   }
-  input_indices_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.SpnLayerInit.node_list)
 }
-inline ::std::string* SpnLayerInit::mutable_input_indices() {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
-  }
-  return input_indices_;
+
+// -------------------------------------------------------------------
+
+// SpnData
+
+// optional string node_list = 1;
+inline bool SpnData::_internal_has_node_list() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* SpnLayerInit::release_input_indices() {
-  clear_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline bool SpnData::has_node_list() const {
+  return _internal_has_node_list();
+}
+inline void SpnData::clear_node_list() {
+  _impl_.node_list_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SpnData::node_list() const {
+  // @@protoc_insertion_point(field_get:model.SpnData.node_list)
+  return _internal_node_list();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpnData::set_node_list(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.node_list_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.SpnData.node_list)
+}
+inline std::string* SpnData::mutable_node_list() {
+  std::string* _s = _internal_mutable_node_list();
+  // @@protoc_insertion_point(field_mutable:model.SpnData.node_list)
+  return _s;
+}
+inline const std::string& SpnData::_internal_node_list() const {
+  return _impl_.node_list_.Get();
+}
+inline void SpnData::_internal_set_node_list(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.node_list_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpnData::_internal_mutable_node_list() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.node_list_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpnData::release_node_list() {
+  // @@protoc_insertion_point(field_release:model.SpnData.node_list)
+  if (!_internal_has_node_list()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.node_list_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_list_.IsDefault()) {
+    _impl_.node_list_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpnData::set_allocated_node_list(std::string* node_list) {
+  if (node_list != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = input_indices_;
-    input_indices_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void SpnLayerInit::set_allocated_input_indices(::std::string* input_indices) {
-  if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-    delete input_indices_;
+  _impl_.node_list_.SetAllocated(node_list, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_list_.IsDefault()) {
+    _impl_.node_list_.Set("", GetArenaForAllocation());
   }
-  if (input_indices) {
-    set_has_input_indices();
-    input_indices_ = input_indices;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.SpnData.node_list)
+}
+
+// optional string adjacency_matrix = 2;
+inline bool SpnData::_internal_has_adjacency_matrix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SpnData::has_adjacency_matrix() const {
+  return _internal_has_adjacency_matrix();
+}
+inline void SpnData::clear_adjacency_matrix() {
+  _impl_.adjacency_matrix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SpnData::adjacency_matrix() const {
+  // @@protoc_insertion_point(field_get:model.SpnData.adjacency_matrix)
+  return _internal_adjacency_matrix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpnData::set_adjacency_matrix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.adjacency_matrix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.SpnData.adjacency_matrix)
+}
+inline std::string* SpnData::mutable_adjacency_matrix() {
+  std::string* _s = _internal_mutable_adjacency_matrix();
+  // @@protoc_insertion_point(field_mutable:model.SpnData.adjacency_matrix)
+  return _s;
+}
+inline const std::string& SpnData::_internal_adjacency_matrix() const {
+  return _impl_.adjacency_matrix_.Get();
+}
+inline void SpnData::_internal_set_adjacency_matrix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.adjacency_matrix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpnData::_internal_mutable_adjacency_matrix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.adjacency_matrix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpnData::release_adjacency_matrix() {
+  // @@protoc_insertion_point(field_release:model.SpnData.adjacency_matrix)
+  if (!_internal_has_adjacency_matrix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.adjacency_matrix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.adjacency_matrix_.IsDefault()) {
+    _impl_.adjacency_matrix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpnData::set_allocated_adjacency_matrix(std::string* adjacency_matrix) {
+  if (adjacency_matrix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_input_indices();
-    input_indices_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.adjacency_matrix_.SetAllocated(adjacency_matrix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.adjacency_matrix_.IsDefault()) {
+    _impl_.adjacency_matrix_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.SpnData.adjacency_matrix)
 }
 
-// optional string node_list = 6;
-inline bool SpnLayerInit::has_node_list() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void SpnLayerInit::set_has_node_list() {
-  _has_bits_[0] |= 0x00000020u;
+// optional string input_indices = 3;
+inline bool SpnData::_internal_has_input_indices() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void SpnLayerInit::clear_has_node_list() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool SpnData::has_input_indices() const {
+  return _internal_has_input_indices();
 }
-inline void SpnLayerInit::clear_node_list() {
-  if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-    node_list_->clear();
+inline void SpnData::clear_input_indices() {
+  _impl_.input_indices_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& SpnData::input_indices() const {
+  // @@protoc_insertion_point(field_get:model.SpnData.input_indices)
+  return _internal_input_indices();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpnData::set_input_indices(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.input_indices_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.SpnData.input_indices)
+}
+inline std::string* SpnData::mutable_input_indices() {
+  std::string* _s = _internal_mutable_input_indices();
+  // @@protoc_insertion_point(field_mutable:model.SpnData.input_indices)
+  return _s;
+}
+inline const std::string& SpnData::_internal_input_indices() const {
+  return _impl_.input_indices_.Get();
+}
+inline void SpnData::_internal_set_input_indices(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.input_indices_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpnData::_internal_mutable_input_indices() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.input_indices_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpnData::release_input_indices() {
+  // @@protoc_insertion_point(field_release:model.SpnData.input_indices)
+  if (!_internal_has_input_indices()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.input_indices_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.input_indices_.IsDefault()) {
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpnData::set_allocated_input_indices(std::string* input_indices) {
+  if (input_indices != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  clear_has_node_list();
+  _impl_.input_indices_.SetAllocated(input_indices, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.input_indices_.IsDefault()) {
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.SpnData.input_indices)
 }
-inline const ::std::string& SpnLayerInit::node_list() const {
-  return *node_list_;
+
+// repeated .model.SpnLayerInit layers = 4;
+inline int SpnData::_internal_layers_size() const {
+  return _impl_.layers_.size();
 }
-inline void SpnLayerInit::set_node_list(const ::std::string& value) {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  node_list_->assign(value);
+inline int SpnData::layers_size() const {
+  return _internal_layers_size();
 }
-inline void SpnLayerInit::set_node_list(const char* value) {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  node_list_->assign(value);
+inline void SpnData::clear_layers() {
+  _impl_.layers_.Clear();
 }
-inline void SpnLayerInit::set_node_list(const char* value, size_t size) {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  node_list_->assign(reinterpret_cast<const char*>(value), size);
+inline ::model::SpnLayerInit* SpnData::mutable_layers(int index) {
+  // @@protoc_insertion_point(field_mutable:model.SpnData.layers)
+  return _impl_.layers_.Mutable(index);
 }
-inline ::std::string* SpnLayerInit::mutable_node_list() {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  return node_list_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::SpnLayerInit >*
+SpnData::mutable_layers() {
+  // @@protoc_insertion_point(field_mutable_list:model.SpnData.layers)
+  return &_impl_.layers_;
 }
-inline ::std::string* SpnLayerInit::release_node_list() {
-  clear_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = node_list_;
-    node_list_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::model::SpnLayerInit& SpnData::_internal_layers(int index) const {
+  return _impl_.layers_.Get(index);
 }
-inline void SpnLayerInit::set_allocated_node_list(::std::string* node_list) {
-  if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-    delete node_list_;
-  }
-  if (node_list) {
-    set_has_node_list();
-    node_list_ = node_list;
-  } else {
-    clear_has_node_list();
-    node_list_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline const ::model::SpnLayerInit& SpnData::layers(int index) const {
+  // @@protoc_insertion_point(field_get:model.SpnData.layers)
+  return _internal_layers(index);
+}
+inline ::model::SpnLayerInit* SpnData::_internal_add_layers() {
+  return _impl_.layers_.Add();
+}
+inline ::model::SpnLayerInit* SpnData::add_layers() {
+  ::model::SpnLayerInit* _add = _internal_add_layers();
+  // @@protoc_insertion_point(field_add:model.SpnData.layers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::SpnLayerInit >&
+SpnData::layers() const {
+  // @@protoc_insertion_point(field_list:model.SpnData.layers)
+  return _impl_.layers_;
 }
 
-// -------------------------------------------------------------------
-
-// SpnData
+// optional bool log_space = 5 [default = false];
+inline bool SpnData::_internal_has_log_space() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SpnData::has_log_space() const {
+  return _internal_has_log_space();
+}
+inline void SpnData::clear_log_space() {
+  _impl_.log_space_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool SpnData::_internal_log_space() const {
+  return _impl_.log_space_;
+}
+inline bool SpnData::log_space() const {
+  // @@protoc_insertion_point(field_get:model.SpnData.log_space)
+  return _internal_log_space();
+}
+inline void SpnData::_internal_set_log_space(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.log_space_ = value;
+}
+inline void SpnData::set_log_space(bool value) {
+  _internal_set_log_space(value);
+  // @@protoc_insertion_point(field_set:model.SpnData.log_space)
+}
 
-// optional string node_list = 1;
-inline bool SpnData::has_node_list() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// repeated int32 node_types = 6 [packed = true];
+inline int SpnData::_internal_node_types_size() const {
+  return _impl_.node_types_.size();
 }
-inline void SpnData::set_has_node_list() {
-  _has_bits_[0] |= 0x00000001u;
+inline int SpnData::node_types_size() const {
+  return _internal_node_types_size();
 }
-inline void SpnData::clear_has_node_list() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void SpnData::clear_node_types() {
+  _impl_.node_types_.Clear();
 }
-inline void SpnData::clear_node_list() {
-  if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-    node_list_->clear();
-  }
-  clear_has_node_list();
+inline int32_t SpnData::_internal_node_types(int index) const {
+  return _impl_.node_types_.Get(index);
 }
-inline const ::std::string& SpnData::node_list() const {
-  return *node_list_;
+inline int32_t SpnData::node_types(int index) const {
+  // @@protoc_insertion_point(field_get:model.SpnData.node_types)
+  return _internal_node_types(index);
 }
-inline void SpnData::set_node_list(const ::std::string& value) {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  node_list_->assign(value);
+inline void SpnData::set_node_types(int index, int32_t value) {
+  _impl_.node_types_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.SpnData.node_types)
 }
-inline void SpnData::set_node_list(const char* value) {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  node_list_->assign(value);
+inline void SpnData::_internal_add_node_types(int32_t value) {
+  _impl_.node_types_.Add(value);
 }
-inline void SpnData::set_node_list(const char* value, size_t size) {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  node_list_->assign(reinterpret_cast<const char*>(value), size);
+inline void SpnData::add_node_types(int32_t value) {
+  _internal_add_node_types(value);
+  // @@protoc_insertion_point(field_add:model.SpnData.node_types)
 }
-inline ::std::string* SpnData::mutable_node_list() {
-  set_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    node_list_ = new ::std::string;
-  }
-  return node_list_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::_internal_node_types() const {
+  return _impl_.node_types_;
 }
-inline ::std::string* SpnData::release_node_list() {
-  clear_has_node_list();
-  if (node_list_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = node_list_;
-    node_list_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::node_types() const {
+  // @@protoc_insertion_point(field_list:model.SpnData.node_types)
+  return _internal_node_types();
 }
-inline void SpnData::set_allocated_node_list(::std::string* node_list) {
-  if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-    delete node_list_;
-  }
-  if (node_list) {
-    set_has_node_list();
-    node_list_ = node_list;
-  } else {
-    clear_has_node_list();
-    node_list_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::_internal_mutable_node_types() {
+  return &_impl_.node_types_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::mutable_node_types() {
+  // @@protoc_insertion_point(field_mutable_list:model.SpnData.node_types)
+  return _internal_mutable_node_types();
 }
 
-// optional string adjacency_matrix = 2;
-inline bool SpnData::has_adjacency_matrix() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// repeated int32 node_inputs = 7 [packed = true];
+inline int SpnData::_internal_node_inputs_size() const {
+  return _impl_.node_inputs_.size();
 }
-inline void SpnData::set_has_adjacency_matrix() {
-  _has_bits_[0] |= 0x00000002u;
+inline int SpnData::node_inputs_size() const {
+  return _internal_node_inputs_size();
 }
-inline void SpnData::clear_has_adjacency_matrix() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void SpnData::clear_node_inputs() {
+  _impl_.node_inputs_.Clear();
 }
-inline void SpnData::clear_adjacency_matrix() {
-  if (adjacency_matrix_ != &::google::protobuf::internal::kEmptyString) {
-    adjacency_matrix_->clear();
-  }
-  clear_has_adjacency_matrix();
+inline int32_t SpnData::_internal_node_inputs(int index) const {
+  return _impl_.node_inputs_.Get(index);
 }
-inline const ::std::string& SpnData::adjacency_matrix() const {
-  return *adjacency_matrix_;
+inline int32_t SpnData::node_inputs(int index) const {
+  // @@protoc_insertion_point(field_get:model.SpnData.node_inputs)
+  return _internal_node_inputs(index);
 }
-inline void SpnData::set_adjacency_matrix(const ::std::string& value) {
-  set_has_adjacency_matrix();
-  if (adjacency_matrix_ == &::google::protobuf::internal::kEmptyString) {
-    adjacency_matrix_ = new ::std::string;
-  }
-  adjacency_matrix_->assign(value);
+inline void SpnData::set_node_inputs(int index, int32_t value) {
+  _impl_.node_inputs_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.SpnData.node_inputs)
 }
-inline void SpnData::set_adjacency_matrix(const char* value) {
-  set_has_adjacency_matrix();
-  if (adjacency_matrix_ == &::google::protobuf::internal::kEmptyString) {
-    adjacency_matrix_ = new ::std::string;
-  }
-  adjacency_matrix_->assign(value);
+inline void SpnData::_internal_add_node_inputs(int32_t value) {
+  _impl_.node_inputs_.Add(value);
 }
-inline void SpnData::set_adjacency_matrix(const char* value, size_t size) {
-  set_has_adjacency_matrix();
-  if (adjacency_matrix_ == &::google::protobuf::internal::kEmptyString) {
-    adjacency_matrix_ = new ::std::string;
-  }
-  adjacency_matrix_->assign(reinterpret_cast<const char*>(value), size);
+inline void SpnData::add_node_inputs(int32_t value) {
+  _internal_add_node_inputs(value);
+  // @@protoc_insertion_point(field_add:model.SpnData.node_inputs)
 }
-inline ::std::string* SpnData::mutable_adjacency_matrix() {
-  set_has_adjacency_matrix();
-  if (adjacency_matrix_ == &::google::protobuf::internal::kEmptyString) {
-    adjacency_matrix_ = new ::std::string;
-  }
-  return adjacency_matrix_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::_internal_node_inputs() const {
+  return _impl_.node_inputs_;
 }
-inline ::std::string* SpnData::release_adjacency_matrix() {
-  clear_has_adjacency_matrix();
-  if (adjacency_matrix_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = adjacency_matrix_;
-    adjacency_matrix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::node_inputs() const {
+  // @@protoc_insertion_point(field_list:model.SpnData.node_inputs)
+  return _internal_node_inputs();
 }
-inline void SpnData::set_allocated_adjacency_matrix(::std::string* adjacency_matrix) {
-  if (adjacency_matrix_ != &::google::protobuf::internal::kEmptyString) {
-    delete adjacency_matrix_;
-  }
-  if (adjacency_matrix) {
-    set_has_adjacency_matrix();
-    adjacency_matrix_ = adjacency_matrix;
-  } else {
-    clear_has_adjacency_matrix();
-    adjacency_matrix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::_internal_mutable_node_inputs() {
+  return &_impl_.node_inputs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::mutable_node_inputs() {
+  // @@protoc_insertion_point(field_mutable_list:model.SpnData.node_inputs)
+  return _internal_mutable_node_inputs();
 }
 
-// optional string input_indices = 3;
-inline bool SpnData::has_input_indices() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// repeated int32 edge_children = 8 [packed = true];
+inline int SpnData::_internal_edge_children_size() const {
+  return _impl_.edge_children_.size();
 }
-inline void SpnData::set_has_input_indices() {
-  _has_bits_[0] |= 0x00000004u;
+inline int SpnData::edge_children_size() const {
+  return _internal_edge_children_size();
 }
-inline void SpnData::clear_has_input_indices() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void SpnData::clear_edge_children() {
+  _impl_.edge_children_.Clear();
 }
-inline void SpnData::clear_input_indices() {
-  if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-    input_indices_->clear();
-  }
-  clear_has_input_indices();
+inline int32_t SpnData::_internal_edge_children(int index) const {
+  return _impl_.edge_children_.Get(index);
 }
-inline const ::std::string& SpnData::input_indices() const {
-  return *input_indices_;
+inline int32_t SpnData::edge_children(int index) const {
+  // @@protoc_insertion_point(field_get:model.SpnData.edge_children)
+  return _internal_edge_children(index);
 }
-inline void SpnData::set_input_indices(const ::std::string& value) {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
-  }
-  input_indices_->assign(value);
+inline void SpnData::set_edge_children(int index, int32_t value) {
+  _impl_.edge_children_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.SpnData.edge_children)
 }
-inline void SpnData::set_input_indices(const char* value) {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
-  }
-  input_indices_->assign(value);
+inline void SpnData::_internal_add_edge_children(int32_t value) {
+  _impl_.edge_children_.Add(value);
 }
-inline void SpnData::set_input_indices(const char* value, size_t size) {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
-  }
-  input_indices_->assign(reinterpret_cast<const char*>(value), size);
+inline void SpnData::add_edge_children(int32_t value) {
+  _internal_add_edge_children(value);
+  // @@protoc_insertion_point(field_add:model.SpnData.edge_children)
 }
-inline ::std::string* SpnData::mutable_input_indices() {
-  set_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    input_indices_ = new ::std::string;
-  }
-  return input_indices_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::_internal_edge_children() const {
+  return _impl_.edge_children_;
 }
-inline ::std::string* SpnData::release_input_indices() {
-  clear_has_input_indices();
-  if (input_indices_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = input_indices_;
-    input_indices_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::edge_children() const {
+  // @@protoc_insertion_point(field_list:model.SpnData.edge_children)
+  return _internal_edge_children();
 }
-inline void SpnData::set_allocated_input_indices(::std::string* input_indices) {
-  if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-    delete input_indices_;
-  }
-  if (input_indices) {
-    set_has_input_indices();
-    input_indices_ = input_indices;
-  } else {
-    clear_has_input_indices();
-    input_indices_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::_internal_mutable_edge_children() {
+  return &_impl_.edge_children_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::mutable_edge_children() {
+  // @@protoc_insertion_point(field_mutable_list:model.SpnData.edge_children)
+  return _internal_mutable_edge_children();
 }
 
-// repeated .model.SpnLayerInit layers = 4;
-inline int SpnData::layers_size() const {
-  return layers_.size();
+// repeated int32 edge_parents = 9 [packed = true];
+inline int SpnData::_internal_edge_parents_size() const {
+  return _impl_.edge_parents_.size();
 }
-inline void SpnData::clear_layers() {
-  layers_.Clear();
+inline int SpnData::edge_parents_size() const {
+  return _internal_edge_parents_size();
 }
-inline const ::model::SpnLayerInit& SpnData::layers(int index) const {
-  return layers_.Get(index);
+inline void SpnData::clear_edge_parents() {
+  _impl_.edge_parents_.Clear();
 }
-inline ::model::SpnLayerInit* SpnData::mutable_layers(int index) {
-  return layers_.Mutable(index);
+inline int32_t SpnData::_internal_edge_parents(int index) const {
+  return _impl_.edge_parents_.Get(index);
 }
-inline ::model::SpnLayerInit* SpnData::add_layers() {
-  return layers_.Add();
+inline int32_t SpnData::edge_parents(int index) const {
+  // @@protoc_insertion_point(field_get:model.SpnData.edge_parents)
+  return _internal_edge_parents(index);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::model::SpnLayerInit >&
-SpnData::layers() const {
-  return layers_;
+inline void SpnData::set_edge_parents(int index, int32_t value) {
+  _impl_.edge_parents_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.SpnData.edge_parents)
 }
-inline ::google::protobuf::RepeatedPtrField< ::model::SpnLayerInit >*
-SpnData::mutable_layers() {
-  return &layers_;
+inline void SpnData::_internal_add_edge_parents(int32_t value) {
+  _impl_.edge_parents_.Add(value);
+}
+inline void SpnData::add_edge_parents(int32_t value) {
+  _internal_add_edge_parents(value);
+  // @@protoc_insertion_point(field_add:model.SpnData.edge_parents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::_internal_edge_parents() const {
+  return _impl_.edge_parents_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SpnData::edge_parents() const {
+  // @@protoc_insertion_point(field_list:model.SpnData.edge_parents)
+  return _internal_edge_parents();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::_internal_mutable_edge_parents() {
+  return &_impl_.edge_parents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SpnData::mutable_edge_parents() {
+  // @@protoc_insertion_point(field_mutable_list:model.SpnData.edge_parents)
+  return _internal_mutable_edge_parents();
 }
 
-// -------------------------------------------------------------------
-
-// ModelData
-
-// required string name = 1;
-inline bool ModelData::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// repeated float edge_weights = 10 [packed = true];
+inline int SpnData::_internal_edge_weights_size() const {
+  return _impl_.edge_weights_.size();
 }
-inline void ModelData::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline int SpnData::edge_weights_size() const {
+  return _internal_edge_weights_size();
 }
-inline void ModelData::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void SpnData::clear_edge_weights() {
+  _impl_.edge_weights_.Clear();
 }
-inline void ModelData::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
+inline float SpnData::_internal_edge_weights(int index) const {
+  return _impl_.edge_weights_.Get(index);
+}
+inline float SpnData::edge_weights(int index) const {
+  // @@protoc_insertion_point(field_get:model.SpnData.edge_weights)
+  return _internal_edge_weights(index);
+}
+inline void SpnData::set_edge_weights(int index, float value) {
+  _impl_.edge_weights_.Set(index, value);
+  // @@protoc_insertion_point(field_set:model.SpnData.edge_weights)
+}
+inline void SpnData::_internal_add_edge_weights(float value) {
+  _impl_.edge_weights_.Add(value);
+}
+inline void SpnData::add_edge_weights(float value) {
+  _internal_add_edge_weights(value);
+  // @@protoc_insertion_point(field_add:model.SpnData.edge_weights)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SpnData::_internal_edge_weights() const {
+  return _impl_.edge_weights_;
 }
-inline const ::std::string& ModelData::name() const {
-  return *name_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SpnData::edge_weights() const {
+  // @@protoc_insertion_point(field_list:model.SpnData.edge_weights)
+  return _internal_edge_weights();
 }
-inline void ModelData::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SpnData::_internal_mutable_edge_weights() {
+  return &_impl_.edge_weights_;
 }
-inline void ModelData::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SpnData::mutable_edge_weights() {
+  // @@protoc_insertion_point(field_mutable_list:model.SpnData.edge_weights)
+  return _internal_mutable_edge_weights();
 }
-inline void ModelData::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+
+// -------------------------------------------------------------------
+
+// ModelData
+
+// required string name = 1;
+inline bool ModelData::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* ModelData::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline bool ModelData::has_name() const {
+  return _internal_has_name();
 }
-inline ::std::string* ModelData::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void ModelData::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ModelData::name() const {
+  // @@protoc_insertion_point(field_get:model.ModelData.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ModelData::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.ModelData.name)
+}
+inline std::string* ModelData::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.name)
+  return _s;
+}
+inline const std::string& ModelData::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ModelData::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ModelData::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ModelData::release_name() {
+  // @@protoc_insertion_point(field_release:model.ModelData.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ModelData::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void ModelData::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.name)
 }
 
 // required .model.ModelData.ModelType model_type = 2;
-inline bool ModelData::has_model_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool ModelData::_internal_has_model_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void ModelData::set_has_model_type() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ModelData::clear_has_model_type() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool ModelData::has_model_type() const {
+  return _internal_has_model_type();
 }
 inline void ModelData::clear_model_type() {
-  model_type_ = 0;
-  clear_has_model_type();
+  _impl_.model_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::model::ModelData_ModelType ModelData::_internal_model_type() const {
+  return static_cast< ::model::ModelData_ModelType >(_impl_.model_type_);
 }
 inline ::model::ModelData_ModelType ModelData::model_type() const {
-  return static_cast< ::model::ModelData_ModelType >(model_type_);
+  // @@protoc_insertion_point(field_get:model.ModelData.model_type)
+  return _internal_model_type();
 }
-inline void ModelData::set_model_type(::model::ModelData_ModelType value) {
+inline void ModelData::_internal_set_model_type(::model::ModelData_ModelType value) {
   assert(::model::ModelData_ModelType_IsValid(value));
-  set_has_model_type();
-  model_type_ = value;
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.model_type_ = value;
+}
+inline void ModelData::set_model_type(::model::ModelData_ModelType value) {
+  _internal_set_model_type(value);
+  // @@protoc_insertion_point(field_set:model.ModelData.model_type)
 }
 
 // optional .model.SpnData spn_data = 3;
-inline bool ModelData::has_spn_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ModelData::set_has_spn_data() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool ModelData::_internal_has_spn_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spn_data_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_spn_data() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool ModelData::has_spn_data() const {
+  return _internal_has_spn_data();
 }
 inline void ModelData::clear_spn_data() {
-  if (spn_data_ != NULL) spn_data_->::model::SpnData::Clear();
-  clear_has_spn_data();
+  if (_impl_.spn_data_ != nullptr) _impl_.spn_data_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::model::SpnData& ModelData::_internal_spn_data() const {
+  const ::model::SpnData* p = _impl_.spn_data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::SpnData&>(
+      ::model::_SpnData_default_instance_);
 }
 inline const ::model::SpnData& ModelData::spn_data() const {
-  return spn_data_ != NULL ? *spn_data_ : *default_instance_->spn_data_;
+  // @@protoc_insertion_point(field_get:model.ModelData.spn_data)
+  return _internal_spn_data();
 }
-inline ::model::SpnData* ModelData::mutable_spn_data() {
-  set_has_spn_data();
-  if (spn_data_ == NULL) spn_data_ = new ::model::SpnData;
-  return spn_data_;
+inline void ModelData::unsafe_arena_set_allocated_spn_data(
+    ::model::SpnData* spn_data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spn_data_);
+  }
+  _impl_.spn_data_ = spn_data;
+  if (spn_data) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.spn_data)
 }
 inline ::model::SpnData* ModelData::release_spn_data() {
-  clear_has_spn_data();
-  ::model::SpnData* temp = spn_data_;
-  spn_data_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::model::SpnData* temp = _impl_.spn_data_;
+  _impl_.spn_data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::SpnData* ModelData::unsafe_arena_release_spn_data() {
+  // @@protoc_insertion_point(field_release:model.ModelData.spn_data)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::model::SpnData* temp = _impl_.spn_data_;
+  _impl_.spn_data_ = nullptr;
   return temp;
 }
+inline ::model::SpnData* ModelData::_internal_mutable_spn_data() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.spn_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::SpnData>(GetArenaForAllocation());
+    _impl_.spn_data_ = p;
+  }
+  return _impl_.spn_data_;
+}
+inline ::model::SpnData* ModelData::mutable_spn_data() {
+  ::model::SpnData* _msg = _internal_mutable_spn_data();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.spn_data)
+  return _msg;
+}
 inline void ModelData::set_allocated_spn_data(::model::SpnData* spn_data) {
-  delete spn_data_;
-  spn_data_ = spn_data;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.spn_data_;
+  }
   if (spn_data) {
-    set_has_spn_data();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(spn_data);
+    if (message_arena != submessage_arena) {
+      spn_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spn_data, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_spn_data();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.spn_data_ = spn_data;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.spn_data)
 }
 
 // optional .model.Hyperparams hyper_params = 4;
-inline bool ModelData::has_hyper_params() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void ModelData::set_has_hyper_params() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool ModelData::_internal_has_hyper_params() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hyper_params_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_hyper_params() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool ModelData::has_hyper_params() const {
+  return _internal_has_hyper_params();
 }
 inline void ModelData::clear_hyper_params() {
-  if (hyper_params_ != NULL) hyper_params_->::model::Hyperparams::Clear();
-  clear_has_hyper_params();
+  if (_impl_.hyper_params_ != nullptr) _impl_.hyper_params_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::model::Hyperparams& ModelData::_internal_hyper_params() const {
+  const ::model::Hyperparams* p = _impl_.hyper_params_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Hyperparams&>(
+      ::model::_Hyperparams_default_instance_);
 }
 inline const ::model::Hyperparams& ModelData::hyper_params() const {
-  return hyper_params_ != NULL ? *hyper_params_ : *default_instance_->hyper_params_;
+  // @@protoc_insertion_point(field_get:model.ModelData.hyper_params)
+  return _internal_hyper_params();
 }
-inline ::model::Hyperparams* ModelData::mutable_hyper_params() {
-  set_has_hyper_params();
-  if (hyper_params_ == NULL) hyper_params_ = new ::model::Hyperparams;
-  return hyper_params_;
+inline void ModelData::unsafe_arena_set_allocated_hyper_params(
+    ::model::Hyperparams* hyper_params) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hyper_params_);
+  }
+  _impl_.hyper_params_ = hyper_params;
+  if (hyper_params) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.hyper_params)
 }
 inline ::model::Hyperparams* ModelData::release_hyper_params() {
-  clear_has_hyper_params();
-  ::model::Hyperparams* temp = hyper_params_;
-  hyper_params_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::model::Hyperparams* temp = _impl_.hyper_params_;
+  _impl_.hyper_params_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Hyperparams* ModelData::unsafe_arena_release_hyper_params() {
+  // @@protoc_insertion_point(field_release:model.ModelData.hyper_params)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::model::Hyperparams* temp = _impl_.hyper_params_;
+  _impl_.hyper_params_ = nullptr;
   return temp;
 }
+inline ::model::Hyperparams* ModelData::_internal_mutable_hyper_params() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.hyper_params_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Hyperparams>(GetArenaForAllocation());
+    _impl_.hyper_params_ = p;
+  }
+  return _impl_.hyper_params_;
+}
+inline ::model::Hyperparams* ModelData::mutable_hyper_params() {
+  ::model::Hyperparams* _msg = _internal_mutable_hyper_params();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.hyper_params)
+  return _msg;
+}
 inline void ModelData::set_allocated_hyper_params(::model::Hyperparams* hyper_params) {
-  delete hyper_params_;
-  hyper_params_ = hyper_params;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hyper_params_;
+  }
   if (hyper_params) {
-    set_has_hyper_params();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hyper_params);
+    if (message_arena != submessage_arena) {
+      hyper_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hyper_params, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_hyper_params();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.hyper_params_ = hyper_params;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.hyper_params)
 }
 
 // repeated .model.NodeData nodes = 5;
+inline int ModelData::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
 inline int ModelData::nodes_size() const {
-  return nodes_.size();
+  return _internal_nodes_size();
 }
 inline void ModelData::clear_nodes() {
-  nodes_.Clear();
+  _impl_.nodes_.Clear();
+}
+inline ::model::NodeData* ModelData::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:model.ModelData.nodes)
+  return _impl_.nodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::NodeData >*
+ModelData::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:model.ModelData.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::model::NodeData& ModelData::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
 }
 inline const ::model::NodeData& ModelData::nodes(int index) const {
-  return nodes_.Get(index);
+  // @@protoc_insertion_point(field_get:model.ModelData.nodes)
+  return _internal_nodes(index);
 }
-inline ::model::NodeData* ModelData::mutable_nodes(int index) {
-  return nodes_.Mutable(index);
+inline ::model::NodeData* ModelData::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
 }
 inline ::model::NodeData* ModelData::add_nodes() {
-  return nodes_.Add();
+  ::model::NodeData* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:model.ModelData.nodes)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::model::NodeData >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::NodeData >&
 ModelData::nodes() const {
-  return nodes_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::model::NodeData >*
-ModelData::mutable_nodes() {
-  return &nodes_;
+  // @@protoc_insertion_point(field_list:model.ModelData.nodes)
+  return _impl_.nodes_;
 }
 
 // repeated .model.EdgeData edges = 6;
+inline int ModelData::_internal_edges_size() const {
+  return _impl_.edges_.size();
+}
 inline int ModelData::edges_size() const {
-  return edges_.size();
+  return _internal_edges_size();
 }
 inline void ModelData::clear_edges() {
-  edges_.Clear();
+  _impl_.edges_.Clear();
+}
+inline ::model::EdgeData* ModelData::mutable_edges(int index) {
+  // @@protoc_insertion_point(field_mutable:model.ModelData.edges)
+  return _impl_.edges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::EdgeData >*
+ModelData::mutable_edges() {
+  // @@protoc_insertion_point(field_mutable_list:model.ModelData.edges)
+  return &_impl_.edges_;
+}
+inline const ::model::EdgeData& ModelData::_internal_edges(int index) const {
+  return _impl_.edges_.Get(index);
 }
 inline const ::model::EdgeData& ModelData::edges(int index) const {
-  return edges_.Get(index);
+  // @@protoc_insertion_point(field_get:model.ModelData.edges)
+  return _internal_edges(index);
 }
-inline ::model::EdgeData* ModelData::mutable_edges(int index) {
-  return edges_.Mutable(index);
+inline ::model::EdgeData* ModelData::_internal_add_edges() {
+  return _impl_.edges_.Add();
 }
 inline ::model::EdgeData* ModelData::add_edges() {
-  return edges_.Add();
+  ::model::EdgeData* _add = _internal_add_edges();
+  // @@protoc_insertion_point(field_add:model.ModelData.edges)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::model::EdgeData >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::EdgeData >&
 ModelData::edges() const {
-  return edges_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::model::EdgeData >*
-ModelData::mutable_edges() {
-  return &edges_;
+  // @@protoc_insertion_point(field_list:model.ModelData.edges)
+  return _impl_.edges_;
 }
 
 // optional .model.Metrics train_metrics = 7;
-inline bool ModelData::has_train_metrics() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void ModelData::set_has_train_metrics() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool ModelData::_internal_has_train_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.train_metrics_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_train_metrics() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool ModelData::has_train_metrics() const {
+  return _internal_has_train_metrics();
 }
 inline void ModelData::clear_train_metrics() {
-  if (train_metrics_ != NULL) train_metrics_->::model::Metrics::Clear();
-  clear_has_train_metrics();
+  if (_impl_.train_metrics_ != nullptr) _impl_.train_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::model::Metrics& ModelData::_internal_train_metrics() const {
+  const ::model::Metrics* p = _impl_.train_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Metrics&>(
+      ::model::_Metrics_default_instance_);
 }
 inline const ::model::Metrics& ModelData::train_metrics() const {
-  return train_metrics_ != NULL ? *train_metrics_ : *default_instance_->train_metrics_;
+  // @@protoc_insertion_point(field_get:model.ModelData.train_metrics)
+  return _internal_train_metrics();
 }
-inline ::model::Metrics* ModelData::mutable_train_metrics() {
-  set_has_train_metrics();
-  if (train_metrics_ == NULL) train_metrics_ = new ::model::Metrics;
-  return train_metrics_;
+inline void ModelData::unsafe_arena_set_allocated_train_metrics(
+    ::model::Metrics* train_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.train_metrics_);
+  }
+  _impl_.train_metrics_ = train_metrics;
+  if (train_metrics) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.train_metrics)
 }
 inline ::model::Metrics* ModelData::release_train_metrics() {
-  clear_has_train_metrics();
-  ::model::Metrics* temp = train_metrics_;
-  train_metrics_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::model::Metrics* temp = _impl_.train_metrics_;
+  _impl_.train_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Metrics* ModelData::unsafe_arena_release_train_metrics() {
+  // @@protoc_insertion_point(field_release:model.ModelData.train_metrics)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::model::Metrics* temp = _impl_.train_metrics_;
+  _impl_.train_metrics_ = nullptr;
   return temp;
 }
+inline ::model::Metrics* ModelData::_internal_mutable_train_metrics() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.train_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Metrics>(GetArenaForAllocation());
+    _impl_.train_metrics_ = p;
+  }
+  return _impl_.train_metrics_;
+}
+inline ::model::Metrics* ModelData::mutable_train_metrics() {
+  ::model::Metrics* _msg = _internal_mutable_train_metrics();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.train_metrics)
+  return _msg;
+}
 inline void ModelData::set_allocated_train_metrics(::model::Metrics* train_metrics) {
-  delete train_metrics_;
-  train_metrics_ = train_metrics;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.train_metrics_;
+  }
   if (train_metrics) {
-    set_has_train_metrics();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(train_metrics);
+    if (message_arena != submessage_arena) {
+      train_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, train_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_train_metrics();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.train_metrics_ = train_metrics;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.train_metrics)
 }
 
 // optional .model.Metrics valid_metrics = 8;
-inline bool ModelData::has_valid_metrics() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void ModelData::set_has_valid_metrics() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool ModelData::_internal_has_valid_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.valid_metrics_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_valid_metrics() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool ModelData::has_valid_metrics() const {
+  return _internal_has_valid_metrics();
 }
 inline void ModelData::clear_valid_metrics() {
-  if (valid_metrics_ != NULL) valid_metrics_->::model::Metrics::Clear();
-  clear_has_valid_metrics();
+  if (_impl_.valid_metrics_ != nullptr) _impl_.valid_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::model::Metrics& ModelData::_internal_valid_metrics() const {
+  const ::model::Metrics* p = _impl_.valid_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Metrics&>(
+      ::model::_Metrics_default_instance_);
 }
 inline const ::model::Metrics& ModelData::valid_metrics() const {
-  return valid_metrics_ != NULL ? *valid_metrics_ : *default_instance_->valid_metrics_;
+  // @@protoc_insertion_point(field_get:model.ModelData.valid_metrics)
+  return _internal_valid_metrics();
 }
-inline ::model::Metrics* ModelData::mutable_valid_metrics() {
-  set_has_valid_metrics();
-  if (valid_metrics_ == NULL) valid_metrics_ = new ::model::Metrics;
-  return valid_metrics_;
+inline void ModelData::unsafe_arena_set_allocated_valid_metrics(
+    ::model::Metrics* valid_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.valid_metrics_);
+  }
+  _impl_.valid_metrics_ = valid_metrics;
+  if (valid_metrics) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.valid_metrics)
 }
 inline ::model::Metrics* ModelData::release_valid_metrics() {
-  clear_has_valid_metrics();
-  ::model::Metrics* temp = valid_metrics_;
-  valid_metrics_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::model::Metrics* temp = _impl_.valid_metrics_;
+  _impl_.valid_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Metrics* ModelData::unsafe_arena_release_valid_metrics() {
+  // @@protoc_insertion_point(field_release:model.ModelData.valid_metrics)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::model::Metrics* temp = _impl_.valid_metrics_;
+  _impl_.valid_metrics_ = nullptr;
   return temp;
 }
+inline ::model::Metrics* ModelData::_internal_mutable_valid_metrics() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.valid_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Metrics>(GetArenaForAllocation());
+    _impl_.valid_metrics_ = p;
+  }
+  return _impl_.valid_metrics_;
+}
+inline ::model::Metrics* ModelData::mutable_valid_metrics() {
+  ::model::Metrics* _msg = _internal_mutable_valid_metrics();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.valid_metrics)
+  return _msg;
+}
 inline void ModelData::set_allocated_valid_metrics(::model::Metrics* valid_metrics) {
-  delete valid_metrics_;
-  valid_metrics_ = valid_metrics;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.valid_metrics_;
+  }
   if (valid_metrics) {
-    set_has_valid_metrics();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(valid_metrics);
+    if (message_arena != submessage_arena) {
+      valid_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, valid_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_valid_metrics();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.valid_metrics_ = valid_metrics;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.valid_metrics)
 }
 
 // optional .model.Metrics test_metrics = 9;
-inline bool ModelData::has_test_metrics() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void ModelData::set_has_test_metrics() {
-  _has_bits_[0] |= 0x00000100u;
+inline bool ModelData::_internal_has_test_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.test_metrics_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_test_metrics() {
-  _has_bits_[0] &= ~0x00000100u;
+inline bool ModelData::has_test_metrics() const {
+  return _internal_has_test_metrics();
 }
 inline void ModelData::clear_test_metrics() {
-  if (test_metrics_ != NULL) test_metrics_->::model::Metrics::Clear();
-  clear_has_test_metrics();
+  if (_impl_.test_metrics_ != nullptr) _impl_.test_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::model::Metrics& ModelData::_internal_test_metrics() const {
+  const ::model::Metrics* p = _impl_.test_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Metrics&>(
+      ::model::_Metrics_default_instance_);
 }
 inline const ::model::Metrics& ModelData::test_metrics() const {
-  return test_metrics_ != NULL ? *test_metrics_ : *default_instance_->test_metrics_;
+  // @@protoc_insertion_point(field_get:model.ModelData.test_metrics)
+  return _internal_test_metrics();
 }
-inline ::model::Metrics* ModelData::mutable_test_metrics() {
-  set_has_test_metrics();
-  if (test_metrics_ == NULL) test_metrics_ = new ::model::Metrics;
-  return test_metrics_;
+inline void ModelData::unsafe_arena_set_allocated_test_metrics(
+    ::model::Metrics* test_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.test_metrics_);
+  }
+  _impl_.test_metrics_ = test_metrics;
+  if (test_metrics) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.test_metrics)
 }
 inline ::model::Metrics* ModelData::release_test_metrics() {
-  clear_has_test_metrics();
-  ::model::Metrics* temp = test_metrics_;
-  test_metrics_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::model::Metrics* temp = _impl_.test_metrics_;
+  _impl_.test_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Metrics* ModelData::unsafe_arena_release_test_metrics() {
+  // @@protoc_insertion_point(field_release:model.ModelData.test_metrics)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::model::Metrics* temp = _impl_.test_metrics_;
+  _impl_.test_metrics_ = nullptr;
   return temp;
 }
+inline ::model::Metrics* ModelData::_internal_mutable_test_metrics() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.test_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Metrics>(GetArenaForAllocation());
+    _impl_.test_metrics_ = p;
+  }
+  return _impl_.test_metrics_;
+}
+inline ::model::Metrics* ModelData::mutable_test_metrics() {
+  ::model::Metrics* _msg = _internal_mutable_test_metrics();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.test_metrics)
+  return _msg;
+}
 inline void ModelData::set_allocated_test_metrics(::model::Metrics* test_metrics) {
-  delete test_metrics_;
-  test_metrics_ = test_metrics;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.test_metrics_;
+  }
   if (test_metrics) {
-    set_has_test_metrics();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(test_metrics);
+    if (message_arena != submessage_arena) {
+      test_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, test_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_test_metrics();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
+  _impl_.test_metrics_ = test_metrics;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.test_metrics)
 }
 
 // optional .model.Metrics valid_metric_best = 10;
-inline bool ModelData::has_valid_metric_best() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void ModelData::set_has_valid_metric_best() {
-  _has_bits_[0] |= 0x00000200u;
+inline bool ModelData::_internal_has_valid_metric_best() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.valid_metric_best_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_valid_metric_best() {
-  _has_bits_[0] &= ~0x00000200u;
+inline bool ModelData::has_valid_metric_best() const {
+  return _internal_has_valid_metric_best();
 }
 inline void ModelData::clear_valid_metric_best() {
-  if (valid_metric_best_ != NULL) valid_metric_best_->::model::Metrics::Clear();
-  clear_has_valid_metric_best();
+  if (_impl_.valid_metric_best_ != nullptr) _impl_.valid_metric_best_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::model::Metrics& ModelData::_internal_valid_metric_best() const {
+  const ::model::Metrics* p = _impl_.valid_metric_best_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Metrics&>(
+      ::model::_Metrics_default_instance_);
 }
 inline const ::model::Metrics& ModelData::valid_metric_best() const {
-  return valid_metric_best_ != NULL ? *valid_metric_best_ : *default_instance_->valid_metric_best_;
+  // @@protoc_insertion_point(field_get:model.ModelData.valid_metric_best)
+  return _internal_valid_metric_best();
 }
-inline ::model::Metrics* ModelData::mutable_valid_metric_best() {
-  set_has_valid_metric_best();
-  if (valid_metric_best_ == NULL) valid_metric_best_ = new ::model::Metrics;
-  return valid_metric_best_;
+inline void ModelData::unsafe_arena_set_allocated_valid_metric_best(
+    ::model::Metrics* valid_metric_best) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.valid_metric_best_);
+  }
+  _impl_.valid_metric_best_ = valid_metric_best;
+  if (valid_metric_best) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.valid_metric_best)
 }
 inline ::model::Metrics* ModelData::release_valid_metric_best() {
-  clear_has_valid_metric_best();
-  ::model::Metrics* temp = valid_metric_best_;
-  valid_metric_best_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::model::Metrics* temp = _impl_.valid_metric_best_;
+  _impl_.valid_metric_best_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Metrics* ModelData::unsafe_arena_release_valid_metric_best() {
+  // @@protoc_insertion_point(field_release:model.ModelData.valid_metric_best)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::model::Metrics* temp = _impl_.valid_metric_best_;
+  _impl_.valid_metric_best_ = nullptr;
   return temp;
 }
+inline ::model::Metrics* ModelData::_internal_mutable_valid_metric_best() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.valid_metric_best_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Metrics>(GetArenaForAllocation());
+    _impl_.valid_metric_best_ = p;
+  }
+  return _impl_.valid_metric_best_;
+}
+inline ::model::Metrics* ModelData::mutable_valid_metric_best() {
+  ::model::Metrics* _msg = _internal_mutable_valid_metric_best();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.valid_metric_best)
+  return _msg;
+}
 inline void ModelData::set_allocated_valid_metric_best(::model::Metrics* valid_metric_best) {
-  delete valid_metric_best_;
-  valid_metric_best_ = valid_metric_best;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.valid_metric_best_;
+  }
   if (valid_metric_best) {
-    set_has_valid_metric_best();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(valid_metric_best);
+    if (message_arena != submessage_arena) {
+      valid_metric_best = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, valid_metric_best, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    clear_has_valid_metric_best();
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
+  _impl_.valid_metric_best_ = valid_metric_best;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.valid_metric_best)
 }
 
 // optional .model.Metrics train_metric_es = 11;
-inline bool ModelData::has_train_metric_es() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void ModelData::set_has_train_metric_es() {
-  _has_bits_[0] |= 0x00000400u;
+inline bool ModelData::_internal_has_train_metric_es() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.train_metric_es_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_train_metric_es() {
-  _has_bits_[0] &= ~0x00000400u;
+inline bool ModelData::has_train_metric_es() const {
+  return _internal_has_train_metric_es();
 }
 inline void ModelData::clear_train_metric_es() {
-  if (train_metric_es_ != NULL) train_metric_es_->::model::Metrics::Clear();
-  clear_has_train_metric_es();
+  if (_impl_.train_metric_es_ != nullptr) _impl_.train_metric_es_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::model::Metrics& ModelData::_internal_train_metric_es() const {
+  const ::model::Metrics* p = _impl_.train_metric_es_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Metrics&>(
+      ::model::_Metrics_default_instance_);
 }
 inline const ::model::Metrics& ModelData::train_metric_es() const {
-  return train_metric_es_ != NULL ? *train_metric_es_ : *default_instance_->train_metric_es_;
+  // @@protoc_insertion_point(field_get:model.ModelData.train_metric_es)
+  return _internal_train_metric_es();
 }
-inline ::model::Metrics* ModelData::mutable_train_metric_es() {
-  set_has_train_metric_es();
-  if (train_metric_es_ == NULL) train_metric_es_ = new ::model::Metrics;
-  return train_metric_es_;
+inline void ModelData::unsafe_arena_set_allocated_train_metric_es(
+    ::model::Metrics* train_metric_es) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.train_metric_es_);
+  }
+  _impl_.train_metric_es_ = train_metric_es;
+  if (train_metric_es) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.train_metric_es)
 }
 inline ::model::Metrics* ModelData::release_train_metric_es() {
-  clear_has_train_metric_es();
-  ::model::Metrics* temp = train_metric_es_;
-  train_metric_es_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::model::Metrics* temp = _impl_.train_metric_es_;
+  _impl_.train_metric_es_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Metrics* ModelData::unsafe_arena_release_train_metric_es() {
+  // @@protoc_insertion_point(field_release:model.ModelData.train_metric_es)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::model::Metrics* temp = _impl_.train_metric_es_;
+  _impl_.train_metric_es_ = nullptr;
   return temp;
 }
+inline ::model::Metrics* ModelData::_internal_mutable_train_metric_es() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.train_metric_es_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Metrics>(GetArenaForAllocation());
+    _impl_.train_metric_es_ = p;
+  }
+  return _impl_.train_metric_es_;
+}
+inline ::model::Metrics* ModelData::mutable_train_metric_es() {
+  ::model::Metrics* _msg = _internal_mutable_train_metric_es();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.train_metric_es)
+  return _msg;
+}
 inline void ModelData::set_allocated_train_metric_es(::model::Metrics* train_metric_es) {
-  delete train_metric_es_;
-  train_metric_es_ = train_metric_es;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.train_metric_es_;
+  }
   if (train_metric_es) {
-    set_has_train_metric_es();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(train_metric_es);
+    if (message_arena != submessage_arena) {
+      train_metric_es = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, train_metric_es, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_train_metric_es();
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.train_metric_es_ = train_metric_es;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.train_metric_es)
 }
 
 // optional .model.Metrics test_metric_es = 12;
-inline bool ModelData::has_test_metric_es() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void ModelData::set_has_test_metric_es() {
-  _has_bits_[0] |= 0x00000800u;
+inline bool ModelData::_internal_has_test_metric_es() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.test_metric_es_ != nullptr);
+  return value;
 }
-inline void ModelData::clear_has_test_metric_es() {
-  _has_bits_[0] &= ~0x00000800u;
+inline bool ModelData::has_test_metric_es() const {
+  return _internal_has_test_metric_es();
 }
 inline void ModelData::clear_test_metric_es() {
-  if (test_metric_es_ != NULL) test_metric_es_->::model::Metrics::Clear();
-  clear_has_test_metric_es();
+  if (_impl_.test_metric_es_ != nullptr) _impl_.test_metric_es_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::model::Metrics& ModelData::_internal_test_metric_es() const {
+  const ::model::Metrics* p = _impl_.test_metric_es_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Metrics&>(
+      ::model::_Metrics_default_instance_);
 }
 inline const ::model::Metrics& ModelData::test_metric_es() const {
-  return test_metric_es_ != NULL ? *test_metric_es_ : *default_instance_->test_metric_es_;
+  // @@protoc_insertion_point(field_get:model.ModelData.test_metric_es)
+  return _internal_test_metric_es();
 }
-inline ::model::Metrics* ModelData::mutable_test_metric_es() {
-  set_has_test_metric_es();
-  if (test_metric_es_ == NULL) test_metric_es_ = new ::model::Metrics;
-  return test_metric_es_;
+inline void ModelData::unsafe_arena_set_allocated_test_metric_es(
+    ::model::Metrics* test_metric_es) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.test_metric_es_);
+  }
+  _impl_.test_metric_es_ = test_metric_es;
+  if (test_metric_es) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.ModelData.test_metric_es)
 }
 inline ::model::Metrics* ModelData::release_test_metric_es() {
-  clear_has_test_metric_es();
-  ::model::Metrics* temp = test_metric_es_;
-  test_metric_es_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::model::Metrics* temp = _impl_.test_metric_es_;
+  _impl_.test_metric_es_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Metrics* ModelData::unsafe_arena_release_test_metric_es() {
+  // @@protoc_insertion_point(field_release:model.ModelData.test_metric_es)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::model::Metrics* temp = _impl_.test_metric_es_;
+  _impl_.test_metric_es_ = nullptr;
   return temp;
 }
+inline ::model::Metrics* ModelData::_internal_mutable_test_metric_es() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.test_metric_es_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Metrics>(GetArenaForAllocation());
+    _impl_.test_metric_es_ = p;
+  }
+  return _impl_.test_metric_es_;
+}
+inline ::model::Metrics* ModelData::mutable_test_metric_es() {
+  ::model::Metrics* _msg = _internal_mutable_test_metric_es();
+  // @@protoc_insertion_point(field_mutable:model.ModelData.test_metric_es)
+  return _msg;
+}
 inline void ModelData::set_allocated_test_metric_es(::model::Metrics* test_metric_es) {
-  delete test_metric_es_;
-  test_metric_es_ = test_metric_es;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.test_metric_es_;
+  }
   if (test_metric_es) {
-    set_has_test_metric_es();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(test_metric_es);
+    if (message_arena != submessage_arena) {
+      test_metric_es = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, test_metric_es, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
   } else {
-    clear_has_test_metric_es();
+    _impl_._has_bits_[0] &= ~0x00000100u;
   }
+  _impl_.test_metric_es_ = test_metric_es;
+  // @@protoc_insertion_point(field_set_allocated:model.ModelData.test_metric_es)
 }
 
 // -------------------------------------------------------------------
@@ -3938,47 +6908,59 @@ inline void ModelData::set_allocated_test_metric_es(::model::Metrics* test_metri
 // Operation_StopCondition
 
 // optional bool all_processed = 1 [default = true];
-inline bool Operation_StopCondition::has_all_processed() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Operation_StopCondition::set_has_all_processed() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Operation_StopCondition::_internal_has_all_processed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Operation_StopCondition::clear_has_all_processed() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Operation_StopCondition::has_all_processed() const {
+  return _internal_has_all_processed();
 }
 inline void Operation_StopCondition::clear_all_processed() {
-  all_processed_ = true;
-  clear_has_all_processed();
+  _impl_.all_processed_ = true;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool Operation_StopCondition::_internal_all_processed() const {
+  return _impl_.all_processed_;
 }
 inline bool Operation_StopCondition::all_processed() const {
-  return all_processed_;
+  // @@protoc_insertion_point(field_get:model.Operation.StopCondition.all_processed)
+  return _internal_all_processed();
+}
+inline void Operation_StopCondition::_internal_set_all_processed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.all_processed_ = value;
 }
 inline void Operation_StopCondition::set_all_processed(bool value) {
-  set_has_all_processed();
-  all_processed_ = value;
+  _internal_set_all_processed(value);
+  // @@protoc_insertion_point(field_set:model.Operation.StopCondition.all_processed)
 }
 
 // optional int32 steps = 2 [default = 10000];
+inline bool Operation_StopCondition::_internal_has_steps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool Operation_StopCondition::has_steps() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_steps();
 }
-inline void Operation_StopCondition::set_has_steps() {
-  _has_bits_[0] |= 0x00000002u;
+inline void Operation_StopCondition::clear_steps() {
+  _impl_.steps_ = 10000;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Operation_StopCondition::clear_has_steps() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t Operation_StopCondition::_internal_steps() const {
+  return _impl_.steps_;
 }
-inline void Operation_StopCondition::clear_steps() {
-  steps_ = 10000;
-  clear_has_steps();
+inline int32_t Operation_StopCondition::steps() const {
+  // @@protoc_insertion_point(field_get:model.Operation.StopCondition.steps)
+  return _internal_steps();
 }
-inline ::google::protobuf::int32 Operation_StopCondition::steps() const {
-  return steps_;
+inline void Operation_StopCondition::_internal_set_steps(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.steps_ = value;
 }
-inline void Operation_StopCondition::set_steps(::google::protobuf::int32 value) {
-  set_has_steps();
-  steps_ = value;
+inline void Operation_StopCondition::set_steps(int32_t value) {
+  _internal_set_steps(value);
+  // @@protoc_insertion_point(field_set:model.Operation.StopCondition.steps)
 }
 
 // -------------------------------------------------------------------
@@ -3986,451 +6968,711 @@ inline void Operation_StopCondition::set_steps(::google::protobuf::int32 value)
 // Operation
 
 // required string name = 1 [default = "operation"];
-inline bool Operation::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Operation::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Operation::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Operation::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Operation::has_name() const {
+  return _internal_has_name();
 }
 inline void Operation::clear_name() {
-  if (name_ != _default_name_) {
-    name_->assign(*_default_name_);
+  _impl_.name_.ClearToDefault(::model::Operation::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Operation::name() const {
+  // @@protoc_insertion_point(field_get:model.Operation.name)
+  if (_impl_.name_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_name_.get();
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Operation::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.Operation.name)
+}
+inline std::string* Operation::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:model.Operation.name)
+  return _s;
+}
+inline const std::string& Operation::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Operation::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Operation::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(::model::Operation::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+}
+inline std::string* Operation::release_name() {
+  // @@protoc_insertion_point(field_release:model.Operation.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+  return p;
+}
+inline void Operation::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  clear_has_name();
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:model.Operation.name)
 }
-inline const ::std::string& Operation::name() const {
-  return *name_;
+
+// optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
+inline bool Operation::_internal_has_optimizer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void Operation::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == _default_name_) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline bool Operation::has_optimizer() const {
+  return _internal_has_optimizer();
 }
-inline void Operation::set_name(const char* value) {
-  set_has_name();
-  if (name_ == _default_name_) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void Operation::clear_optimizer() {
+  _impl_.optimizer_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void Operation::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == _default_name_) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+inline ::model::Operation_Optimizer Operation::_internal_optimizer() const {
+  return static_cast< ::model::Operation_Optimizer >(_impl_.optimizer_);
 }
-inline ::std::string* Operation::mutable_name() {
-  set_has_name();
-  if (name_ == _default_name_) {
-    name_ = new ::std::string(*_default_name_);
-  }
-  return name_;
+inline ::model::Operation_Optimizer Operation::optimizer() const {
+  // @@protoc_insertion_point(field_get:model.Operation.optimizer)
+  return _internal_optimizer();
+}
+inline void Operation::_internal_set_optimizer(::model::Operation_Optimizer value) {
+  assert(::model::Operation_Optimizer_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.optimizer_ = value;
+}
+inline void Operation::set_optimizer(::model::Operation_Optimizer value) {
+  _internal_set_optimizer(value);
+  // @@protoc_insertion_point(field_set:model.Operation.optimizer)
+}
+
+// optional .model.Operation.StopCondition stop_condition = 3;
+inline bool Operation::_internal_has_stop_condition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.stop_condition_ != nullptr);
+  return value;
+}
+inline bool Operation::has_stop_condition() const {
+  return _internal_has_stop_condition();
+}
+inline void Operation::clear_stop_condition() {
+  if (_impl_.stop_condition_ != nullptr) _impl_.stop_condition_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::std::string* Operation::release_name() {
-  clear_has_name();
-  if (name_ == _default_name_) {
-    return NULL;
+inline const ::model::Operation_StopCondition& Operation::_internal_stop_condition() const {
+  const ::model::Operation_StopCondition* p = _impl_.stop_condition_;
+  return p != nullptr ? *p : reinterpret_cast<const ::model::Operation_StopCondition&>(
+      ::model::_Operation_StopCondition_default_instance_);
+}
+inline const ::model::Operation_StopCondition& Operation::stop_condition() const {
+  // @@protoc_insertion_point(field_get:model.Operation.stop_condition)
+  return _internal_stop_condition();
+}
+inline void Operation::unsafe_arena_set_allocated_stop_condition(
+    ::model::Operation_StopCondition* stop_condition) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_condition_);
+  }
+  _impl_.stop_condition_ = stop_condition;
+  if (stop_condition) {
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(_default_name_);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:model.Operation.stop_condition)
+}
+inline ::model::Operation_StopCondition* Operation::release_stop_condition() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::model::Operation_StopCondition* temp = _impl_.stop_condition_;
+  _impl_.stop_condition_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::model::Operation_StopCondition* Operation::unsafe_arena_release_stop_condition() {
+  // @@protoc_insertion_point(field_release:model.Operation.stop_condition)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::model::Operation_StopCondition* temp = _impl_.stop_condition_;
+  _impl_.stop_condition_ = nullptr;
+  return temp;
+}
+inline ::model::Operation_StopCondition* Operation::_internal_mutable_stop_condition() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.stop_condition_ == nullptr) {
+    auto* p = CreateMaybeMessage<::model::Operation_StopCondition>(GetArenaForAllocation());
+    _impl_.stop_condition_ = p;
   }
+  return _impl_.stop_condition_;
 }
-inline void Operation::set_allocated_name(::std::string* name) {
-  if (name_ != _default_name_) {
-    delete name_;
+inline ::model::Operation_StopCondition* Operation::mutable_stop_condition() {
+  ::model::Operation_StopCondition* _msg = _internal_mutable_stop_condition();
+  // @@protoc_insertion_point(field_mutable:model.Operation.stop_condition)
+  return _msg;
+}
+inline void Operation::set_allocated_stop_condition(::model::Operation_StopCondition* stop_condition) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stop_condition_;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
+  if (stop_condition) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stop_condition);
+    if (message_arena != submessage_arena) {
+      stop_condition = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stop_condition, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(_default_name_);
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.stop_condition_ = stop_condition;
+  // @@protoc_insertion_point(field_set_allocated:model.Operation.stop_condition)
 }
 
-// optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
-inline bool Operation::has_optimizer() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
+inline bool Operation::_internal_has_operation_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void Operation::set_has_optimizer() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Operation::has_operation_type() const {
+  return _internal_has_operation_type();
 }
-inline void Operation::clear_has_optimizer() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Operation::clear_operation_type() {
+  _impl_.operation_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void Operation::clear_optimizer() {
-  optimizer_ = 0;
-  clear_has_optimizer();
+inline ::model::Operation_OperationType Operation::_internal_operation_type() const {
+  return static_cast< ::model::Operation_OperationType >(_impl_.operation_type_);
 }
-inline ::model::Operation_Optimizer Operation::optimizer() const {
-  return static_cast< ::model::Operation_Optimizer >(optimizer_);
+inline ::model::Operation_OperationType Operation::operation_type() const {
+  // @@protoc_insertion_point(field_get:model.Operation.operation_type)
+  return _internal_operation_type();
 }
-inline void Operation::set_optimizer(::model::Operation_Optimizer value) {
-  assert(::model::Operation_Optimizer_IsValid(value));
-  set_has_optimizer();
-  optimizer_ = value;
+inline void Operation::_internal_set_operation_type(::model::Operation_OperationType value) {
+  assert(::model::Operation_OperationType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.operation_type_ = value;
+}
+inline void Operation::set_operation_type(::model::Operation_OperationType value) {
+  _internal_set_operation_type(value);
+  // @@protoc_insertion_point(field_set:model.Operation.operation_type)
 }
 
-// optional .model.Operation.StopCondition stop_condition = 3;
-inline bool Operation::has_stop_condition() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional int32 batch_size = 5 [default = 100];
+inline bool Operation::_internal_has_batch_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
 }
-inline void Operation::set_has_stop_condition() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Operation::has_batch_size() const {
+  return _internal_has_batch_size();
 }
-inline void Operation::clear_has_stop_condition() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void Operation::clear_batch_size() {
+  _impl_.batch_size_ = 100;
+  _impl_._has_bits_[0] &= ~0x00001000u;
 }
-inline void Operation::clear_stop_condition() {
-  if (stop_condition_ != NULL) stop_condition_->::model::Operation_StopCondition::Clear();
-  clear_has_stop_condition();
+inline int32_t Operation::_internal_batch_size() const {
+  return _impl_.batch_size_;
 }
-inline const ::model::Operation_StopCondition& Operation::stop_condition() const {
-  return stop_condition_ != NULL ? *stop_condition_ : *default_instance_->stop_condition_;
+inline int32_t Operation::batch_size() const {
+  // @@protoc_insertion_point(field_get:model.Operation.batch_size)
+  return _internal_batch_size();
+}
+inline void Operation::_internal_set_batch_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.batch_size_ = value;
+}
+inline void Operation::set_batch_size(int32_t value) {
+  _internal_set_batch_size(value);
+  // @@protoc_insertion_point(field_set:model.Operation.batch_size)
+}
+
+// optional string data_proto = 6;
+inline bool Operation::_internal_has_data_proto() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Operation::has_data_proto() const {
+  return _internal_has_data_proto();
+}
+inline void Operation::clear_data_proto() {
+  _impl_.data_proto_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Operation::data_proto() const {
+  // @@protoc_insertion_point(field_get:model.Operation.data_proto)
+  return _internal_data_proto();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Operation::set_data_proto(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.data_proto_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.Operation.data_proto)
+}
+inline std::string* Operation::mutable_data_proto() {
+  std::string* _s = _internal_mutable_data_proto();
+  // @@protoc_insertion_point(field_mutable:model.Operation.data_proto)
+  return _s;
+}
+inline const std::string& Operation::_internal_data_proto() const {
+  return _impl_.data_proto_.Get();
+}
+inline void Operation::_internal_set_data_proto(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.data_proto_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Operation::_internal_mutable_data_proto() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.data_proto_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Operation::release_data_proto() {
+  // @@protoc_insertion_point(field_release:model.Operation.data_proto)
+  if (!_internal_has_data_proto()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.data_proto_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_proto_.IsDefault()) {
+    _impl_.data_proto_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Operation::set_allocated_data_proto(std::string* data_proto) {
+  if (data_proto != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.data_proto_.SetAllocated(data_proto, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_proto_.IsDefault()) {
+    _impl_.data_proto_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.Operation.data_proto)
+}
+
+// optional int32 eval_after = 7 [default = 500];
+inline bool Operation::_internal_has_eval_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Operation::has_eval_after() const {
+  return _internal_has_eval_after();
+}
+inline void Operation::clear_eval_after() {
+  _impl_.eval_after_ = 500;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t Operation::_internal_eval_after() const {
+  return _impl_.eval_after_;
 }
-inline ::model::Operation_StopCondition* Operation::mutable_stop_condition() {
-  set_has_stop_condition();
-  if (stop_condition_ == NULL) stop_condition_ = new ::model::Operation_StopCondition;
-  return stop_condition_;
+inline int32_t Operation::eval_after() const {
+  // @@protoc_insertion_point(field_get:model.Operation.eval_after)
+  return _internal_eval_after();
 }
-inline ::model::Operation_StopCondition* Operation::release_stop_condition() {
-  clear_has_stop_condition();
-  ::model::Operation_StopCondition* temp = stop_condition_;
-  stop_condition_ = NULL;
-  return temp;
+inline void Operation::_internal_set_eval_after(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.eval_after_ = value;
 }
-inline void Operation::set_allocated_stop_condition(::model::Operation_StopCondition* stop_condition) {
-  delete stop_condition_;
-  stop_condition_ = stop_condition;
-  if (stop_condition) {
-    set_has_stop_condition();
-  } else {
-    clear_has_stop_condition();
-  }
+inline void Operation::set_eval_after(int32_t value) {
+  _internal_set_eval_after(value);
+  // @@protoc_insertion_point(field_set:model.Operation.eval_after)
 }
 
-// optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
-inline bool Operation::has_operation_type() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional int32 checkpoint_after = 8 [default = 1000];
+inline bool Operation::_internal_has_checkpoint_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
 }
-inline void Operation::set_has_operation_type() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Operation::has_checkpoint_after() const {
+  return _internal_has_checkpoint_after();
 }
-inline void Operation::clear_has_operation_type() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void Operation::clear_checkpoint_after() {
+  _impl_.checkpoint_after_ = 1000;
+  _impl_._has_bits_[0] &= ~0x00004000u;
 }
-inline void Operation::clear_operation_type() {
-  operation_type_ = 0;
-  clear_has_operation_type();
+inline int32_t Operation::_internal_checkpoint_after() const {
+  return _impl_.checkpoint_after_;
 }
-inline ::model::Operation_OperationType Operation::operation_type() const {
-  return static_cast< ::model::Operation_OperationType >(operation_type_);
+inline int32_t Operation::checkpoint_after() const {
+  // @@protoc_insertion_point(field_get:model.Operation.checkpoint_after)
+  return _internal_checkpoint_after();
 }
-inline void Operation::set_operation_type(::model::Operation_OperationType value) {
-  assert(::model::Operation_OperationType_IsValid(value));
-  set_has_operation_type();
-  operation_type_ = value;
+inline void Operation::_internal_set_checkpoint_after(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.checkpoint_after_ = value;
+}
+inline void Operation::set_checkpoint_after(int32_t value) {
+  _internal_set_checkpoint_after(value);
+  // @@protoc_insertion_point(field_set:model.Operation.checkpoint_after)
 }
 
-// optional int32 batch_size = 5 [default = 100];
-inline bool Operation::has_batch_size() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional string checkpoint_directory = 9;
+inline bool Operation::_internal_has_checkpoint_directory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Operation::set_has_batch_size() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool Operation::has_checkpoint_directory() const {
+  return _internal_has_checkpoint_directory();
 }
-inline void Operation::clear_has_batch_size() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void Operation::clear_checkpoint_directory() {
+  _impl_.checkpoint_directory_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Operation::checkpoint_directory() const {
+  // @@protoc_insertion_point(field_get:model.Operation.checkpoint_directory)
+  return _internal_checkpoint_directory();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Operation::set_checkpoint_directory(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.checkpoint_directory_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.Operation.checkpoint_directory)
+}
+inline std::string* Operation::mutable_checkpoint_directory() {
+  std::string* _s = _internal_mutable_checkpoint_directory();
+  // @@protoc_insertion_point(field_mutable:model.Operation.checkpoint_directory)
+  return _s;
+}
+inline const std::string& Operation::_internal_checkpoint_directory() const {
+  return _impl_.checkpoint_directory_.Get();
+}
+inline void Operation::_internal_set_checkpoint_directory(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.checkpoint_directory_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Operation::_internal_mutable_checkpoint_directory() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.checkpoint_directory_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Operation::release_checkpoint_directory() {
+  // @@protoc_insertion_point(field_release:model.Operation.checkpoint_directory)
+  if (!_internal_has_checkpoint_directory()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.checkpoint_directory_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkpoint_directory_.IsDefault()) {
+    _impl_.checkpoint_directory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Operation::set_allocated_checkpoint_directory(std::string* checkpoint_directory) {
+  if (checkpoint_directory != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.checkpoint_directory_.SetAllocated(checkpoint_directory, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkpoint_directory_.IsDefault()) {
+    _impl_.checkpoint_directory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.Operation.checkpoint_directory)
 }
-inline void Operation::clear_batch_size() {
-  batch_size_ = 100;
-  clear_has_batch_size();
+
+// optional bool randomize = 10 [default = false];
+inline bool Operation::_internal_has_randomize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline ::google::protobuf::int32 Operation::batch_size() const {
-  return batch_size_;
+inline bool Operation::has_randomize() const {
+  return _internal_has_randomize();
 }
-inline void Operation::set_batch_size(::google::protobuf::int32 value) {
-  set_has_batch_size();
-  batch_size_ = value;
+inline void Operation::clear_randomize() {
+  _impl_.randomize_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-
-// optional string data_proto = 6;
-inline bool Operation::has_data_proto() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool Operation::_internal_randomize() const {
+  return _impl_.randomize_;
 }
-inline void Operation::set_has_data_proto() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool Operation::randomize() const {
+  // @@protoc_insertion_point(field_get:model.Operation.randomize)
+  return _internal_randomize();
 }
-inline void Operation::clear_has_data_proto() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void Operation::_internal_set_randomize(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.randomize_ = value;
 }
-inline void Operation::clear_data_proto() {
-  if (data_proto_ != &::google::protobuf::internal::kEmptyString) {
-    data_proto_->clear();
-  }
-  clear_has_data_proto();
+inline void Operation::set_randomize(bool value) {
+  _internal_set_randomize(value);
+  // @@protoc_insertion_point(field_set:model.Operation.randomize)
 }
-inline const ::std::string& Operation::data_proto() const {
-  return *data_proto_;
+
+// optional int32 random_seed = 11 [default = 42];
+inline bool Operation::_internal_has_random_seed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
 }
-inline void Operation::set_data_proto(const ::std::string& value) {
-  set_has_data_proto();
-  if (data_proto_ == &::google::protobuf::internal::kEmptyString) {
-    data_proto_ = new ::std::string;
-  }
-  data_proto_->assign(value);
+inline bool Operation::has_random_seed() const {
+  return _internal_has_random_seed();
 }
-inline void Operation::set_data_proto(const char* value) {
-  set_has_data_proto();
-  if (data_proto_ == &::google::protobuf::internal::kEmptyString) {
-    data_proto_ = new ::std::string;
-  }
-  data_proto_->assign(value);
+inline void Operation::clear_random_seed() {
+  _impl_.random_seed_ = 42;
+  _impl_._has_bits_[0] &= ~0x00008000u;
 }
-inline void Operation::set_data_proto(const char* value, size_t size) {
-  set_has_data_proto();
-  if (data_proto_ == &::google::protobuf::internal::kEmptyString) {
-    data_proto_ = new ::std::string;
-  }
-  data_proto_->assign(reinterpret_cast<const char*>(value), size);
+inline int32_t Operation::_internal_random_seed() const {
+  return _impl_.random_seed_;
 }
-inline ::std::string* Operation::mutable_data_proto() {
-  set_has_data_proto();
-  if (data_proto_ == &::google::protobuf::internal::kEmptyString) {
-    data_proto_ = new ::std::string;
-  }
-  return data_proto_;
+inline int32_t Operation::random_seed() const {
+  // @@protoc_insertion_point(field_get:model.Operation.random_seed)
+  return _internal_random_seed();
 }
-inline ::std::string* Operation::release_data_proto() {
-  clear_has_data_proto();
-  if (data_proto_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = data_proto_;
-    data_proto_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void Operation::_internal_set_random_seed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.random_seed_ = value;
 }
-inline void Operation::set_allocated_data_proto(::std::string* data_proto) {
-  if (data_proto_ != &::google::protobuf::internal::kEmptyString) {
-    delete data_proto_;
-  }
-  if (data_proto) {
-    set_has_data_proto();
-    data_proto_ = data_proto;
-  } else {
-    clear_has_data_proto();
-    data_proto_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void Operation::set_random_seed(int32_t value) {
+  _internal_set_random_seed(value);
+  // @@protoc_insertion_point(field_set:model.Operation.random_seed)
 }
 
-// optional int32 eval_after = 7 [default = 500];
-inline bool Operation::has_eval_after() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+// optional bool verbose = 12 [default = true];
+inline bool Operation::_internal_has_verbose() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
 }
-inline void Operation::set_has_eval_after() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool Operation::has_verbose() const {
+  return _internal_has_verbose();
 }
-inline void Operation::clear_has_eval_after() {
-  _has_bits_[0] &= ~0x00000040u;
+inline void Operation::clear_verbose() {
+  _impl_.verbose_ = true;
+  _impl_._has_bits_[0] &= ~0x00010000u;
 }
-inline void Operation::clear_eval_after() {
-  eval_after_ = 500;
-  clear_has_eval_after();
+inline bool Operation::_internal_verbose() const {
+  return _impl_.verbose_;
 }
-inline ::google::protobuf::int32 Operation::eval_after() const {
-  return eval_after_;
+inline bool Operation::verbose() const {
+  // @@protoc_insertion_point(field_get:model.Operation.verbose)
+  return _internal_verbose();
+}
+inline void Operation::_internal_set_verbose(bool value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.verbose_ = value;
 }
-inline void Operation::set_eval_after(::google::protobuf::int32 value) {
-  set_has_eval_after();
-  eval_after_ = value;
+inline void Operation::set_verbose(bool value) {
+  _internal_set_verbose(value);
+  // @@protoc_insertion_point(field_set:model.Operation.verbose)
 }
 
-// optional int32 checkpoint_after = 8 [default = 1000];
-inline bool Operation::has_checkpoint_after() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+// optional bool normalize_each_train_step = 13 [default = true];
+inline bool Operation::_internal_has_normalize_each_train_step() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool Operation::has_normalize_each_train_step() const {
+  return _internal_has_normalize_each_train_step();
 }
-inline void Operation::set_has_checkpoint_after() {
-  _has_bits_[0] |= 0x00000080u;
+inline void Operation::clear_normalize_each_train_step() {
+  _impl_.normalize_each_train_step_ = true;
+  _impl_._has_bits_[0] &= ~0x00020000u;
 }
-inline void Operation::clear_has_checkpoint_after() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool Operation::_internal_normalize_each_train_step() const {
+  return _impl_.normalize_each_train_step_;
 }
-inline void Operation::clear_checkpoint_after() {
-  checkpoint_after_ = 1000;
-  clear_has_checkpoint_after();
+inline bool Operation::normalize_each_train_step() const {
+  // @@protoc_insertion_point(field_get:model.Operation.normalize_each_train_step)
+  return _internal_normalize_each_train_step();
 }
-inline ::google::protobuf::int32 Operation::checkpoint_after() const {
-  return checkpoint_after_;
+inline void Operation::_internal_set_normalize_each_train_step(bool value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.normalize_each_train_step_ = value;
 }
-inline void Operation::set_checkpoint_after(::google::protobuf::int32 value) {
-  set_has_checkpoint_after();
-  checkpoint_after_ = value;
+inline void Operation::set_normalize_each_train_step(bool value) {
+  _internal_set_normalize_each_train_step(value);
+  // @@protoc_insertion_point(field_set:model.Operation.normalize_each_train_step)
 }
 
-// optional string checkpoint_directory = 9;
-inline bool Operation::has_checkpoint_directory() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+// optional int32 shard_rank = 14 [default = 0];
+inline bool Operation::_internal_has_shard_rank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void Operation::set_has_checkpoint_directory() {
-  _has_bits_[0] |= 0x00000100u;
+inline bool Operation::has_shard_rank() const {
+  return _internal_has_shard_rank();
 }
-inline void Operation::clear_has_checkpoint_directory() {
-  _has_bits_[0] &= ~0x00000100u;
+inline void Operation::clear_shard_rank() {
+  _impl_.shard_rank_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void Operation::clear_checkpoint_directory() {
-  if (checkpoint_directory_ != &::google::protobuf::internal::kEmptyString) {
-    checkpoint_directory_->clear();
-  }
-  clear_has_checkpoint_directory();
+inline int32_t Operation::_internal_shard_rank() const {
+  return _impl_.shard_rank_;
 }
-inline const ::std::string& Operation::checkpoint_directory() const {
-  return *checkpoint_directory_;
+inline int32_t Operation::shard_rank() const {
+  // @@protoc_insertion_point(field_get:model.Operation.shard_rank)
+  return _internal_shard_rank();
 }
-inline void Operation::set_checkpoint_directory(const ::std::string& value) {
-  set_has_checkpoint_directory();
-  if (checkpoint_directory_ == &::google::protobuf::internal::kEmptyString) {
-    checkpoint_directory_ = new ::std::string;
-  }
-  checkpoint_directory_->assign(value);
+inline void Operation::_internal_set_shard_rank(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.shard_rank_ = value;
 }
-inline void Operation::set_checkpoint_directory(const char* value) {
-  set_has_checkpoint_directory();
-  if (checkpoint_directory_ == &::google::protobuf::internal::kEmptyString) {
-    checkpoint_directory_ = new ::std::string;
-  }
-  checkpoint_directory_->assign(value);
+inline void Operation::set_shard_rank(int32_t value) {
+  _internal_set_shard_rank(value);
+  // @@protoc_insertion_point(field_set:model.Operation.shard_rank)
 }
-inline void Operation::set_checkpoint_directory(const char* value, size_t size) {
-  set_has_checkpoint_directory();
-  if (checkpoint_directory_ == &::google::protobuf::internal::kEmptyString) {
-    checkpoint_directory_ = new ::std::string;
-  }
-  checkpoint_directory_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional int32 shard_count = 15 [default = 1];
+inline bool Operation::_internal_has_shard_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
 }
-inline ::std::string* Operation::mutable_checkpoint_directory() {
-  set_has_checkpoint_directory();
-  if (checkpoint_directory_ == &::google::protobuf::internal::kEmptyString) {
-    checkpoint_directory_ = new ::std::string;
-  }
-  return checkpoint_directory_;
+inline bool Operation::has_shard_count() const {
+  return _internal_has_shard_count();
 }
-inline ::std::string* Operation::release_checkpoint_directory() {
-  clear_has_checkpoint_directory();
-  if (checkpoint_directory_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = checkpoint_directory_;
-    checkpoint_directory_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void Operation::clear_shard_count() {
+  _impl_.shard_count_ = 1;
+  _impl_._has_bits_[0] &= ~0x00040000u;
 }
-inline void Operation::set_allocated_checkpoint_directory(::std::string* checkpoint_directory) {
-  if (checkpoint_directory_ != &::google::protobuf::internal::kEmptyString) {
-    delete checkpoint_directory_;
-  }
-  if (checkpoint_directory) {
-    set_has_checkpoint_directory();
-    checkpoint_directory_ = checkpoint_directory;
-  } else {
-    clear_has_checkpoint_directory();
-    checkpoint_directory_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline int32_t Operation::_internal_shard_count() const {
+  return _impl_.shard_count_;
+}
+inline int32_t Operation::shard_count() const {
+  // @@protoc_insertion_point(field_get:model.Operation.shard_count)
+  return _internal_shard_count();
+}
+inline void Operation::_internal_set_shard_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.shard_count_ = value;
+}
+inline void Operation::set_shard_count(int32_t value) {
+  _internal_set_shard_count(value);
+  // @@protoc_insertion_point(field_set:model.Operation.shard_count)
 }
 
-// optional bool randomize = 10 [default = false];
-inline bool Operation::has_randomize() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+// optional int32 thread_count = 16 [default = 1];
+inline bool Operation::_internal_has_thread_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
 }
-inline void Operation::set_has_randomize() {
-  _has_bits_[0] |= 0x00000200u;
+inline bool Operation::has_thread_count() const {
+  return _internal_has_thread_count();
 }
-inline void Operation::clear_has_randomize() {
-  _has_bits_[0] &= ~0x00000200u;
+inline void Operation::clear_thread_count() {
+  _impl_.thread_count_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000800u;
 }
-inline void Operation::clear_randomize() {
-  randomize_ = false;
-  clear_has_randomize();
+inline int32_t Operation::_internal_thread_count() const {
+  return _impl_.thread_count_;
 }
-inline bool Operation::randomize() const {
-  return randomize_;
+inline int32_t Operation::thread_count() const {
+  // @@protoc_insertion_point(field_get:model.Operation.thread_count)
+  return _internal_thread_count();
 }
-inline void Operation::set_randomize(bool value) {
-  set_has_randomize();
-  randomize_ = value;
+inline void Operation::_internal_set_thread_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.thread_count_ = value;
+}
+inline void Operation::set_thread_count(int32_t value) {
+  _internal_set_thread_count(value);
+  // @@protoc_insertion_point(field_set:model.Operation.thread_count)
 }
 
-// optional int32 random_seed = 11 [default = 42];
-inline bool Operation::has_random_seed() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+// optional .model.Operation.ParallelMode parallel_mode = 17 [default = NODE_LEVELS];
+inline bool Operation::_internal_has_parallel_mode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void Operation::set_has_random_seed() {
-  _has_bits_[0] |= 0x00000400u;
+inline bool Operation::has_parallel_mode() const {
+  return _internal_has_parallel_mode();
 }
-inline void Operation::clear_has_random_seed() {
-  _has_bits_[0] &= ~0x00000400u;
+inline void Operation::clear_parallel_mode() {
+  _impl_.parallel_mode_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void Operation::clear_random_seed() {
-  random_seed_ = 42;
-  clear_has_random_seed();
+inline ::model::Operation_ParallelMode Operation::_internal_parallel_mode() const {
+  return static_cast< ::model::Operation_ParallelMode >(_impl_.parallel_mode_);
 }
-inline ::google::protobuf::int32 Operation::random_seed() const {
-  return random_seed_;
+inline ::model::Operation_ParallelMode Operation::parallel_mode() const {
+  // @@protoc_insertion_point(field_get:model.Operation.parallel_mode)
+  return _internal_parallel_mode();
 }
-inline void Operation::set_random_seed(::google::protobuf::int32 value) {
-  set_has_random_seed();
-  random_seed_ = value;
+inline void Operation::_internal_set_parallel_mode(::model::Operation_ParallelMode value) {
+  assert(::model::Operation_ParallelMode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.parallel_mode_ = value;
+}
+inline void Operation::set_parallel_mode(::model::Operation_ParallelMode value) {
+  _internal_set_parallel_mode(value);
+  // @@protoc_insertion_point(field_set:model.Operation.parallel_mode)
 }
 
-// optional bool verbose = 12 [default = true];
-inline bool Operation::has_verbose() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
+// optional float prune_threshold = 18 [default = 0];
+inline bool Operation::_internal_has_prune_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
 }
-inline void Operation::set_has_verbose() {
-  _has_bits_[0] |= 0x00000800u;
+inline bool Operation::has_prune_threshold() const {
+  return _internal_has_prune_threshold();
 }
-inline void Operation::clear_has_verbose() {
-  _has_bits_[0] &= ~0x00000800u;
+inline void Operation::clear_prune_threshold() {
+  _impl_.prune_threshold_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
-inline void Operation::clear_verbose() {
-  verbose_ = true;
-  clear_has_verbose();
+inline float Operation::_internal_prune_threshold() const {
+  return _impl_.prune_threshold_;
 }
-inline bool Operation::verbose() const {
-  return verbose_;
+inline float Operation::prune_threshold() const {
+  // @@protoc_insertion_point(field_get:model.Operation.prune_threshold)
+  return _internal_prune_threshold();
 }
-inline void Operation::set_verbose(bool value) {
-  set_has_verbose();
-  verbose_ = value;
+inline void Operation::_internal_set_prune_threshold(float value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.prune_threshold_ = value;
+}
+inline void Operation::set_prune_threshold(float value) {
+  _internal_set_prune_threshold(value);
+  // @@protoc_insertion_point(field_set:model.Operation.prune_threshold)
 }
 
-// optional bool normalize_each_train_step = 13 [default = true];
-inline bool Operation::has_normalize_each_train_step() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+// optional bool simplify = 19 [default = false];
+inline bool Operation::_internal_has_simplify() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void Operation::set_has_normalize_each_train_step() {
-  _has_bits_[0] |= 0x00001000u;
+inline bool Operation::has_simplify() const {
+  return _internal_has_simplify();
 }
-inline void Operation::clear_has_normalize_each_train_step() {
-  _has_bits_[0] &= ~0x00001000u;
+inline void Operation::clear_simplify() {
+  _impl_.simplify_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void Operation::clear_normalize_each_train_step() {
-  normalize_each_train_step_ = true;
-  clear_has_normalize_each_train_step();
+inline bool Operation::_internal_simplify() const {
+  return _impl_.simplify_;
 }
-inline bool Operation::normalize_each_train_step() const {
-  return normalize_each_train_step_;
+inline bool Operation::simplify() const {
+  // @@protoc_insertion_point(field_get:model.Operation.simplify)
+  return _internal_simplify();
 }
-inline void Operation::set_normalize_each_train_step(bool value) {
-  set_has_normalize_each_train_step();
-  normalize_each_train_step_ = value;
+inline void Operation::_internal_set_simplify(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.simplify_ = value;
+}
+inline void Operation::set_simplify(bool value) {
+  _internal_set_simplify(value);
+  // @@protoc_insertion_point(field_set:model.Operation.simplify)
 }
 
 // -------------------------------------------------------------------
@@ -4438,520 +7680,686 @@ inline void Operation::set_normalize_each_train_step(bool value) {
 // DatasetInfo
 
 // required .model.DatasetInfo.DataType type = 1;
-inline bool DatasetInfo::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool DatasetInfo::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void DatasetInfo::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void DatasetInfo::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool DatasetInfo::has_type() const {
+  return _internal_has_type();
 }
 inline void DatasetInfo::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::model::DatasetInfo_DataType DatasetInfo::_internal_type() const {
+  return static_cast< ::model::DatasetInfo_DataType >(_impl_.type_);
 }
 inline ::model::DatasetInfo_DataType DatasetInfo::type() const {
-  return static_cast< ::model::DatasetInfo_DataType >(type_);
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.type)
+  return _internal_type();
 }
-inline void DatasetInfo::set_type(::model::DatasetInfo_DataType value) {
+inline void DatasetInfo::_internal_set_type(::model::DatasetInfo_DataType value) {
   assert(::model::DatasetInfo_DataType_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void DatasetInfo::set_type(::model::DatasetInfo_DataType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.type)
 }
 
 // required string file_pattern = 2;
-inline bool DatasetInfo::has_file_pattern() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void DatasetInfo::set_has_file_pattern() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool DatasetInfo::_internal_has_file_pattern() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void DatasetInfo::clear_has_file_pattern() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool DatasetInfo::has_file_pattern() const {
+  return _internal_has_file_pattern();
 }
 inline void DatasetInfo::clear_file_pattern() {
-  if (file_pattern_ != &::google::protobuf::internal::kEmptyString) {
-    file_pattern_->clear();
-  }
-  clear_has_file_pattern();
-}
-inline const ::std::string& DatasetInfo::file_pattern() const {
-  return *file_pattern_;
-}
-inline void DatasetInfo::set_file_pattern(const ::std::string& value) {
-  set_has_file_pattern();
-  if (file_pattern_ == &::google::protobuf::internal::kEmptyString) {
-    file_pattern_ = new ::std::string;
-  }
-  file_pattern_->assign(value);
-}
-inline void DatasetInfo::set_file_pattern(const char* value) {
-  set_has_file_pattern();
-  if (file_pattern_ == &::google::protobuf::internal::kEmptyString) {
-    file_pattern_ = new ::std::string;
-  }
-  file_pattern_->assign(value);
-}
-inline void DatasetInfo::set_file_pattern(const char* value, size_t size) {
-  set_has_file_pattern();
-  if (file_pattern_ == &::google::protobuf::internal::kEmptyString) {
-    file_pattern_ = new ::std::string;
-  }
-  file_pattern_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* DatasetInfo::mutable_file_pattern() {
-  set_has_file_pattern();
-  if (file_pattern_ == &::google::protobuf::internal::kEmptyString) {
-    file_pattern_ = new ::std::string;
-  }
-  return file_pattern_;
-}
-inline ::std::string* DatasetInfo::release_file_pattern() {
-  clear_has_file_pattern();
-  if (file_pattern_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.file_pattern_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DatasetInfo::file_pattern() const {
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.file_pattern)
+  return _internal_file_pattern();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DatasetInfo::set_file_pattern(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.file_pattern_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.file_pattern)
+}
+inline std::string* DatasetInfo::mutable_file_pattern() {
+  std::string* _s = _internal_mutable_file_pattern();
+  // @@protoc_insertion_point(field_mutable:model.DatasetInfo.file_pattern)
+  return _s;
+}
+inline const std::string& DatasetInfo::_internal_file_pattern() const {
+  return _impl_.file_pattern_.Get();
+}
+inline void DatasetInfo::_internal_set_file_pattern(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.file_pattern_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DatasetInfo::_internal_mutable_file_pattern() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.file_pattern_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DatasetInfo::release_file_pattern() {
+  // @@protoc_insertion_point(field_release:model.DatasetInfo.file_pattern)
+  if (!_internal_has_file_pattern()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.file_pattern_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_pattern_.IsDefault()) {
+    _impl_.file_pattern_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DatasetInfo::set_allocated_file_pattern(std::string* file_pattern) {
+  if (file_pattern != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = file_pattern_;
-    file_pattern_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void DatasetInfo::set_allocated_file_pattern(::std::string* file_pattern) {
-  if (file_pattern_ != &::google::protobuf::internal::kEmptyString) {
-    delete file_pattern_;
-  }
-  if (file_pattern) {
-    set_has_file_pattern();
-    file_pattern_ = file_pattern;
-  } else {
-    clear_has_file_pattern();
-    file_pattern_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.file_pattern_.SetAllocated(file_pattern, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_pattern_.IsDefault()) {
+    _impl_.file_pattern_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.DatasetInfo.file_pattern)
 }
 
 // required int32 size = 3;
+inline bool DatasetInfo::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool DatasetInfo::has_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_size();
 }
-inline void DatasetInfo::set_has_size() {
-  _has_bits_[0] |= 0x00000004u;
+inline void DatasetInfo::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void DatasetInfo::clear_has_size() {
-  _has_bits_[0] &= ~0x00000004u;
+inline int32_t DatasetInfo::_internal_size() const {
+  return _impl_.size_;
 }
-inline void DatasetInfo::clear_size() {
-  size_ = 0;
-  clear_has_size();
+inline int32_t DatasetInfo::size() const {
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.size)
+  return _internal_size();
 }
-inline ::google::protobuf::int32 DatasetInfo::size() const {
-  return size_;
+inline void DatasetInfo::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.size_ = value;
 }
-inline void DatasetInfo::set_size(::google::protobuf::int32 value) {
-  set_has_size();
-  size_ = value;
+inline void DatasetInfo::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.size)
 }
 
 // required int32 dimensions = 4;
+inline bool DatasetInfo::_internal_has_dimensions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool DatasetInfo::has_dimensions() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_dimensions();
 }
-inline void DatasetInfo::set_has_dimensions() {
-  _has_bits_[0] |= 0x00000008u;
+inline void DatasetInfo::clear_dimensions() {
+  _impl_.dimensions_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void DatasetInfo::clear_has_dimensions() {
-  _has_bits_[0] &= ~0x00000008u;
+inline int32_t DatasetInfo::_internal_dimensions() const {
+  return _impl_.dimensions_;
 }
-inline void DatasetInfo::clear_dimensions() {
-  dimensions_ = 0;
-  clear_has_dimensions();
+inline int32_t DatasetInfo::dimensions() const {
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.dimensions)
+  return _internal_dimensions();
 }
-inline ::google::protobuf::int32 DatasetInfo::dimensions() const {
-  return dimensions_;
+inline void DatasetInfo::_internal_set_dimensions(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.dimensions_ = value;
 }
-inline void DatasetInfo::set_dimensions(::google::protobuf::int32 value) {
-  set_has_dimensions();
-  dimensions_ = value;
+inline void DatasetInfo::set_dimensions(int32_t value) {
+  _internal_set_dimensions(value);
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.dimensions)
 }
 
 // optional int32 type_size = 5 [default = 4];
+inline bool DatasetInfo::_internal_has_type_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool DatasetInfo::has_type_size() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_type_size();
 }
-inline void DatasetInfo::set_has_type_size() {
-  _has_bits_[0] |= 0x00000010u;
+inline void DatasetInfo::clear_type_size() {
+  _impl_.type_size_ = 4;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void DatasetInfo::clear_has_type_size() {
-  _has_bits_[0] &= ~0x00000010u;
+inline int32_t DatasetInfo::_internal_type_size() const {
+  return _impl_.type_size_;
 }
-inline void DatasetInfo::clear_type_size() {
-  type_size_ = 4;
-  clear_has_type_size();
+inline int32_t DatasetInfo::type_size() const {
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.type_size)
+  return _internal_type_size();
 }
-inline ::google::protobuf::int32 DatasetInfo::type_size() const {
-  return type_size_;
+inline void DatasetInfo::_internal_set_type_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.type_size_ = value;
 }
-inline void DatasetInfo::set_type_size(::google::protobuf::int32 value) {
-  set_has_type_size();
-  type_size_ = value;
+inline void DatasetInfo::set_type_size(int32_t value) {
+  _internal_set_type_size(value);
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.type_size)
 }
 
 // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
-inline bool DatasetInfo::has_data_format() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void DatasetInfo::set_has_data_format() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool DatasetInfo::_internal_has_data_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void DatasetInfo::clear_has_data_format() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool DatasetInfo::has_data_format() const {
+  return _internal_has_data_format();
 }
 inline void DatasetInfo::clear_data_format() {
-  data_format_ = 0;
-  clear_has_data_format();
+  _impl_.data_format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::model::DatasetInfo_DataFormat DatasetInfo::_internal_data_format() const {
+  return static_cast< ::model::DatasetInfo_DataFormat >(_impl_.data_format_);
 }
 inline ::model::DatasetInfo_DataFormat DatasetInfo::data_format() const {
-  return static_cast< ::model::DatasetInfo_DataFormat >(data_format_);
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.data_format)
+  return _internal_data_format();
 }
-inline void DatasetInfo::set_data_format(::model::DatasetInfo_DataFormat value) {
+inline void DatasetInfo::_internal_set_data_format(::model::DatasetInfo_DataFormat value) {
   assert(::model::DatasetInfo_DataFormat_IsValid(value));
-  set_has_data_format();
-  data_format_ = value;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.data_format_ = value;
+}
+inline void DatasetInfo::set_data_format(::model::DatasetInfo_DataFormat value) {
+  _internal_set_data_format(value);
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.data_format)
 }
 
-// -------------------------------------------------------------------
-
-// DatabaseInfo
-
-// required string name = 1;
-inline bool DatabaseInfo::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .model.DatasetInfo.DiskReader disk_reader = 7 [default = STREAM];
+inline bool DatasetInfo::_internal_has_disk_reader() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void DatabaseInfo::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool DatasetInfo::has_disk_reader() const {
+  return _internal_has_disk_reader();
 }
-inline void DatabaseInfo::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void DatasetInfo::clear_disk_reader() {
+  _impl_.disk_reader_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void DatabaseInfo::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
+inline ::model::DatasetInfo_DiskReader DatasetInfo::_internal_disk_reader() const {
+  return static_cast< ::model::DatasetInfo_DiskReader >(_impl_.disk_reader_);
 }
-inline const ::std::string& DatabaseInfo::name() const {
-  return *name_;
+inline ::model::DatasetInfo_DiskReader DatasetInfo::disk_reader() const {
+  // @@protoc_insertion_point(field_get:model.DatasetInfo.disk_reader)
+  return _internal_disk_reader();
 }
-inline void DatabaseInfo::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void DatasetInfo::_internal_set_disk_reader(::model::DatasetInfo_DiskReader value) {
+  assert(::model::DatasetInfo_DiskReader_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.disk_reader_ = value;
 }
-inline void DatabaseInfo::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void DatasetInfo::set_disk_reader(::model::DatasetInfo_DiskReader value) {
+  _internal_set_disk_reader(value);
+  // @@protoc_insertion_point(field_set:model.DatasetInfo.disk_reader)
 }
-inline void DatabaseInfo::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+
+// -------------------------------------------------------------------
+
+// DatabaseInfo
+
+// required string name = 1;
+inline bool DatabaseInfo::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* DatabaseInfo::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline bool DatabaseInfo::has_name() const {
+  return _internal_has_name();
 }
-inline ::std::string* DatabaseInfo::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void DatabaseInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DatabaseInfo::name() const {
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DatabaseInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.name)
+}
+inline std::string* DatabaseInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:model.DatabaseInfo.name)
+  return _s;
+}
+inline const std::string& DatabaseInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void DatabaseInfo::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DatabaseInfo::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DatabaseInfo::release_name() {
+  // @@protoc_insertion_point(field_release:model.DatabaseInfo.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DatabaseInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void DatabaseInfo::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.DatabaseInfo.name)
 }
 
 // repeated .model.DatasetInfo data = 2;
+inline int DatabaseInfo::_internal_data_size() const {
+  return _impl_.data_.size();
+}
 inline int DatabaseInfo::data_size() const {
-  return data_.size();
+  return _internal_data_size();
 }
 inline void DatabaseInfo::clear_data() {
-  data_.Clear();
+  _impl_.data_.Clear();
+}
+inline ::model::DatasetInfo* DatabaseInfo::mutable_data(int index) {
+  // @@protoc_insertion_point(field_mutable:model.DatabaseInfo.data)
+  return _impl_.data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::DatasetInfo >*
+DatabaseInfo::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:model.DatabaseInfo.data)
+  return &_impl_.data_;
+}
+inline const ::model::DatasetInfo& DatabaseInfo::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
 }
 inline const ::model::DatasetInfo& DatabaseInfo::data(int index) const {
-  return data_.Get(index);
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.data)
+  return _internal_data(index);
 }
-inline ::model::DatasetInfo* DatabaseInfo::mutable_data(int index) {
-  return data_.Mutable(index);
+inline ::model::DatasetInfo* DatabaseInfo::_internal_add_data() {
+  return _impl_.data_.Add();
 }
 inline ::model::DatasetInfo* DatabaseInfo::add_data() {
-  return data_.Add();
+  ::model::DatasetInfo* _add = _internal_add_data();
+  // @@protoc_insertion_point(field_add:model.DatabaseInfo.data)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::model::DatasetInfo >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::model::DatasetInfo >&
 DatabaseInfo::data() const {
-  return data_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::model::DatasetInfo >*
-DatabaseInfo::mutable_data() {
-  return &data_;
+  // @@protoc_insertion_point(field_list:model.DatabaseInfo.data)
+  return _impl_.data_;
 }
 
 // optional string data_handler = 3 [default = "deeplearn"];
-inline bool DatabaseInfo::has_data_handler() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool DatabaseInfo::_internal_has_data_handler() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void DatabaseInfo::set_has_data_handler() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void DatabaseInfo::clear_has_data_handler() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool DatabaseInfo::has_data_handler() const {
+  return _internal_has_data_handler();
 }
 inline void DatabaseInfo::clear_data_handler() {
-  if (data_handler_ != _default_data_handler_) {
-    data_handler_->assign(*_default_data_handler_);
-  }
-  clear_has_data_handler();
-}
-inline const ::std::string& DatabaseInfo::data_handler() const {
-  return *data_handler_;
-}
-inline void DatabaseInfo::set_data_handler(const ::std::string& value) {
-  set_has_data_handler();
-  if (data_handler_ == _default_data_handler_) {
-    data_handler_ = new ::std::string;
-  }
-  data_handler_->assign(value);
-}
-inline void DatabaseInfo::set_data_handler(const char* value) {
-  set_has_data_handler();
-  if (data_handler_ == _default_data_handler_) {
-    data_handler_ = new ::std::string;
-  }
-  data_handler_->assign(value);
-}
-inline void DatabaseInfo::set_data_handler(const char* value, size_t size) {
-  set_has_data_handler();
-  if (data_handler_ == _default_data_handler_) {
-    data_handler_ = new ::std::string;
-  }
-  data_handler_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* DatabaseInfo::mutable_data_handler() {
-  set_has_data_handler();
-  if (data_handler_ == _default_data_handler_) {
-    data_handler_ = new ::std::string(*_default_data_handler_);
-  }
-  return data_handler_;
-}
-inline ::std::string* DatabaseInfo::release_data_handler() {
-  clear_has_data_handler();
-  if (data_handler_ == _default_data_handler_) {
-    return NULL;
-  } else {
-    ::std::string* temp = data_handler_;
-    data_handler_ = const_cast< ::std::string*>(_default_data_handler_);
-    return temp;
-  }
-}
-inline void DatabaseInfo::set_allocated_data_handler(::std::string* data_handler) {
-  if (data_handler_ != _default_data_handler_) {
-    delete data_handler_;
-  }
-  if (data_handler) {
-    set_has_data_handler();
-    data_handler_ = data_handler;
+  _impl_.data_handler_.ClearToDefault(::model::DatabaseInfo::Impl_::_i_give_permission_to_break_this_code_default_data_handler_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& DatabaseInfo::data_handler() const {
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.data_handler)
+  if (_impl_.data_handler_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_data_handler_.get();
+  return _internal_data_handler();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DatabaseInfo::set_data_handler(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.data_handler_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.data_handler)
+}
+inline std::string* DatabaseInfo::mutable_data_handler() {
+  std::string* _s = _internal_mutable_data_handler();
+  // @@protoc_insertion_point(field_mutable:model.DatabaseInfo.data_handler)
+  return _s;
+}
+inline const std::string& DatabaseInfo::_internal_data_handler() const {
+  return _impl_.data_handler_.Get();
+}
+inline void DatabaseInfo::_internal_set_data_handler(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.data_handler_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DatabaseInfo::_internal_mutable_data_handler() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.data_handler_.Mutable(::model::DatabaseInfo::Impl_::_i_give_permission_to_break_this_code_default_data_handler_, GetArenaForAllocation());
+}
+inline std::string* DatabaseInfo::release_data_handler() {
+  // @@protoc_insertion_point(field_release:model.DatabaseInfo.data_handler)
+  if (!_internal_has_data_handler()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.data_handler_.Release();
+  return p;
+}
+inline void DatabaseInfo::set_allocated_data_handler(std::string* data_handler) {
+  if (data_handler != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_data_handler();
-    data_handler_ = const_cast< ::std::string*>(_default_data_handler_);
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.data_handler_.SetAllocated(data_handler, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:model.DatabaseInfo.data_handler)
 }
 
 // optional float main_memory = 4 [default = 2];
-inline bool DatabaseInfo::has_main_memory() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool DatabaseInfo::_internal_has_main_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void DatabaseInfo::set_has_main_memory() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void DatabaseInfo::clear_has_main_memory() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool DatabaseInfo::has_main_memory() const {
+  return _internal_has_main_memory();
 }
 inline void DatabaseInfo::clear_main_memory() {
-  main_memory_ = 2;
-  clear_has_main_memory();
+  _impl_.main_memory_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float DatabaseInfo::_internal_main_memory() const {
+  return _impl_.main_memory_;
 }
 inline float DatabaseInfo::main_memory() const {
-  return main_memory_;
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.main_memory)
+  return _internal_main_memory();
+}
+inline void DatabaseInfo::_internal_set_main_memory(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.main_memory_ = value;
 }
 inline void DatabaseInfo::set_main_memory(float value) {
-  set_has_main_memory();
-  main_memory_ = value;
+  _internal_set_main_memory(value);
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.main_memory)
 }
 
 // optional float gpu_memory = 5 [default = 1.5];
-inline bool DatabaseInfo::has_gpu_memory() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void DatabaseInfo::set_has_gpu_memory() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool DatabaseInfo::_internal_has_gpu_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void DatabaseInfo::clear_has_gpu_memory() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool DatabaseInfo::has_gpu_memory() const {
+  return _internal_has_gpu_memory();
 }
 inline void DatabaseInfo::clear_gpu_memory() {
-  gpu_memory_ = 1.5f;
-  clear_has_gpu_memory();
+  _impl_.gpu_memory_ = 1.5f;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline float DatabaseInfo::_internal_gpu_memory() const {
+  return _impl_.gpu_memory_;
 }
 inline float DatabaseInfo::gpu_memory() const {
-  return gpu_memory_;
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.gpu_memory)
+  return _internal_gpu_memory();
+}
+inline void DatabaseInfo::_internal_set_gpu_memory(float value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.gpu_memory_ = value;
 }
 inline void DatabaseInfo::set_gpu_memory(float value) {
-  set_has_gpu_memory();
-  gpu_memory_ = value;
+  _internal_set_gpu_memory(value);
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.gpu_memory)
 }
 
 // optional string path_prefix = 6 [default = ""];
-inline bool DatabaseInfo::has_path_prefix() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool DatabaseInfo::_internal_has_path_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void DatabaseInfo::set_has_path_prefix() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void DatabaseInfo::clear_has_path_prefix() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool DatabaseInfo::has_path_prefix() const {
+  return _internal_has_path_prefix();
 }
 inline void DatabaseInfo::clear_path_prefix() {
-  if (path_prefix_ != &::google::protobuf::internal::kEmptyString) {
-    path_prefix_->clear();
+  _impl_.path_prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& DatabaseInfo::path_prefix() const {
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.path_prefix)
+  return _internal_path_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DatabaseInfo::set_path_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.path_prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.path_prefix)
+}
+inline std::string* DatabaseInfo::mutable_path_prefix() {
+  std::string* _s = _internal_mutable_path_prefix();
+  // @@protoc_insertion_point(field_mutable:model.DatabaseInfo.path_prefix)
+  return _s;
+}
+inline const std::string& DatabaseInfo::_internal_path_prefix() const {
+  return _impl_.path_prefix_.Get();
+}
+inline void DatabaseInfo::_internal_set_path_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.path_prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DatabaseInfo::_internal_mutable_path_prefix() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.path_prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DatabaseInfo::release_path_prefix() {
+  // @@protoc_insertion_point(field_release:model.DatabaseInfo.path_prefix)
+  if (!_internal_has_path_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.path_prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_prefix_.IsDefault()) {
+    _impl_.path_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DatabaseInfo::set_allocated_path_prefix(std::string* path_prefix) {
+  if (path_prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.path_prefix_.SetAllocated(path_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_prefix_.IsDefault()) {
+    _impl_.path_prefix_.Set("", GetArenaForAllocation());
   }
-  clear_has_path_prefix();
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:model.DatabaseInfo.path_prefix)
 }
-inline const ::std::string& DatabaseInfo::path_prefix() const {
-  return *path_prefix_;
+
+// optional int32 shard_rank = 7 [default = 0];
+inline bool DatabaseInfo::_internal_has_shard_rank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void DatabaseInfo::set_path_prefix(const ::std::string& value) {
-  set_has_path_prefix();
-  if (path_prefix_ == &::google::protobuf::internal::kEmptyString) {
-    path_prefix_ = new ::std::string;
-  }
-  path_prefix_->assign(value);
+inline bool DatabaseInfo::has_shard_rank() const {
+  return _internal_has_shard_rank();
 }
-inline void DatabaseInfo::set_path_prefix(const char* value) {
-  set_has_path_prefix();
-  if (path_prefix_ == &::google::protobuf::internal::kEmptyString) {
-    path_prefix_ = new ::std::string;
-  }
-  path_prefix_->assign(value);
+inline void DatabaseInfo::clear_shard_rank() {
+  _impl_.shard_rank_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void DatabaseInfo::set_path_prefix(const char* value, size_t size) {
-  set_has_path_prefix();
-  if (path_prefix_ == &::google::protobuf::internal::kEmptyString) {
-    path_prefix_ = new ::std::string;
-  }
-  path_prefix_->assign(reinterpret_cast<const char*>(value), size);
+inline int32_t DatabaseInfo::_internal_shard_rank() const {
+  return _impl_.shard_rank_;
 }
-inline ::std::string* DatabaseInfo::mutable_path_prefix() {
-  set_has_path_prefix();
-  if (path_prefix_ == &::google::protobuf::internal::kEmptyString) {
-    path_prefix_ = new ::std::string;
-  }
-  return path_prefix_;
+inline int32_t DatabaseInfo::shard_rank() const {
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.shard_rank)
+  return _internal_shard_rank();
 }
-inline ::std::string* DatabaseInfo::release_path_prefix() {
-  clear_has_path_prefix();
-  if (path_prefix_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = path_prefix_;
-    path_prefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void DatabaseInfo::_internal_set_shard_rank(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.shard_rank_ = value;
 }
-inline void DatabaseInfo::set_allocated_path_prefix(::std::string* path_prefix) {
-  if (path_prefix_ != &::google::protobuf::internal::kEmptyString) {
-    delete path_prefix_;
-  }
-  if (path_prefix) {
-    set_has_path_prefix();
-    path_prefix_ = path_prefix;
-  } else {
-    clear_has_path_prefix();
-    path_prefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void DatabaseInfo::set_shard_rank(int32_t value) {
+  _internal_set_shard_rank(value);
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.shard_rank)
+}
+
+// optional int32 shard_count = 8 [default = 1];
+inline bool DatabaseInfo::_internal_has_shard_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
+inline bool DatabaseInfo::has_shard_count() const {
+  return _internal_has_shard_count();
+}
+inline void DatabaseInfo::clear_shard_count() {
+  _impl_.shard_count_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t DatabaseInfo::_internal_shard_count() const {
+  return _impl_.shard_count_;
+}
+inline int32_t DatabaseInfo::shard_count() const {
+  // @@protoc_insertion_point(field_get:model.DatabaseInfo.shard_count)
+  return _internal_shard_count();
+}
+inline void DatabaseInfo::_internal_set_shard_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.shard_count_ = value;
+}
+inline void DatabaseInfo::set_shard_count(int32_t value) {
+  _internal_set_shard_count(value);
+  // @@protoc_insertion_point(field_set:model.DatabaseInfo.shard_count)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace model
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::model::Metric_MetricType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::Metric_MetricType>() {
   return ::model::Metric_MetricType_descriptor();
 }
+template <> struct is_proto_enum< ::model::Hyperparams_Decay> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::Hyperparams_Decay>() {
   return ::model::Hyperparams_Decay_descriptor();
 }
+template <> struct is_proto_enum< ::model::Hyperparams_BestModelCriterion> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::Hyperparams_BestModelCriterion>() {
   return ::model::Hyperparams_BestModelCriterion_descriptor();
 }
+template <> struct is_proto_enum< ::model::NodeData_NodeType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::NodeData_NodeType>() {
   return ::model::NodeData_NodeType_descriptor();
 }
+template <> struct is_proto_enum< ::model::ModelData_ModelType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::ModelData_ModelType>() {
   return ::model::ModelData_ModelType_descriptor();
 }
+template <> struct is_proto_enum< ::model::Operation_Optimizer> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::Operation_Optimizer>() {
   return ::model::Operation_Optimizer_descriptor();
 }
+template <> struct is_proto_enum< ::model::Operation_OperationType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::Operation_OperationType>() {
   return ::model::Operation_OperationType_descriptor();
 }
+template <> struct is_proto_enum< ::model::Operation_ParallelMode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::model::Operation_ParallelMode>() {
+  return ::model::Operation_ParallelMode_descriptor();
+}
+template <> struct is_proto_enum< ::model::DatasetInfo_DataType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::DatasetInfo_DataType>() {
   return ::model::DatasetInfo_DataType_descriptor();
 }
+template <> struct is_proto_enum< ::model::DatasetInfo_DataFormat> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::model::DatasetInfo_DataFormat>() {
   return ::model::DatasetInfo_DataFormat_descriptor();
 }
+template <> struct is_proto_enum< ::model::DatasetInfo_DiskReader> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::model::DatasetInfo_DiskReader>() {
+  return ::model::DatasetInfo_DiskReader_descriptor();
+}
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_deeplearn_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_deeplearn_2eproto
@@ -0,0 +1,1205 @@
+/*
+ * File:   CompiledSpn.cpp
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:31 PM
+ */
+
+#include <boost/assert.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_01.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include "CompiledSpn.h"
+
+// at least this many samples (nodes x batch size) per task on the thread pool
+#define MIN_SAMPLES_PER_TASK    16384
+// at least this many rows per workspace when partitioning the batch
+#define MIN_ROWS_PER_WORKSPACE  32
+// rows of a block of Sample(), each block having its own random stream
+#define SAMPLE_BLOCK_ROWS       1024
+// at least this many weights per task of NormalizeWeights()
+#define MIN_WEIGHTS_PER_TASK    16384
+
+namespace model
+{
+
+CompiledSpn::CompiledSpn()
+: m_argmaxCount(0)
+, m_productSlotCount(0)
+, m_bContiguousWeights(true)
+, m_samples(NULL)
+, m_sampleCount(0)
+, m_sampleSeed(0)
+, m_batchSize(0)
+, m_batchDimension(0)
+, m_bLogSpace(false)
+, m_threadPool(NULL)
+, m_bPartitionBatch(false)
+, m_bMaxProduct(false)
+, m_phaseCount(1)
+, m_bCacheValid(false)
+, m_levelStart(0)
+{
+    m_buffers.resize(1);
+    m_workspaces.resize(1);
+}
+
+CompiledSpn::~CompiledSpn()
+{
+    delete m_threadPool;
+    m_threadPool = NULL;
+}
+
+/*****************************************************************************/
+
+CompiledSpn* CompiledSpn::Compile(std::vector<Node*>& nodeList
+    , bool bLogSpace /*= false*/)
+{
+    size_t N = nodeList.size();
+    std::map<Node*, size_t> nodeIndices;
+    std::vector<size_t> levels(N, 0);
+    size_t levelCount = 1;
+    
+    // levels, in the order of nodeList
+    for (size_t i = 0; i < N; ++i)
+    {
+        Node* node = nodeList.at(i);
+        
+        if (node->GetDimension() != 1)
+            return NULL;
+        nodeIndices[node] = i;
+        
+        // children come before their parents in nodeList
+        std::vector<Edge*>& edges = node->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator it = edges.begin(); it != edges.end(); ++it)
+        {
+            std::map<Node*, size_t>::iterator itChild = nodeIndices.find((*it)->GetNode1());
+            if ((*it)->GetNode2() != node || itChild == nodeIndices.end())
+                return NULL;
+            levels[i] = std::max(levels[i], levels[itChild->second] + 1);
+        }
+        levelCount = std::max(levelCount, levels[i] + 1);
+    }
+    
+    // order the nodes by level, keeping the order of nodeList inside a level.
+    // The root is the only node of the last level.
+    CompiledSpn* spn = new CompiledSpn();
+    spn->m_bLogSpace = bLogSpace;
+    spn->m_levelOffsets.assign(levelCount + 1, 0);
+    for (size_t i = 0; i < N; ++i)
+        spn->m_levelOffsets[levels[i] + 1]++;
+    for (size_t l = 0; l < levelCount; ++l)
+        spn->m_levelOffsets[l + 1] += spn->m_levelOffsets[l];
+    
+    std::vector<size_t> newIndices(N), order(N);
+    std::vector<size_t> fill(spn->m_levelOffsets.begin(), spn->m_levelOffsets.end() - 1);
+    for (size_t i = 0; i < N; ++i)
+    {
+        newIndices[i] = fill[levels[i]]++;
+        order[newIndices[i]] = i;
+    }
+    
+    spn->m_childOffsets.push_back(0);
+    for (size_t n = 0; n < N; ++n)
+    {
+        Node* node = nodeList.at(order[n]);
+        int nodeType = node->GetNodeType();
+        
+        spn->m_types.push_back(nodeType);
+        bool bQueryDependent = (nodeType == NodeData::QUERY);
+        spn->m_argmaxRows.push_back(isWeighted(nodeType) ? (int)spn->m_argmaxCount++ : -1);
+        spn->m_inputIndices.push_back(nodeType == NodeData::INPUT
+                || nodeType == NodeData::QUERY ? (int)node->GetInputStartIndex() : -1);
+        
+        std::vector<Edge*>& edges = node->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator it = edges.begin(); it != edges.end(); ++it)
+        {
+            spn->m_children.push_back(newIndices[nodeIndices[(*it)->GetNode1()]]);
+            bQueryDependent = bQueryDependent || spn->m_queryDependent[spn->m_children.back()];
+            spn->m_slotParents.push_back(n);
+            spn->m_slotRows.push_back(nodeType == NodeData::PRODUCT
+                    ? (int)spn->m_productSlotCount++ : -1);
+            spn->m_edges.push_back(*it);
+        }
+        spn->m_childOffsets.push_back(spn->m_children.size());
+        spn->m_queryDependent.push_back(bQueryDependent);
+        spn->m_nodeLevels.push_back(levels[order[n]]);
+    }
+    
+    // parents, as the transpose of the children
+    spn->m_parentOffsets.assign(N + 1, 0);
+    for (size_t k = 0; k < spn->m_children.size(); ++k)
+        spn->m_parentOffsets[spn->m_children[k] + 1]++;
+    for (size_t n = 0; n < N; ++n)
+        spn->m_parentOffsets[n + 1] += spn->m_parentOffsets[n];
+    spn->m_parentSlots.resize(spn->m_children.size());
+    fill.assign(spn->m_parentOffsets.begin(), spn->m_parentOffsets.end() - 1);
+    for (size_t k = 0; k < spn->m_children.size(); ++k)
+        spn->m_parentSlots[fill[spn->m_children[k]]++] = k;
+    
+    // the leaves reading each column
+    size_t columnCount = 0;
+    for (size_t n = 0; n < N; ++n)
+        columnCount = std::max(columnCount, (size_t)(spn->m_inputIndices[n] + 1));
+    spn->m_columnOffsets.assign(columnCount + 1, 0);
+    for (size_t n = 0; n < N; ++n)
+    {
+        if (spn->m_inputIndices[n] >= 0)
+            spn->m_columnOffsets[spn->m_inputIndices[n] + 1]++;
+    }
+    for (size_t c = 0; c < columnCount; ++c)
+        spn->m_columnOffsets[c + 1] += spn->m_columnOffsets[c];
+    spn->m_columnLeaves.resize(spn->m_columnOffsets[columnCount]);
+    fill.assign(spn->m_columnOffsets.begin(), spn->m_columnOffsets.end() - 1);
+    for (size_t n = 0; n < N; ++n)
+    {
+        if (spn->m_inputIndices[n] >= 0)
+            spn->m_columnLeaves[fill[spn->m_inputIndices[n]]++] = n;
+    }
+    spn->m_dirty.resize(N, false);
+    spn->m_dirtyLevels.resize(levelCount);
+    
+    // normally true once Model::bindParameters() ran
+    for (size_t n = 0; n < N && spn->m_bContiguousWeights; ++n)
+    {
+        const size_t kBegin = spn->m_childOffsets[n], kEnd = spn->m_childOffsets[n+1];
+        for (size_t k = kBegin + 1; k < kEnd && spn->m_bContiguousWeights; ++k)
+        {
+            spn->m_bContiguousWeights = (spn->m_edges[k]->GetWeightData()
+                    == spn->m_edges[kBegin]->GetWeightData() + (k - kBegin));
+        }
+    }
+    
+    spn->m_weights.resize(spn->m_children.size(), 1);
+    spn->m_counts.resize(spn->m_children.size(), 0);
+    if (bLogSpace)
+        spn->m_logWeights.resize(spn->m_children.size(), 0);
+    spn->LoadWeights();
+    return spn;
+}
+
+void CompiledSpn::LoadWeights()
+{
+    for (size_t i = 0; i < m_types.size(); ++i)
+    {
+        if (!isWeighted(m_types[i]))
+            continue;
+        for (size_t k = m_childOffsets[i]; k < m_childOffsets[i+1]; ++k)
+        {
+            const float w = m_edges[k]->GetWeightData()[0];
+            if (w != m_weights[k])
+                m_bCacheValid = false;
+            m_weights[k] = w;
+            
+            // non-positive weights can't contribute to the log-sum-exp
+            if (m_bLogSpace)
+            {
+                m_logWeights[k] = m_weights[k] > 0 ? std::log(m_weights[k])
+                        : -std::numeric_limits<float>::infinity();
+            }
+        }
+    }
+}
+
+void CompiledSpn::SetThreadCount(size_t threadCount)
+{
+    threadCount = std::max(threadCount, (size_t)1);
+    if (threadCount == m_buffers.size())
+        return;
+    
+    delete m_threadPool;
+    m_threadPool = (threadCount > 1 ? new util::ThreadPool(threadCount) : NULL);
+    m_buffers.resize(threadCount);
+}
+
+/*****************************************************************************/
+
+math::pimatrix CompiledSpn::Forward(const math::pimatrix& batch
+    , bool bQueryPhase /*= false*/)
+{
+    return forward(batch, bQueryPhase ? 2 : 1);
+}
+
+math::pimatrix CompiledSpn::Query(const math::pimatrix& batch, const math::pimatrix& queries)
+{
+    const size_t N = m_types.size(), D = batch.size2(), Q = queries.size1();
+    BOOST_ASSERT_MSG(Q == 0 || queries.size2() == D
+            , "Queries should have as many columns as the batch");
+    
+    m_queryValues.resize(Q * D);
+    if (Q > 0)
+        queries.copyTo(&m_queryValues[0]);
+    
+    // the leaves of the queried columns, and the nodes above them
+    std::vector<bool> queried(D, false), dependent(N, false);
+    for (size_t j = 0; j < Q * D; ++j)
+        queried[j % D] = queried[j % D] || m_queryValues[j] >= 0;
+    for (size_t i = 0; i < N; ++i)
+    {
+        dependent[i] = (m_inputIndices[i] >= 0 && (size_t)m_inputIndices[i] < D
+                && queried[m_inputIndices[i]]);
+        for (size_t k = m_childOffsets[i]; k < m_childOffsets[i+1] && !dependent[i]; ++k)
+            dependent[i] = dependent[m_children[k]];
+    }
+    
+    m_queryDependent.swap(dependent);
+    math::pimatrix mRoot = forward(batch, Q + 1);
+    m_queryDependent.swap(dependent);
+    m_queryValues.clear();
+    return mRoot;
+}
+
+math::pimatrix CompiledSpn::forward(const math::pimatrix& batch, size_t phaseCount)
+{
+    BOOST_ASSERT_MSG(!m_types.empty(), "Empty network");
+    
+    const size_t B = batch.size1(), D = batch.size2();
+    m_phaseCount = phaseCount;
+    m_batchSize = B;
+    m_batchDimension = D;
+    m_batch.resize(B * D);
+    batch.copyTo(m_batch.empty() ? NULL : &m_batch[0]);
+    for (size_t t = 0; t < m_buffers.size(); ++t)
+        m_buffers[t].resize(B);
+    partitionBatch();
+    
+    if (m_workspaces.size() > 1)
+    {
+        m_threadPool->ParallelFor(m_workspaces.size()
+                , boost::bind(&CompiledSpn::forwardWorkspaces, this, _1, _2, _3));
+    }
+    else
+    {
+        util::ThreadPool::Job job = boost::bind(&CompiledSpn::forwardNodes, this, _1, _2, _3);
+        for (size_t l = 0; l < GetLevelCount(); ++l)
+        {
+            runLevel(l, job);
+        }
+    }
+    
+    // the activations can be updated by ForwardIncremental()
+    m_bCacheValid = (m_phaseCount == 1 && !m_bMaxProduct);
+    return getRoot();
+}
+
+math::pimatrix CompiledSpn::ForwardIncremental(const math::pimatrix& batch)
+{
+    const size_t B = batch.size1(), D = batch.size2();
+    if (!m_bCacheValid || B != m_batchSize || D != m_batchDimension)
+        return Forward(batch);
+    
+    // the columns which changed since the last evaluation
+    std::vector<float> newBatch(B * D);
+    std::vector<bool> changed(D, false);
+    if (B > 0)
+        batch.copyTo(&newBatch[0]);
+    for (size_t j = 0; j < B * D; ++j)
+    {
+        if (newBatch[j] != m_batch[j])
+            changed[j % D] = true;
+    }
+    m_batch.swap(newBatch);
+    
+    // their leaves are dirty, then the parents of dirty nodes, level by level
+    for (size_t c = 0; c < D && c + 1 < m_columnOffsets.size(); ++c)
+    {
+        if (!changed[c])
+            continue;
+        for (size_t j = m_columnOffsets[c]; j < m_columnOffsets[c+1]; ++j)
+        {
+            m_dirty[m_columnLeaves[j]] = true;
+            m_dirtyLevels[0].push_back(m_columnLeaves[j]);
+        }
+    }
+    
+    for (size_t l = 0; l < GetLevelCount(); ++l)
+    {
+        std::vector<size_t>& nodes = m_dirtyLevels[l];
+        for (size_t n = 0; n < nodes.size(); ++n)
+        {
+            const size_t i = nodes[n];
+            for (size_t p = 0; p < m_workspaces.size(); ++p)
+            {
+                if (m_bLogSpace)
+                    forwardLogNode(i, m_workspaces[p], 0, B > 0 ? &m_buffers[0][0] : NULL);
+                else
+                    forwardNode(i, m_workspaces[p], 0, B > 0 ? &m_buffers[0][0] : NULL);
+            }
+            
+            for (size_t j = m_parentOffsets[i]; j < m_parentOffsets[i+1]; ++j)
+            {
+                const size_t parent = m_slotParents[m_parentSlots[j]];
+                if (!m_dirty[parent])
+                {
+                    m_dirty[parent] = true;
+                    m_dirtyLevels[m_nodeLevels[parent]].push_back(parent);
+                }
+            }
+            m_dirty[i] = false;
+        }
+        nodes.clear();
+    }
+    return getRoot();
+}
+
+void CompiledSpn::Backward(const math::pimatrix& rootDerivatives)
+{
+    const size_t B = m_batchSize;
+    BOOST_ASSERT_MSG(rootDerivatives.size1() == m_phaseCount * B && rootDerivatives.size2() == 1
+            , "Derivatives should have the size of the result of Forward()");
+    
+    const size_t N = m_types.size();
+    std::vector<float> rootDerivs(m_phaseCount * B);
+    if (B > 0)
+        rootDerivatives.copyTo(&rootDerivs[0]);
+    for (size_t p = 0; p < m_workspaces.size(); ++p)
+    {
+        // a root without query leaves has a single phase
+        Workspace& ws = m_workspaces[p];
+        ws.derivatives.resize(N * m_phaseCount * ws.batchSize);
+        ws.slotDerivatives.resize(m_productSlotCount * m_phaseCount * ws.batchSize);
+        for (size_t h = 0; h < getPhaseCount(N - 1); ++h)
+            std::fill(derivatives(ws, N - 1, h), derivatives(ws, N - 1, h) + ws.batchSize, 0.0f);
+        for (size_t h = 0; h < m_phaseCount; ++h)
+        {
+            float* d = derivatives(ws, N - 1, h);
+            for (size_t b = 0; b < ws.batchSize; ++b)
+                d[b] += rootDerivs[h * B + ws.rowStart + b];
+        }
+    }
+    
+    if (m_workspaces.size() > 1)
+    {
+        m_threadPool->ParallelFor(m_workspaces.size()
+                , boost::bind(&CompiledSpn::backwardWorkspaces, this, _1, _2, _3));
+        if (!m_bMaxProduct)
+        {
+            m_threadPool->ParallelFor(m_children.size()
+                    , boost::bind(&CompiledSpn::reduceGradients, this, _1, _2, _3)
+                    , MIN_SAMPLES_PER_TASK / m_workspaces.size());
+        }
+    }
+    else
+    {
+        util::ThreadPool::Job job = boost::bind(&CompiledSpn::backwardNodes, this, _1, _2, _3);
+        for (size_t l = GetLevelCount(); l-- > 0; )
+        {
+            runLevel(l, job);
+        }
+    }
+}
+
+math::pimatrix CompiledSpn::Mpe(const math::pimatrix& batch, math::pimatrix& assignment)
+{
+    const size_t B = batch.size1(), D = batch.size2();
+    
+    // upward: sum nodes act as max nodes, and remember their argmax
+    m_bMaxProduct = true;
+    math::pimatrix mRoot = Forward(batch);
+    
+    // downward: the derivatives are 1 on the nodes of the MPE tree, 0 elsewhere
+    math::pimatrix mSelected(B, 1, 1.0f);
+    Backward(mSelected);
+    m_bMaxProduct = false;
+    
+    // the columns of the leaves are 0, then 1 where any of their leaves
+    // is selected: several leaves can read the same column
+    for (size_t i = 0; i < m_levelOffsets[1]; ++i)
+    {
+        if (m_inputIndices[i] < 0)
+            continue;
+        const size_t col = (size_t)m_inputIndices[i];
+        for (size_t b = 0; b < B; ++b)
+            m_batch[b * D + col] = 0.0f;
+    }
+    for (size_t i = 0; i < m_levelOffsets[1]; ++i)
+    {
+        if (m_inputIndices[i] < 0)
+            continue;
+        
+        const size_t col = (size_t)m_inputIndices[i];
+        for (size_t p = 0; p < m_workspaces.size(); ++p)
+        {
+            Workspace& ws = m_workspaces[p];
+            const float* selected = derivatives(ws, i, 0);
+            for (size_t b = 0; b < ws.batchSize; ++b)
+            {
+                if (selected[b] > 0)
+                    m_batch[(ws.rowStart + b) * D + col] = 1.0f;
+            }
+        }
+    }
+    assignment.resize(B, D);
+    if (B > 0)
+        assignment.copyRows(&m_batch[0], B, 0);
+    return mRoot;
+}
+
+void CompiledSpn::AccumulateCounts(bool bHard)
+{
+    for (size_t i = 0; i < m_types.size(); ++i)
+    {
+        if (m_types[i] != NodeData::SUM)
+            continue;
+        
+        const size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+        if (!bHard)
+        {
+            for (size_t k = kBegin; k < kEnd; ++k)
+                m_counts[k] += m_weights[k] * m_workspaces[0].gradients[k];
+            continue;
+        }
+        
+        for (size_t p = 0; p < m_workspaces.size(); ++p)
+        {
+            Workspace& ws = m_workspaces[p];
+            const float* selected = derivatives(ws, i, 0);
+            const boost::uint32_t* argmax = argmaxes(ws, i, 0);
+            for (size_t b = 0; b < ws.batchSize; ++b)
+            {
+                if (selected[b] > 0)
+                    m_counts[kBegin + argmax[b]] += 1;
+            }
+        }
+    }
+}
+
+void CompiledSpn::StoreCountWeights()
+{
+    for (size_t i = 0; i < m_types.size(); ++i)
+    {
+        if (m_types[i] != NodeData::SUM)
+            continue;
+        
+        const size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+        double total = 0;
+        for (size_t k = kBegin; k < kEnd; ++k)
+            total += m_counts[k];
+        
+        for (size_t k = kBegin; k < kEnd; ++k)
+        {
+            if (total > 0)
+                m_edges[k]->GetWeightData()[0] = (float)(m_counts[k] / total);
+            m_counts[k] = 0;
+        }
+    }
+}
+
+void CompiledSpn::StoreGradients()
+{
+    for (size_t i = 0; i < m_types.size(); ++i)
+    {
+        // weights of product nodes are not trained
+        if (!isWeighted(m_types[i]))
+            continue;
+        for (size_t k = m_childOffsets[i]; k < m_childOffsets[i+1]; ++k)
+            m_edges[k]->SetDerivatives(&m_workspaces[0].gradients[k]);
+    }
+}
+
+bool CompiledSpn::NormalizeWeights()
+{
+    if (!m_bContiguousWeights)
+        return false;
+    
+    const size_t N = m_types.size();
+    if (m_threadPool)
+    {
+        m_threadPool->ParallelFor(N
+                , boost::bind(&CompiledSpn::normalizeNodes, this, _1, _2, _3)
+                , MIN_WEIGHTS_PER_TASK * N / std::max(m_children.size(), (size_t)1) + 1);
+    }
+    else
+    {
+        normalizeNodes(0, N, 0);
+    }
+    return true;
+}
+
+void CompiledSpn::Sample(size_t count, int randomSeed, math::pimatrix& samples)
+{
+    samples.resize(count, m_columnOffsets.empty() ? 0 : m_columnOffsets.size() - 1);
+    m_samples = &samples;
+    m_sampleCount = count;
+    m_sampleSeed = (boost::uint32_t)randomSeed;
+    
+    size_t blockCount = (count + SAMPLE_BLOCK_ROWS - 1) / SAMPLE_BLOCK_ROWS;
+    if (m_threadPool)
+        m_threadPool->ParallelFor(blockCount
+                , boost::bind(&CompiledSpn::sampleBlocks, this, _1, _2, _3));
+    else
+        sampleBlocks(0, blockCount, 0);
+    m_samples = NULL;
+}
+
+/*****************************************************************************/
+
+void CompiledSpn::runLevel(size_t level, const util::ThreadPool::Job& job)
+{
+    m_levelStart = m_levelOffsets[level];
+    size_t count = m_levelOffsets[level + 1] - m_levelStart;
+    
+    if (m_threadPool)
+    {
+        m_threadPool->ParallelFor(count, job
+                , MIN_SAMPLES_PER_TASK / std::max(m_batchSize, (size_t)1));
+    }
+    else
+    {
+        job(0, count, 0);
+    }
+}
+
+math::pimatrix CompiledSpn::getRoot()
+{
+    const size_t N = m_types.size();
+    math::pimatrix mRoot(m_phaseCount * m_batchSize, 1);
+    for (size_t p = 0; p < m_workspaces.size(); ++p)
+    {
+        Workspace& ws = m_workspaces[p];
+        for (size_t h = 0; h < m_phaseCount && ws.batchSize > 0; ++h)
+            mRoot.copyRows(activations(ws, N - 1, h), ws.batchSize, h * m_batchSize + ws.rowStart);
+    }
+    return mRoot;
+}
+
+void CompiledSpn::partitionBatch()
+{
+    size_t count = 1;
+    if (m_bPartitionBatch && m_threadPool)
+    {
+        count = std::min(m_buffers.size(), m_batchSize / MIN_ROWS_PER_WORKSPACE);
+        count = std::max(count, (size_t)1);
+    }
+    
+    m_workspaces.resize(count);
+    for (size_t p = 0; p < count; ++p)
+    {
+        Workspace& ws = m_workspaces[p];
+        ws.rowStart = p * m_batchSize / count;
+        ws.batchSize = (p + 1) * m_batchSize / count - ws.rowStart;
+        ws.activations.resize(m_types.size() * m_phaseCount * ws.batchSize);
+        ws.argmax.resize(m_argmaxCount * m_phaseCount * ws.batchSize);
+        ws.gradients.resize(m_children.size());
+    }
+}
+
+void CompiledSpn::forwardNodes(size_t begin, size_t end, size_t threadIndex)
+{
+    Workspace& ws = m_workspaces[0];
+    float* buffer = (m_batchSize > 0 ? &m_buffers[threadIndex][0] : NULL);
+    for (size_t i = m_levelStart + begin; i < m_levelStart + end; ++i)
+    {
+        for (size_t h = 0; h < getPhaseCount(i); ++h)
+        {
+            if (m_bLogSpace)
+                forwardLogNode(i, ws, h, buffer);
+            else
+                forwardNode(i, ws, h, buffer);
+        }
+    }
+}
+
+void CompiledSpn::backwardNodes(size_t begin, size_t end, size_t threadIndex)
+{
+    Workspace& ws = m_workspaces[0];
+    float* buffer = (m_batchSize > 0 ? &m_buffers[threadIndex][0] : NULL);
+    for (size_t i = m_levelStart + begin; i < m_levelStart + end; ++i)
+    {
+        if (m_bMaxProduct)
+            tracebackNode(i, ws);
+        else if (isLeaf(m_types[i]))
+            continue;       // leaves take no derivatives
+        else if (m_bLogSpace)
+            backwardLogNode(i, ws);
+        else
+            backwardNode(i, ws, buffer);
+    }
+}
+
+void CompiledSpn::forwardWorkspaces(size_t begin, size_t end, size_t threadIndex)
+{
+    for (size_t p = begin; p < end; ++p)
+    {
+        // there are no more workspaces than buffers
+        Workspace& ws = m_workspaces[p];
+        float* buffer = (m_batchSize > 0 ? &m_buffers[p][0] : NULL);
+        for (size_t i = 0; i < m_types.size(); ++i)
+        {
+            for (size_t h = 0; h < getPhaseCount(i); ++h)
+            {
+                if (m_bLogSpace)
+                    forwardLogNode(i, ws, h, buffer);
+                else
+                    forwardNode(i, ws, h, buffer);
+            }
+        }
+    }
+}
+
+void CompiledSpn::backwardWorkspaces(size_t begin, size_t end, size_t threadIndex)
+{
+    for (size_t p = begin; p < end; ++p)
+    {
+        Workspace& ws = m_workspaces[p];
+        float* buffer = (m_batchSize > 0 ? &m_buffers[p][0] : NULL);
+        for (size_t i = m_types.size(); i-- > 0; )
+        {
+            if (m_bMaxProduct)
+                tracebackNode(i, ws);
+            else if (isLeaf(m_types[i]))
+                continue;       // leaves take no derivatives
+            else if (m_bLogSpace)
+                backwardLogNode(i, ws);
+            else
+                backwardNode(i, ws, buffer);
+        }
+    }
+}
+
+void CompiledSpn::reduceGradients(size_t begin, size_t end, size_t threadIndex)
+{
+    std::vector<float>& gradients = m_workspaces[0].gradients;
+    for (size_t p = 1; p < m_workspaces.size(); ++p)
+    {
+        const std::vector<float>& g = m_workspaces[p].gradients;
+        for (size_t k = begin; k < end; ++k)
+            gradients[k] += g[k];
+    }
+}
+
+void CompiledSpn::normalizeNodes(size_t begin, size_t end, size_t threadIndex)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        const size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+        if (m_types[i] != NodeData::SUM || kBegin == kEnd)
+            continue;
+        
+        float* w = m_edges[kBegin]->GetWeightData();
+        const size_t n = kEnd - kBegin;
+        float sum = 0;
+        for (size_t k = 0; k < n; ++k)
+            sum += w[k];
+        
+        // as pimatrix::element_div(), which never divides by 0
+        if (std::abs(sum) < 1E-10f)
+            sum = (sum < 0 ? -1E-10f : 1E-10f);
+        for (size_t k = 0; k < n; ++k)
+            w[k] /= sum;
+    }
+}
+
+void CompiledSpn::sampleBlocks(size_t begin, size_t end, size_t threadIndex)
+{
+    const size_t N = m_types.size(), D = m_samples->size2();
+    std::vector<unsigned char> selected;
+    std::vector<float> rows;
+    
+    for (size_t block = begin; block < end; ++block)
+    {
+        const size_t rowStart = block * SAMPLE_BLOCK_ROWS;
+        const size_t B = std::min((size_t)SAMPLE_BLOCK_ROWS, m_sampleCount - rowStart);
+        boost::random::mt19937 gen(m_sampleSeed * 2654435761u + (boost::uint32_t)block);
+        boost::random::uniform_01<float> uniform;
+        
+        // selected[i * B + b]: node i is on the tree of sample b
+        selected.assign(N * B, 0);
+        rows.assign(B * D, 0.0f);
+        std::fill(selected.begin() + (N - 1) * B, selected.end(), 1);
+        
+        for (size_t i = N; i-- > 0; )
+        {
+            const unsigned char* sel = &selected[i * B];
+            const size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+            
+            if (isLeaf(m_types[i]))
+            {
+                if (m_inputIndices[i] < 0)
+                    continue;
+                const size_t col = (size_t)m_inputIndices[i];
+                for (size_t b = 0; b < B; ++b)
+                {
+                    if (sel[b])
+                        rows[b * D + col] = 1.0f;
+                }
+            }
+            else if (isWeighted(m_types[i]))
+            {
+                // non-positive weights are never picked
+                float total = 0;
+                for (size_t k = kBegin; k < kEnd; ++k)
+                    total += std::max(m_weights[k], 0.0f);
+                
+                for (size_t b = 0; b < B; ++b)
+                {
+                    if (!sel[b] || kBegin == kEnd)
+                        continue;
+                    float u = uniform(gen) * total;
+                    size_t k = kBegin;
+                    for (; k + 1 < kEnd; ++k)
+                    {
+                        u -= std::max(m_weights[k], 0.0f);
+                        if (u < 0)
+                            break;
+                    }
+                    selected[m_children[k] * B + b] = 1;
+                }
+            }
+            else
+            {
+                for (size_t k = kBegin; k < kEnd; ++k)
+                {
+                    unsigned char* child = &selected[m_children[k] * B];
+                    for (size_t b = 0; b < B; ++b)
+                        child[b] |= sel[b];
+                }
+            }
+        }
+        
+        if (B > 0 && D > 0)
+            m_samples->copyRows(&rows[0], B, rowStart);
+    }
+}
+
+/*****************************************************************************/
+
+void CompiledSpn::forwardNode(size_t i, Workspace& ws, size_t phase, float* buffer)
+{
+    const size_t B = ws.batchSize, D = m_batchDimension;
+    float* out = activations(ws, i, phase);
+    size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+    
+    switch (m_types[i])
+    {
+        case NodeData::QUERY:
+            // the query variables are summed out in the second phase,
+            // except in Query()
+            if (phase > 0 && m_queryValues.empty())
+            {
+                std::fill(out, out + B, 1.0f);
+                break;
+            }
+            // otherwise, read it like an input
+        case NodeData::INPUT:
+        {
+            const size_t col = (size_t)m_inputIndices[i];
+            BOOST_ASSERT_MSG(col < D, "Invalid dimension");
+            const float value = getQueryValue(col, phase);
+            if (value >= 0)
+            {
+                std::fill(out, out + B, value);
+                break;
+            }
+            for (size_t b = 0; b < B; ++b)
+                out[b] = m_batch[(ws.rowStart + b) * D + col];
+            break;
+        }
+        case NodeData::HIDDEN:
+            std::fill(out, out + B, 1.0f);
+            break;
+        case NodeData::SUM:
+            if (m_bMaxProduct)
+            {
+                forwardMaxNode(i, ws, phase);
+                break;
+            }
+            std::fill(out, out + B, 0.0f);
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                const float w = m_weights[k];
+                const float* in = activations(ws, m_children[k], phase);
+                for (size_t b = 0; b < B; ++b)
+                    out[b] += w * in[b];
+            }
+            break;
+        case NodeData::MAX:
+            forwardMaxNode(i, ws, phase);
+            break;
+        case NodeData::PRODUCT:
+            std::fill(out, out + B, 1.0f);
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                const float* in = activations(ws, m_children[k], phase);
+                for (size_t b = 0; b < B; ++b)
+                    out[b] *= in[b];
+            }
+            break;
+    }
+}
+
+void CompiledSpn::forwardLogNode(size_t i, Workspace& ws, size_t phase, float* buffer)
+{
+    const size_t B = ws.batchSize, D = m_batchDimension;
+    const float NEG_INF = -std::numeric_limits<float>::infinity();
+    float* out = activations(ws, i, phase);
+    size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+    
+    switch (m_types[i])
+    {
+        case NodeData::QUERY:
+            // the query variables are summed out in the second phase,
+            // except in Query()
+            if (phase > 0 && m_queryValues.empty())
+            {
+                std::fill(out, out + B, 0.0f);
+                break;
+            }
+            // otherwise, read it like an input
+        case NodeData::INPUT:
+        {
+            const size_t col = (size_t)m_inputIndices[i];
+            BOOST_ASSERT_MSG(col < D, "Invalid dimension");
+            const float value = getQueryValue(col, phase);
+            if (value >= 0)
+            {
+                std::fill(out, out + B, std::log(value));
+                break;
+            }
+            for (size_t b = 0; b < B; ++b)
+                out[b] = std::log(m_batch[(ws.rowStart + b) * D + col]);
+            break;
+        }
+        case NodeData::HIDDEN:
+            std::fill(out, out + B, 0.0f);
+            break;
+        case NodeData::SUM:
+        {
+            if (m_bMaxProduct)
+            {
+                forwardMaxNode(i, ws, phase);
+                break;
+            }
+            
+            // log-sum-exp: out = max + log(sum(exp(x - max)))
+            std::fill(out, out + B, NEG_INF);
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                const float lw = m_logWeights[k];
+                const float* in = activations(ws, m_children[k], phase);
+                for (size_t b = 0; b < B; ++b)
+                    out[b] = std::max(out[b], lw + in[b]);
+            }
+            
+            float* acc = buffer;
+            std::fill(acc, acc + B, 0.0f);
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                const float lw = m_logWeights[k];
+                const float* in = activations(ws, m_children[k], phase);
+                for (size_t b = 0; b < B; ++b)
+                    acc[b] += std::exp(lw + in[b] - out[b]);
+            }
+            for (size_t b = 0; b < B; ++b)
+            {
+                // all children are -inf: so is the sum
+                if (out[b] != NEG_INF)
+                    out[b] += std::log(acc[b]);
+            }
+            break;
+        }
+        case NodeData::MAX:
+            forwardMaxNode(i, ws, phase);
+            break;
+        case NodeData::PRODUCT:
+            std::fill(out, out + B, 0.0f);
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                const float* in = activations(ws, m_children[k], phase);
+                for (size_t b = 0; b < B; ++b)
+                    out[b] += in[b];
+            }
+            break;
+    }
+}
+
+/*****************************************************************************/
+
+void CompiledSpn::backwardNode(size_t i, Workspace& ws, float* buffer)
+{
+    const size_t B = ws.batchSize;
+    
+    // gather from the parents, the root already has its derivatives.
+    // A parent has at least as many phases as its children: when the child
+    // has only one, it gets the derivatives of all the phases of the parent.
+    if (i + 1 < m_types.size())
+    {
+        for (size_t h = 0; h < getPhaseCount(i); ++h)
+            std::fill(derivatives(ws, i, h), derivatives(ws, i, h) + B, 0.0f);
+        
+        for (size_t j = m_parentOffsets[i]; j < m_parentOffsets[i+1]; ++j)
+        {
+            const size_t k = m_parentSlots[j], p = m_slotParents[k];
+            for (size_t h = 0; h < getPhaseCount(p); ++h)
+            {
+                float* d = derivatives(ws, i, h);
+                const float* dp = derivatives(ws, p, h);
+                
+                if (m_types[p] == NodeData::SUM)
+                {
+                    const float w = m_weights[k];
+                    for (size_t b = 0; b < B; ++b)
+                        d[b] += w * dp[b];
+                }
+                else if (m_types[p] == NodeData::MAX)
+                {
+                    // only to the argmax
+                    const float w = m_weights[k];
+                    const boost::uint32_t* argmax = argmaxes(ws, p, h);
+                    const boost::uint32_t slot = (boost::uint32_t)(k - m_childOffsets[p]);
+                    for (size_t b = 0; b < B; ++b)
+                    {
+                        if (argmax[b] == slot)
+                            d[b] += w * dp[b];
+                    }
+                }
+                else
+                {
+                    // left in the slot by backwardProductNode()
+                    const float* ds = slotDerivatives(ws, k, h);
+                    for (size_t b = 0; b < B; ++b)
+                        d[b] += ds[b];
+                }
+            }
+        }
+    }
+    
+    if (m_types[i] == NodeData::PRODUCT)
+    {
+        backwardProductNode(i, ws, buffer);
+        return;
+    }
+    
+    // gradients wrt the weights of the children
+    if (!isWeighted(m_types[i]))
+        return;
+    
+    for (size_t k = m_childOffsets[i]; k < m_childOffsets[i+1]; ++k)
+    {
+        const boost::uint32_t slot = (boost::uint32_t)(k - m_childOffsets[i]);
+        float g = 0;
+        for (size_t h = 0; h < getPhaseCount(i); ++h)
+        {
+            const float* in = activations(ws, m_children[k], h);
+            const float* d = derivatives(ws, i, h);
+            if (m_types[i] == NodeData::SUM)
+            {
+                for (size_t b = 0; b < B; ++b)
+                    g += in[b] * d[b];
+            }
+            else
+            {
+                const boost::uint32_t* argmax = argmaxes(ws, i, h);
+                for (size_t b = 0; b < B; ++b)
+                {
+                    if (argmax[b] == slot)
+                        g += in[b] * d[b];
+                }
+            }
+        }
+        ws.gradients[k] = g;
+    }
+}
+
+void CompiledSpn::backwardProductNode(size_t i, Workspace& ws, float* buffer)
+{
+    const size_t B = ws.batchSize;
+    const size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+    if (kBegin == kEnd)
+        return;
+    
+    for (size_t h = 0; h < getPhaseCount(i); ++h)
+    {
+        // prefix: derivatives * child_0 * ... * child_k-1
+        const float* dp = derivatives(ws, i, h);
+        std::copy(dp, dp + B, slotDerivatives(ws, kBegin, h));
+        for (size_t k = kBegin + 1; k < kEnd; ++k)
+        {
+            const float* prev = slotDerivatives(ws, k - 1, h);
+            const float* in = activations(ws, m_children[k - 1], h);
+            float* out = slotDerivatives(ws, k, h);
+            for (size_t b = 0; b < B; ++b)
+                out[b] = prev[b] * in[b];
+        }
+        
+        // suffix: from the last child down, times child_k+1 * ... * child_n-1
+        float* suffix = buffer;
+        std::fill(suffix, suffix + B, 1.0f);
+        for (size_t k = kEnd; k-- > kBegin; )
+        {
+            const float* in = activations(ws, m_children[k], h);
+            float* out = slotDerivatives(ws, k, h);
+            for (size_t b = 0; b < B; ++b)
+            {
+                out[b] *= suffix[b];
+                suffix[b] *= in[b];
+            }
+        }
+    }
+}
+
+void CompiledSpn::backwardLogNode(size_t i, Workspace& ws)
+{
+    const size_t B = ws.batchSize;
+    const float NEG_INF = -std::numeric_limits<float>::infinity();
+    
+    // gather from the parents, the root already has its derivatives
+    if (i + 1 < m_types.size())
+    {
+        for (size_t h = 0; h < getPhaseCount(i); ++h)
+            std::fill(derivatives(ws, i, h), derivatives(ws, i, h) + B, 0.0f);
+        
+        for (size_t j = m_parentOffsets[i]; j < m_parentOffsets[i+1]; ++j)
+        {
+            const size_t k = m_parentSlots[j], p = m_slotParents[k];
+            for (size_t h = 0; h < getPhaseCount(p); ++h)
+            {
+                const float* act = activations(ws, i, h);
+                float* d = derivatives(ws, i, h);
+                const float* dp = derivatives(ws, p, h);
+                
+                if (m_types[p] == NodeData::SUM)
+                {
+                    // d(sum)/d(child_k) = w_k * exp(child_k - sum)
+                    const float w = m_weights[k];
+                    const float* actP = activations(ws, p, h);
+                    for (size_t b = 0; b < B; ++b)
+                    {
+                        if (act[b] != NEG_INF && actP[b] != NEG_INF)
+                            d[b] += w * dp[b] * std::exp(act[b] - actP[b]);
+                    }
+                }
+                else if (m_types[p] == NodeData::MAX)
+                {
+                    // max = w_argmax * child_argmax: d(max)/d(child_argmax) = 1
+                    const boost::uint32_t* argmax = argmaxes(ws, p, h);
+                    const boost::uint32_t slot = (boost::uint32_t)(k - m_childOffsets[p]);
+                    for (size_t b = 0; b < B; ++b)
+                    {
+                        if (argmax[b] == slot)
+                            d[b] += dp[b];
+                    }
+                }
+                else
+                {
+                    // d(prod)/d(child) = 1
+                    for (size_t b = 0; b < B; ++b)
+                        d[b] += dp[b];
+                }
+            }
+        }
+    }
+    
+    // d(sum)/d(w_k) = exp(child_k - sum),
+    // d(max)/d(w_argmax) = 1 / w_argmax = exp(child_argmax - max)
+    if (!isWeighted(m_types[i]))
+        return;
+    
+    for (size_t k = m_childOffsets[i]; k < m_childOffsets[i+1]; ++k)
+    {
+        const boost::uint32_t slot = (boost::uint32_t)(k - m_childOffsets[i]);
+        float g = 0;
+        for (size_t h = 0; h < getPhaseCount(i); ++h)
+        {
+            const float* in = activations(ws, m_children[k], h);
+            const float* act = activations(ws, i, h);
+            const float* d = derivatives(ws, i, h);
+            const boost::uint32_t* argmax = (m_types[i] == NodeData::MAX
+                    ? argmaxes(ws, i, h) : NULL);
+            for (size_t b = 0; b < B; ++b)
+            {
+                if ((!argmax || argmax[b] == slot) && in[b] != NEG_INF && act[b] != NEG_INF)
+                    g += d[b] * std::exp(in[b] - act[b]);
+            }
+        }
+        ws.gradients[k] = g;
+    }
+}
+
+/*****************************************************************************/
+
+void CompiledSpn::forwardMaxNode(size_t i, Workspace& ws, size_t phase)
+{
+    const size_t B = ws.batchSize;
+    float* out = activations(ws, i, phase);
+    boost::uint32_t* argmax = argmaxes(ws, i, phase);
+    size_t kBegin = m_childOffsets[i], kEnd = m_childOffsets[i+1];
+    
+    // the first child wins the ties
+    for (size_t k = kBegin; k < kEnd; ++k)
+    {
+        const float* in = activations(ws, m_children[k], phase);
+        const boost::uint32_t slot = (boost::uint32_t)(k - kBegin);
+        
+        if (m_bLogSpace)
+        {
+            const float lw = m_logWeights[k];
+            for (size_t b = 0; b < B; ++b)
+            {
+                if (k == kBegin || lw + in[b] > out[b])
+                {
+                    out[b] = lw + in[b];
+                    argmax[b] = slot;
+                }
+            }
+        }
+        else
+        {
+            const float w = m_weights[k];
+            for (size_t b = 0; b < B; ++b)
+            {
+                if (k == kBegin || w * in[b] > out[b])
+                {
+                    out[b] = w * in[b];
+                    argmax[b] = slot;
+                }
+            }
+        }
+    }
+}
+
+void CompiledSpn::tracebackNode(size_t i, Workspace& ws)
+{
+    const size_t B = ws.batchSize;
+    
+    // the root is selected, other nodes are selected by one of their parents:
+    // a product selects all its children, a sum or max node its argmax
+    if (i + 1 == m_types.size())
+        return;
+    
+    for (size_t h = 0; h < getPhaseCount(i); ++h)
+        std::fill(derivatives(ws, i, h), derivatives(ws, i, h) + B, 0.0f);
+    
+    for (size_t j = m_parentOffsets[i]; j < m_parentOffsets[i+1]; ++j)
+    {
+        const size_t k = m_parentSlots[j], p = m_slotParents[k];
+        for (size_t h = 0; h < getPhaseCount(p); ++h)
+        {
+            float* selected = derivatives(ws, i, h);
+            const float* selectedP = derivatives(ws, p, h);
+            
+            if (m_types[p] == NodeData::PRODUCT)
+            {
+                for (size_t b = 0; b < B; ++b)
+                    selected[b] = std::max(selected[b], selectedP[b]);
+            }
+            else
+            {
+                const boost::uint32_t* argmax = argmaxes(ws, p, h);
+                const boost::uint32_t slot = (boost::uint32_t)(k - m_childOffsets[p]);
+                for (size_t b = 0; b < B; ++b)
+                {
+                    if (argmax[b] == slot)
+                        selected[b] = std::max(selected[b], selectedP[b]);
+                }
+            }
+        }
+    }
+}
+
+}
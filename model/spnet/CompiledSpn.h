@@ -0,0 +1,417 @@
+/*
+ * File:   CompiledSpn.h
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:31 PM
+ */
+
+#ifndef COMPILEDSPN_H
+#define	COMPILEDSPN_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <pimatrix.h>
+#include <Node.h>
+#include <Edge.h>
+#include <ThreadPool.h>
+
+namespace model
+{
+
+/*
+ * An SPN lowered into flat arrays, in topological order, so that forward
+ * and backward passes are plain loops instead of virtual calls on Nodes
+ * and 1x1 matrix products on Edges.
+ * 
+ * Nodes are grouped by level: leaves are in level 0, and the children of
+ * a node are all in lower levels. With more than 1 thread, either the nodes
+ * of a level are evaluated in parallel, or the batch is split into row
+ * ranges, each evaluated on its own Workspace (SetPartitionBatch()).
+ * In backward, every node gathers its derivative from its parents, and
+ * product nodes leave the derivatives of each of their children in a slot
+ * of their own, so no two threads write to the same place.
+ * 
+ * Activations and derivatives are stored node by node, the samples of
+ * a node being contiguous: activations[node * batchSize + sample].
+ * 
+ * Weights live in the Edges (in the ParameterBuffer of the Spn): call
+ * LoadWeights() after they change, and StoreGradients() to hand the
+ * gradients of the last Backward() to the Edges.
+ * 
+ * In log space, activations are log-probabilities and derivatives are
+ * taken wrt them. The gradients wrt the weights are the same in both modes.
+ * 
+ * MAX nodes take the largest weighted child, and pass derivatives to it only.
+ * 
+ * Forward() can also evaluate the batch a second time with the QUERY leaves
+ * summed out (the negative phase of Spn::TrainOneBatch). Only the nodes which
+ * depend on QUERY leaves have 2 phases, the others are evaluated once and
+ * shared: phase h of node i is activations[(i * m_phaseCount + h) * batchSize].
+ * Query() uses the same phases, one per query, with the nodes above the
+ * queried columns in place of the ones above the QUERY leaves.
+ */
+class CompiledSpn : boost::noncopyable
+{
+    /*
+     * State of the forward and backward passes on a range of rows
+     */
+    struct Workspace
+    {
+        size_t rowStart, batchSize;
+        std::vector<float> activations, derivatives;
+        std::vector<float> gradients;       // d(error)/d(weight) of each child, SUM only
+        std::vector<float> slotDerivatives; // d(error)/d(child) through each child of the PRODUCT nodes
+        
+        /*
+         * the winning child (from 0) of the weighted nodes in the last Forward(),
+         * see argmaxes(). MAX only, or SUM in Mpe().
+         */
+        std::vector<boost::uint32_t> argmax;
+    };
+    
+    std::vector<int> m_types;               // NodeData_NodeType of each node
+    std::vector<int> m_inputIndices;        // column in the batch, INPUT and QUERY only
+    std::vector<int> m_argmaxRows;          // row in Workspace::argmax, SUM and MAX only
+    std::vector<int> m_slotRows;            // row in Workspace::slotDerivatives, children of PRODUCT only
+    std::vector<bool> m_queryDependent;     // QUERY leaves, and the nodes above them
+    size_t m_argmaxCount;
+    size_t m_productSlotCount;
+    
+    /*
+     * children of node i are m_children[m_childOffsets[i] .. m_childOffsets[i+1])
+     */
+    std::vector<size_t> m_childOffsets;
+    std::vector<size_t> m_children;
+    std::vector<size_t> m_slotParents;      // the parent of each child
+    std::vector<Edge*> m_edges;             // the edge of each child
+    bool m_bContiguousWeights;              // the weights of the children of a node are adjacent in the Edges
+    std::vector<float> m_weights;           // the weight of each child, SUM only
+    std::vector<float> m_logWeights;        // log of m_weights, in log space only
+    std::vector<double> m_counts;           // expected counts of each child for EM, SUM only
+    
+    /*
+     * node i is the child m_parentSlots[m_parentOffsets[i] .. m_parentOffsets[i+1])
+     * of its parents
+     */
+    std::vector<size_t> m_parentOffsets;
+    std::vector<size_t> m_parentSlots;
+    
+    /*
+     * nodes of level l are [m_levelOffsets[l], m_levelOffsets[l+1])
+     */
+    std::vector<size_t> m_levelOffsets;
+    std::vector<size_t> m_nodeLevels;
+    
+    /*
+     * leaves reading column c are m_columnLeaves[m_columnOffsets[c] .. m_columnOffsets[c+1])
+     */
+    std::vector<size_t> m_columnOffsets;
+    std::vector<size_t> m_columnLeaves;
+    
+    /*
+     * ForwardIncremental(): the nodes to recompute, by level
+     */
+    std::vector<bool> m_dirty;
+    std::vector<std::vector<size_t> > m_dirtyLevels;
+    
+    /*
+     * Sample(): the samples being drawn, and their seed
+     */
+    math::pimatrix* m_samples;
+    size_t m_sampleCount;
+    boost::uint32_t m_sampleSeed;
+    
+    /*
+     * a single one, unless the batch is partitioned.
+     * The gradients of all workspaces are summed into the first one.
+     */
+    std::vector<Workspace> m_workspaces;
+    std::vector<float> m_batch;
+    std::vector<std::vector<float> > m_buffers;     // batch_size floats of scratch space per thread
+    size_t m_batchSize, m_batchDimension;
+    bool m_bLogSpace;
+    
+    util::ThreadPool* m_threadPool;         // NULL with 1 thread
+    bool m_bPartitionBatch;
+    bool m_bMaxProduct;                     // in Mpe(): sum nodes act as max nodes
+    size_t m_phaseCount;                    // 2 if the last Forward() had a query phase
+    std::vector<float> m_queryValues;       // in Query(), the queries: row h-1 gives the leaves of phase h
+    bool m_bCacheValid;                     // the activations match m_batch and the weights
+    size_t m_levelStart;                    // first node of the level being evaluated
+
+    CompiledSpn();
+
+public:
+    virtual ~CompiledSpn();
+
+    /*
+     * nodeList: topologically sorted nodes, the root being the last one.
+     * Returns NULL if the network has nodes which can't be compiled
+     * (nodes whose dimension is not 1).
+     */
+    static CompiledSpn* Compile(std::vector<Node*>& nodeList, bool bLogSpace = false);
+
+    /*
+     * Copy the weights from the Edges.
+     */
+    void LoadWeights();
+
+    /*
+     * Returns the activations of the root, batch_size x 1:
+     * probabilities, or log-probabilities in log space.
+     * bQueryPhase: then the activations of the batch where all QUERY
+     * leaves are 1, in rows [batch_size, 2 x batch_size).
+     */
+    math::pimatrix Forward(const math::pimatrix& batch, bool bQueryPhase = false);
+    
+    /*
+     * Forward() of the batch, then of the batch where the columns of query q
+     * (row q of queries, negative for the columns not in the query) take its
+     * values, in rows [(q+1) x batch_size, (q+2) x batch_size).
+     * The nodes which read no queried column are evaluated once for all.
+     * Overwrites the state of the last Forward().
+     */
+    math::pimatrix Query(const math::pimatrix& batch, const math::pimatrix& queries);
+    
+    /*
+     * Same as Forward(), but only recomputes the leaves of the columns
+     * which changed since the last evaluation, and their ancestors.
+     * Falls back to Forward() if the batch has another size, or if the
+     * last evaluation was not a plain Forward(), or if LoadWeights() found
+     * new weights since then.
+     */
+    math::pimatrix ForwardIncremental(const math::pimatrix& batch);
+
+    /*
+     * rootDerivatives: derivatives of the error wrt the activations
+     * of the root in the last Forward(), which has the same size
+     */
+    void Backward(const math::pimatrix& rootDerivatives);
+
+    /*
+     * Most probable explanation of the batch: an upward pass where the sum
+     * nodes act as max nodes, then a traceback from the root which follows
+     * the argmax of sum and max nodes and all children of product nodes.
+     * 
+     * Leaves are indicators, a missing variable having all its indicators
+     * set to 1. assignment is the completed batch: 1 for the indicators on
+     * the MPE tree, 0 for the others; columns without leaves are copied.
+     * Returns the (log-)probabilities of the MPE states, batch_size x 1.
+     * 
+     * Overwrites the state of the last Forward().
+     */
+    math::pimatrix Mpe(const math::pimatrix& batch, math::pimatrix& assignment);
+
+    /*
+     * E-step of EM on the sum nodes: add the expected counts of their
+     * children on the samples of the last pass to the counts.
+     * Soft: w_k * d(log P)/d(w_k), after a Backward() with the derivatives
+     * of log P wrt the root. Hard (bHard): the number of samples where the
+     * child is on the MPE tree, after an Mpe().
+     */
+    void AccumulateCounts(bool bHard);
+    
+    /*
+     * M-step: set the weights of every sum node to its normalized counts,
+     * in the Edges, and reset the counts. Sum nodes without counts keep
+     * their weights.
+     */
+    void StoreCountWeights();
+    
+    /*
+     * Ancestral sampling: from the root down, every sum (and max) node
+     * picks one child with probability proportional to the edge weights,
+     * product nodes take all their children. samples is count x the number
+     * of columns read by the leaves: 1 for the leaves reached, 0 elsewhere.
+     * Blocks of rows run on the thread pool, each with its own random
+     * stream derived from randomSeed, so the samples only depend on the seed.
+     */
+    void Sample(size_t count, int randomSeed, math::pimatrix& samples);
+
+    /*
+     * Give the gradients of the last Backward() to the Edges,
+     * so that Edge::UpdateParams() can use them.
+     */
+    void StoreGradients();
+    
+    /*
+     * Divide the weights of the children of every sum node by their sum,
+     * in place in the Edges: a segmented reduction over the parameters,
+     * where the children of a node are adjacent (Model::bindParameters()),
+     * with the nodes spread over the thread pool.
+     * false if the weights are not laid out that way, nothing is done then.
+     */
+    bool NormalizeWeights();
+    
+    /*
+     * Number of threads evaluating the nodes of a level,
+     * or the row ranges of the batch
+     */
+    void SetThreadCount(size_t threadCount);
+    
+    /*
+     * true: split the batch into one row range per thread, each running
+     * the whole network, then sum the gradients of all ranges.
+     * false: evaluate the nodes of each level in parallel (the default).
+     */
+    void SetPartitionBatch(bool bPartitionBatch)
+    {
+        m_bPartitionBatch = bPartitionBatch;
+    }
+
+    size_t GetNodeCount()
+    {
+        return m_types.size();
+    }
+    
+    size_t GetLevelCount()
+    {
+        return m_levelOffsets.size() - 1;
+    }
+    
+    bool IsLogSpace()
+    {
+        return m_bLogSpace;
+    }
+
+private:
+    
+    /*
+     * Forward() with the given number of phases
+     */
+    math::pimatrix forward(const math::pimatrix& batch, size_t phaseCount);
+    
+    /*
+     * Run job on the nodes of the given level, in parallel if possible
+     */
+    void runLevel(size_t level, const util::ThreadPool::Job& job);
+    
+    /*
+     * Split the batch into row ranges, and size the workspaces
+     */
+    void partitionBatch();
+    
+    /*
+     * Activations of the root, for all phases
+     */
+    math::pimatrix getRoot();
+    
+    /*
+     * Jobs on the nodes of the current level
+     */
+    void forwardNodes(size_t begin, size_t end, size_t threadIndex);
+    
+    void backwardNodes(size_t begin, size_t end, size_t threadIndex);
+    
+    /*
+     * Jobs on workspaces, running all the nodes of the network
+     */
+    void forwardWorkspaces(size_t begin, size_t end, size_t threadIndex);
+    
+    void backwardWorkspaces(size_t begin, size_t end, size_t threadIndex);
+    
+    /*
+     * Job on the children slots: sum the gradients of all workspaces
+     */
+    void reduceGradients(size_t begin, size_t end, size_t threadIndex);
+    
+    /*
+     * Job on blocks of SAMPLE_BLOCK_ROWS rows of Sample()
+     */
+    void sampleBlocks(size_t begin, size_t end, size_t threadIndex);
+    
+    /*
+     * Job on nodes of NormalizeWeights()
+     */
+    void normalizeNodes(size_t begin, size_t end, size_t threadIndex);
+    
+    void forwardNode(size_t i, Workspace& ws, size_t phase, float* buffer);
+    
+    void forwardLogNode(size_t i, Workspace& ws, size_t phase, float* buffer);
+    
+    void backwardNode(size_t i, Workspace& ws, float* buffer);
+    
+    void backwardLogNode(size_t i, Workspace& ws);
+    
+    /*
+     * d(prod)/d(child_k) = (child_0 * ... * child_k-1) * (child_k+1 * ... * child_n-1)
+     * times the derivatives of product node i, into the slot of every child:
+     * a prefix and a suffix pass over its children, without dividing by
+     * child_k, so it is exact when children are 0 or the product underflows.
+     */
+    void backwardProductNode(size_t i, Workspace& ws, float* buffer);
+    
+    void forwardMaxNode(size_t i, Workspace& ws, size_t phase);
+    
+    /*
+     * Derivatives are 1 for the samples where node i is on the MPE tree
+     */
+    void tracebackNode(size_t i, Workspace& ws);
+    
+    /*
+     * INPUT, HIDDEN and QUERY nodes: they take no derivatives
+     */
+    static bool isLeaf(int nodeType)
+    {
+        return nodeType == NodeData::INPUT || nodeType == NodeData::HIDDEN
+                || nodeType == NodeData::QUERY;
+    }
+    
+    size_t getPhaseCount(size_t i)
+    {
+        return m_queryDependent[i] ? m_phaseCount : 1;
+    }
+    
+    /*
+     * In Query(), the value of column col in the given phase,
+     * negative if the column keeps the value of the batch
+     */
+    float getQueryValue(size_t col, size_t phase)
+    {
+        return (phase > 0 && !m_queryValues.empty())
+                ? m_queryValues[(phase - 1) * m_batchDimension + col] : -1.0f;
+    }
+    
+    /*
+     * Storage of a phase of node i. Nodes with a single phase
+     * give it for all phases.
+     */
+    float* activations(Workspace& ws, size_t i, size_t phase)
+    {
+        phase = (m_queryDependent[i] ? phase : 0);
+        return &ws.activations[(i * m_phaseCount + phase) * ws.batchSize];
+    }
+    
+    float* derivatives(Workspace& ws, size_t i, size_t phase)
+    {
+        phase = (m_queryDependent[i] ? phase : 0);
+        return &ws.derivatives[(i * m_phaseCount + phase) * ws.batchSize];
+    }
+    
+    /*
+     * Derivatives through child slot k, in the given phase of its parent
+     */
+    float* slotDerivatives(Workspace& ws, size_t k, size_t phase)
+    {
+        return &ws.slotDerivatives[(m_slotRows[k] * m_phaseCount + phase) * ws.batchSize];
+    }
+    
+    boost::uint32_t* argmaxes(Workspace& ws, size_t i, size_t phase)
+    {
+        phase = (m_queryDependent[i] ? phase : 0);
+        return &ws.argmax[(m_argmaxRows[i] * m_phaseCount + phase) * ws.batchSize];
+    }
+    
+    /*
+     * SUM and MAX nodes: they have weights
+     */
+    static bool isWeighted(int nodeType)
+    {
+        return nodeType == NodeData::SUM || nodeType == NodeData::MAX;
+    }
+};
+
+}
+
+#endif	/* COMPILEDSPN_H */
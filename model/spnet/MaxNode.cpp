@@ -5,6 +5,7 @@
  * Created on September 5, 2013, 12:03 PM
  */
 
+#include <boost/assert.hpp>
 #include "MaxNode.h"
 
 namespace model
@@ -21,34 +22,54 @@ MaxNode::~MaxNode()
 
 void MaxNode::Forward()
 {
-    /*
-    std::vector<Edge*>::iterator it = m_incomingEdges.begin();
-    int i = 0;
-    for (; it != m_incomingEdges.end(); ++it)
+    // weighted max, the first edge wins the ties
+    std::vector<Edge*>::iterator it;
+    size_t i = 0;
+    for (it = m_incomingEdges.begin(); it != m_incomingEdges.end(); ++it, ++i)
     {
         BOOST_ASSERT((*it)->GetNode2() == this);
         
+        math::pimatrix m = (*it)->Forward();
         if (i == 0)
-            m_activations = (*it)->Forward();
-        else
-            m_activations += (*it)->Forward();
-        i++;
+        {
+            m_activations = m;
+            m_argmax.assign(m.size1() * m.size2(), 0);
+            continue;
+        }
+        
+        for (size_t r = 0; r < m.size1(); ++r)
+        {
+            for (size_t c = 0; c < m.size2(); ++c)
+            {
+                if (m(r, c) > m_activations(r, c))
+                {
+                    m_activations.set(r, c, m(r, c));
+                    m_argmax[r * m.size2() + c] = i;
+                }
+            }
+        }
     }
-    */
 }
 
 void MaxNode::Backward()
 {
-    /*
-    std::vector<Edge*>::iterator it = m_incomingEdges.begin();
-    math::pimatrix mProdActs = m_activations;
-    mProdActs.element_mult(m_derivatives);
+    std::vector<Edge*>::iterator it;
+    size_t i = 0;
+    math::pimatrix mDerivs(m_derivatives.size1(), m_derivatives.size2());
     
-    for (; it != m_incomingEdges.end(); ++it)
+    for (it = m_incomingEdges.begin(); it != m_incomingEdges.end(); ++it, ++i)
     {
-        (*it)->Backward(m_derivatives);
+        // the derivatives of the units where this edge won
+        for (size_t r = 0; r < mDerivs.size1(); ++r)
+        {
+            for (size_t c = 0; c < mDerivs.size2(); ++c)
+            {
+                mDerivs.set(r, c, m_argmax[r * mDerivs.size2() + c] == i
+                        ? m_derivatives(r, c) : 0);
+            }
+        }
+        (*it)->Backward(mDerivs);
     }
-    */
 }
 
 void MaxNode::NormalizeIncomingEdges()
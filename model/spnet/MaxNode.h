@@ -9,12 +9,22 @@
 #define	MAXNODE_H
 
 #include <Node.h>
+#include <vector>
 
 namespace model
 {
 
+/*
+ * Takes the largest weighted child, unit by unit.
+ * Derivatives only go to the child which won.
+ */
 class MaxNode : public Node
 {
+    /*
+     * batch_size x node_size: index of the winning incoming edge
+     */
+    std::vector<size_t> m_argmax;
+    
 public:
     MaxNode(const NodeData& nodeData);
     
@@ -6,6 +6,7 @@
  */
 
 #include "ProductNode.h"
+#include <algorithm>
 
 namespace model
 {
@@ -44,18 +45,45 @@ void ProductNode::Forward()
 
 void ProductNode::Backward()
 {
-    std::vector<Edge*>::iterator it = m_incomingEdges.begin();
-    math::pimatrix mProdActs = m_activations;
-    mProdActs.element_mult(m_derivatives);
+    // d(prod)/d(child_k) is the product of the other children, computed as
+    // (act_0 * ... * act_k-1) * (act_k+1 * ... * act_n-1), without dividing
+    // by act_k: exact when some children are 0.
+    const size_t n = m_incomingEdges.size();
+    const size_t M = m_derivatives.size1() * m_derivatives.size2();
+    if (n == 0 || M == 0)
+        return;
     
-    for (; it != m_incomingEdges.end(); ++it)
+    // prefix k: derivatives * act_0 * ... * act_k-1
+    m_prefixes.resize(n * M);
+    const float* deriv = m_derivatives.data();
+    std::copy(deriv, deriv + M, m_prefixes.begin());
+    for (size_t k = 1; k < n; ++k)
     {
-        Node* incomingNeighbor = (*it)->GetNode1();
-        BOOST_ASSERT((*it)->GetNode2() == this);
+        const float* act = m_incomingEdges[k - 1]->GetNode1()->GetActivations().data();
+        const float* prev = &m_prefixes[(k - 1) * M];
+        float* prefix = &m_prefixes[k * M];
+        for (size_t i = 0; i < M; ++i)
+            prefix[i] = prev[i] * act[i];
+    }
+    
+    // from the last child down, the suffix is act_k+1 * ... * act_n-1
+    m_suffix.assign(M, 1.0f);
+    m_childDerivatives.resize(m_derivatives.size1(), m_derivatives.size2());
+    float* suffix = &m_suffix[0];
+    float* out = m_childDerivatives.data();
+    for (size_t k = n; k-- > 0; )
+    {
+        Node* incomingNeighbor = m_incomingEdges[k]->GetNode1();
+        BOOST_ASSERT(m_incomingEdges[k]->GetNode2() == this);
         
-        math::pimatrix tmp = mProdActs;
-        tmp.element_div(incomingNeighbor->GetActivations());
-        incomingNeighbor->AccumDerivatives(tmp);
+        const float* act = incomingNeighbor->GetActivations().data();
+        const float* prefix = &m_prefixes[k * M];
+        for (size_t i = 0; i < M; ++i)
+        {
+            out[i] = prefix[i] * suffix[i];
+            suffix[i] *= act[i];
+        }
+        incomingNeighbor->AccumDerivatives(m_childDerivatives);
     }
 }
 
@@ -9,6 +9,7 @@
 #define	PRODUCTNODE_H
 
 #include <Node.h>
+#include <vector>
 
 namespace model
 {
@@ -26,7 +27,9 @@ public:
     virtual void NormalizeIncomingEdges();
     
 private:
-
+    // buffers of Backward(), kept to avoid allocations
+    std::vector<float> m_prefixes, m_suffix;
+    math::pimatrix m_childDerivatives;
 };
 
 }
@@ -9,10 +9,11 @@
 #include <boost/assert.hpp>
 #include <boost/range/algorithm_ext.hpp>
 #include <boost/range/adaptor/filtered.hpp>
-#include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/math/special_functions/binomial.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/unordered_set.hpp>
 
 #include <spnet/Spn.h>
 #include <pimatrix.h>
@@ -27,10 +28,16 @@ namespace model
 
 Spn::Spn()
 : m_root(NULL)
+, m_compiled(NULL)
+, m_bUseCompiled(true)
+, m_threadCount(1)
+, m_parallelMode(Operation::NODE_LEVELS)
 {   }
 
 Spn::~Spn()
 {
+    delete m_compiled;
+    m_compiled = NULL;
     m_inputNodes.clear();
     m_hiddenNodes.clear();
     m_queryNodes.clear();
@@ -42,6 +49,12 @@ math::pimatrix Spn::Forward(math::pimatrix* batch)
 {
     std::vector<Node*>::iterator it;
     
+    if (batch && m_compiled && m_bUseCompiled)
+    {
+        m_compiled->LoadWeights();
+        return m_compiled->Forward(*batch);
+    }
+    
     // set data
     if (batch)
     {
@@ -71,6 +84,105 @@ math::pimatrix Spn::Forward(math::pimatrix* batch)
     return m_root->GetActivations();
 }
 
+math::pimatrix Spn::ForwardIncremental(math::pimatrix* batch)
+{
+    if (batch && m_compiled && m_bUseCompiled)
+    {
+        m_compiled->LoadWeights();
+        return m_compiled->ForwardIncremental(*batch);
+    }
+    return Forward(batch);
+}
+
+math::pimatrix Spn::Mpe(math::pimatrix* batch, math::pimatrix& assignment)
+{
+    BOOST_ASSERT_MSG(batch && m_root, "No batch, or Validate() was not run.");
+    
+    if (!m_compiled || !m_bUseCompiled)
+    {
+        std::cout << "ERR\tMPE inference needs the compiled evaluator"
+                  << " (all nodes of dimension 1)" << std::endl;
+        assignment.resize(0, 0);
+        return math::pimatrix();
+    }
+    m_compiled->LoadWeights();
+    return m_compiled->Mpe(*batch, assignment);
+}
+
+void Spn::Sample(const Operation& op, size_t count, math::pimatrix& samples)
+{
+    BOOST_ASSERT_MSG(m_root, "Validate() was not run.");
+    
+    if (!m_compiled || !m_bUseCompiled)
+    {
+        std::cout << "ERR\tSampling needs the compiled evaluator"
+                  << " (all nodes of dimension 1)" << std::endl;
+        samples.resize(0, 0);
+        return;
+    }
+    SetThreadCount(op.thread_count(), op.parallel_mode());
+    m_compiled->LoadWeights();
+    m_compiled->Sample(count, op.random_seed(), samples);
+}
+
+math::pimatrix Spn::Query(math::pimatrix* evidence, math::pimatrix* missing
+        , math::pimatrix* queries, math::pimatrix& conditionals)
+{
+    BOOST_ASSERT_MSG(evidence && missing && m_root, "No evidence, or Validate() was not run.");
+    const size_t B = evidence->size1(), D = evidence->size2();
+    const size_t Q = (queries ? queries->size1() : 0);
+    BOOST_ASSERT_MSG(missing->size1() == B && missing->size2() == D
+            , "The missing mask should have the size of the evidence");
+    BOOST_ASSERT_MSG(!queries || queries->size2() == D
+            , "Queries should have as many columns as the evidence");
+    
+    math::pimatrix mEvidence(B, D), mLogProb;
+    for (size_t b = 0; b < B; ++b)
+    {
+        for (size_t c = 0; c < D; ++c)
+            mEvidence.set(b, c, (*missing)(b, c) != 0 ? 1.0f : (*evidence)(b, c));
+    }
+    
+    if (m_compiled && m_bUseCompiled)
+    {
+        // the nodes above no queried column are evaluated once
+        math::pimatrix noQueries(0, D);
+        m_compiled->LoadWeights();
+        mLogProb = m_compiled->Query(mEvidence, queries ? *queries : noQueries);
+    }
+    else
+    {
+        // the evidence, then one copy of it for every query
+        math::pimatrix mInputs((Q + 1) * B, D);
+        for (size_t q = 0; q <= Q; ++q)
+        {
+            mInputs.copyRows(mEvidence, 0, B, q * B);
+            for (size_t c = 0; q > 0 && c < D; ++c)
+            {
+                if ((*queries)(q - 1, c) >= 0)
+                    mInputs.setValue((*queries)(q - 1, c), q * B, B, c, 1);
+            }
+        }
+        mLogProb = Forward(&mInputs);
+    }
+    
+    if (!IsLogSpace())
+        mLogProb.element_log();
+    
+    math::pimatrix mLogEvidence(B, 1);
+    mLogEvidence.copyRows(mLogProb, 0, B, 0);
+    conditionals.resize(B, Q);
+    for (size_t q = 0; q < Q; ++q)
+    {
+        for (size_t b = 0; b < B; ++b)
+        {
+            conditionals.set(b, q, std::exp(mLogProb((q + 1) * B + b, 0)
+                                            - mLogEvidence(b, 0)));
+        }
+    }
+    return mLogEvidence;
+}
+
 void Spn::Backward()
 {
     std::vector<Node*>::reverse_iterator it;
@@ -81,6 +193,24 @@ void Spn::Backward()
     } 
 }
 
+void Spn::ComputeGradients(math::pimatrix* batch, std::vector<float>& gradients)
+{
+    // derivatives of log(p) wrt the root: 1/p, or 1 in log space
+    math::pimatrix mError = Forward(batch);
+    if (IsLogSpace())
+        mError.setValue(1);
+    else
+        mError.element_inverse();
+    backpropagate(mError);
+    
+    gradients.clear();
+    for (std::vector<Edge*>::iterator it = m_edges.begin(); it != m_edges.end(); ++it)
+    {
+        const float* g = m_params->GetGradients() + (*it)->GetParameterOffset();
+        gradients.insert(gradients.end(), g, g + (*it)->GetParameterCount());
+    }
+}
+
 float getLastMetricAvg(Metrics& metrics, Metric_MetricType t)
 {
     int i = -1;
@@ -110,13 +240,27 @@ void Spn::Train(Operation& trainOp, Operation* evalOp /*= NULL*/)
 {
     BOOST_ASSERT_MSG(!m_nodeList.empty() && m_root,
             "No backprop order. Please run Validate() first.");
+    if (trainOp.simplify())
+        Simplify(false);
     
     // load data handler
     data::DataHandler* dataHandler = util::Util::LoadDataHandler(
             trainOp.data_proto(), trainOp.randomize()
-            , trainOp.random_seed(), trainOp.verbose());
+            , trainOp.random_seed(), trainOp.verbose()
+            , trainOp.shard_rank(), trainOp.shard_count());
     if (!dataHandler)
         return;
+    SetThreadCount(trainOp.thread_count(), trainOp.parallel_mode());
+    
+    bool bEM = (trainOp.optimizer() == Operation::EM
+            || trainOp.optimizer() == Operation::HARD_EM);
+    if (bEM && !(m_compiled && m_bUseCompiled))
+    {
+        std::cout << "ERR\tEM needs the compiled evaluator"
+                  << " (all nodes of dimension 1)" << std::endl;
+        delete dataHandler;
+        return;
+    }
     
     data::Dataset* trainSet, *evalSet, *testSet;
     trainSet = dataHandler->GetDataset(model::DatasetInfo::TRAIN_SET);
@@ -172,17 +316,43 @@ void Spn::Train(Operation& trainOp, Operation* evalOp /*= NULL*/)
     // normalize before training
     normalizeWeights();
     
+    // EM reads every sample exactly once per pass over the training set
+    if (bEM)
+        trainSet->ResetEpoch();
+    
     for (iTrainStep = 0; stopCondition(stopCond, iTrainStep); ++iTrainStep)
     {
-        // load data, this is for asynchronous data loading
-        trainSet->EndLoadNextBatch();
-        currentBatch = trainSet->GetCurrentBatch();
-        trainSet->BeginLoadNextBatch();
+        if (bEM)
+        {
+            trainSet->LoadEpochBatch();
+            currentBatch = trainSet->GetCurrentBatch();
+        }
+        else
+        {
+            // load data, this is for asynchronous data loading
+            trainSet->EndLoadNextBatch();
+            currentBatch = trainSet->GetCurrentBatch();
+            trainSet->BeginLoadNextBatch();
+        }
         
         // train current batch
         std::cout << "Step: " << iTrainStep << "\r";
         trainMetrics.Clear();
-        TrainOneBatch(trainOp, currentBatch, iTrainStep, &trainMetrics);
+        if (bEM)
+        {
+            accumulateCounts(trainOp, currentBatch, &trainMetrics);
+            
+            // M-step after every pass over the training set
+            if (trainSet->IsEpochEnd())
+            {
+                m_compiled->StoreCountWeights();
+                trainSet->ResetEpoch();
+            }
+        }
+        else
+        {
+            TrainOneBatch(trainOp, currentBatch, iTrainStep, &trainMetrics);
+        }
         
         // normalize if required.
         if (trainOp.normalize_each_train_step())
@@ -238,8 +408,14 @@ void Spn::Train(Operation& trainOp, Operation* evalOp /*= NULL*/)
             util::Util::WriteProto(cpFullPath.generic_string(), &currentModelData);
         }
     }
-    Prune();
+    
+    // the counts of an incomplete pass
+    if (bEM)
+        m_compiled->StoreCountWeights();
+    Prune(trainOp.prune_threshold());
     normalizeWeights();
+    if (trainOp.simplify())
+        Simplify(true);
     
     delete dataHandler;
 }
@@ -248,22 +424,30 @@ void Spn::Evaluate(Operation& evalOp, data::Dataset* evalDataset
         , Metrics &evalStats)
 {
     Operation_StopCondition stopCond = evalOp.stop_condition();
-	if (stopCond.all_processed())
-	{
-		stopCond.set_steps(evalDataset->GetNumBatches());
-    }
+    bool bEpoch = stopCond.all_processed();
     
     int iStep;
     math::pimatrix* currentBatch;
     math::pimatrix jointProb, tmp;
     
-    for (iStep = 0; stopCondition(stopCond, iStep); ++iStep)
+    // with all_processed, read every sample exactly once
+    if (bEpoch)
+        evalDataset->ResetEpoch();
+    
+    for (iStep = 0; bEpoch || stopCondition(stopCond, iStep); ++iStep)
     {
-        // load data, this is for asynchronous data loading
-        evalDataset->EndLoadNextBatch();
+        if (bEpoch)
+        {
+            if (!evalDataset->LoadEpochBatch())
+                break;
+        }
+        else
+        {
+            // load data, this is for asynchronous data loading
+            evalDataset->EndLoadNextBatch();
+            evalDataset->BeginLoadNextBatch();
+        }
         currentBatch = evalDataset->GetCurrentBatch();
-        evalDataset->BeginLoadNextBatch();
-        
             
         jointProb = Forward(currentBatch);
 
@@ -271,7 +455,10 @@ void Spn::Evaluate(Operation& evalOp, data::Dataset* evalDataset
                 && jointProb.size2() == m_root->GetDimension()
                 , "Invalid dimension of the joint probability");
         
-        jointProb.element_log(true);
+        if (IsLogSpace())
+            jointProb.element_negate(0, jointProb.size1(), 0, 1);
+        else
+            jointProb.element_log(true);
         jointProb.sum(1, tmp);
         util::Util::AccumulateMetric(evalStats, Metric::NLL,
                 currentBatch->size1(), tmp(0, 0));
@@ -282,9 +469,19 @@ void Spn::Evaluate(Operation& evalOp, data::Dataset* evalDataset
 
 bool Spn::Validate()
 {
-	bool bRet = Model::Validate();
-	if (!bRet)
-		return false;
+    delete m_compiled;
+    m_compiled = NULL;
+    
+    // the topological sort runs on the flat arrays,
+    // Model::Validate() only reports the cycles
+    std::vector<boost::uint32_t> order;
+    m_graph.Build(m_nodes);
+    if (!m_graph.TopologicalSort(order))
+        return Model::Validate();
+    
+    m_nodeList.resize(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        m_nodeList[i] = m_nodes[order[i]];
 
 	// find root
     m_root = NULL;
@@ -302,7 +499,35 @@ bool Spn::Validate()
     
     // in SPN, the root must be the last one..
     Node* lastNode = (*m_nodeList.rbegin());
-    return m_root != NULL && m_root == lastNode;
+    if (m_root == NULL || m_root != lastNode)
+        return false;
+    
+    // the weights of the children of a node are next to each other
+    bindParameters();
+    m_graph.BindParameters(m_nodes, m_params);
+    
+    bool bLogSpace = m_modelData.spn_data().log_space();
+    m_compiled = CompiledSpn::Compile(m_nodeList, bLogSpace);
+    if (!m_compiled && bLogSpace)
+    {
+        std::cout << "ERR\tlog_space is not supported for SPNs with nodes"
+                  << " of dimension other than 1" << std::endl;
+        return false;
+    }
+    SetThreadCount(m_threadCount, m_parallelMode);
+    return true;
+}
+
+void Spn::SetThreadCount(int threadCount
+    , Operation_ParallelMode mode /*= Operation::NODE_LEVELS*/)
+{
+    m_threadCount = std::max(threadCount, 1);
+    m_parallelMode = mode;
+    if (m_compiled)
+    {
+        m_compiled->SetThreadCount(m_threadCount);
+        m_compiled->SetPartitionBatch(mode == Operation::BATCH_ROWS);
+    }
 }
 
 /**************************************************************************/
@@ -314,47 +539,54 @@ void Spn::TrainOneBatch(Operation& trainOp
     std::vector<Node*>::iterator it;
     size_t nSamples = batch->size1();
     
+    // get the error (actually the probability at the root)
+    math::pimatrix mJointProb, mError;
+    
     // quite tricky here: we construct 2 set of samples,
     // the first set is for the positive phase
-    // and the second for the negative phase
-    math::pimatrix twoBatch(nSamples*2, batch->size2());
-    
-    twoBatch.copyRows(*batch, 0, nSamples, 0);
-    twoBatch.copyRows(*batch, 0, nSamples, nSamples);
-    
-    // set query variables of the second half to 1
-    for(it = m_queryNodes.begin(); it != m_queryNodes.end(); ++it)
+    // and the second for the negative phase, where the query variables are 1.
+    // The compiled evaluator only computes the nodes above the query
+    // variables twice, and shares the others.
+    if (m_compiled && m_bUseCompiled)
     {
-         twoBatch.setValue(1.0f, nSamples, nSamples
-                 , (*it)->GetInputStartIndex(), (*it)->GetDimension());
+        m_compiled->LoadWeights();
+        mJointProb = m_compiled->Forward(*batch, true);
+    }
+    else
+    {
+        math::pimatrix twoBatch(nSamples*2, batch->size2());
+
+        twoBatch.copyRows(*batch, 0, nSamples, 0);
+        twoBatch.copyRows(*batch, 0, nSamples, nSamples);
+
+        // set query variables of the second half to 1
+        for(it = m_queryNodes.begin(); it != m_queryNodes.end(); ++it)
+        {
+             twoBatch.setValue(1.0f, nSamples, nSamples
+                     , (*it)->GetInputStartIndex(), (*it)->GetDimension());
+        }
+        mJointProb = Forward(&twoBatch);
     }
-    
-    // get the error (actually the probability at the root)
-    math::pimatrix mJointProb, mError;
-    
-    mJointProb = Forward(&twoBatch);
     BOOST_ASSERT(mJointProb.size1() == 2*nSamples && mJointProb.size2() == 1);
     
     // then we negate the error of half of the "batch"
-    mError = mJointProb;
-    mError.element_inverse();
-    mError.element_negate(nSamples, nSamples, 0, 1);
-    
-    for(it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    // derivatives of log(p) wrt the root: 1/p, or 1 in log space
+    if (IsLogSpace())
     {
-        (*it)->InitializeDerivative();
+        mError.resize(2*nSamples, 1);
+        mError.setValue(1);
     }
-    m_root->AccumDerivatives(mError);
+    else
+    {
+        mError = mJointProb;
+        mError.element_inverse();
+    }
+    mError.element_negate(nSamples, nSamples, 0, 1);
     
-    // and do backward.
-    Backward();
+    backpropagate(mError);
     
     // lastly: update parameters
-    std::vector<Edge*>::iterator itEdge;
-    for(itEdge = m_edges.begin(); itEdge != m_edges.end(); ++itEdge)
-    {
-        (*itEdge)->UpdateParams(iTrainStep, trainOp.batch_size());
-    }
+    updateParams(iTrainStep, trainOp.batch_size(), trainOp.optimizer());
     
     // update parameters for nodes. Normally this is not 
     // necessary for SPN where nodes do not have biases.
@@ -368,16 +600,421 @@ void Spn::TrainOneBatch(Operation& trainOp
     {
         math::pimatrix m(nSamples, 1), tmp;
         m.copyRows(mJointProb, 0, nSamples, 0);
-        m.element_log(true);
+        if (IsLogSpace())
+            m.element_negate(0, nSamples, 0, 1);
+        else
+            m.element_log(true);
         m.sum(1, tmp);
         
         util::Util::AccumulateMetric(*metrics, Metric::NLL, nSamples, tmp(0, 0));
     }
 }
 
-void Spn::Prune()
+void Spn::accumulateCounts(Operation& trainOp, math::pimatrix* batch
+                    , Metrics *metrics)
+{
+    size_t nSamples = batch->size1();
+    math::pimatrix mJointProb, mDerivs;
+    
+    m_compiled->LoadWeights();
+    if (trainOp.optimizer() == Operation::HARD_EM)
+    {
+        // the children on the MPE tree of every sample
+        math::pimatrix assignment;
+        m_compiled->Mpe(*batch, assignment);
+        m_compiled->AccumulateCounts(true);
+        
+        if (metrics)
+            mJointProb = m_compiled->Forward(*batch);
+    }
+    else
+    {
+        // derivatives of log(p) wrt the root: 1/p, or 1 in log space
+        mJointProb = m_compiled->Forward(*batch);
+        if (IsLogSpace())
+        {
+            mDerivs.resize(nSamples, 1);
+            mDerivs.setValue(1);
+        }
+        else
+        {
+            mDerivs = mJointProb;
+            mDerivs.element_inverse();
+        }
+        m_compiled->Backward(mDerivs);
+        m_compiled->AccumulateCounts(false);
+    }
+    
+    // get log-likelihood
+    if (metrics)
+    {
+        math::pimatrix tmp;
+        if (IsLogSpace())
+            mJointProb.element_negate(0, nSamples, 0, 1);
+        else
+            mJointProb.element_log(true);
+        mJointProb.sum(1, tmp);
+        
+        util::Util::AccumulateMetric(*metrics, Metric::NLL, nSamples, tmp(0, 0));
+    }
+}
+
+void Spn::backpropagate(math::pimatrix& rootDerivatives)
+{
+    if (m_compiled && m_bUseCompiled)
+    {
+        m_compiled->Backward(rootDerivatives);
+        m_compiled->StoreGradients();
+        return;
+    }
+    
+    std::vector<Node*>::iterator it;
+    for(it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    {
+        (*it)->InitializeDerivative();
+    }
+    m_root->AccumDerivatives(rootDerivatives);
+
+    // and do backward.
+    Backward();
+}
+
+void Spn::Prune(float threshold)
+{
+    if (threshold <= 0 || !m_root)
+        return;
+    
+    normalizeWeights();
+    boost::unordered_set<Edge*> removedEdges;
+    boost::unordered_set<Node*> touchedNodes;
+    std::vector<Node*>::iterator it;
+    
+    // small weights of sum nodes
+    for (it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    {
+        if ((*it)->GetNodeType() != NodeData::SUM)
+            continue;
+        
+        std::vector<Edge*>& incoming = (*it)->GetIncomingEdges();
+        Edge* maxEdge = NULL;
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end(); ++itEdge)
+        {
+            if (!maxEdge || (*itEdge)->GetWeight()(0, 0) > maxEdge->GetWeight()(0, 0))
+                maxEdge = *itEdge;
+        }
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end(); ++itEdge)
+        {
+            if (*itEdge != maxEdge && (*itEdge)->GetWeight()(0, 0) < threshold)
+            {
+                removedEdges.insert(*itEdge);
+                touchedNodes.insert((*itEdge)->GetNode1());
+                touchedNodes.insert(*it);
+            }
+        }
+    }
+    if (!touchedNodes.empty())
+    {
+        // the compiled network is gone until the next Validate()
+        delete m_compiled;
+        m_compiled = NULL;
+    }
+    for (boost::unordered_set<Node*>::iterator itNode = touchedNodes.begin();
+            itNode != touchedNodes.end(); ++itNode)
+    {
+        (*itNode)->RemoveEdges(removedEdges);
+    }
+    normalizeWeights();
+    
+    // single-child nodes, bottom-up: their child takes their place.
+    // The removed edges stay in the lists of the child and the parents
+    // until a node is visited or the end, so each list is filtered once.
+    touchedNodes.clear();
+    for (it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    {
+        Node* node = *it;
+        if (touchedNodes.erase(node))
+            node->RemoveEdges(removedEdges);
+        
+        NodeData_NodeType nodeType = node->GetNodeType();
+        if (node == m_root || node->GetIncomingEdgesCount() != 1
+                || (nodeType != NodeData::SUM && nodeType != NodeData::PRODUCT))
+            continue;
+        
+        delete m_compiled;
+        m_compiled = NULL;
+        
+        Edge* childEdge = node->GetIncomingEdges()[0];
+        Node* child = childEdge->GetNode1();
+        std::vector<Edge*>& outgoing = node->GetOutgoingEdges();
+        for (std::vector<Edge*>::iterator itEdge = outgoing.begin();
+                itEdge != outgoing.end(); ++itEdge)
+        {
+            addEdge(child, (*itEdge)->GetNode2()
+                    , (*itEdge)->GetWeight()(0, 0) * childEdge->GetWeight()(0, 0));
+            removedEdges.insert(*itEdge);
+            touchedNodes.insert((*itEdge)->GetNode2());
+        }
+        removedEdges.insert(childEdge);
+        touchedNodes.insert(child);
+        node->RemoveEdges(removedEdges);
+    }
+    for (boost::unordered_set<Node*>::iterator itNode = touchedNodes.begin();
+            itNode != touchedNodes.end(); ++itNode)
+    {
+        (*itNode)->RemoveEdges(removedEdges);
+    }
+    
+    removeUnreachable(removedEdges);
+    normalizeWeights();
+}
+
+void Spn::Simplify(bool bWeights)
+{
+    if (!m_root)
+        return;
+    
+    boost::unordered_set<Edge*> removedEdges;
+    boost::unordered_map<Node*, Edge*> firstEdges;
+    std::vector<Node*>::iterator it;
+    
+    // bottom-up, so that the children are already flat
+    for (it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    {
+        Node* node = *it;
+        NodeData_NodeType nodeType = node->GetNodeType();
+        if (nodeType != NodeData::PRODUCT && !(bWeights && nodeType == NodeData::SUM))
+            continue;
+        
+        // the edges of this node, by child. The removed ones are only
+        // filtered out of its list once, after the loop.
+        std::vector<Edge*> incoming(node->GetIncomingEdges());
+        size_t removedCount = removedEdges.size();
+        firstEdges.clear();
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end(); ++itEdge)
+        {
+            Node* child = (*itEdge)->GetNode1();
+            
+            // parallel edges of sum nodes add up
+            Edge*& firstEdge = firstEdges[child];
+            if (nodeType == NodeData::SUM && firstEdge)
+            {
+                addWeight(firstEdge, (*itEdge)->GetWeight()(0, 0));
+                child->RemoveEdge(*itEdge);
+                removedEdges.insert(*itEdge);
+                continue;
+            }
+            firstEdge = *itEdge;
+            
+            // children of the same type, which no other node uses
+            if (child->GetNodeType() != nodeType || child->GetOutgoingEdgesCount() != 1
+                    || child->GetIncomingEdgesCount() == 0)
+                continue;
+            
+            // w * (w_1 c_1 + w_2 c_2) = w w_1 c_1 + w w_2 c_2
+            // w * (w_1 c_1 * w_2 c_2) = w w_1 c_1 * w_2 c_2
+            float w = (*itEdge)->GetWeight()(0, 0);
+            std::vector<Edge*>& grandChildren = child->GetIncomingEdges();
+            for (size_t k = 0; k < grandChildren.size(); ++k)
+            {
+                float wk = (nodeType == NodeData::SUM || k == 0 ? w : 1.0f)
+                            * grandChildren[k]->GetWeight()(0, 0);
+                Edge*& sibling = firstEdges[grandChildren[k]->GetNode1()];
+                if (nodeType == NodeData::SUM && sibling)
+                    addWeight(sibling, wk);
+                else
+                    sibling = addEdge(grandChildren[k]->GetNode1(), node, wk, false);
+            }
+            firstEdges.erase(child);
+            child->RemoveEdge(*itEdge);
+            removedEdges.insert(*itEdge);
+        }
+        if (removedEdges.size() > removedCount)
+        {
+            // the compiled network is gone until the next Validate()
+            delete m_compiled;
+            m_compiled = NULL;
+            node->RemoveEdges(removedEdges);
+        }
+    }
+    
+    // identical nodes: same type, same input column, or the same
+    // children with the same weights. Children come first, so their
+    // duplicates are already gone.
+    boost::unordered_map<Node*, size_t> nodeIds;
+    boost::unordered_map<std::vector<double>, Node*> signatures;
+    std::vector<std::pair<double, double> > children;
+    for (it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
+    {
+        Node* node = *it;
+        size_t nodeId = nodeIds.size();
+        nodeIds[node] = nodeId;
+        NodeData_NodeType nodeType = node->GetNodeType();
+        if (node == m_root || node->GetOutgoingEdgesCount() == 0 || nodeType == NodeData::HIDDEN
+                || (!bWeights && (nodeType == NodeData::SUM || nodeType == NodeData::MAX)))
+            continue;
+        
+        std::vector<double> signature(1, nodeType);
+        if (nodeType == NodeData::INPUT || nodeType == NodeData::QUERY)
+            signature.push_back(node->GetInputStartIndex());
+        
+        children.clear();
+        std::vector<Edge*>& incoming = node->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end(); ++itEdge)
+        {
+            children.push_back(std::make_pair((double)nodeIds[(*itEdge)->GetNode1()]
+                    , (double)(*itEdge)->GetWeight()(0, 0)));
+        }
+        std::sort(children.begin(), children.end());
+        for (size_t k = 0; k < children.size(); ++k)
+        {
+            signature.push_back(children[k].first);
+            signature.push_back(children[k].second);
+        }
+        
+        std::pair<boost::unordered_map<std::vector<double>, Node*>::iterator, bool> found
+                = signatures.insert(std::make_pair(signature, node));
+        if (found.second)
+            continue;
+        
+        // the parents take the first one instead
+        std::vector<Edge*> outgoing(node->GetOutgoingEdges());
+        for (std::vector<Edge*>::iterator itEdge = outgoing.begin();
+                itEdge != outgoing.end(); ++itEdge)
+        {
+            addEdge(found.first->second, (*itEdge)->GetNode2()
+                    , (*itEdge)->GetWeight()(0, 0), bWeights);
+            detachEdge(*itEdge, removedEdges);
+        }
+    }
+    
+    if (!removedEdges.empty())
+        removeUnreachable(removedEdges);
+}
+
+Edge* Spn::addEdge(Node* child, Node* parent, float w, bool bMerge /*= true*/)
+{
+    // a sum parent which already has the child adds up the weights
+    Edge* newEdge = NULL;
+    if (bMerge && parent->GetNodeType() == NodeData::SUM)
+    {
+        std::vector<Edge*>& siblings = parent->GetIncomingEdges();
+        for (size_t k = 0; k < siblings.size() && !newEdge; ++k)
+        {
+            if (siblings[k]->GetNode1() == child)
+                newEdge = siblings[k];
+        }
+    }
+    if (newEdge)
+    {
+        w += newEdge->GetWeight()(0, 0);
+    }
+    else
+    {
+        newEdge = new Edge(child, parent, true);
+        newEdge->MergeHyperparams(m_modelData.hyper_params());
+        m_edges.push_back(newEdge);
+    }
+    math::pimatrix weight(1, 1, w);
+    newEdge->SetWeight(weight);
+    return newEdge;
+}
+
+void Spn::addWeight(Edge* e, float w)
+{
+    math::pimatrix weight(1, 1, e->GetWeight()(0, 0) + w);
+    e->SetWeight(weight);
+}
+
+void Spn::detachEdge(Edge* e, boost::unordered_set<Edge*>& removedEdges)
 {
+    // the compiled network is gone until the next Validate()
+    delete m_compiled;
+    m_compiled = NULL;
+    
+    e->GetNode1()->RemoveEdge(e);
+    e->GetNode2()->RemoveEdge(e);
+    removedEdges.insert(e);
+}
+
+void Spn::removeUnreachable(boost::unordered_set<Edge*>& removedEdges)
+{
+    std::vector<Node*>::iterator it;
+    boost::unordered_set<Node*> reachable;
+    std::vector<Node*> stack(1, m_root);
+    reachable.insert(m_root);
+    while (!stack.empty())
+    {
+        Node* node = stack.back();
+        stack.pop_back();
+        std::vector<Edge*>& incoming = node->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator itEdge = incoming.begin();
+                itEdge != incoming.end(); ++itEdge)
+        {
+            if (reachable.insert((*itEdge)->GetNode1()).second)
+                stack.push_back((*itEdge)->GetNode1());
+        }
+    }
+    
+    std::vector<Node*> nodes;
+    for (it = m_nodes.begin(); it != m_nodes.end(); ++it)
+    {
+        if (reachable.count(*it))
+        {
+            nodes.push_back(*it);
+            continue;
+        }
+        // detach the reachable nodes from it
+        std::vector<Edge*> attached((*it)->GetIncomingEdges());
+        attached.insert(attached.end(), (*it)->GetOutgoingEdges().begin()
+                , (*it)->GetOutgoingEdges().end());
+        for (std::vector<Edge*>::iterator itEdge = attached.begin();
+                itEdge != attached.end(); ++itEdge)
+        {
+            Node* other = ((*itEdge)->GetNode1() == *it ? (*itEdge)->GetNode2()
+                                                        : (*itEdge)->GetNode1());
+            if (reachable.count(other))
+                other->RemoveEdge(*itEdge);
+            removedEdges.insert(*itEdge);
+        }
+        delete (*it);
+    }
+    
+    std::vector<Edge*> edges;
+    for (std::vector<Edge*>::iterator itEdge = m_edges.begin();
+            itEdge != m_edges.end(); ++itEdge)
+    {
+        if (removedEdges.count(*itEdge))
+            delete (*itEdge);
+        else
+            edges.push_back(*itEdge);
+    }
+    m_nodes.swap(nodes);
+    m_edges.swap(edges);
     
+    m_inputNodes.clear();
+    m_hiddenNodes.clear();
+    m_queryNodes.clear();
+    for (it = m_nodes.begin(); it != m_nodes.end(); ++it)
+    {
+        if ((*it)->GetNodeType() == NodeData::INPUT)
+            m_inputNodes.push_back(*it);
+        else if ((*it)->GetNodeType() == NodeData::HIDDEN)
+            m_hiddenNodes.push_back(*it);
+        else if ((*it)->GetNodeType() == NodeData::QUERY)
+            m_queryNodes.push_back(*it);
+    }
+    
+    // the initial structure doesn't describe the network anymore
+    bool bLogSpace = m_modelData.spn_data().log_space();
+    m_modelData.clear_spn_data();
+    if (bLogSpace)
+        m_modelData.mutable_spn_data()->set_log_space(true);
+    
+    Validate();
 }
 
 bool Spn::stopCondition(const Operation_StopCondition& cond, int iStep)
@@ -427,6 +1064,9 @@ void Spn::appendStats(Metrics* metrics, Metrics &newMetrics, int iTrainStep)
 
 void Spn::normalizeWeights()
 {
+    if (m_compiled && m_compiled->NormalizeWeights())
+        return;
+    
     std::vector<Node*>::iterator it;
     for (it = m_nodeList.begin(); it != m_nodeList.end(); ++it)
     {
@@ -509,19 +1149,29 @@ bool Spn::LoadSpnInit(const SpnData& spnData
     bool bListInit = spnData.has_adjacency_matrix() 
                     && spnData.has_input_indices() && spnData.has_node_list();
     bool bLayerwiseInit = spnData.layers_size() > 0;
+    bool bSparseInit = spnData.node_types_size() > 0;
     
-    if (!bListInit && !bLayerwiseInit)
+    if (!bListInit && !bLayerwiseInit && !bSparseInit)
         return true;
     
     if (bLayerwiseInit)
     {
-        if (bListInit)
+        if (bListInit || bSparseInit)
         {
             std::cout << "Multiple ways to initialize SPN. Only take layers data"
                       << std::endl;
         }
         return LoadSpnLayerInit(spnData, nodes, edges);
     }
+    if (bSparseInit)
+    {
+        if (bListInit)
+        {
+            std::cout << "Multiple ways to initialize SPN. Only take the sparse structure"
+                      << std::endl;
+        }
+        return LoadSpnSparseInit(spnData, nodes, edges);
+    }
     return Spn::LoadSpnListInit(spnData, nodes, edges);
 }
 
@@ -665,9 +1315,31 @@ bool Spn::LoadSpnListInit(const SpnData& spnData
     return true;
 }
 
-bool findNodeByName(const std::string& sNodeName, Node* n)
+bool Spn::LoadSpnSparseInit(const SpnData& spnData
+                , std::vector<Node*>& nodes, std::vector<Edge*>& edges)
 {
-    return sNodeName.compare(n->GetName()) == 0;
+    SpnGraph graph;
+    if (!graph.Load(spnData) || !graph.CreateNodes(nodes, edges))
+    {
+        Model::deleteList(nodes);
+        nodes.clear();
+        Model::deleteList(edges);
+        edges.clear();
+        return false;
+    }
+    return true;
+}
+
+typedef boost::unordered_map<std::string, Node*> NodeIndex;
+
+/*
+ * Nodes by name. For duplicated names, the first node wins.
+ */
+void indexNodes(const std::vector<Node*>& nodes, NodeIndex& nodeIndex)
+{
+    nodeIndex.rehash(nodes.size());
+    for (std::vector<Node*>::const_iterator it = nodes.begin(); it != nodes.end(); ++it)
+        nodeIndex.insert(std::make_pair((*it)->GetName(), *it));
 }
 
 bool Spn::LoadSpnStructure(const ModelData& modelData
@@ -675,9 +1347,13 @@ bool Spn::LoadSpnStructure(const ModelData& modelData
 {
     bool bNewModel = nodes.size() == 0 && edges.size() == 0;
     Node* newNode;
-    std::vector<Node*>::iterator itFind;
+    NodeIndex nodeIndex;
+    NodeIndex::iterator itFind;
     int i;
     
+    if (!bNewModel)
+        indexNodes(nodes, nodeIndex);
+    
     // nodes
     for (i = modelData.nodes_size() - 1; i >= 0; --i)
     {
@@ -698,16 +1374,15 @@ bool Spn::LoadSpnStructure(const ModelData& modelData
         }
         else
         {
-            itFind = std::find_if(nodes.begin(), nodes.end()
-                    , boost::bind(findNodeByName, nodeData.name(), _1));
-            if (itFind == nodes.end())
+            itFind = nodeIndex.find(nodeData.name());
+            if (itFind == nodeIndex.end())
             {
                 std::cout << "Ignore initialization of node: " 
                           << nodeData.name() << std::endl;
             }
             else
             {
-                newNode = (*itFind);
+                newNode = itFind->second;
                 newNode->MergeNodeData(nodeData);
             }
         }
@@ -717,31 +1392,33 @@ bool Spn::LoadSpnStructure(const ModelData& modelData
     Node *node1, *node2;
     Edge *newEdge;
     
+    if (bNewModel)
+        indexNodes(nodes, nodeIndex);
+    edges.reserve(edges.size() + modelData.edges_size());
+    
     for (i = modelData.edges_size() - 1; i >= 0; --i)
     {
         const EdgeData& edgeData = modelData.edges(i);
         
-        itFind = std::find_if(nodes.begin(), nodes.end()
-                    , boost::bind(findNodeByName, edgeData.node1(), _1));
-        if (itFind == nodes.end())
+        itFind = nodeIndex.find(edgeData.node1());
+        if (itFind == nodeIndex.end())
         {
             std::cout << "Couldn't find node: " << edgeData.node1()
                       << " so we ignore the edge " << edgeData.node1()
                       << " - " << edgeData.node2() << std::endl;
             continue;
         }
-        node1 = (*itFind);
+        node1 = itFind->second;
         
-        itFind = std::find_if(nodes.begin(), nodes.end()
-                    , boost::bind(findNodeByName, edgeData.node2(), _1));
-        if (itFind == nodes.end())
+        itFind = nodeIndex.find(edgeData.node2());
+        if (itFind == nodeIndex.end())
         {
             std::cout << "Couldn't find node: " << edgeData.node2()
                       << " so we ignore the edge " << edgeData.node1()
                       << " - " << edgeData.node2() << std::endl;
             continue;
         }
-        node2 = (*itFind);
+        node2 = itFind->second;
         
         newEdge = new Edge(node1, node2, edgeData.directed());
         newEdge->MergeEdgeData(edgeData);
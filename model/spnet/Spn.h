@@ -8,38 +8,165 @@
 #ifndef SPN_H
 #define	SPN_H
 
+#include <boost/unordered_set.hpp>
 #include <deeplearn.pb.h>
 #include <pimatrix.h>
 #include <Model.h>
+#include <spnet/CompiledSpn.h>
+#include <spnet/SpnGraph.h>
 
 namespace model
 {
 
 class Spn : public Model
 {
+    friend class SpnGraph;
+    
     // views on the underlying list of nodes (in Model)
     std::vector<Node*> m_inputNodes, m_hiddenNodes, m_queryNodes;
     Node* m_root;
     
+    /*
+     * The structure as flat arrays, in the order of m_nodes,
+     * with the weights of the edges. Built by Validate().
+     */
+    SpnGraph m_graph;
+    
+    /*
+     * Built by Validate(), NULL if the network can't be compiled
+     */
+    CompiledSpn* m_compiled;
+    bool m_bUseCompiled;
+    int m_threadCount;
+    Operation_ParallelMode m_parallelMode;
+    
 public:
     Spn();
     virtual ~Spn();
     
+    /*
+     * Activations of the root: probabilities,
+     * or log-probabilities if IsLogSpace()
+     */
     math::pimatrix Forward(math::pimatrix* batch);
+    
+    /*
+     * For batches which differ from the last one in a few columns:
+     * only the nodes above these columns are evaluated again.
+     * Same as Forward() without the compiled evaluator.
+     */
+    math::pimatrix ForwardIncremental(math::pimatrix* batch);
+    
+    /*
+     * Node by node, from the derivatives accumulated in the nodes.
+     */
     void Backward();
+    
+    /*
+     * Derivatives of log P(batch) wrt the weights, without updating them:
+     * the GetParameterCount() values of every edge, in the order of
+     * ToModelData(). Only the edges of sum and max nodes get derivatives.
+     */
+    void ComputeGradients(math::pimatrix* batch, std::vector<float>& gradients);
+    
+    /*
+     * Most probable explanation of every sample of the batch, where the
+     * missing variables have all their indicators set to 1. assignment is
+     * the completed batch, see CompiledSpn::Mpe(). Returns the probabilities
+     * (log-probabilities if IsLogSpace()) of the MPE states.
+     * Needs the compiled evaluator.
+     */
+    math::pimatrix Mpe(math::pimatrix* batch, math::pimatrix& assignment);
+    
+    /*
+     * Draw count samples from the network, see CompiledSpn::Sample().
+     * Uses the random_seed, thread_count and parallel_mode of op.
+     * Needs the compiled evaluator.
+     */
+    void Sample(const Operation& op, size_t count, math::pimatrix& samples);
+    
+    /*
+     * Remove the edges of sum nodes whose normalized weight is below
+     * threshold (the largest one is always kept), the nodes no longer
+     * reachable from the root, and merge sum and product nodes having
+     * a single child into their parents. Weights are renormalized and
+     * the network is validated again. Nothing happens if threshold <= 0.
+     */
+    void Prune(float threshold);
+    
+    /*
+     * Same function, smaller graph: product nodes absorb their product
+     * children which have no other parent, and identical nodes (same
+     * type and input, or same children) are merged, bottom-up.
+     * With bWeights, the same for sum nodes, multiplying the weights, and
+     * edges to the same child are merged: this changes the parameters,
+     * so Train() only does it at the end.
+     */
+    void Simplify(bool bWeights);
+    
+    /*
+     * Batched inference with partial evidence.
+     * evidence: batch_size x input_dim; missing: the same size, non-zero where
+     * the value is missing. Missing indicators are set to 1 (summed out).
+     * queries: query_count x input_dim, each row gives the values of its query
+     * variables, negative for the columns which are not in that query.
+     * 
+     * Returns log P(evidence), batch_size x 1, and P(query | evidence) in
+     * conditionals, batch_size x query_count. With the compiled evaluator,
+     * the nodes which read no queried column are evaluated once for the
+     * evidence and all queries, see CompiledSpn::Query(); node by node,
+     * the evidence is evaluated again for every query.
+     */
+    math::pimatrix Query(math::pimatrix* evidence, math::pimatrix* missing
+        , math::pimatrix* queries, math::pimatrix& conditionals);
+    
     void Train(Operation& trainOp, Operation* evalOp = NULL);
     virtual void Evaluate(Operation& evalOp, data::Dataset* evalDataset
         , model::Metrics &evalStats);
 
     virtual bool Validate();
     
+    /*
+     * Evaluate with the flat arrays built by Validate() (the default),
+     * or node by node.
+     */
+    void SetUseCompiled(bool bUseCompiled)
+    {
+        m_bUseCompiled = bUseCompiled;
+    }
+    
+    const SpnGraph& GetGraph()
+    {
+        return m_graph;
+    }
+    
+    /*
+     * Number of threads of the compiled evaluator (Operation.thread_count),
+     * and how they share the work (Operation.parallel_mode)
+     */
+    void SetThreadCount(int threadCount
+        , Operation_ParallelMode mode = Operation::NODE_LEVELS);
+    
+    /*
+     * true if evaluated with log-probabilities (SpnData.log_space)
+     */
+    bool IsLogSpace()
+    {
+        return m_compiled && m_bUseCompiled && m_compiled->IsLogSpace();
+    }
+    
 private:
     
     void TrainOneBatch(Operation& trainOp
                     , math::pimatrix* batch, int iTrainStep
                     , Metrics *metrics);
     
-    void Prune();
+    /*
+     * E-step of EM and HARD_EM on the batch. The weights are only
+     * updated by the M-step, after a pass over the training set.
+     */
+    void accumulateCounts(Operation& trainOp, math::pimatrix* batch
+                    , Metrics *metrics);
     
     bool stopCondition(const Operation_StopCondition& cond, int iStep);
     bool evalCondition(int eval_after, int iStep);
@@ -52,6 +179,28 @@ private:
     
     void normalizeWeights();
     
+    /*
+     * Backward pass from the derivatives of the error wrt the root in the
+     * last Forward(), leaving the derivatives wrt the weights in the Edges
+     */
+    void backpropagate(math::pimatrix& rootDerivatives);
+    
+    /*
+     * An edge child -> parent with weight w. With bMerge, w is added to
+     * the weight of the existing edge instead if parent is a sum node.
+     */
+    Edge* addEdge(Node* child, Node* parent, float w, bool bMerge = true);
+    
+    void addWeight(Edge* e, float w);
+    
+    void detachEdge(Edge* e, boost::unordered_set<Edge*>& removedEdges);
+    
+    /*
+     * Delete the removed edges and the nodes which can't be reached
+     * from the root anymore, then Validate() again
+     */
+    void removeUnreachable(boost::unordered_set<Edge*>& removedEdges);
+    
 public:
     static Spn* FromProto(const ModelData& modelData);
 
@@ -62,6 +211,8 @@ private:
                 , std::vector<Node*>& nodes, std::vector<Edge*>& edges);
     static bool LoadSpnListInit(const SpnData& spnData
                 , std::vector<Node*>& nodes, std::vector<Edge*>& edges);
+    static bool LoadSpnSparseInit(const SpnData& spnData
+                , std::vector<Node*>& nodes, std::vector<Edge*>& edges);
     
     static bool LoadSpnStructure(const ModelData& modelData
                 , std::vector<Node*>& nodes, std::vector<Edge*>& edges);
@@ -1,25 +1,293 @@
-/* 
+/*
  * File:   SpnGraph.cpp
  * Author: hoaivu_pham
- * 
+ *
  * Created on September 5, 2013, 11:16 AM
  */
 
+#include <boost/lexical_cast.hpp>
+#include <boost/unordered_map.hpp>
+#include <deque>
+#include <iostream>
 #include "SpnGraph.h"
+#include "Spn.h"
 
 namespace model
 {
 
-SpnGraph::SpnGraph(std::string sFilePath)
+SpnGraph::SpnGraph()
+: m_params(NULL)
 {
+    m_childOffsets.push_back(0);
+    m_parentOffsets.push_back(0);
 }
 
-SpnGraph::SpnGraph(const SpnGraph& orig)
+SpnGraph::~SpnGraph()
 {
 }
 
-SpnGraph::~SpnGraph()
+/*****************************************************************************/
+
+bool SpnGraph::Load(const SpnData& spnData)
+{
+    const int nodeCount = spnData.node_types_size();
+    const int edgeCount = spnData.edge_children_size();
+    if (spnData.node_inputs_size() != nodeCount
+            || spnData.edge_parents_size() != edgeCount
+            || (spnData.edge_weights_size() > 0 && spnData.edge_weights_size() != edgeCount))
+    {
+        std::cout << "ERR\tSpnData in the proto file is invalid: node_types and"
+                  << " node_inputs, or edge_children, edge_parents and edge_weights"
+                  << " have different sizes" << std::endl;
+        return false;
+    }
+
+    m_types.resize(nodeCount);
+    m_scopes.resize(nodeCount);
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        if (!NodeData_NodeType_IsValid(spnData.node_types(i)))
+        {
+            std::cout << "ERR\tInvalid node type: " << spnData.node_types(i)
+                        << " at location " << i << " in node_types." << std::endl;
+            return false;
+        }
+        m_types[i] = (boost::uint8_t)spnData.node_types(i);
+        m_scopes[i] = -1;
+
+        if (m_types[i] == NodeData::INPUT || m_types[i] == NodeData::QUERY)
+        {
+            m_scopes[i] = spnData.node_inputs(i);
+            if (m_scopes[i] < 0)
+            {
+                std::cout << "ERR\tInvalid input index: " << m_scopes[i]
+                          << " at location " << i << " in node_inputs."
+                          << std::endl;
+                return false;
+            }
+        }
+    }
+
+    std::vector<boost::uint32_t> edgeChildren(edgeCount), edgeParents(edgeCount);
+    std::vector<float> edgeWeights(edgeCount, 1.0f);
+    for (int k = 0; k < edgeCount; ++k)
+    {
+        int child = spnData.edge_children(k), parent = spnData.edge_parents(k);
+        if (child < 0 || child >= nodeCount || parent < 0 || parent >= nodeCount
+                || child == parent)
+        {
+            std::cout << "ERR\tInvalid edge " << child << " - " << parent
+                      << " at location " << k << " in edge_children and edge_parents."
+                      << std::endl;
+            return false;
+        }
+        edgeChildren[k] = child;
+        edgeParents[k] = parent;
+        if (spnData.edge_weights_size() > 0)
+            edgeWeights[k] = spnData.edge_weights(k);
+    }
+    buildIndices(edgeChildren, edgeParents, edgeWeights);
+    return true;
+}
+
+void SpnGraph::Build(const std::vector<Node*>& nodes)
+{
+    const size_t N = nodes.size();
+    boost::unordered_map<Node*, boost::uint32_t> nodeIndices;
+    nodeIndices.rehash(N);
+    for (size_t i = 0; i < N; ++i)
+        nodeIndices[nodes[i]] = i;
+
+    m_types.resize(N);
+    m_scopes.resize(N);
+    m_childOffsets.assign(1, 0);
+    m_parentOffsets.assign(1, 0);
+    m_children.clear();
+    m_weights.clear();
+    m_weightOffsets.clear();
+    m_params = NULL;
+    m_parents.clear();
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        NodeData_NodeType nodeType = nodes[i]->GetNodeType();
+        m_types[i] = (boost::uint8_t)nodeType;
+        m_scopes[i] = (nodeType == NodeData::INPUT || nodeType == NodeData::QUERY)
+                ? (int)nodes[i]->GetInputStartIndex() : -1;
+
+        std::vector<Edge*>& incoming = nodes[i]->GetIncomingEdges();
+        for (std::vector<Edge*>::iterator it = incoming.begin(); it != incoming.end(); ++it)
+        {
+            m_children.push_back(nodeIndices[(*it)->GetNode1()]);
+            m_weights.push_back((*it)->GetWeightData()[0]);
+        }
+        m_childOffsets.push_back(m_children.size());
+
+        std::vector<Edge*>& outgoing = nodes[i]->GetOutgoingEdges();
+        for (std::vector<Edge*>::iterator it = outgoing.begin(); it != outgoing.end(); ++it)
+            m_parents.push_back(nodeIndices[(*it)->GetNode2()]);
+        m_parentOffsets.push_back(m_parents.size());
+    }
+}
+
+void SpnGraph::BindParameters(const std::vector<Node*>& nodes, ParameterBuffer* params)
 {
+    BOOST_ASSERT_MSG(nodes.size() == GetNodeCount(), "Not the nodes of the graph");
+    m_weightOffsets.resize(GetEdgeCount());
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        std::vector<Edge*>& incoming = nodes[i]->GetIncomingEdges();
+        BOOST_ASSERT(incoming.size() == m_childOffsets[i + 1] - m_childOffsets[i]);
+        for (size_t j = 0; j < incoming.size(); ++j)
+            m_weightOffsets[m_childOffsets[i] + j] = (boost::uint32_t)incoming[j]->GetParameterOffset();
+    }
+    std::vector<float>().swap(m_weights);
+    m_params = params;
 }
 
-}
\ No newline at end of file
+bool SpnGraph::CreateNodes(std::vector<Node*>& nodes, std::vector<Edge*>& edges) const
+{
+    const size_t N = GetNodeCount();
+    NodeData nodeData;
+
+    // every node in SPN has dimension of 1
+    nodeData.set_dimension(1);
+    nodes.reserve(nodes.size() + N);
+    const size_t firstNode = nodes.size();
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        nodeData.set_name(boost::lexical_cast<std::string>(i));
+        nodeData.set_type(GetType(i));
+        nodeData.clear_input_start_index();
+        if (m_scopes[i] >= 0)
+            nodeData.set_input_start_index(m_scopes[i]);
+
+        Node* tmpNode = Spn::CreateNewNode(nodeData);
+        if (!tmpNode)
+            return false;
+        nodes.push_back(tmpNode);
+    }
+
+    edges.reserve(edges.size() + GetEdgeCount());
+    for (size_t i = 0; i < N; ++i)
+    {
+        for (size_t k = m_childOffsets[i]; k < m_childOffsets[i + 1]; ++k)
+        {
+            Edge* newEdge = new Edge(nodes[firstNode + m_children[k]], nodes[firstNode + i], true);
+            newEdge->GetWeightData()[0] = GetWeight(k);
+            edges.push_back(newEdge);
+        }
+    }
+    return true;
+}
+
+void SpnGraph::ToSpnData(SpnData& spnData) const
+{
+    spnData.clear_node_types();
+    spnData.clear_node_inputs();
+    spnData.clear_edge_children();
+    spnData.clear_edge_parents();
+    spnData.clear_edge_weights();
+
+    spnData.mutable_node_types()->Reserve(GetNodeCount());
+    spnData.mutable_node_inputs()->Reserve(GetNodeCount());
+    for (size_t i = 0; i < GetNodeCount(); ++i)
+    {
+        spnData.add_node_types(m_types[i]);
+        spnData.add_node_inputs(m_scopes[i]);
+    }
+
+    spnData.mutable_edge_children()->Reserve(GetEdgeCount());
+    spnData.mutable_edge_parents()->Reserve(GetEdgeCount());
+    spnData.mutable_edge_weights()->Reserve(GetEdgeCount());
+    for (size_t i = 0; i < GetNodeCount(); ++i)
+    {
+        for (size_t k = m_childOffsets[i]; k < m_childOffsets[i + 1]; ++k)
+        {
+            spnData.add_edge_children(m_children[k]);
+            spnData.add_edge_parents(i);
+            spnData.add_edge_weights(GetWeight(k));
+        }
+    }
+}
+
+bool SpnGraph::TopologicalSort(std::vector<boost::uint32_t>& order) const
+{
+    const size_t N = GetNodeCount();
+
+    // number of children not yet in the order
+    std::vector<boost::uint32_t> remaining(N);
+    std::deque<boost::uint32_t> S;
+    for (size_t i = 0; i < N; ++i)
+    {
+        remaining[i] = m_childOffsets[i + 1] - m_childOffsets[i];
+        if (remaining[i] == 0)
+            S.push_back(i);
+    }
+
+    order.clear();
+    order.reserve(N);
+    while (!S.empty())
+    {
+        boost::uint32_t n = S.front();
+        S.pop_front();
+        order.push_back(n);
+        for (size_t j = m_parentOffsets[n]; j < m_parentOffsets[n + 1]; ++j)
+        {
+            if (--remaining[m_parents[j]] == 0)
+                S.push_back(m_parents[j]);
+        }
+    }
+    return order.size() == N;
+}
+
+size_t SpnGraph::GetMemorySize() const
+{
+    return m_types.size() * sizeof(boost::uint8_t)
+            + m_scopes.size() * sizeof(boost::int32_t)
+            + (m_childOffsets.size() + m_children.size()) * sizeof(boost::uint32_t)
+            + m_weights.size() * sizeof(float)
+            + m_weightOffsets.size() * sizeof(boost::uint32_t)
+            + (m_parentOffsets.size() + m_parents.size()) * sizeof(boost::uint32_t);
+}
+
+/*****************************************************************************/
+
+void SpnGraph::buildIndices(const std::vector<boost::uint32_t>& edgeChildren
+        , const std::vector<boost::uint32_t>& edgeParents
+        , const std::vector<float>& edgeWeights)
+{
+    const size_t N = GetNodeCount(), E = edgeChildren.size();
+
+    // counting sort of the edges by parent, then by child
+    m_childOffsets.assign(N + 1, 0);
+    m_parentOffsets.assign(N + 1, 0);
+    for (size_t k = 0; k < E; ++k)
+    {
+        m_childOffsets[edgeParents[k] + 1]++;
+        m_parentOffsets[edgeChildren[k] + 1]++;
+    }
+    for (size_t i = 0; i < N; ++i)
+    {
+        m_childOffsets[i + 1] += m_childOffsets[i];
+        m_parentOffsets[i + 1] += m_parentOffsets[i];
+    }
+
+    m_children.resize(E);
+    m_weights.resize(E);
+    m_weightOffsets.clear();
+    m_params = NULL;
+    m_parents.resize(E);
+    std::vector<boost::uint32_t> childFill(m_childOffsets.begin(), m_childOffsets.end() - 1);
+    std::vector<boost::uint32_t> parentFill(m_parentOffsets.begin(), m_parentOffsets.end() - 1);
+    for (size_t k = 0; k < E; ++k)
+    {
+        boost::uint32_t slot = childFill[edgeParents[k]]++;
+        m_children[slot] = edgeChildren[k];
+        m_weights[slot] = edgeWeights[k];
+        m_parents[parentFill[edgeChildren[k]]++] = edgeParents[k];
+    }
+}
+
+}
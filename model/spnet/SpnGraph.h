@@ -1,4 +1,4 @@
-/* 
+/*
  * File:   SpnGraph.h
  * Author: hoaivu_pham
  *
@@ -8,40 +8,152 @@
 #ifndef SPNGRAPH_H
 #define	SPNGRAPH_H
 
+#include <boost/cstdint.hpp>
 #include <vector>
-#include <string>
-#include <pimatrix.h>
+#include <deeplearn.pb.h>
+#include <Node.h>
+#include <Edge.h>
+#include <ParameterBuffer.h>
 
 namespace model
 {
 
+/*
+ * Structure of an SPN as flat arrays: node i has type m_types[i], and its
+ * children are m_children[m_childOffsets[i] .. m_childOffsets[i+1]), with
+ * the weights of these edges in m_weights. The parents of node i are
+ * m_parents[m_parentOffsets[i] .. m_parentOffsets[i+1]).
+ * 
+ * It reads and writes the sparse SpnData format, and Spn::Validate() sorts
+ * the nodes on it. The network itself is still made of Node and Edge
+ * objects, which the graph indexes at about 12 bytes per edge (child,
+ * weight or its offset, parent). Once bound to the parameters of the model
+ * (BindParameters()), the weights are read from there, so they are always
+ * the trained ones.
+ */
 class SpnGraph
 {
+    std::vector<boost::uint8_t> m_types;        // NodeData::NodeType
+    std::vector<boost::int32_t> m_scopes;       // column of INPUT and QUERY nodes, -1 otherwise
+    std::vector<boost::uint32_t> m_childOffsets, m_children;
+    std::vector<float> m_weights;               // without m_params
+    std::vector<boost::uint32_t> m_weightOffsets;   // in m_params
+    ParameterBuffer* m_params;
+    std::vector<boost::uint32_t> m_parentOffsets, m_parents;
+
 public:
-    enum SpnNodeType
-    {
-        SPN_NODE_INPUT,
-        SPN_NODE_SUM,
-        SPN_NODE_PRODUCT,
-        SPN_NODE_MAX
-    };
+    SpnGraph();
+    virtual ~SpnGraph();
 
     /*
-     * A 1xN matrix containing N nodes, each item takes value from SpnNodeType
+     * From the sparse structure of spnData (node_types, node_inputs,
+     * edge_children, edge_parents and edge_weights), in O(V+E).
+     * Prints the error and returns false if it is invalid.
      */
-    math::pimatrix m_nodeList;
+    bool Load(const SpnData& spnData);
+
     /*
-     * m_adjacencyMatrix(i, j) != 0: there is an edge from i to j
+     * From Node objects of dimension 1 and their edges. The children and
+     * parents of every node keep the order of its incoming and outgoing edges.
+     * The weights are copied, until BindParameters().
      */
-    math::pimatrix m_adjacencyMatrix;
-    int m_iRootNode;
-    
-    SpnGraph(std::string sFilePath);
-    SpnGraph(const SpnGraph& orig);
-    virtual ~SpnGraph();
+    void Build(const std::vector<Node*>& nodes);
     
-private:
+    /*
+     * After Build(nodes) and Model::bindParameters(): read the weights
+     * from params, at the offsets of the edges, instead of copying them.
+     * params must outlive the graph or the next Build().
+     */
+    void BindParameters(const std::vector<Node*>& nodes, ParameterBuffer* params);
+
+    /*
+     * Node and Edge objects for the legacy APIs, named after their index
+     */
+    bool CreateNodes(std::vector<Node*>& nodes, std::vector<Edge*>& edges) const;
+
+    /*
+     * The sparse structure, with the weights
+     */
+    void ToSpnData(SpnData& spnData) const;
+
+    /*
+     * Kahn's algorithm from the leaves up: order gets the node indices,
+     * the root being the last one. false if there is a cycle.
+     */
+    bool TopologicalSort(std::vector<boost::uint32_t>& order) const;
+
+    size_t GetNodeCount() const
+    {
+        return m_types.size();
+    }
+
+    size_t GetEdgeCount() const
+    {
+        return m_children.size();
+    }
+
+    NodeData_NodeType GetType(size_t i) const
+    {
+        return (NodeData_NodeType)m_types[i];
+    }
 
+    int GetScope(size_t i) const
+    {
+        return m_scopes[i];
+    }
+
+    /*
+     * slots k of the children of node i: [GetChildBegin(i), GetChildEnd(i))
+     */
+    size_t GetChildBegin(size_t i) const
+    {
+        return m_childOffsets[i];
+    }
+
+    size_t GetChildEnd(size_t i) const
+    {
+        return m_childOffsets[i + 1];
+    }
+
+    size_t GetChild(size_t k) const
+    {
+        return m_children[k];
+    }
+
+    float GetWeight(size_t k) const
+    {
+        return m_params ? m_params->GetWeights()[m_weightOffsets[k]] : m_weights[k];
+    }
+
+    size_t GetParentBegin(size_t i) const
+    {
+        return m_parentOffsets[i];
+    }
+
+    size_t GetParentEnd(size_t i) const
+    {
+        return m_parentOffsets[i + 1];
+    }
+
+    size_t GetParent(size_t j) const
+    {
+        return m_parents[j];
+    }
+
+    /*
+     * Bytes used by the arrays
+     */
+    size_t GetMemorySize() const;
+
+private:
+    /*
+     * m_childOffsets and m_children from the edges (child, parent),
+     * then m_parentOffsets and m_parents. Stable: the edges of a node
+     * keep their order.
+     */
+    void buildIndices(const std::vector<boost::uint32_t>& edgeChildren
+            , const std::vector<boost::uint32_t>& edgeParents
+            , const std::vector<float>& edgeWeights);
 };
 
 }
@@ -50,7 +50,13 @@ OBJECTFILES= \
 	${OBJECTDIR}/_ext/1121429291/DeepLearnDataHandler.o \
 	${OBJECTDIR}/_ext/1121429291/DataHandler.o \
 	${OBJECTDIR}/_ext/1121429291/Disk.o \
-	${OBJECTDIR}/_ext/382279727/MaxNode.o
+	${OBJECTDIR}/_ext/382279727/MaxNode.o \
+	${OBJECTDIR}/data/SharedMemoryDataHandler.o \
+	${OBJECTDIR}/data/DirectReader.o \
+	${OBJECTDIR}/model/spnet/CompiledSpn.o \
+	${OBJECTDIR}/util/ThreadPool.o \
+	${OBJECTDIR}/model/spnet/SpnGraph.o \
+	${OBJECTDIR}/model/ParameterBuffer.o
 
 # Test Directory
 TESTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}/tests
@@ -75,7 +81,7 @@ FFLAGS=
 ASFLAGS=
 
 # Link Libraries and Options
-LDLIBSOPTIONS=-L/home/hoaivu_pham/lib/boost_1_54_0/lib -Wl,-rpath /home/hoaivu_pham/lib/boost_1_54_0/lib -lprotobuf -lboost_filesystem -lboost_random -lboost_regex -lboost_serialization -lboost_system
+LDLIBSOPTIONS=-L/home/hoaivu_pham/lib/boost_1_54_0/lib -Wl,-rpath /home/hoaivu_pham/lib/boost_1_54_0/lib -lprotobuf -lboost_filesystem -lboost_random -lboost_regex -lboost_serialization -lboost_system -lrt -lboost_thread
 
 # Build Targets
 .build-conf: ${BUILD_SUBPROJECTS}
@@ -170,6 +176,36 @@ ${OBJECTDIR}/_ext/382279727/MaxNode.o: /home/hoaivu_pham/NetBeansProjects/deeple
 	${RM} $@.d
 	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/_ext/382279727/MaxNode.o /home/hoaivu_pham/NetBeansProjects/deeplearn/model/spnet/MaxNode.cpp
 
+${OBJECTDIR}/data/SharedMemoryDataHandler.o: data/SharedMemoryDataHandler.cpp 
+	${MKDIR} -p ${OBJECTDIR}/data
+	${RM} $@.d
+	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/data/SharedMemoryDataHandler.o data/SharedMemoryDataHandler.cpp
+
+${OBJECTDIR}/data/DirectReader.o: data/DirectReader.cpp 
+	${MKDIR} -p ${OBJECTDIR}/data
+	${RM} $@.d
+	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/data/DirectReader.o data/DirectReader.cpp
+
+${OBJECTDIR}/model/spnet/CompiledSpn.o: model/spnet/CompiledSpn.cpp 
+	${MKDIR} -p ${OBJECTDIR}/model/spnet
+	${RM} $@.d
+	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/model/spnet/CompiledSpn.o model/spnet/CompiledSpn.cpp
+
+${OBJECTDIR}/util/ThreadPool.o: util/ThreadPool.cpp 
+	${MKDIR} -p ${OBJECTDIR}/util
+	${RM} $@.d
+	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/util/ThreadPool.o util/ThreadPool.cpp
+
+${OBJECTDIR}/model/spnet/SpnGraph.o: model/spnet/SpnGraph.cpp 
+	${MKDIR} -p ${OBJECTDIR}/model/spnet
+	${RM} $@.d
+	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/model/spnet/SpnGraph.o model/spnet/SpnGraph.cpp
+
+${OBJECTDIR}/model/ParameterBuffer.o: model/ParameterBuffer.cpp 
+	${MKDIR} -p ${OBJECTDIR}/model
+	${RM} $@.d
+	$(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -MMD -MP -MF $@.d -o ${OBJECTDIR}/model/ParameterBuffer.o model/ParameterBuffer.cpp
+
 # Subprojects
 .build-subprojects:
 
@@ -427,6 +463,84 @@ ${OBJECTDIR}/_ext/382279727/MaxNode_nomain.o: ${OBJECTDIR}/_ext/382279727/MaxNod
 	    ${CP} ${OBJECTDIR}/_ext/382279727/MaxNode.o ${OBJECTDIR}/_ext/382279727/MaxNode_nomain.o;\
 	fi
 
+${OBJECTDIR}/data/SharedMemoryDataHandler_nomain.o: ${OBJECTDIR}/data/SharedMemoryDataHandler.o data/SharedMemoryDataHandler.cpp 
+	${MKDIR} -p ${OBJECTDIR}/data
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/data/SharedMemoryDataHandler.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} $@.d;\
+	    $(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -Dmain=__nomain -MMD -MP -MF $@.d -o ${OBJECTDIR}/data/SharedMemoryDataHandler_nomain.o data/SharedMemoryDataHandler.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/data/SharedMemoryDataHandler.o ${OBJECTDIR}/data/SharedMemoryDataHandler_nomain.o;\
+	fi
+
+${OBJECTDIR}/data/DirectReader_nomain.o: ${OBJECTDIR}/data/DirectReader.o data/DirectReader.cpp 
+	${MKDIR} -p ${OBJECTDIR}/data
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/data/DirectReader.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} $@.d;\
+	    $(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -Dmain=__nomain -MMD -MP -MF $@.d -o ${OBJECTDIR}/data/DirectReader_nomain.o data/DirectReader.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/data/DirectReader.o ${OBJECTDIR}/data/DirectReader_nomain.o;\
+	fi
+
+${OBJECTDIR}/model/spnet/CompiledSpn_nomain.o: ${OBJECTDIR}/model/spnet/CompiledSpn.o model/spnet/CompiledSpn.cpp 
+	${MKDIR} -p ${OBJECTDIR}/model/spnet
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/model/spnet/CompiledSpn.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} $@.d;\
+	    $(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -Dmain=__nomain -MMD -MP -MF $@.d -o ${OBJECTDIR}/model/spnet/CompiledSpn_nomain.o model/spnet/CompiledSpn.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/model/spnet/CompiledSpn.o ${OBJECTDIR}/model/spnet/CompiledSpn_nomain.o;\
+	fi
+
+${OBJECTDIR}/util/ThreadPool_nomain.o: ${OBJECTDIR}/util/ThreadPool.o util/ThreadPool.cpp 
+	${MKDIR} -p ${OBJECTDIR}/util
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/util/ThreadPool.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} $@.d;\
+	    $(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -Dmain=__nomain -MMD -MP -MF $@.d -o ${OBJECTDIR}/util/ThreadPool_nomain.o util/ThreadPool.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/util/ThreadPool.o ${OBJECTDIR}/util/ThreadPool_nomain.o;\
+	fi
+
+${OBJECTDIR}/model/spnet/SpnGraph_nomain.o: ${OBJECTDIR}/model/spnet/SpnGraph.o model/spnet/SpnGraph.cpp 
+	${MKDIR} -p ${OBJECTDIR}/model/spnet
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/model/spnet/SpnGraph.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} $@.d;\
+	    $(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -Dmain=__nomain -MMD -MP -MF $@.d -o ${OBJECTDIR}/model/spnet/SpnGraph_nomain.o model/spnet/SpnGraph.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/model/spnet/SpnGraph.o ${OBJECTDIR}/model/spnet/SpnGraph_nomain.o;\
+	fi
+
+${OBJECTDIR}/model/ParameterBuffer_nomain.o: ${OBJECTDIR}/model/ParameterBuffer.o model/ParameterBuffer.cpp 
+	${MKDIR} -p ${OBJECTDIR}/model
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/model/ParameterBuffer.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} $@.d;\
+	    $(COMPILE.cc) -O2 -Imath -Imodel -Idata -Iutil -I/home/hoaivu_pham/lib/boost_1_54_0/include -Dmain=__nomain -MMD -MP -MF $@.d -o ${OBJECTDIR}/model/ParameterBuffer_nomain.o model/ParameterBuffer.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/model/ParameterBuffer.o ${OBJECTDIR}/model/ParameterBuffer_nomain.o;\
+	fi
+
 # Run Test Targets
 .test-conf:
 	@if [ "${TEST}" = "" ]; \
@@ -1,526 +1,679 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: deeplearn.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "deeplearn.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace model {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Metric_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Metric_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Metric_MetricType_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Metrics_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Metrics_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Hyperparams_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Hyperparams_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Hyperparams_Decay_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* Hyperparams_BestModelCriterion_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* NodeData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  NodeData_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* NodeData_NodeType_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* EdgeData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  EdgeData_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SpnLayerInit_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SpnLayerInit_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SpnData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SpnData_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ModelData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ModelData_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* ModelData_ModelType_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Operation_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Operation_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Operation_StopCondition_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Operation_StopCondition_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Operation_Optimizer_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* Operation_OperationType_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* DatasetInfo_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DatasetInfo_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* DatasetInfo_DataType_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* DatasetInfo_DataFormat_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* DatabaseInfo_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DatabaseInfo_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_deeplearn_2eproto() {
-  protobuf_AddDesc_deeplearn_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "deeplearn.proto");
-  GOOGLE_CHECK(file != NULL);
-  Metric_descriptor_ = file->message_type(0);
-  static const int Metric_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metric, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metric, steps_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metric, values_),
+namespace model {
+PROTOBUF_CONSTEXPR Metric::Metric(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.steps_)*/{}
+  , /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_.type_)*/1} {}
+struct MetricDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricDefaultTypeInternal() {}
+  union {
+    Metric _instance;
   };
-  Metric_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Metric_descriptor_,
-      Metric::default_instance_,
-      Metric_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metric, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metric, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Metric));
-  Metric_MetricType_descriptor_ = Metric_descriptor_->enum_type(0);
-  Metrics_descriptor_ = file->message_type(1);
-  static const int Metrics_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metrics, metrics_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricDefaultTypeInternal _Metric_default_instance_;
+PROTOBUF_CONSTEXPR Metrics::Metrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.metrics_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsDefaultTypeInternal() {}
+  union {
+    Metrics _instance;
   };
-  Metrics_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Metrics_descriptor_,
-      Metrics::default_instance_,
-      Metrics_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metrics, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Metrics, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Metrics));
-  Hyperparams_descriptor_ = file->message_type(2);
-  static const int Hyperparams_offsets_[7] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, base_learningrate_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, learningrate_decay_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, learningrate_decay_half_life_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, initial_momentum_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, final_momentum_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, momentum_change_steps_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, select_model_criterion_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsDefaultTypeInternal _Metrics_default_instance_;
+PROTOBUF_CONSTEXPR Hyperparams::Hyperparams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.learningrate_decay_)*/0
+  , /*decltype(_impl_.initial_momentum_)*/0
+  , /*decltype(_impl_.final_momentum_)*/0
+  , /*decltype(_impl_.select_model_criterion_)*/0
+  , /*decltype(_impl_.epsilon_)*/1e-08f
+  , /*decltype(_impl_.base_learningrate_)*/0.01f
+  , /*decltype(_impl_.learningrate_decay_half_life_)*/1000
+  , /*decltype(_impl_.momentum_change_steps_)*/10
+  , /*decltype(_impl_.adam_beta1_)*/0.9f
+  , /*decltype(_impl_.adam_beta2_)*/0.999f
+  , /*decltype(_impl_.rmsprop_decay_)*/0.9f} {}
+struct HyperparamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HyperparamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HyperparamsDefaultTypeInternal() {}
+  union {
+    Hyperparams _instance;
   };
-  Hyperparams_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Hyperparams_descriptor_,
-      Hyperparams::default_instance_,
-      Hyperparams_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hyperparams, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Hyperparams));
-  Hyperparams_Decay_descriptor_ = Hyperparams_descriptor_->enum_type(0);
-  Hyperparams_BestModelCriterion_descriptor_ = Hyperparams_descriptor_->enum_type(1);
-  NodeData_descriptor_ = file->message_type(3);
-  static const int NodeData_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, dimension_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, input_start_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, bias_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, hyper_params_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HyperparamsDefaultTypeInternal _Hyperparams_default_instance_;
+PROTOBUF_CONSTEXPR NodeData::NodeData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bias_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hyper_params_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.dimension_)*/0
+  , /*decltype(_impl_.input_start_index_)*/0} {}
+struct NodeDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeDataDefaultTypeInternal() {}
+  union {
+    NodeData _instance;
   };
-  NodeData_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      NodeData_descriptor_,
-      NodeData::default_instance_,
-      NodeData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeData, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(NodeData));
-  NodeData_NodeType_descriptor_ = NodeData_descriptor_->enum_type(0);
-  EdgeData_descriptor_ = file->message_type(4);
-  static const int EdgeData_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, directed_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, weight_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, node1_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, node2_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, hyper_params_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeDataDefaultTypeInternal _NodeData_default_instance_;
+PROTOBUF_CONSTEXPR EdgeData::EdgeData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.weight_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node1_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node2_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hyper_params_)*/nullptr
+  , /*decltype(_impl_.directed_)*/true} {}
+struct EdgeDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EdgeDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EdgeDataDefaultTypeInternal() {}
+  union {
+    EdgeData _instance;
   };
-  EdgeData_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      EdgeData_descriptor_,
-      EdgeData::default_instance_,
-      EdgeData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EdgeData, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(EdgeData));
-  SpnLayerInit_descriptor_ = file->message_type(5);
-  static const int SpnLayerInit_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, product_combinations_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, input_indices_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, node_list_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeDataDefaultTypeInternal _EdgeData_default_instance_;
+PROTOBUF_CONSTEXPR SpnLayerInit::SpnLayerInit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.input_indices_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_list_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.size_)*/0
+  , /*decltype(_impl_.product_combinations_)*/3} {}
+struct SpnLayerInitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpnLayerInitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpnLayerInitDefaultTypeInternal() {}
+  union {
+    SpnLayerInit _instance;
   };
-  SpnLayerInit_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SpnLayerInit_descriptor_,
-      SpnLayerInit::default_instance_,
-      SpnLayerInit_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnLayerInit, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SpnLayerInit));
-  SpnData_descriptor_ = file->message_type(6);
-  static const int SpnData_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnData, node_list_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnData, adjacency_matrix_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnData, input_indices_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnData, layers_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpnLayerInitDefaultTypeInternal _SpnLayerInit_default_instance_;
+PROTOBUF_CONSTEXPR SpnData::SpnData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.layers_)*/{}
+  , /*decltype(_impl_.node_types_)*/{}
+  , /*decltype(_impl_._node_types_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.node_inputs_)*/{}
+  , /*decltype(_impl_._node_inputs_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.edge_children_)*/{}
+  , /*decltype(_impl_._edge_children_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.edge_parents_)*/{}
+  , /*decltype(_impl_._edge_parents_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.edge_weights_)*/{}
+  , /*decltype(_impl_.node_list_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.adjacency_matrix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.input_indices_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.log_space_)*/false} {}
+struct SpnDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpnDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpnDataDefaultTypeInternal() {}
+  union {
+    SpnData _instance;
   };
-  SpnData_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SpnData_descriptor_,
-      SpnData::default_instance_,
-      SpnData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnData, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SpnData, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SpnData));
-  ModelData_descriptor_ = file->message_type(7);
-  static const int ModelData_offsets_[12] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, model_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, spn_data_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, hyper_params_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, nodes_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, edges_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, train_metrics_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, valid_metrics_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, test_metrics_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, valid_metric_best_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, train_metric_es_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, test_metric_es_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpnDataDefaultTypeInternal _SpnData_default_instance_;
+PROTOBUF_CONSTEXPR ModelData::ModelData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_.edges_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.spn_data_)*/nullptr
+  , /*decltype(_impl_.hyper_params_)*/nullptr
+  , /*decltype(_impl_.train_metrics_)*/nullptr
+  , /*decltype(_impl_.valid_metrics_)*/nullptr
+  , /*decltype(_impl_.test_metrics_)*/nullptr
+  , /*decltype(_impl_.valid_metric_best_)*/nullptr
+  , /*decltype(_impl_.train_metric_es_)*/nullptr
+  , /*decltype(_impl_.test_metric_es_)*/nullptr
+  , /*decltype(_impl_.model_type_)*/0} {}
+struct ModelDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModelDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModelDataDefaultTypeInternal() {}
+  union {
+    ModelData _instance;
   };
-  ModelData_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      ModelData_descriptor_,
-      ModelData::default_instance_,
-      ModelData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ModelData, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(ModelData));
-  ModelData_ModelType_descriptor_ = ModelData_descriptor_->enum_type(0);
-  Operation_descriptor_ = file->message_type(8);
-  static const int Operation_offsets_[13] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, optimizer_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, stop_condition_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, operation_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, batch_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, data_proto_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, eval_after_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, checkpoint_after_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, checkpoint_directory_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, randomize_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, random_seed_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, verbose_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, normalize_each_train_step_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModelDataDefaultTypeInternal _ModelData_default_instance_;
+PROTOBUF_CONSTEXPR Operation_StopCondition::Operation_StopCondition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.all_processed_)*/true
+  , /*decltype(_impl_.steps_)*/10000} {}
+struct Operation_StopConditionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Operation_StopConditionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Operation_StopConditionDefaultTypeInternal() {}
+  union {
+    Operation_StopCondition _instance;
   };
-  Operation_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Operation_descriptor_,
-      Operation::default_instance_,
-      Operation_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Operation));
-  Operation_StopCondition_descriptor_ = Operation_descriptor_->nested_type(0);
-  static const int Operation_StopCondition_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation_StopCondition, all_processed_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation_StopCondition, steps_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Operation_StopConditionDefaultTypeInternal _Operation_StopCondition_default_instance_;
+PROTOBUF_CONSTEXPR Operation::Operation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_proto_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.checkpoint_directory_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stop_condition_)*/nullptr
+  , /*decltype(_impl_.optimizer_)*/0
+  , /*decltype(_impl_.operation_type_)*/0
+  , /*decltype(_impl_.shard_rank_)*/0
+  , /*decltype(_impl_.randomize_)*/false
+  , /*decltype(_impl_.simplify_)*/false
+  , /*decltype(_impl_.parallel_mode_)*/0
+  , /*decltype(_impl_.prune_threshold_)*/0
+  , /*decltype(_impl_.thread_count_)*/1
+  , /*decltype(_impl_.batch_size_)*/100
+  , /*decltype(_impl_.eval_after_)*/500
+  , /*decltype(_impl_.checkpoint_after_)*/1000
+  , /*decltype(_impl_.random_seed_)*/42
+  , /*decltype(_impl_.verbose_)*/true
+  , /*decltype(_impl_.normalize_each_train_step_)*/true
+  , /*decltype(_impl_.shard_count_)*/1} {}
+struct OperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OperationDefaultTypeInternal() {}
+  union {
+    Operation _instance;
   };
-  Operation_StopCondition_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Operation_StopCondition_descriptor_,
-      Operation_StopCondition::default_instance_,
-      Operation_StopCondition_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation_StopCondition, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Operation_StopCondition, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Operation_StopCondition));
-  Operation_Optimizer_descriptor_ = Operation_descriptor_->enum_type(0);
-  Operation_OperationType_descriptor_ = Operation_descriptor_->enum_type(1);
-  DatasetInfo_descriptor_ = file->message_type(9);
-  static const int DatasetInfo_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, file_pattern_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, dimensions_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, type_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, data_format_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OperationDefaultTypeInternal _Operation_default_instance_;
+PROTOBUF_CONSTEXPR DatasetInfo::DatasetInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_pattern_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.size_)*/0
+  , /*decltype(_impl_.dimensions_)*/0
+  , /*decltype(_impl_.data_format_)*/0
+  , /*decltype(_impl_.disk_reader_)*/0
+  , /*decltype(_impl_.type_size_)*/4} {}
+struct DatasetInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatasetInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatasetInfoDefaultTypeInternal() {}
+  union {
+    DatasetInfo _instance;
   };
-  DatasetInfo_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DatasetInfo_descriptor_,
-      DatasetInfo::default_instance_,
-      DatasetInfo_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatasetInfo, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DatasetInfo));
-  DatasetInfo_DataType_descriptor_ = DatasetInfo_descriptor_->enum_type(0);
-  DatasetInfo_DataFormat_descriptor_ = DatasetInfo_descriptor_->enum_type(1);
-  DatabaseInfo_descriptor_ = file->message_type(10);
-  static const int DatabaseInfo_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, data_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, data_handler_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, main_memory_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, gpu_memory_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, path_prefix_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatasetInfoDefaultTypeInternal _DatasetInfo_default_instance_;
+PROTOBUF_CONSTEXPR DatabaseInfo::DatabaseInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_handler_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shard_rank_)*/0
+  , /*decltype(_impl_.shard_count_)*/1
+  , /*decltype(_impl_.main_memory_)*/2
+  , /*decltype(_impl_.gpu_memory_)*/1.5f} {}
+struct DatabaseInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatabaseInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatabaseInfoDefaultTypeInternal() {}
+  union {
+    DatabaseInfo _instance;
   };
-  DatabaseInfo_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DatabaseInfo_descriptor_,
-      DatabaseInfo::default_instance_,
-      DatabaseInfo_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DatabaseInfo, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DatabaseInfo));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_deeplearn_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Metric_descriptor_, &Metric::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Metrics_descriptor_, &Metrics::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Hyperparams_descriptor_, &Hyperparams::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    NodeData_descriptor_, &NodeData::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    EdgeData_descriptor_, &EdgeData::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SpnLayerInit_descriptor_, &SpnLayerInit::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SpnData_descriptor_, &SpnData::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    ModelData_descriptor_, &ModelData::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Operation_descriptor_, &Operation::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Operation_StopCondition_descriptor_, &Operation_StopCondition::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DatasetInfo_descriptor_, &DatasetInfo::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DatabaseInfo_descriptor_, &DatabaseInfo::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_deeplearn_2eproto() {
-  delete Metric::default_instance_;
-  delete Metric_reflection_;
-  delete Metrics::default_instance_;
-  delete Metrics_reflection_;
-  delete Hyperparams::default_instance_;
-  delete Hyperparams_reflection_;
-  delete NodeData::default_instance_;
-  delete NodeData_reflection_;
-  delete EdgeData::default_instance_;
-  delete EdgeData_reflection_;
-  delete SpnLayerInit::default_instance_;
-  delete SpnLayerInit_reflection_;
-  delete SpnData::default_instance_;
-  delete SpnData_reflection_;
-  delete ModelData::default_instance_;
-  delete ModelData_reflection_;
-  delete Operation::default_instance_;
-  delete Operation_reflection_;
-  delete Operation::_default_name_;
-  delete Operation_StopCondition::default_instance_;
-  delete Operation_StopCondition_reflection_;
-  delete DatasetInfo::default_instance_;
-  delete DatasetInfo_reflection_;
-  delete DatabaseInfo::default_instance_;
-  delete DatabaseInfo_reflection_;
-  delete DatabaseInfo::_default_data_handler_;
-}
-
-void protobuf_AddDesc_deeplearn_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\017deeplearn.proto\022\005model\"\205\001\n\006Metric\022+\n\004t"
-    "ype\030\001 \002(\0162\030.model.Metric.MetricType:\003NLL"
-    "\022\r\n\005steps\030\002 \003(\005\022\016\n\006values\030\003 \003(\002\"/\n\nMetri"
-    "cType\022\007\n\003NLL\020\001\022\030\n\024CLASSIFICATION_ERROR\020\002"
-    "\")\n\007Metrics\022\036\n\007metrics\030\001 \003(\0132\r.model.Met"
-    "ric\"\345\003\n\013Hyperparams\022\037\n\021base_learningrate"
-    "\030\001 \001(\002:\0040.01\022@\n\022learningrate_decay\030\002 \001(\016"
-    "2\030.model.Hyperparams.Decay:\nDECAY_NONE\022*"
-    "\n\034learningrate_decay_half_life\030\003 \001(\005:\00410"
-    "00\022\033\n\020initial_momentum\030\004 \001(\002:\0010\022\031\n\016final"
-    "_momentum\030\005 \001(\002:\0010\022!\n\025momentum_change_st"
-    "eps\030\006 \001(\005:\00210\022U\n\026select_model_criterion\030"
-    "\007 \001(\0162%.model.Hyperparams.BestModelCrite"
-    "rion:\016CRITERION_NONE\"C\n\005Decay\022\016\n\nDECAY_N"
-    "ONE\020\000\022\023\n\017DECAY_INVERSE_T\020\001\022\025\n\021DECAY_EXPO"
-    "NENTIAL\020\002\"P\n\022BestModelCriterion\022\022\n\016CRITE"
-    "RION_NONE\020\000\022\021\n\rCRITERION_NLL\020\001\022\023\n\017CRITER"
-    "ION_ERROR\020\002\"\363\001\n\010NodeData\022\014\n\004name\030\001 \002(\t\022&"
-    "\n\004type\030\002 \002(\0162\030.model.NodeData.NodeType\022\021"
-    "\n\tdimension\030\003 \002(\005\022\031\n\021input_start_index\030\004"
-    " \001(\005\022\014\n\004bias\030\005 \001(\014\022(\n\014hyper_params\030\006 \001(\013"
-    "2\022.model.Hyperparams\"K\n\010NodeType\022\t\n\005INPU"
-    "T\020\000\022\n\n\006HIDDEN\020\001\022\t\n\005QUERY\020\002\022\013\n\007PRODUCT\020\003\022"
-    "\007\n\003SUM\020\004\022\007\n\003MAX\020\005\"z\n\010EdgeData\022\026\n\010directe"
-    "d\030\001 \001(\010:\004true\022\016\n\006weight\030\002 \001(\014\022\r\n\005node1\030\003"
-    " \001(\t\022\r\n\005node2\030\004 \001(\t\022(\n\014hyper_params\030\005 \001("
-    "\0132\022.model.Hyperparams\"\235\001\n\014SpnLayerInit\022\014"
-    "\n\004name\030\001 \002(\t\022&\n\004type\030\002 \001(\0162\030.model.NodeD"
-    "ata.NodeType\022\014\n\004size\030\003 \001(\005\022\037\n\024product_co"
-    "mbinations\030\004 \001(\005:\0013\022\025\n\rinput_indices\030\005 \001"
-    "(\t\022\021\n\tnode_list\030\006 \001(\t\"r\n\007SpnData\022\021\n\tnode"
-    "_list\030\001 \001(\t\022\030\n\020adjacency_matrix\030\002 \001(\t\022\025\n"
-    "\rinput_indices\030\003 \001(\t\022#\n\006layers\030\004 \003(\0132\023.m"
-    "odel.SpnLayerInit\"\333\003\n\tModelData\022\014\n\004name\030"
-    "\001 \002(\t\022.\n\nmodel_type\030\002 \002(\0162\032.model.ModelD"
-    "ata.ModelType\022 \n\010spn_data\030\003 \001(\0132\016.model."
-    "SpnData\022(\n\014hyper_params\030\004 \001(\0132\022.model.Hy"
-    "perparams\022\036\n\005nodes\030\005 \003(\0132\017.model.NodeDat"
-    "a\022\036\n\005edges\030\006 \003(\0132\017.model.EdgeData\022%\n\rtra"
-    "in_metrics\030\007 \001(\0132\016.model.Metrics\022%\n\rvali"
-    "d_metrics\030\010 \001(\0132\016.model.Metrics\022$\n\014test_"
-    "metrics\030\t \001(\0132\016.model.Metrics\022)\n\021valid_m"
-    "etric_best\030\n \001(\0132\016.model.Metrics\022\'\n\017trai"
-    "n_metric_es\030\013 \001(\0132\016.model.Metrics\022&\n\016tes"
-    "t_metric_es\030\014 \001(\0132\016.model.Metrics\"\024\n\tMod"
-    "elType\022\007\n\003SPN\020\000\"\241\005\n\tOperation\022\027\n\004name\030\001 "
-    "\002(\t:\toperation\022\?\n\toptimizer\030\002 \001(\0162\032.mode"
-    "l.Operation.Optimizer:\020GRADIENT_DESCENT\022"
-    "6\n\016stop_condition\030\003 \001(\0132\036.model.Operatio"
-    "n.StopCondition\022=\n\016operation_type\030\004 \001(\0162"
-    "\036.model.Operation.OperationType:\005TRAIN\022\027"
-    "\n\nbatch_size\030\005 \001(\005:\003100\022\022\n\ndata_proto\030\006 "
-    "\001(\t\022\027\n\neval_after\030\007 \001(\005:\003500\022\036\n\020checkpoi"
-    "nt_after\030\010 \001(\005:\0041000\022\034\n\024checkpoint_direc"
-    "tory\030\t \001(\t\022\030\n\trandomize\030\n \001(\010:\005false\022\027\n\013"
-    "random_seed\030\013 \001(\005:\00242\022\025\n\007verbose\030\014 \001(\010:\004"
-    "true\022\'\n\031normalize_each_train_step\030\r \001(\010:"
-    "\004true\032B\n\rStopCondition\022\033\n\rall_processed\030"
-    "\001 \001(\010:\004true\022\024\n\005steps\030\002 \001(\005:\00510000\"b\n\tOpt"
-    "imizer\022\024\n\020GRADIENT_DESCENT\020\000\022\031\n\025HARD_GRA"
-    "DIENT_DESCENT\020\001\022\006\n\002EM\020\002\022\013\n\007HARD_EM\020\003\022\006\n\002"
-    "CD\020\004\022\007\n\003PCD\020\005\"$\n\rOperationType\022\t\n\005TRAIN\020"
-    "\000\022\010\n\004TEST\020\001\"\250\002\n\013DatasetInfo\022)\n\004type\030\001 \002("
-    "\0162\033.model.DatasetInfo.DataType\022\024\n\014file_p"
-    "attern\030\002 \002(\t\022\014\n\004size\030\003 \002(\005\022\022\n\ndimensions"
-    "\030\004 \002(\005\022\024\n\ttype_size\030\005 \001(\005:\0014\022@\n\013data_for"
-    "mat\030\006 \001(\0162\035.model.DatasetInfo.DataFormat"
-    ":\014BOOST_MATRIX\"5\n\010DataType\022\r\n\tTRAIN_SET\020"
-    "\000\022\014\n\010EVAL_SET\020\001\022\014\n\010TEST_SET\020\002\"\'\n\nDataFor"
-    "mat\022\020\n\014BOOST_MATRIX\020\000\022\007\n\003CSV\020\001\"\247\001\n\014Datab"
-    "aseInfo\022\014\n\004name\030\001 \002(\t\022 \n\004data\030\002 \003(\0132\022.mo"
-    "del.DatasetInfo\022\037\n\014data_handler\030\003 \001(\t:\td"
-    "eeplearn\022\026\n\013main_memory\030\004 \001(\002:\0012\022\027\n\ngpu_"
-    "memory\030\005 \001(\002:\0031.5\022\025\n\013path_prefix\030\006 \001(\t:\000", 2960);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "deeplearn.proto", &protobuf_RegisterTypes);
-  Metric::default_instance_ = new Metric();
-  Metrics::default_instance_ = new Metrics();
-  Hyperparams::default_instance_ = new Hyperparams();
-  NodeData::default_instance_ = new NodeData();
-  EdgeData::default_instance_ = new EdgeData();
-  SpnLayerInit::default_instance_ = new SpnLayerInit();
-  SpnData::default_instance_ = new SpnData();
-  ModelData::default_instance_ = new ModelData();
-  Operation::_default_name_ =
-      new ::std::string("operation", 9);
-  Operation::default_instance_ = new Operation();
-  Operation_StopCondition::default_instance_ = new Operation_StopCondition();
-  DatasetInfo::default_instance_ = new DatasetInfo();
-  DatabaseInfo::_default_data_handler_ =
-      new ::std::string("deeplearn", 9);
-  DatabaseInfo::default_instance_ = new DatabaseInfo();
-  Metric::default_instance_->InitAsDefaultInstance();
-  Metrics::default_instance_->InitAsDefaultInstance();
-  Hyperparams::default_instance_->InitAsDefaultInstance();
-  NodeData::default_instance_->InitAsDefaultInstance();
-  EdgeData::default_instance_->InitAsDefaultInstance();
-  SpnLayerInit::default_instance_->InitAsDefaultInstance();
-  SpnData::default_instance_->InitAsDefaultInstance();
-  ModelData::default_instance_->InitAsDefaultInstance();
-  Operation::default_instance_->InitAsDefaultInstance();
-  Operation_StopCondition::default_instance_->InitAsDefaultInstance();
-  DatasetInfo::default_instance_->InitAsDefaultInstance();
-  DatabaseInfo::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_deeplearn_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_deeplearn_2eproto {
-  StaticDescriptorInitializer_deeplearn_2eproto() {
-    protobuf_AddDesc_deeplearn_2eproto();
-  }
-} static_descriptor_initializer_deeplearn_2eproto_;
-
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* Metric_MetricType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Metric_MetricType_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatabaseInfoDefaultTypeInternal _DatabaseInfo_default_instance_;
+}  // namespace model
+static ::_pb::Metadata file_level_metadata_deeplearn_2eproto[12];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_deeplearn_2eproto[11];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_deeplearn_2eproto = nullptr;
+
+const uint32_t TableStruct_deeplearn_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::model::Metric, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::Metric, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::Metric, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::model::Metric, _impl_.steps_),
+  PROTOBUF_FIELD_OFFSET(::model::Metric, _impl_.values_),
+  0,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::model::Metrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::Metrics, _impl_.metrics_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.base_learningrate_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.learningrate_decay_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.learningrate_decay_half_life_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.initial_momentum_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.final_momentum_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.momentum_change_steps_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.select_model_criterion_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.adam_beta1_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.adam_beta2_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.rmsprop_decay_),
+  PROTOBUF_FIELD_OFFSET(::model::Hyperparams, _impl_.epsilon_),
+  5,
+  0,
+  6,
+  1,
+  2,
+  7,
+  3,
+  8,
+  9,
+  10,
+  4,
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_.dimension_),
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_.input_start_index_),
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_.bias_),
+  PROTOBUF_FIELD_OFFSET(::model::NodeData, _impl_.hyper_params_),
+  0,
+  3,
+  4,
+  5,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _impl_.directed_),
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _impl_.node1_),
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _impl_.node2_),
+  PROTOBUF_FIELD_OFFSET(::model::EdgeData, _impl_.hyper_params_),
+  4,
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_.product_combinations_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_.input_indices_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnLayerInit, _impl_.node_list_),
+  0,
+  3,
+  4,
+  5,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.node_list_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.adjacency_matrix_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.input_indices_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.layers_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.log_space_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.node_types_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.node_inputs_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.edge_children_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.edge_parents_),
+  PROTOBUF_FIELD_OFFSET(::model::SpnData, _impl_.edge_weights_),
+  0,
+  1,
+  2,
+  ~0u,
+  3,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.model_type_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.spn_data_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.hyper_params_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.nodes_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.edges_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.train_metrics_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.valid_metrics_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.test_metrics_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.valid_metric_best_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.train_metric_es_),
+  PROTOBUF_FIELD_OFFSET(::model::ModelData, _impl_.test_metric_es_),
+  0,
+  9,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::model::Operation_StopCondition, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation_StopCondition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::Operation_StopCondition, _impl_.all_processed_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation_StopCondition, _impl_.steps_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.optimizer_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.stop_condition_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.operation_type_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.batch_size_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.data_proto_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.eval_after_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.checkpoint_after_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.checkpoint_directory_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.randomize_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.random_seed_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.verbose_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.normalize_each_train_step_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.shard_rank_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.shard_count_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.thread_count_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.parallel_mode_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.prune_threshold_),
+  PROTOBUF_FIELD_OFFSET(::model::Operation, _impl_.simplify_),
+  0,
+  4,
+  3,
+  5,
+  12,
+  1,
+  13,
+  14,
+  2,
+  7,
+  15,
+  16,
+  17,
+  6,
+  18,
+  11,
+  9,
+  10,
+  8,
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.file_pattern_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.dimensions_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.type_size_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.data_format_),
+  PROTOBUF_FIELD_OFFSET(::model::DatasetInfo, _impl_.disk_reader_),
+  1,
+  0,
+  2,
+  3,
+  6,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.data_handler_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.main_memory_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.gpu_memory_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.path_prefix_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.shard_rank_),
+  PROTOBUF_FIELD_OFFSET(::model::DatabaseInfo, _impl_.shard_count_),
+  0,
+  ~0u,
+  1,
+  5,
+  6,
+  2,
+  3,
+  4,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::model::Metric)},
+  { 12, -1, -1, sizeof(::model::Metrics)},
+  { 19, 36, -1, sizeof(::model::Hyperparams)},
+  { 47, 59, -1, sizeof(::model::NodeData)},
+  { 65, 76, -1, sizeof(::model::EdgeData)},
+  { 81, 93, -1, sizeof(::model::SpnLayerInit)},
+  { 99, 115, -1, sizeof(::model::SpnData)},
+  { 125, 143, -1, sizeof(::model::ModelData)},
+  { 155, 163, -1, sizeof(::model::Operation_StopCondition)},
+  { 165, 190, -1, sizeof(::model::Operation)},
+  { 209, 222, -1, sizeof(::model::DatasetInfo)},
+  { 229, 243, -1, sizeof(::model::DatabaseInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::model::_Metric_default_instance_._instance,
+  &::model::_Metrics_default_instance_._instance,
+  &::model::_Hyperparams_default_instance_._instance,
+  &::model::_NodeData_default_instance_._instance,
+  &::model::_EdgeData_default_instance_._instance,
+  &::model::_SpnLayerInit_default_instance_._instance,
+  &::model::_SpnData_default_instance_._instance,
+  &::model::_ModelData_default_instance_._instance,
+  &::model::_Operation_StopCondition_default_instance_._instance,
+  &::model::_Operation_default_instance_._instance,
+  &::model::_DatasetInfo_default_instance_._instance,
+  &::model::_DatabaseInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_deeplearn_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017deeplearn.proto\022\005model\"\205\001\n\006Metric\022+\n\004t"
+  "ype\030\001 \002(\0162\030.model.Metric.MetricType:\003NLL"
+  "\022\r\n\005steps\030\002 \003(\005\022\016\n\006values\030\003 \003(\002\"/\n\nMetri"
+  "cType\022\007\n\003NLL\020\001\022\030\n\024CLASSIFICATION_ERROR\020\002"
+  "\")\n\007Metrics\022\036\n\007metrics\030\001 \003(\0132\r.model.Met"
+  "ric\"\315\004\n\013Hyperparams\022\037\n\021base_learningrate"
+  "\030\001 \001(\002:\0040.01\022@\n\022learningrate_decay\030\002 \001(\016"
+  "2\030.model.Hyperparams.Decay:\nDECAY_NONE\022*"
+  "\n\034learningrate_decay_half_life\030\003 \001(\005:\00410"
+  "00\022\033\n\020initial_momentum\030\004 \001(\002:\0010\022\031\n\016final"
+  "_momentum\030\005 \001(\002:\0010\022!\n\025momentum_change_st"
+  "eps\030\006 \001(\005:\00210\022U\n\026select_model_criterion\030"
+  "\007 \001(\0162%.model.Hyperparams.BestModelCrite"
+  "rion:\016CRITERION_NONE\022\027\n\nadam_beta1\030\010 \001(\002"
+  ":\0030.9\022\031\n\nadam_beta2\030\t \001(\002:\0050.999\022\032\n\rrmsp"
+  "rop_decay\030\n \001(\002:\0030.9\022\026\n\007epsilon\030\013 \001(\002:\0051"
+  "e-08\"C\n\005Decay\022\016\n\nDECAY_NONE\020\000\022\023\n\017DECAY_I"
+  "NVERSE_T\020\001\022\025\n\021DECAY_EXPONENTIAL\020\002\"P\n\022Bes"
+  "tModelCriterion\022\022\n\016CRITERION_NONE\020\000\022\021\n\rC"
+  "RITERION_NLL\020\001\022\023\n\017CRITERION_ERROR\020\002\"\363\001\n\010"
+  "NodeData\022\014\n\004name\030\001 \002(\t\022&\n\004type\030\002 \002(\0162\030.m"
+  "odel.NodeData.NodeType\022\021\n\tdimension\030\003 \002("
+  "\005\022\031\n\021input_start_index\030\004 \001(\005\022\014\n\004bias\030\005 \001"
+  "(\014\022(\n\014hyper_params\030\006 \001(\0132\022.model.Hyperpa"
+  "rams\"K\n\010NodeType\022\t\n\005INPUT\020\000\022\n\n\006HIDDEN\020\001\022"
+  "\t\n\005QUERY\020\002\022\013\n\007PRODUCT\020\003\022\007\n\003SUM\020\004\022\007\n\003MAX\020"
+  "\005\"z\n\010EdgeData\022\026\n\010directed\030\001 \001(\010:\004true\022\016\n"
+  "\006weight\030\002 \001(\014\022\r\n\005node1\030\003 \001(\t\022\r\n\005node2\030\004 "
+  "\001(\t\022(\n\014hyper_params\030\005 \001(\0132\022.model.Hyperp"
+  "arams\"\235\001\n\014SpnLayerInit\022\014\n\004name\030\001 \002(\t\022&\n\004"
+  "type\030\002 \001(\0162\030.model.NodeData.NodeType\022\014\n\004"
+  "size\030\003 \001(\005\022\037\n\024product_combinations\030\004 \001(\005"
+  ":\0013\022\025\n\rinput_indices\030\005 \001(\t\022\021\n\tnode_list\030"
+  "\006 \001(\t\"\214\002\n\007SpnData\022\021\n\tnode_list\030\001 \001(\t\022\030\n\020"
+  "adjacency_matrix\030\002 \001(\t\022\025\n\rinput_indices\030"
+  "\003 \001(\t\022#\n\006layers\030\004 \003(\0132\023.model.SpnLayerIn"
+  "it\022\030\n\tlog_space\030\005 \001(\010:\005false\022\026\n\nnode_typ"
+  "es\030\006 \003(\005B\002\020\001\022\027\n\013node_inputs\030\007 \003(\005B\002\020\001\022\031\n"
+  "\redge_children\030\010 \003(\005B\002\020\001\022\030\n\014edge_parents"
+  "\030\t \003(\005B\002\020\001\022\030\n\014edge_weights\030\n \003(\002B\002\020\001\"\333\003\n"
+  "\tModelData\022\014\n\004name\030\001 \002(\t\022.\n\nmodel_type\030\002"
+  " \002(\0162\032.model.ModelData.ModelType\022 \n\010spn_"
+  "data\030\003 \001(\0132\016.model.SpnData\022(\n\014hyper_para"
+  "ms\030\004 \001(\0132\022.model.Hyperparams\022\036\n\005nodes\030\005 "
+  "\003(\0132\017.model.NodeData\022\036\n\005edges\030\006 \003(\0132\017.mo"
+  "del.EdgeData\022%\n\rtrain_metrics\030\007 \001(\0132\016.mo"
+  "del.Metrics\022%\n\rvalid_metrics\030\010 \001(\0132\016.mod"
+  "el.Metrics\022$\n\014test_metrics\030\t \001(\0132\016.model"
+  ".Metrics\022)\n\021valid_metric_best\030\n \001(\0132\016.mo"
+  "del.Metrics\022\'\n\017train_metric_es\030\013 \001(\0132\016.m"
+  "odel.Metrics\022&\n\016test_metric_es\030\014 \001(\0132\016.m"
+  "odel.Metrics\"\024\n\tModelType\022\007\n\003SPN\020\000\"\267\007\n\tO"
+  "peration\022\027\n\004name\030\001 \002(\t:\toperation\022\?\n\topt"
+  "imizer\030\002 \001(\0162\032.model.Operation.Optimizer"
+  ":\020GRADIENT_DESCENT\0226\n\016stop_condition\030\003 \001"
+  "(\0132\036.model.Operation.StopCondition\022=\n\016op"
+  "eration_type\030\004 \001(\0162\036.model.Operation.Ope"
+  "rationType:\005TRAIN\022\027\n\nbatch_size\030\005 \001(\005:\0031"
+  "00\022\022\n\ndata_proto\030\006 \001(\t\022\027\n\neval_after\030\007 \001"
+  "(\005:\003500\022\036\n\020checkpoint_after\030\010 \001(\005:\0041000\022"
+  "\034\n\024checkpoint_directory\030\t \001(\t\022\030\n\trandomi"
+  "ze\030\n \001(\010:\005false\022\027\n\013random_seed\030\013 \001(\005:\00242"
+  "\022\025\n\007verbose\030\014 \001(\010:\004true\022\'\n\031normalize_eac"
+  "h_train_step\030\r \001(\010:\004true\022\025\n\nshard_rank\030\016"
+  " \001(\005:\0010\022\026\n\013shard_count\030\017 \001(\005:\0011\022\027\n\014threa"
+  "d_count\030\020 \001(\005:\0011\022A\n\rparallel_mode\030\021 \001(\0162"
+  "\035.model.Operation.ParallelMode:\013NODE_LEV"
+  "ELS\022\032\n\017prune_threshold\030\022 \001(\002:\0010\022\027\n\010simpl"
+  "ify\030\023 \001(\010:\005false\032B\n\rStopCondition\022\033\n\rall"
+  "_processed\030\001 \001(\010:\004true\022\024\n\005steps\030\002 \001(\005:\0051"
+  "0000\"\206\001\n\tOptimizer\022\024\n\020GRADIENT_DESCENT\020\000"
+  "\022\031\n\025HARD_GRADIENT_DESCENT\020\001\022\006\n\002EM\020\002\022\013\n\007H"
+  "ARD_EM\020\003\022\006\n\002CD\020\004\022\007\n\003PCD\020\005\022\010\n\004ADAM\020\006\022\013\n\007A"
+  "DAGRAD\020\007\022\013\n\007RMSPROP\020\010\"$\n\rOperationType\022\t"
+  "\n\005TRAIN\020\000\022\010\n\004TEST\020\001\"/\n\014ParallelMode\022\017\n\013N"
+  "ODE_LEVELS\020\000\022\016\n\nBATCH_ROWS\020\001\"\220\003\n\013Dataset"
+  "Info\022)\n\004type\030\001 \002(\0162\033.model.DatasetInfo.D"
+  "ataType\022\024\n\014file_pattern\030\002 \002(\t\022\014\n\004size\030\003 "
+  "\002(\005\022\022\n\ndimensions\030\004 \002(\005\022\024\n\ttype_size\030\005 \001"
+  "(\005:\0014\022@\n\013data_format\030\006 \001(\0162\035.model.Datas"
+  "etInfo.DataFormat:\014BOOST_MATRIX\022:\n\013disk_"
+  "reader\030\007 \001(\0162\035.model.DatasetInfo.DiskRea"
+  "der:\006STREAM\"5\n\010DataType\022\r\n\tTRAIN_SET\020\000\022\014"
+  "\n\010EVAL_SET\020\001\022\014\n\010TEST_SET\020\002\"\'\n\nDataFormat"
+  "\022\020\n\014BOOST_MATRIX\020\000\022\007\n\003CSV\020\001\"*\n\nDiskReade"
+  "r\022\n\n\006STREAM\020\000\022\020\n\014DIRECT_ASYNC\020\001\"\326\001\n\014Data"
+  "baseInfo\022\014\n\004name\030\001 \002(\t\022 \n\004data\030\002 \003(\0132\022.m"
+  "odel.DatasetInfo\022\037\n\014data_handler\030\003 \001(\t:\t"
+  "deeplearn\022\026\n\013main_memory\030\004 \001(\002:\0012\022\027\n\ngpu"
+  "_memory\030\005 \001(\002:\0031.5\022\025\n\013path_prefix\030\006 \001(\t:"
+  "\000\022\025\n\nshard_rank\030\007 \001(\005:\0010\022\026\n\013shard_count\030"
+  "\010 \001(\005:\0011"
+  ;
+static ::_pbi::once_flag descriptor_table_deeplearn_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_deeplearn_2eproto = {
+    false, false, 3648, descriptor_table_protodef_deeplearn_2eproto,
+    "deeplearn.proto",
+    &descriptor_table_deeplearn_2eproto_once, nullptr, 0, 12,
+    schemas, file_default_instances, TableStruct_deeplearn_2eproto::offsets,
+    file_level_metadata_deeplearn_2eproto, file_level_enum_descriptors_deeplearn_2eproto,
+    file_level_service_descriptors_deeplearn_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_deeplearn_2eproto_getter() {
+  return &descriptor_table_deeplearn_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_deeplearn_2eproto(&descriptor_table_deeplearn_2eproto);
+namespace model {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Metric_MetricType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[0];
 }
 bool Metric_MetricType_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 1:
     case 2:
       return true;
@@ -529,5519 +682,6007 @@ bool Metric_MetricType_IsValid(int value) {
   }
 }
 
-#ifndef _MSC_VER
-const Metric_MetricType Metric::NLL;
-const Metric_MetricType Metric::CLASSIFICATION_ERROR;
-const Metric_MetricType Metric::MetricType_MIN;
-const Metric_MetricType Metric::MetricType_MAX;
-const int Metric::MetricType_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Metric::kTypeFieldNumber;
-const int Metric::kStepsFieldNumber;
-const int Metric::kValuesFieldNumber;
-#endif  // !_MSC_VER
-
-Metric::Metric()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Metric_MetricType Metric::NLL;
+constexpr Metric_MetricType Metric::CLASSIFICATION_ERROR;
+constexpr Metric_MetricType Metric::MetricType_MIN;
+constexpr Metric_MetricType Metric::MetricType_MAX;
+constexpr int Metric::MetricType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Hyperparams_Decay_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[1];
 }
-
-void Metric::InitAsDefaultInstance() {
+bool Hyperparams_Decay_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Metric::Metric(const Metric& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Hyperparams_Decay Hyperparams::DECAY_NONE;
+constexpr Hyperparams_Decay Hyperparams::DECAY_INVERSE_T;
+constexpr Hyperparams_Decay Hyperparams::DECAY_EXPONENTIAL;
+constexpr Hyperparams_Decay Hyperparams::Decay_MIN;
+constexpr Hyperparams_Decay Hyperparams::Decay_MAX;
+constexpr int Hyperparams::Decay_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Hyperparams_BestModelCriterion_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[2];
+}
+bool Hyperparams_BestModelCriterion_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void Metric::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 1;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Hyperparams_BestModelCriterion Hyperparams::CRITERION_NONE;
+constexpr Hyperparams_BestModelCriterion Hyperparams::CRITERION_NLL;
+constexpr Hyperparams_BestModelCriterion Hyperparams::CRITERION_ERROR;
+constexpr Hyperparams_BestModelCriterion Hyperparams::BestModelCriterion_MIN;
+constexpr Hyperparams_BestModelCriterion Hyperparams::BestModelCriterion_MAX;
+constexpr int Hyperparams::BestModelCriterion_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NodeData_NodeType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[3];
+}
+bool NodeData_NodeType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Metric::~Metric() {
-  SharedDtor();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr NodeData_NodeType NodeData::INPUT;
+constexpr NodeData_NodeType NodeData::HIDDEN;
+constexpr NodeData_NodeType NodeData::QUERY;
+constexpr NodeData_NodeType NodeData::PRODUCT;
+constexpr NodeData_NodeType NodeData::SUM;
+constexpr NodeData_NodeType NodeData::MAX;
+constexpr NodeData_NodeType NodeData::NodeType_MIN;
+constexpr NodeData_NodeType NodeData::NodeType_MAX;
+constexpr int NodeData::NodeType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ModelData_ModelType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[4];
+}
+bool ModelData_ModelType_IsValid(int value) {
+  switch (value) {
+    case 0:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void Metric::SharedDtor() {
-  if (this != default_instance_) {
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ModelData_ModelType ModelData::SPN;
+constexpr ModelData_ModelType ModelData::ModelType_MIN;
+constexpr ModelData_ModelType ModelData::ModelType_MAX;
+constexpr int ModelData::ModelType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_Optimizer_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[5];
+}
+bool Operation_Optimizer_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+      return true;
+    default:
+      return false;
   }
 }
 
-void Metric::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Operation_Optimizer Operation::GRADIENT_DESCENT;
+constexpr Operation_Optimizer Operation::HARD_GRADIENT_DESCENT;
+constexpr Operation_Optimizer Operation::EM;
+constexpr Operation_Optimizer Operation::HARD_EM;
+constexpr Operation_Optimizer Operation::CD;
+constexpr Operation_Optimizer Operation::PCD;
+constexpr Operation_Optimizer Operation::ADAM;
+constexpr Operation_Optimizer Operation::ADAGRAD;
+constexpr Operation_Optimizer Operation::RMSPROP;
+constexpr Operation_Optimizer Operation::Optimizer_MIN;
+constexpr Operation_Optimizer Operation::Optimizer_MAX;
+constexpr int Operation::Optimizer_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_OperationType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[6];
 }
-const ::google::protobuf::Descriptor* Metric::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Metric_descriptor_;
+bool Operation_OperationType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
 
-const Metric& Metric::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Operation_OperationType Operation::TRAIN;
+constexpr Operation_OperationType Operation::TEST;
+constexpr Operation_OperationType Operation::OperationType_MIN;
+constexpr Operation_OperationType Operation::OperationType_MAX;
+constexpr int Operation::OperationType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_ParallelMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[7];
+}
+bool Operation_ParallelMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Metric* Metric::default_instance_ = NULL;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Operation_ParallelMode Operation::NODE_LEVELS;
+constexpr Operation_ParallelMode Operation::BATCH_ROWS;
+constexpr Operation_ParallelMode Operation::ParallelMode_MIN;
+constexpr Operation_ParallelMode Operation::ParallelMode_MAX;
+constexpr int Operation::ParallelMode_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetInfo_DataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[8];
+}
+bool DatasetInfo_DataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
 
-Metric* Metric::New() const {
-  return new Metric;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DatasetInfo_DataType DatasetInfo::TRAIN_SET;
+constexpr DatasetInfo_DataType DatasetInfo::EVAL_SET;
+constexpr DatasetInfo_DataType DatasetInfo::TEST_SET;
+constexpr DatasetInfo_DataType DatasetInfo::DataType_MIN;
+constexpr DatasetInfo_DataType DatasetInfo::DataType_MAX;
+constexpr int DatasetInfo::DataType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetInfo_DataFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[9];
+}
+bool DatasetInfo_DataFormat_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void Metric::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 1;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DatasetInfo_DataFormat DatasetInfo::BOOST_MATRIX;
+constexpr DatasetInfo_DataFormat DatasetInfo::CSV;
+constexpr DatasetInfo_DataFormat DatasetInfo::DataFormat_MIN;
+constexpr DatasetInfo_DataFormat DatasetInfo::DataFormat_MAX;
+constexpr int DatasetInfo::DataFormat_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetInfo_DiskReader_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deeplearn_2eproto);
+  return file_level_enum_descriptors_deeplearn_2eproto[10];
+}
+bool DatasetInfo_DiskReader_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
   }
-  steps_.Clear();
-  values_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
 }
 
-bool Metric::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .model.Metric.MetricType type = 1 [default = NLL];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::Metric_MetricType_IsValid(value)) {
-            set_type(static_cast< ::model::Metric_MetricType >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_steps;
-        break;
-      }
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DatasetInfo_DiskReader DatasetInfo::STREAM;
+constexpr DatasetInfo_DiskReader DatasetInfo::DIRECT_ASYNC;
+constexpr DatasetInfo_DiskReader DatasetInfo::DiskReader_MIN;
+constexpr DatasetInfo_DiskReader DatasetInfo::DiskReader_MAX;
+constexpr int DatasetInfo::DiskReader_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-      // repeated int32 steps = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_steps:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 1, 16, input, this->mutable_steps())));
-        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
-                   == ::google::protobuf::internal::WireFormatLite::
-                      WIRETYPE_LENGTH_DELIMITED) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_steps())));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_steps;
-        if (input->ExpectTag(29)) goto parse_values;
-        break;
-      }
+// ===================================================================
 
-      // repeated float values = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_values:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 1, 29, input, this->mutable_values())));
-        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
-                   == ::google::protobuf::internal::WireFormatLite::
-                      WIRETYPE_LENGTH_DELIMITED) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, this->mutable_values())));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_values;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+class Metric::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Metric>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  return true;
-#undef DO_
-}
-
-void Metric::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .model.Metric.MetricType type = 1 [default = NLL];
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
+};
 
-  // repeated int32 steps = 2;
-  for (int i = 0; i < this->steps_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(
-      2, this->steps(i), output);
-  }
+Metric::Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.Metric)
+}
+Metric::Metric(const Metric& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Metric* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steps_){from._impl_.steps_}
+    , decltype(_impl_.values_){from._impl_.values_}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:model.Metric)
+}
+
+inline void Metric::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steps_){arena}
+    , decltype(_impl_.values_){arena}
+    , decltype(_impl_.type_){1}
+  };
+}
 
-  // repeated float values = 3;
-  for (int i = 0; i < this->values_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(
-      3, this->values(i), output);
+Metric::~Metric() {
+  // @@protoc_insertion_point(destructor:model.Metric)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+inline void Metric::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.steps_.~RepeatedField();
+  _impl_.values_.~RepeatedField();
+}
+
+void Metric::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-::google::protobuf::uint8* Metric::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+void Metric::Clear() {
+// @@protoc_insertion_point(message_clear_start:model.Metric)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.steps_.Clear();
+  _impl_.values_.Clear();
+  _impl_.type_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Metric::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .model.Metric.MetricType type = 1 [default = NLL];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::Metric_MetricType_IsValid(val))) {
+            _internal_set_type(static_cast<::model::Metric_MetricType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 steps = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_steps(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_steps(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float values = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_values(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<29>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_values(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Metric::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.Metric)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .model.Metric.MetricType type = 1 [default = NLL];
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // repeated int32 steps = 2;
-  for (int i = 0; i < this->steps_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteInt32ToArray(2, this->steps(i), target);
+  for (int i = 0, n = this->_internal_steps_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_steps(i), target);
   }
 
   // repeated float values = 3;
-  for (int i = 0; i < this->values_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteFloatToArray(3, this->values(i), target);
+  for (int i = 0, n = this->_internal_values_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_values(i), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.Metric)
   return target;
 }
 
-int Metric::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .model.Metric.MetricType type = 1 [default = NLL];
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+size_t Metric::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.Metric)
+  size_t total_size = 0;
 
+  // required .model.Metric.MetricType type = 1 [default = NLL];
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated int32 steps = 2;
   {
-    int data_size = 0;
-    for (int i = 0; i < this->steps_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        Int32Size(this->steps(i));
-    }
-    total_size += 1 * this->steps_size() + data_size;
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.steps_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_steps_size());
+    total_size += data_size;
   }
 
   // repeated float values = 3;
   {
-    int data_size = 0;
-    data_size = 4 * this->values_size();
-    total_size += 1 * this->values_size() + data_size;
+    unsigned int count = static_cast<unsigned int>(this->_internal_values_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_values_size());
+    total_size += data_size;
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Metric::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Metric* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Metric*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Metric::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Metric::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Metric::GetClassData() const { return &_class_data_; }
 
-void Metric::MergeFrom(const Metric& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  steps_.MergeFrom(from.steps_);
-  values_.MergeFrom(from.values_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void Metric::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Metric::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Metric*>(&to_msg);
+  auto& from = static_cast<const Metric&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.Metric)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.steps_.MergeFrom(from._impl_.steps_);
+  _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  if (from._internal_has_type()) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Metric::CopyFrom(const Metric& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.Metric)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Metric::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Metric::Swap(Metric* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    steps_.Swap(&other->steps_);
-    values_.Swap(&other->values_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Metric::InternalSwap(Metric* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.steps_.InternalSwap(&other->_impl_.steps_);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::google::protobuf::Metadata Metric::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Metric_descriptor_;
-  metadata.reflection = Metric_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Metric::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Metrics::kMetricsFieldNumber;
-#endif  // !_MSC_VER
-
-Metrics::Metrics()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Metrics::_Internal {
+ public:
+};
 
-void Metrics::InitAsDefaultInstance() {
+Metrics::Metrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.Metrics)
 }
-
 Metrics::Metrics(const Metrics& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Metrics::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Metrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){from._impl_.metrics_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:model.Metrics)
+}
+
+inline void Metrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Metrics::~Metrics() {
+  // @@protoc_insertion_point(destructor:model.Metrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Metrics::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Metrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.metrics_.~RepeatedPtrField();
 }
 
 void Metrics::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Metrics::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Metrics_descriptor_;
-}
-
-const Metrics& Metrics::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-Metrics* Metrics::default_instance_ = NULL;
-
-Metrics* Metrics::New() const {
-  return new Metrics;
+  _impl_._cached_size_.Set(size);
 }
 
 void Metrics::Clear() {
-  metrics_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
+// @@protoc_insertion_point(message_clear_start:model.Metrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool Metrics::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .model.Metric metrics = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_metrics:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_metrics()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_metrics;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+  _impl_.metrics_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Metrics::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated .model.Metric metrics = 1;
-  for (int i = 0; i < this->metrics_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->metrics(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+const char* Metrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .model.Metric metrics = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metrics(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Metrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.Metrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* Metrics::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
   // repeated .model.Metric metrics = 1;
-  for (int i = 0; i < this->metrics_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->metrics(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metrics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metrics(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.Metrics)
   return target;
 }
 
-int Metrics::ByteSize() const {
-  int total_size = 0;
+size_t Metrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.Metrics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .model.Metric metrics = 1;
-  total_size += 1 * this->metrics_size();
-  for (int i = 0; i < this->metrics_size(); i++) {
+  total_size += 1UL * this->_internal_metrics_size();
+  for (const auto& msg : this->_impl_.metrics_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->metrics(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Metrics::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Metrics* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Metrics*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Metrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Metrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Metrics::GetClassData() const { return &_class_data_; }
 
-void Metrics::MergeFrom(const Metrics& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  metrics_.MergeFrom(from.metrics_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void Metrics::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Metrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Metrics*>(&to_msg);
+  auto& from = static_cast<const Metrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.Metrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Metrics::CopyFrom(const Metrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.Metrics)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Metrics::IsInitialized() const {
-
-  for (int i = 0; i < metrics_size(); i++) {
-    if (!this->metrics(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.metrics_))
+    return false;
   return true;
 }
 
-void Metrics::Swap(Metrics* other) {
-  if (other != this) {
-    metrics_.Swap(&other->metrics_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Metrics::InternalSwap(Metrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.metrics_.InternalSwap(&other->_impl_.metrics_);
 }
 
-::google::protobuf::Metadata Metrics::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Metrics_descriptor_;
-  metadata.reflection = Metrics_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Metrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[1]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Hyperparams_Decay_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Hyperparams_Decay_descriptor_;
-}
-bool Hyperparams_Decay_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
+class Hyperparams::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Hyperparams>()._impl_._has_bits_);
+  static void set_has_base_learningrate(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
-}
-
-#ifndef _MSC_VER
-const Hyperparams_Decay Hyperparams::DECAY_NONE;
-const Hyperparams_Decay Hyperparams::DECAY_INVERSE_T;
-const Hyperparams_Decay Hyperparams::DECAY_EXPONENTIAL;
-const Hyperparams_Decay Hyperparams::Decay_MIN;
-const Hyperparams_Decay Hyperparams::Decay_MAX;
-const int Hyperparams::Decay_ARRAYSIZE;
-#endif  // _MSC_VER
-const ::google::protobuf::EnumDescriptor* Hyperparams_BestModelCriterion_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Hyperparams_BestModelCriterion_descriptor_;
-}
-bool Hyperparams_BestModelCriterion_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
+  static void set_has_learningrate_decay(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const Hyperparams_BestModelCriterion Hyperparams::CRITERION_NONE;
-const Hyperparams_BestModelCriterion Hyperparams::CRITERION_NLL;
-const Hyperparams_BestModelCriterion Hyperparams::CRITERION_ERROR;
-const Hyperparams_BestModelCriterion Hyperparams::BestModelCriterion_MIN;
-const Hyperparams_BestModelCriterion Hyperparams::BestModelCriterion_MAX;
-const int Hyperparams::BestModelCriterion_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Hyperparams::kBaseLearningrateFieldNumber;
-const int Hyperparams::kLearningrateDecayFieldNumber;
-const int Hyperparams::kLearningrateDecayHalfLifeFieldNumber;
-const int Hyperparams::kInitialMomentumFieldNumber;
-const int Hyperparams::kFinalMomentumFieldNumber;
-const int Hyperparams::kMomentumChangeStepsFieldNumber;
-const int Hyperparams::kSelectModelCriterionFieldNumber;
-#endif  // !_MSC_VER
-
-Hyperparams::Hyperparams()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  static void set_has_learningrate_decay_half_life(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_initial_momentum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_final_momentum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_momentum_change_steps(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_select_model_criterion(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_adam_beta1(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_adam_beta2(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_rmsprop_decay(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_epsilon(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
 
-void Hyperparams::InitAsDefaultInstance() {
+Hyperparams::Hyperparams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.Hyperparams)
 }
-
 Hyperparams::Hyperparams(const Hyperparams& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Hyperparams::SharedCtor() {
-  _cached_size_ = 0;
-  base_learningrate_ = 0.01f;
-  learningrate_decay_ = 0;
-  learningrate_decay_half_life_ = 1000;
-  initial_momentum_ = 0;
-  final_momentum_ = 0;
-  momentum_change_steps_ = 10;
-  select_model_criterion_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Hyperparams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.learningrate_decay_){}
+    , decltype(_impl_.initial_momentum_){}
+    , decltype(_impl_.final_momentum_){}
+    , decltype(_impl_.select_model_criterion_){}
+    , decltype(_impl_.epsilon_){}
+    , decltype(_impl_.base_learningrate_){}
+    , decltype(_impl_.learningrate_decay_half_life_){}
+    , decltype(_impl_.momentum_change_steps_){}
+    , decltype(_impl_.adam_beta1_){}
+    , decltype(_impl_.adam_beta2_){}
+    , decltype(_impl_.rmsprop_decay_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.learningrate_decay_, &from._impl_.learningrate_decay_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rmsprop_decay_) -
+    reinterpret_cast<char*>(&_impl_.learningrate_decay_)) + sizeof(_impl_.rmsprop_decay_));
+  // @@protoc_insertion_point(copy_constructor:model.Hyperparams)
+}
+
+inline void Hyperparams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.learningrate_decay_){0}
+    , decltype(_impl_.initial_momentum_){0}
+    , decltype(_impl_.final_momentum_){0}
+    , decltype(_impl_.select_model_criterion_){0}
+    , decltype(_impl_.epsilon_){1e-08f}
+    , decltype(_impl_.base_learningrate_){0.01f}
+    , decltype(_impl_.learningrate_decay_half_life_){1000}
+    , decltype(_impl_.momentum_change_steps_){10}
+    , decltype(_impl_.adam_beta1_){0.9f}
+    , decltype(_impl_.adam_beta2_){0.999f}
+    , decltype(_impl_.rmsprop_decay_){0.9f}
+  };
 }
 
 Hyperparams::~Hyperparams() {
+  // @@protoc_insertion_point(destructor:model.Hyperparams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Hyperparams::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Hyperparams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Hyperparams::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Hyperparams::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Hyperparams_descriptor_;
-}
-
-const Hyperparams& Hyperparams::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-Hyperparams* Hyperparams::default_instance_ = NULL;
-
-Hyperparams* Hyperparams::New() const {
-  return new Hyperparams;
+  _impl_._cached_size_.Set(size);
 }
 
 void Hyperparams::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    base_learningrate_ = 0.01f;
-    learningrate_decay_ = 0;
-    learningrate_decay_half_life_ = 1000;
-    initial_momentum_ = 0;
-    final_momentum_ = 0;
-    momentum_change_steps_ = 10;
-    select_model_criterion_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Hyperparams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:model.Hyperparams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.learningrate_decay_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.select_model_criterion_) -
+        reinterpret_cast<char*>(&_impl_.learningrate_decay_)) + sizeof(_impl_.select_model_criterion_));
+    _impl_.epsilon_ = 1e-08f;
+    _impl_.base_learningrate_ = 0.01f;
+    _impl_.learningrate_decay_half_life_ = 1000;
+    _impl_.momentum_change_steps_ = 10;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    _impl_.adam_beta1_ = 0.9f;
+    _impl_.adam_beta2_ = 0.999f;
+    _impl_.rmsprop_decay_ = 0.9f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Hyperparams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional float base_learningrate = 1 [default = 0.01];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &base_learningrate_)));
-          set_has_base_learningrate();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_learningrate_decay;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_base_learningrate(&has_bits);
+          _impl_.base_learningrate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Hyperparams.Decay learningrate_decay = 2 [default = DECAY_NONE];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_learningrate_decay:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::Hyperparams_Decay_IsValid(value)) {
-            set_learningrate_decay(static_cast< ::model::Hyperparams_Decay >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::Hyperparams_Decay_IsValid(val))) {
+            _internal_set_learningrate_decay(static_cast<::model::Hyperparams_Decay>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_learningrate_decay_half_life;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 learningrate_decay_half_life = 3 [default = 1000];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_learningrate_decay_half_life:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &learningrate_decay_half_life_)));
-          set_has_learningrate_decay_half_life();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(37)) goto parse_initial_momentum;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_learningrate_decay_half_life(&has_bits);
+          _impl_.learningrate_decay_half_life_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float initial_momentum = 4 [default = 0];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_initial_momentum:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &initial_momentum_)));
-          set_has_initial_momentum();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(45)) goto parse_final_momentum;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_initial_momentum(&has_bits);
+          _impl_.initial_momentum_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float final_momentum = 5 [default = 0];
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_final_momentum:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &final_momentum_)));
-          set_has_final_momentum();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(48)) goto parse_momentum_change_steps;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_final_momentum(&has_bits);
+          _impl_.final_momentum_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 momentum_change_steps = 6 [default = 10];
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_momentum_change_steps:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &momentum_change_steps_)));
-          set_has_momentum_change_steps();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(56)) goto parse_select_model_criterion;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_momentum_change_steps(&has_bits);
+          _impl_.momentum_change_steps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_select_model_criterion:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::Hyperparams_BestModelCriterion_IsValid(value)) {
-            set_select_model_criterion(static_cast< ::model::Hyperparams_BestModelCriterion >(value));
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::Hyperparams_BestModelCriterion_IsValid(val))) {
+            _internal_set_select_model_criterion(static_cast<::model::Hyperparams_BestModelCriterion>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(7, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(7, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Hyperparams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float adam_beta1 = 8 [default = 0.9];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_adam_beta1(&has_bits);
+          _impl_.adam_beta1_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float adam_beta2 = 9 [default = 0.999];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_adam_beta2(&has_bits);
+          _impl_.adam_beta2_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float rmsprop_decay = 10 [default = 0.9];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_rmsprop_decay(&has_bits);
+          _impl_.rmsprop_decay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float epsilon = 11 [default = 1e-08];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _Internal::set_has_epsilon(&has_bits);
+          _impl_.epsilon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Hyperparams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.Hyperparams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional float base_learningrate = 1 [default = 0.01];
-  if (has_base_learningrate()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->base_learningrate(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_base_learningrate(), target);
   }
 
   // optional .model.Hyperparams.Decay learningrate_decay = 2 [default = DECAY_NONE];
-  if (has_learningrate_decay()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->learningrate_decay(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_learningrate_decay(), target);
   }
 
   // optional int32 learningrate_decay_half_life = 3 [default = 1000];
-  if (has_learningrate_decay_half_life()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->learningrate_decay_half_life(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_learningrate_decay_half_life(), target);
   }
 
   // optional float initial_momentum = 4 [default = 0];
-  if (has_initial_momentum()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->initial_momentum(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_initial_momentum(), target);
   }
 
   // optional float final_momentum = 5 [default = 0];
-  if (has_final_momentum()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->final_momentum(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_final_momentum(), target);
   }
 
   // optional int32 momentum_change_steps = 6 [default = 10];
-  if (has_momentum_change_steps()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->momentum_change_steps(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_momentum_change_steps(), target);
   }
 
   // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
-  if (has_select_model_criterion()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      7, this->select_model_criterion(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_select_model_criterion(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional float adam_beta1 = 8 [default = 0.9];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_adam_beta1(), target);
   }
-}
 
-::google::protobuf::uint8* Hyperparams::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional float base_learningrate = 1 [default = 0.01];
-  if (has_base_learningrate()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->base_learningrate(), target);
+  // optional float adam_beta2 = 9 [default = 0.999];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_adam_beta2(), target);
   }
 
-  // optional .model.Hyperparams.Decay learningrate_decay = 2 [default = DECAY_NONE];
-  if (has_learningrate_decay()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->learningrate_decay(), target);
+  // optional float rmsprop_decay = 10 [default = 0.9];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_rmsprop_decay(), target);
   }
 
-  // optional int32 learningrate_decay_half_life = 3 [default = 1000];
-  if (has_learningrate_decay_half_life()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->learningrate_decay_half_life(), target);
+  // optional float epsilon = 11 [default = 1e-08];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_epsilon(), target);
   }
 
-  // optional float initial_momentum = 4 [default = 0];
-  if (has_initial_momentum()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->initial_momentum(), target);
-  }
-
-  // optional float final_momentum = 5 [default = 0];
-  if (has_final_momentum()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->final_momentum(), target);
-  }
-
-  // optional int32 momentum_change_steps = 6 [default = 10];
-  if (has_momentum_change_steps()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->momentum_change_steps(), target);
-  }
-
-  // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
-  if (has_select_model_criterion()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      7, this->select_model_criterion(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.Hyperparams)
   return target;
 }
 
-int Hyperparams::ByteSize() const {
-  int total_size = 0;
+size_t Hyperparams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.Hyperparams)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional float base_learningrate = 1 [default = 0.01];
-    if (has_base_learningrate()) {
-      total_size += 1 + 4;
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
     // optional .model.Hyperparams.Decay learningrate_decay = 2 [default = DECAY_NONE];
-    if (has_learningrate_decay()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->learningrate_decay());
-    }
-
-    // optional int32 learningrate_decay_half_life = 3 [default = 1000];
-    if (has_learningrate_decay_half_life()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->learningrate_decay_half_life());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_learningrate_decay());
     }
 
     // optional float initial_momentum = 4 [default = 0];
-    if (has_initial_momentum()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 + 4;
     }
 
     // optional float final_momentum = 5 [default = 0];
-    if (has_final_momentum()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 4;
     }
 
-    // optional int32 momentum_change_steps = 6 [default = 10];
-    if (has_momentum_change_steps()) {
+    // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->momentum_change_steps());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_select_model_criterion());
     }
 
-    // optional .model.Hyperparams.BestModelCriterion select_model_criterion = 7 [default = CRITERION_NONE];
-    if (has_select_model_criterion()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->select_model_criterion());
+    // optional float epsilon = 11 [default = 1e-08];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float base_learningrate = 1 [default = 0.01];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 learningrate_decay_half_life = 3 [default = 1000];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_learningrate_decay_half_life());
+    }
+
+    // optional int32 momentum_change_steps = 6 [default = 10];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_momentum_change_steps());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  if (cached_has_bits & 0x00000700u) {
+    // optional float adam_beta1 = 8 [default = 0.9];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float adam_beta2 = 9 [default = 0.999];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float rmsprop_decay = 10 [default = 0.9];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 4;
+    }
 
-void Hyperparams::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Hyperparams* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Hyperparams*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Hyperparams::MergeFrom(const Hyperparams& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_base_learningrate()) {
-      set_base_learningrate(from.base_learningrate());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Hyperparams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Hyperparams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Hyperparams::GetClassData() const { return &_class_data_; }
+
+
+void Hyperparams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Hyperparams*>(&to_msg);
+  auto& from = static_cast<const Hyperparams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.Hyperparams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.learningrate_decay_ = from._impl_.learningrate_decay_;
     }
-    if (from.has_learningrate_decay()) {
-      set_learningrate_decay(from.learningrate_decay());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.initial_momentum_ = from._impl_.initial_momentum_;
     }
-    if (from.has_learningrate_decay_half_life()) {
-      set_learningrate_decay_half_life(from.learningrate_decay_half_life());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.final_momentum_ = from._impl_.final_momentum_;
     }
-    if (from.has_initial_momentum()) {
-      set_initial_momentum(from.initial_momentum());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.select_model_criterion_ = from._impl_.select_model_criterion_;
     }
-    if (from.has_final_momentum()) {
-      set_final_momentum(from.final_momentum());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.epsilon_ = from._impl_.epsilon_;
     }
-    if (from.has_momentum_change_steps()) {
-      set_momentum_change_steps(from.momentum_change_steps());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.base_learningrate_ = from._impl_.base_learningrate_;
     }
-    if (from.has_select_model_criterion()) {
-      set_select_model_criterion(from.select_model_criterion());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.learningrate_decay_half_life_ = from._impl_.learningrate_decay_half_life_;
     }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.momentum_change_steps_ = from._impl_.momentum_change_steps_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Hyperparams::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.adam_beta1_ = from._impl_.adam_beta1_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.adam_beta2_ = from._impl_.adam_beta2_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.rmsprop_decay_ = from._impl_.rmsprop_decay_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Hyperparams::CopyFrom(const Hyperparams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.Hyperparams)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Hyperparams::IsInitialized() const {
-
   return true;
 }
 
-void Hyperparams::Swap(Hyperparams* other) {
-  if (other != this) {
-    std::swap(base_learningrate_, other->base_learningrate_);
-    std::swap(learningrate_decay_, other->learningrate_decay_);
-    std::swap(learningrate_decay_half_life_, other->learningrate_decay_half_life_);
-    std::swap(initial_momentum_, other->initial_momentum_);
-    std::swap(final_momentum_, other->final_momentum_);
-    std::swap(momentum_change_steps_, other->momentum_change_steps_);
-    std::swap(select_model_criterion_, other->select_model_criterion_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Hyperparams::InternalSwap(Hyperparams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Hyperparams, _impl_.select_model_criterion_)
+      + sizeof(Hyperparams::_impl_.select_model_criterion_)
+      - PROTOBUF_FIELD_OFFSET(Hyperparams, _impl_.learningrate_decay_)>(
+          reinterpret_cast<char*>(&_impl_.learningrate_decay_),
+          reinterpret_cast<char*>(&other->_impl_.learningrate_decay_));
+  swap(_impl_.epsilon_, other->_impl_.epsilon_);
+  swap(_impl_.base_learningrate_, other->_impl_.base_learningrate_);
+  swap(_impl_.learningrate_decay_half_life_, other->_impl_.learningrate_decay_half_life_);
+  swap(_impl_.momentum_change_steps_, other->_impl_.momentum_change_steps_);
+  swap(_impl_.adam_beta1_, other->_impl_.adam_beta1_);
+  swap(_impl_.adam_beta2_, other->_impl_.adam_beta2_);
+  swap(_impl_.rmsprop_decay_, other->_impl_.rmsprop_decay_);
 }
 
-::google::protobuf::Metadata Hyperparams::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Hyperparams_descriptor_;
-  metadata.reflection = Hyperparams_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Hyperparams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[2]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* NodeData_NodeType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NodeData_NodeType_descriptor_;
-}
-bool NodeData_NodeType_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
-    case 4:
-    case 5:
-      return true;
-    default:
-      return false;
+class NodeData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NodeData>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const NodeData_NodeType NodeData::INPUT;
-const NodeData_NodeType NodeData::HIDDEN;
-const NodeData_NodeType NodeData::QUERY;
-const NodeData_NodeType NodeData::PRODUCT;
-const NodeData_NodeType NodeData::SUM;
-const NodeData_NodeType NodeData::MAX;
-const NodeData_NodeType NodeData::NodeType_MIN;
-const NodeData_NodeType NodeData::NodeType_MAX;
-const int NodeData::NodeType_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int NodeData::kNameFieldNumber;
-const int NodeData::kTypeFieldNumber;
-const int NodeData::kDimensionFieldNumber;
-const int NodeData::kInputStartIndexFieldNumber;
-const int NodeData::kBiasFieldNumber;
-const int NodeData::kHyperParamsFieldNumber;
-#endif  // !_MSC_VER
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_dimension(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_input_start_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_bias(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::model::Hyperparams& hyper_params(const NodeData* msg);
+  static void set_has_hyper_params(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000019) ^ 0x00000019) != 0;
+  }
+};
 
-NodeData::NodeData()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::model::Hyperparams&
+NodeData::_Internal::hyper_params(const NodeData* msg) {
+  return *msg->_impl_.hyper_params_;
 }
-
-void NodeData::InitAsDefaultInstance() {
-  hyper_params_ = const_cast< ::model::Hyperparams*>(&::model::Hyperparams::default_instance());
+NodeData::NodeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.NodeData)
 }
-
 NodeData::NodeData(const NodeData& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void NodeData::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  type_ = 0;
-  dimension_ = 0;
-  input_start_index_ = 0;
-  bias_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  hyper_params_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.bias_){}
+    , decltype(_impl_.hyper_params_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.dimension_){}
+    , decltype(_impl_.input_start_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.bias_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bias_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_bias()) {
+    _this->_impl_.bias_.Set(from._internal_bias(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_hyper_params()) {
+    _this->_impl_.hyper_params_ = new ::model::Hyperparams(*from._impl_.hyper_params_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.input_start_index_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.input_start_index_));
+  // @@protoc_insertion_point(copy_constructor:model.NodeData)
+}
+
+inline void NodeData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.bias_){}
+    , decltype(_impl_.hyper_params_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.dimension_){0}
+    , decltype(_impl_.input_start_index_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.bias_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bias_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 NodeData::~NodeData() {
+  // @@protoc_insertion_point(destructor:model.NodeData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NodeData::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (bias_ != &::google::protobuf::internal::kEmptyString) {
-    delete bias_;
-  }
-  if (this != default_instance_) {
-    delete hyper_params_;
-  }
+inline void NodeData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.bias_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.hyper_params_;
 }
 
 void NodeData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* NodeData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NodeData_descriptor_;
-}
-
-const NodeData& NodeData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
+  _impl_._cached_size_.Set(size);
 }
 
-NodeData* NodeData::default_instance_ = NULL;
+void NodeData::Clear() {
+// @@protoc_insertion_point(message_clear_start:model.NodeData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-NodeData* NodeData::New() const {
-  return new NodeData;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.bias_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.hyper_params_ != nullptr);
+      _impl_.hyper_params_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000038u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.input_start_index_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.input_start_index_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NodeData::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    type_ = 0;
-    dimension_ = 0;
-    input_start_index_ = 0;
-    if (has_bias()) {
-      if (bias_ != &::google::protobuf::internal::kEmptyString) {
-        bias_->clear();
-      }
-    }
-    if (has_hyper_params()) {
-      if (hyper_params_ != NULL) hyper_params_->::model::Hyperparams::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool NodeData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* NodeData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_type;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.NodeData.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required .model.NodeData.NodeType type = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::NodeData_NodeType_IsValid(value)) {
-            set_type(static_cast< ::model::NodeData_NodeType >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::NodeData_NodeType_IsValid(val))) {
+            _internal_set_type(static_cast<::model::NodeData_NodeType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_dimension;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 dimension = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_dimension:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &dimension_)));
-          set_has_dimension();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_input_start_index;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_dimension(&has_bits);
+          _impl_.dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 input_start_index = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_input_start_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &input_start_index_)));
-          set_has_input_start_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_bias;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_input_start_index(&has_bits);
+          _impl_.input_start_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bytes bias = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_bias:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_bias()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_hyper_params;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_bias();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Hyperparams hyper_params = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_hyper_params:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_hyper_params()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void NodeData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hyper_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.NodeData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.NodeData.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // required .model.NodeData.NodeType type = 2;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->type(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
   }
 
   // required int32 dimension = 3;
-  if (has_dimension()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->dimension(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_dimension(), target);
   }
 
   // optional int32 input_start_index = 4;
-  if (has_input_start_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->input_start_index(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_input_start_index(), target);
   }
 
   // optional bytes bias = 5;
-  if (has_bias()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      5, this->bias(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_bias(), target);
   }
 
   // optional .model.Hyperparams hyper_params = 6;
-  if (has_hyper_params()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->hyper_params(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::hyper_params(this),
+        _Internal::hyper_params(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.NodeData)
+  return target;
 }
 
-::google::protobuf::uint8* NodeData::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // required .model.NodeData.NodeType type = 2;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->type(), target);
-  }
-
-  // required int32 dimension = 3;
-  if (has_dimension()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->dimension(), target);
-  }
+size_t NodeData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:model.NodeData)
+  size_t total_size = 0;
 
-  // optional int32 input_start_index = 4;
-  if (has_input_start_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->input_start_index(), target);
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // optional bytes bias = 5;
-  if (has_bias()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        5, this->bias(), target);
+  if (_internal_has_type()) {
+    // required .model.NodeData.NodeType type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  // optional .model.Hyperparams hyper_params = 6;
-  if (has_hyper_params()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->hyper_params(), target);
+  if (_internal_has_dimension()) {
+    // required int32 dimension = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_dimension());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t NodeData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.NodeData)
+  size_t total_size = 0;
 
-int NodeData::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000019) ^ 0x00000019) == 0) {  // All required fields are present.
     // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
 
     // required .model.NodeData.NodeType type = 2;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
 
     // required int32 dimension = 3;
-    if (has_dimension()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->dimension());
-    }
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_dimension());
 
-    // optional int32 input_start_index = 4;
-    if (has_input_start_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->input_start_index());
-    }
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
     // optional bytes bias = 5;
-    if (has_bias()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->bias());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_bias());
     }
 
     // optional .model.Hyperparams hyper_params = 6;
-    if (has_hyper_params()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->hyper_params());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hyper_params_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional int32 input_start_index = 4;
+  if (cached_has_bits & 0x00000020u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_input_start_index());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void NodeData::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const NodeData* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const NodeData*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NodeData::MergeFrom(const NodeData& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeData::GetClassData() const { return &_class_data_; }
+
+
+void NodeData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeData*>(&to_msg);
+  auto& from = static_cast<const NodeData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.NodeData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_type()) {
-      set_type(from.type());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_bias(from._internal_bias());
     }
-    if (from.has_dimension()) {
-      set_dimension(from.dimension());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_hyper_params()->::model::Hyperparams::MergeFrom(
+          from._internal_hyper_params());
     }
-    if (from.has_input_start_index()) {
-      set_input_start_index(from.input_start_index());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
-    if (from.has_bias()) {
-      set_bias(from.bias());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.dimension_ = from._impl_.dimension_;
     }
-    if (from.has_hyper_params()) {
-      mutable_hyper_params()->::model::Hyperparams::MergeFrom(from.hyper_params());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.input_start_index_ = from._impl_.input_start_index_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void NodeData::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NodeData::CopyFrom(const NodeData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.NodeData)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool NodeData::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void NodeData::Swap(NodeData* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(type_, other->type_);
-    std::swap(dimension_, other->dimension_);
-    std::swap(input_start_index_, other->input_start_index_);
-    std::swap(bias_, other->bias_);
-    std::swap(hyper_params_, other->hyper_params_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata NodeData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = NodeData_descriptor_;
-  metadata.reflection = NodeData_reflection_;
-  return metadata;
+void NodeData::InternalSwap(NodeData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bias_, lhs_arena,
+      &other->_impl_.bias_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeData, _impl_.input_start_index_)
+      + sizeof(NodeData::_impl_.input_start_index_)
+      - PROTOBUF_FIELD_OFFSET(NodeData, _impl_.hyper_params_)>(
+          reinterpret_cast<char*>(&_impl_.hyper_params_),
+          reinterpret_cast<char*>(&other->_impl_.hyper_params_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[3]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int EdgeData::kDirectedFieldNumber;
-const int EdgeData::kWeightFieldNumber;
-const int EdgeData::kNode1FieldNumber;
-const int EdgeData::kNode2FieldNumber;
-const int EdgeData::kHyperParamsFieldNumber;
-#endif  // !_MSC_VER
+class EdgeData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EdgeData>()._impl_._has_bits_);
+  static void set_has_directed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_node1(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_node2(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::model::Hyperparams& hyper_params(const EdgeData* msg);
+  static void set_has_hyper_params(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
 
-EdgeData::EdgeData()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::model::Hyperparams&
+EdgeData::_Internal::hyper_params(const EdgeData* msg) {
+  return *msg->_impl_.hyper_params_;
 }
-
-void EdgeData::InitAsDefaultInstance() {
-  hyper_params_ = const_cast< ::model::Hyperparams*>(&::model::Hyperparams::default_instance());
+EdgeData::EdgeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.EdgeData)
 }
-
 EdgeData::EdgeData(const EdgeData& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void EdgeData::SharedCtor() {
-  _cached_size_ = 0;
-  directed_ = true;
-  weight_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  node1_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  node2_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  hyper_params_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EdgeData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.node1_){}
+    , decltype(_impl_.node2_){}
+    , decltype(_impl_.hyper_params_){nullptr}
+    , decltype(_impl_.directed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.weight_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_weight()) {
+    _this->_impl_.weight_.Set(from._internal_weight(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.node1_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node1_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_node1()) {
+    _this->_impl_.node1_.Set(from._internal_node1(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.node2_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node2_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_node2()) {
+    _this->_impl_.node2_.Set(from._internal_node2(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_hyper_params()) {
+    _this->_impl_.hyper_params_ = new ::model::Hyperparams(*from._impl_.hyper_params_);
+  }
+  _this->_impl_.directed_ = from._impl_.directed_;
+  // @@protoc_insertion_point(copy_constructor:model.EdgeData)
+}
+
+inline void EdgeData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.node1_){}
+    , decltype(_impl_.node2_){}
+    , decltype(_impl_.hyper_params_){nullptr}
+    , decltype(_impl_.directed_){true}
+  };
+  _impl_.weight_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.node1_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node1_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.node2_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node2_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 EdgeData::~EdgeData() {
+  // @@protoc_insertion_point(destructor:model.EdgeData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void EdgeData::SharedDtor() {
-  if (weight_ != &::google::protobuf::internal::kEmptyString) {
-    delete weight_;
-  }
-  if (node1_ != &::google::protobuf::internal::kEmptyString) {
-    delete node1_;
-  }
-  if (node2_ != &::google::protobuf::internal::kEmptyString) {
-    delete node2_;
-  }
-  if (this != default_instance_) {
-    delete hyper_params_;
-  }
+inline void EdgeData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.weight_.Destroy();
+  _impl_.node1_.Destroy();
+  _impl_.node2_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.hyper_params_;
 }
 
 void EdgeData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* EdgeData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return EdgeData_descriptor_;
-}
-
-const EdgeData& EdgeData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-EdgeData* EdgeData::default_instance_ = NULL;
-
-EdgeData* EdgeData::New() const {
-  return new EdgeData;
+  _impl_._cached_size_.Set(size);
 }
 
 void EdgeData::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    directed_ = true;
-    if (has_weight()) {
-      if (weight_ != &::google::protobuf::internal::kEmptyString) {
-        weight_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:model.EdgeData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.weight_.ClearNonDefaultToEmpty();
     }
-    if (has_node1()) {
-      if (node1_ != &::google::protobuf::internal::kEmptyString) {
-        node1_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.node1_.ClearNonDefaultToEmpty();
     }
-    if (has_node2()) {
-      if (node2_ != &::google::protobuf::internal::kEmptyString) {
-        node2_->clear();
-      }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.node2_.ClearNonDefaultToEmpty();
     }
-    if (has_hyper_params()) {
-      if (hyper_params_ != NULL) hyper_params_->::model::Hyperparams::Clear();
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.hyper_params_ != nullptr);
+      _impl_.hyper_params_->Clear();
     }
+    _impl_.directed_ = true;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool EdgeData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* EdgeData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional bool directed = 1 [default = true];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &directed_)));
-          set_has_directed();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_weight;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_directed(&has_bits);
+          _impl_.directed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bytes weight = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_weight:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_weight()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_node1;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_weight();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string node1 = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_node1:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_node1()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->node1().data(), this->node1().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_node2;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_node1();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.EdgeData.node1");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string node2 = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_node2:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_node2()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->node2().data(), this->node2().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_hyper_params;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_node2();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.EdgeData.node2");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Hyperparams hyper_params = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_hyper_params:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_hyper_params()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void EdgeData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hyper_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EdgeData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.EdgeData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional bool directed = 1 [default = true];
-  if (has_directed()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->directed(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_directed(), target);
   }
 
   // optional bytes weight = 2;
-  if (has_weight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->weight(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_weight(), target);
   }
 
   // optional string node1 = 3;
-  if (has_node1()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node1().data(), this->node1().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->node1(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_node1().data(), static_cast<int>(this->_internal_node1().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.EdgeData.node1");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_node1(), target);
   }
 
   // optional string node2 = 4;
-  if (has_node2()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node2().data(), this->node2().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->node2(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_node2().data(), static_cast<int>(this->_internal_node2().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.EdgeData.node2");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_node2(), target);
   }
 
   // optional .model.Hyperparams hyper_params = 5;
-  if (has_hyper_params()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->hyper_params(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::hyper_params(this),
+        _Internal::hyper_params(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* EdgeData::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional bool directed = 1 [default = true];
-  if (has_directed()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->directed(), target);
-  }
-
-  // optional bytes weight = 2;
-  if (has_weight()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->weight(), target);
-  }
-
-  // optional string node1 = 3;
-  if (has_node1()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node1().data(), this->node1().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->node1(), target);
-  }
-
-  // optional string node2 = 4;
-  if (has_node2()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node2().data(), this->node2().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->node2(), target);
-  }
-
-  // optional .model.Hyperparams hyper_params = 5;
-  if (has_hyper_params()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->hyper_params(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.EdgeData)
   return target;
 }
 
-int EdgeData::ByteSize() const {
-  int total_size = 0;
+size_t EdgeData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.EdgeData)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional bool directed = 1 [default = true];
-    if (has_directed()) {
-      total_size += 1 + 1;
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
     // optional bytes weight = 2;
-    if (has_weight()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->weight());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_weight());
     }
 
     // optional string node1 = 3;
-    if (has_node1()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->node1());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_node1());
     }
 
     // optional string node2 = 4;
-    if (has_node2()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->node2());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_node2());
     }
 
     // optional .model.Hyperparams hyper_params = 5;
-    if (has_hyper_params()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->hyper_params());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hyper_params_);
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional bool directed = 1 [default = true];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
 
-void EdgeData::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const EdgeData* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const EdgeData*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EdgeData::MergeFrom(const EdgeData& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_directed()) {
-      set_directed(from.directed());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EdgeData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeData::GetClassData() const { return &_class_data_; }
+
+
+void EdgeData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EdgeData*>(&to_msg);
+  auto& from = static_cast<const EdgeData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.EdgeData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_weight(from._internal_weight());
     }
-    if (from.has_weight()) {
-      set_weight(from.weight());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_node1(from._internal_node1());
     }
-    if (from.has_node1()) {
-      set_node1(from.node1());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_node2(from._internal_node2());
     }
-    if (from.has_node2()) {
-      set_node2(from.node2());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_hyper_params()->::model::Hyperparams::MergeFrom(
+          from._internal_hyper_params());
     }
-    if (from.has_hyper_params()) {
-      mutable_hyper_params()->::model::Hyperparams::MergeFrom(from.hyper_params());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.directed_ = from._impl_.directed_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void EdgeData::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EdgeData::CopyFrom(const EdgeData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.EdgeData)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool EdgeData::IsInitialized() const {
-
   return true;
 }
 
-void EdgeData::Swap(EdgeData* other) {
-  if (other != this) {
-    std::swap(directed_, other->directed_);
-    std::swap(weight_, other->weight_);
-    std::swap(node1_, other->node1_);
-    std::swap(node2_, other->node2_);
-    std::swap(hyper_params_, other->hyper_params_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata EdgeData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = EdgeData_descriptor_;
-  metadata.reflection = EdgeData_reflection_;
-  return metadata;
+void EdgeData::InternalSwap(EdgeData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.weight_, lhs_arena,
+      &other->_impl_.weight_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node1_, lhs_arena,
+      &other->_impl_.node1_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node2_, lhs_arena,
+      &other->_impl_.node2_, rhs_arena
+  );
+  swap(_impl_.hyper_params_, other->_impl_.hyper_params_);
+  swap(_impl_.directed_, other->_impl_.directed_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EdgeData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[4]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SpnLayerInit::kNameFieldNumber;
-const int SpnLayerInit::kTypeFieldNumber;
-const int SpnLayerInit::kSizeFieldNumber;
-const int SpnLayerInit::kProductCombinationsFieldNumber;
-const int SpnLayerInit::kInputIndicesFieldNumber;
-const int SpnLayerInit::kNodeListFieldNumber;
-#endif  // !_MSC_VER
-
-SpnLayerInit::SpnLayerInit()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class SpnLayerInit::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SpnLayerInit>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_product_combinations(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_input_indices(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_node_list(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void SpnLayerInit::InitAsDefaultInstance() {
+SpnLayerInit::SpnLayerInit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.SpnLayerInit)
 }
-
 SpnLayerInit::SpnLayerInit(const SpnLayerInit& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SpnLayerInit::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  type_ = 0;
-  size_ = 0;
-  product_combinations_ = 3;
-  input_indices_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  node_list_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpnLayerInit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.input_indices_){}
+    , decltype(_impl_.node_list_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.product_combinations_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.input_indices_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_input_indices()) {
+    _this->_impl_.input_indices_.Set(from._internal_input_indices(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.node_list_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_list_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_node_list()) {
+    _this->_impl_.node_list_.Set(from._internal_node_list(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.product_combinations_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.product_combinations_));
+  // @@protoc_insertion_point(copy_constructor:model.SpnLayerInit)
+}
+
+inline void SpnLayerInit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.input_indices_){}
+    , decltype(_impl_.node_list_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.size_){0}
+    , decltype(_impl_.product_combinations_){3}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.input_indices_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.node_list_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_list_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpnLayerInit::~SpnLayerInit() {
+  // @@protoc_insertion_point(destructor:model.SpnLayerInit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpnLayerInit::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-    delete input_indices_;
-  }
-  if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-    delete node_list_;
-  }
-  if (this != default_instance_) {
-  }
+inline void SpnLayerInit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.input_indices_.Destroy();
+  _impl_.node_list_.Destroy();
 }
 
 void SpnLayerInit::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SpnLayerInit::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SpnLayerInit_descriptor_;
+  _impl_._cached_size_.Set(size);
 }
 
-const SpnLayerInit& SpnLayerInit::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-SpnLayerInit* SpnLayerInit::default_instance_ = NULL;
+void SpnLayerInit::Clear() {
+// @@protoc_insertion_point(message_clear_start:model.SpnLayerInit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-SpnLayerInit* SpnLayerInit::New() const {
-  return new SpnLayerInit;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.input_indices_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.node_list_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000038u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.size_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.size_));
+    _impl_.product_combinations_ = 3;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SpnLayerInit::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    type_ = 0;
-    size_ = 0;
-    product_combinations_ = 3;
-    if (has_input_indices()) {
-      if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-        input_indices_->clear();
-      }
-    }
-    if (has_node_list()) {
-      if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-        node_list_->clear();
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SpnLayerInit::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SpnLayerInit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_type;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.SpnLayerInit.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.NodeData.NodeType type = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::NodeData_NodeType_IsValid(value)) {
-            set_type(static_cast< ::model::NodeData_NodeType >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::NodeData_NodeType_IsValid(val))) {
+            _internal_set_type(static_cast<::model::NodeData_NodeType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_size;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 size = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &size_)));
-          set_has_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_product_combinations;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 product_combinations = 4 [default = 3];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_product_combinations:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &product_combinations_)));
-          set_has_product_combinations();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_input_indices;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_product_combinations(&has_bits);
+          _impl_.product_combinations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string input_indices = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_input_indices:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_input_indices()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->input_indices().data(), this->input_indices().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_node_list;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_input_indices();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.SpnLayerInit.input_indices");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string node_list = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_node_list:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_node_list()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->node_list().data(), this->node_list().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SpnLayerInit::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_node_list();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.SpnLayerInit.node_list");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpnLayerInit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.SpnLayerInit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.SpnLayerInit.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // optional .model.NodeData.NodeType type = 2;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->type(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
   }
 
   // optional int32 size = 3;
-  if (has_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->size(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_size(), target);
   }
 
   // optional int32 product_combinations = 4 [default = 3];
-  if (has_product_combinations()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->product_combinations(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_product_combinations(), target);
   }
 
   // optional string input_indices = 5;
-  if (has_input_indices()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->input_indices().data(), this->input_indices().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      5, this->input_indices(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_input_indices().data(), static_cast<int>(this->_internal_input_indices().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.SpnLayerInit.input_indices");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_input_indices(), target);
   }
 
   // optional string node_list = 6;
-  if (has_node_list()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node_list().data(), this->node_list().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      6, this->node_list(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_node_list().data(), static_cast<int>(this->_internal_node_list().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.SpnLayerInit.node_list");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_node_list(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.SpnLayerInit)
+  return target;
 }
 
-::google::protobuf::uint8* SpnLayerInit::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // optional .model.NodeData.NodeType type = 2;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->type(), target);
-  }
-
-  // optional int32 size = 3;
-  if (has_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->size(), target);
-  }
-
-  // optional int32 product_combinations = 4 [default = 3];
-  if (has_product_combinations()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->product_combinations(), target);
-  }
-
-  // optional string input_indices = 5;
-  if (has_input_indices()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->input_indices().data(), this->input_indices().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->input_indices(), target);
-  }
-
-  // optional string node_list = 6;
-  if (has_node_list()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node_list().data(), this->node_list().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        6, this->node_list(), target);
-  }
+size_t SpnLayerInit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.SpnLayerInit)
+  size_t total_size = 0;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // required string name = 1;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
-  return target;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-int SpnLayerInit::ByteSize() const {
-  int total_size = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003eu) {
+    // optional string input_indices = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_input_indices());
+    }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string name = 1;
-    if (has_name()) {
+    // optional string node_list = 6;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_node_list());
     }
 
     // optional .model.NodeData.NodeType type = 2;
-    if (has_type()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
     }
 
     // optional int32 size = 3;
-    if (has_size()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->size());
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
     }
 
     // optional int32 product_combinations = 4 [default = 3];
-    if (has_product_combinations()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->product_combinations());
-    }
-
-    // optional string input_indices = 5;
-    if (has_input_indices()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->input_indices());
-    }
-
-    // optional string node_list = 6;
-    if (has_node_list()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->node_list());
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_product_combinations());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpnLayerInit::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SpnLayerInit* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SpnLayerInit*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpnLayerInit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpnLayerInit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpnLayerInit::GetClassData() const { return &_class_data_; }
+
 
-void SpnLayerInit::MergeFrom(const SpnLayerInit& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+void SpnLayerInit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpnLayerInit*>(&to_msg);
+  auto& from = static_cast<const SpnLayerInit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.SpnLayerInit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_type()) {
-      set_type(from.type());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_input_indices(from._internal_input_indices());
     }
-    if (from.has_size()) {
-      set_size(from.size());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_node_list(from._internal_node_list());
     }
-    if (from.has_product_combinations()) {
-      set_product_combinations(from.product_combinations());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
-    if (from.has_input_indices()) {
-      set_input_indices(from.input_indices());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.size_ = from._impl_.size_;
     }
-    if (from.has_node_list()) {
-      set_node_list(from.node_list());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.product_combinations_ = from._impl_.product_combinations_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SpnLayerInit::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpnLayerInit::CopyFrom(const SpnLayerInit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.SpnLayerInit)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SpnLayerInit::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SpnLayerInit::Swap(SpnLayerInit* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(type_, other->type_);
-    std::swap(size_, other->size_);
-    std::swap(product_combinations_, other->product_combinations_);
-    std::swap(input_indices_, other->input_indices_);
-    std::swap(node_list_, other->node_list_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata SpnLayerInit::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SpnLayerInit_descriptor_;
-  metadata.reflection = SpnLayerInit_reflection_;
-  return metadata;
+void SpnLayerInit::InternalSwap(SpnLayerInit* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.input_indices_, lhs_arena,
+      &other->_impl_.input_indices_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_list_, lhs_arena,
+      &other->_impl_.node_list_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpnLayerInit, _impl_.size_)
+      + sizeof(SpnLayerInit::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(SpnLayerInit, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+  swap(_impl_.product_combinations_, other->_impl_.product_combinations_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpnLayerInit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SpnData::kNodeListFieldNumber;
-const int SpnData::kAdjacencyMatrixFieldNumber;
-const int SpnData::kInputIndicesFieldNumber;
-const int SpnData::kLayersFieldNumber;
-#endif  // !_MSC_VER
-
-SpnData::SpnData()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class SpnData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SpnData>()._impl_._has_bits_);
+  static void set_has_node_list(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_adjacency_matrix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_input_indices(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_log_space(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
 
-void SpnData::InitAsDefaultInstance() {
+SpnData::SpnData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.SpnData)
 }
-
 SpnData::SpnData(const SpnData& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SpnData::SharedCtor() {
-  _cached_size_ = 0;
-  node_list_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  adjacency_matrix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  input_indices_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpnData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.layers_){from._impl_.layers_}
+    , decltype(_impl_.node_types_){from._impl_.node_types_}
+    , /*decltype(_impl_._node_types_cached_byte_size_)*/{0}
+    , decltype(_impl_.node_inputs_){from._impl_.node_inputs_}
+    , /*decltype(_impl_._node_inputs_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_children_){from._impl_.edge_children_}
+    , /*decltype(_impl_._edge_children_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_parents_){from._impl_.edge_parents_}
+    , /*decltype(_impl_._edge_parents_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_weights_){from._impl_.edge_weights_}
+    , decltype(_impl_.node_list_){}
+    , decltype(_impl_.adjacency_matrix_){}
+    , decltype(_impl_.input_indices_){}
+    , decltype(_impl_.log_space_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_list_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_list_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_node_list()) {
+    _this->_impl_.node_list_.Set(from._internal_node_list(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.adjacency_matrix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.adjacency_matrix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_adjacency_matrix()) {
+    _this->_impl_.adjacency_matrix_.Set(from._internal_adjacency_matrix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.input_indices_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_input_indices()) {
+    _this->_impl_.input_indices_.Set(from._internal_input_indices(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.log_space_ = from._impl_.log_space_;
+  // @@protoc_insertion_point(copy_constructor:model.SpnData)
+}
+
+inline void SpnData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.layers_){arena}
+    , decltype(_impl_.node_types_){arena}
+    , /*decltype(_impl_._node_types_cached_byte_size_)*/{0}
+    , decltype(_impl_.node_inputs_){arena}
+    , /*decltype(_impl_._node_inputs_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_children_){arena}
+    , /*decltype(_impl_._edge_children_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_parents_){arena}
+    , /*decltype(_impl_._edge_parents_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_weights_){arena}
+    , decltype(_impl_.node_list_){}
+    , decltype(_impl_.adjacency_matrix_){}
+    , decltype(_impl_.input_indices_){}
+    , decltype(_impl_.log_space_){false}
+  };
+  _impl_.node_list_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_list_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.adjacency_matrix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.adjacency_matrix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.input_indices_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.input_indices_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpnData::~SpnData() {
+  // @@protoc_insertion_point(destructor:model.SpnData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpnData::SharedDtor() {
-  if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-    delete node_list_;
-  }
-  if (adjacency_matrix_ != &::google::protobuf::internal::kEmptyString) {
-    delete adjacency_matrix_;
-  }
-  if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-    delete input_indices_;
-  }
-  if (this != default_instance_) {
-  }
+inline void SpnData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.layers_.~RepeatedPtrField();
+  _impl_.node_types_.~RepeatedField();
+  _impl_.node_inputs_.~RepeatedField();
+  _impl_.edge_children_.~RepeatedField();
+  _impl_.edge_parents_.~RepeatedField();
+  _impl_.edge_weights_.~RepeatedField();
+  _impl_.node_list_.Destroy();
+  _impl_.adjacency_matrix_.Destroy();
+  _impl_.input_indices_.Destroy();
 }
 
 void SpnData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SpnData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SpnData_descriptor_;
-}
-
-const SpnData& SpnData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-SpnData* SpnData::default_instance_ = NULL;
-
-SpnData* SpnData::New() const {
-  return new SpnData;
+  _impl_._cached_size_.Set(size);
 }
 
 void SpnData::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_node_list()) {
-      if (node_list_ != &::google::protobuf::internal::kEmptyString) {
-        node_list_->clear();
-      }
-    }
-    if (has_adjacency_matrix()) {
-      if (adjacency_matrix_ != &::google::protobuf::internal::kEmptyString) {
-        adjacency_matrix_->clear();
-      }
-    }
-    if (has_input_indices()) {
-      if (input_indices_ != &::google::protobuf::internal::kEmptyString) {
-        input_indices_->clear();
-      }
-    }
-  }
-  layers_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SpnData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:model.SpnData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.layers_.Clear();
+  _impl_.node_types_.Clear();
+  _impl_.node_inputs_.Clear();
+  _impl_.edge_children_.Clear();
+  _impl_.edge_parents_.Clear();
+  _impl_.edge_weights_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.node_list_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.adjacency_matrix_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.input_indices_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.log_space_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpnData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string node_list = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_node_list()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->node_list().data(), this->node_list().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_adjacency_matrix;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_list();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.SpnData.node_list");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string adjacency_matrix = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_adjacency_matrix:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_adjacency_matrix()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->adjacency_matrix().data(), this->adjacency_matrix().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_input_indices;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_adjacency_matrix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.SpnData.adjacency_matrix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string input_indices = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_input_indices:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_input_indices()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->input_indices().data(), this->input_indices().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_layers;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_input_indices();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.SpnData.input_indices");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .model.SpnLayerInit layers = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_layers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_layers()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_layers;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SpnData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_layers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool log_space = 5 [default = false];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_log_space(&has_bits);
+          _impl_.log_space_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 node_types = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_node_types(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_node_types(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 node_inputs = 7 [packed = true];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_node_inputs(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_node_inputs(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 edge_children = 8 [packed = true];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_edge_children(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_edge_children(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 edge_parents = 9 [packed = true];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_edge_parents(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_edge_parents(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float edge_weights = 10 [packed = true];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_edge_weights(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 85) {
+          _internal_add_edge_weights(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpnData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.SpnData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string node_list = 1;
-  if (has_node_list()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node_list().data(), this->node_list().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->node_list(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_node_list().data(), static_cast<int>(this->_internal_node_list().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.SpnData.node_list");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node_list(), target);
   }
 
   // optional string adjacency_matrix = 2;
-  if (has_adjacency_matrix()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->adjacency_matrix().data(), this->adjacency_matrix().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->adjacency_matrix(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_adjacency_matrix().data(), static_cast<int>(this->_internal_adjacency_matrix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.SpnData.adjacency_matrix");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_adjacency_matrix(), target);
   }
 
   // optional string input_indices = 3;
-  if (has_input_indices()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->input_indices().data(), this->input_indices().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->input_indices(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_input_indices().data(), static_cast<int>(this->_internal_input_indices().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.SpnData.input_indices");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_input_indices(), target);
   }
 
   // repeated .model.SpnLayerInit layers = 4;
-  for (int i = 0; i < this->layers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->layers(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_layers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_layers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional bool log_space = 5 [default = false];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_log_space(), target);
   }
-}
 
-::google::protobuf::uint8* SpnData::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string node_list = 1;
-  if (has_node_list()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->node_list().data(), this->node_list().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->node_list(), target);
+  // repeated int32 node_types = 6 [packed = true];
+  {
+    int byte_size = _impl_._node_types_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_node_types(), byte_size, target);
+    }
   }
 
-  // optional string adjacency_matrix = 2;
-  if (has_adjacency_matrix()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->adjacency_matrix().data(), this->adjacency_matrix().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->adjacency_matrix(), target);
+  // repeated int32 node_inputs = 7 [packed = true];
+  {
+    int byte_size = _impl_._node_inputs_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          7, _internal_node_inputs(), byte_size, target);
+    }
   }
 
-  // optional string input_indices = 3;
-  if (has_input_indices()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->input_indices().data(), this->input_indices().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->input_indices(), target);
+  // repeated int32 edge_children = 8 [packed = true];
+  {
+    int byte_size = _impl_._edge_children_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          8, _internal_edge_children(), byte_size, target);
+    }
   }
 
-  // repeated .model.SpnLayerInit layers = 4;
-  for (int i = 0; i < this->layers_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->layers(i), target);
+  // repeated int32 edge_parents = 9 [packed = true];
+  {
+    int byte_size = _impl_._edge_parents_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          9, _internal_edge_parents(), byte_size, target);
+    }
+  }
+
+  // repeated float edge_weights = 10 [packed = true];
+  if (this->_internal_edge_weights_size() > 0) {
+    target = stream->WriteFixedPacked(10, _internal_edge_weights(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.SpnData)
   return target;
 }
 
-int SpnData::ByteSize() const {
-  int total_size = 0;
+size_t SpnData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.SpnData)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string node_list = 1;
-    if (has_node_list()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->node_list());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    // optional string adjacency_matrix = 2;
-    if (has_adjacency_matrix()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->adjacency_matrix());
-    }
-
-    // optional string input_indices = 3;
-    if (has_input_indices()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->input_indices());
-    }
-
-  }
   // repeated .model.SpnLayerInit layers = 4;
-  total_size += 1 * this->layers_size();
-  for (int i = 0; i < this->layers_size(); i++) {
+  total_size += 1UL * this->_internal_layers_size();
+  for (const auto& msg : this->_impl_.layers_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->layers(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void SpnData::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SpnData* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SpnData*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // repeated int32 node_types = 6 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.node_types_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._node_types_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-}
 
-void SpnData::MergeFrom(const SpnData& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  layers_.MergeFrom(from.layers_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_node_list()) {
-      set_node_list(from.node_list());
-    }
-    if (from.has_adjacency_matrix()) {
-      set_adjacency_matrix(from.adjacency_matrix());
-    }
-    if (from.has_input_indices()) {
-      set_input_indices(from.input_indices());
+  // repeated int32 node_inputs = 7 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.node_inputs_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._node_inputs_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SpnData::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void SpnData::CopyFrom(const SpnData& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool SpnData::IsInitialized() const {
-
-  for (int i = 0; i < layers_size(); i++) {
-    if (!this->layers(i).IsInitialized()) return false;
+  // repeated int32 edge_children = 8 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.edge_children_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_children_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  return true;
-}
 
-void SpnData::Swap(SpnData* other) {
-  if (other != this) {
-    std::swap(node_list_, other->node_list_);
-    std::swap(adjacency_matrix_, other->adjacency_matrix_);
-    std::swap(input_indices_, other->input_indices_);
-    layers_.Swap(&other->layers_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+  // repeated int32 edge_parents = 9 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.edge_parents_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_parents_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-}
-
-::google::protobuf::Metadata SpnData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SpnData_descriptor_;
-  metadata.reflection = SpnData_reflection_;
-  return metadata;
-}
-
 
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* ModelData_ModelType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ModelData_ModelType_descriptor_;
-}
-bool ModelData_ModelType_IsValid(int value) {
-  switch(value) {
-    case 0:
-      return true;
-    default:
-      return false;
+  // repeated float edge_weights = 10 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_edge_weights_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
   }
-}
 
-#ifndef _MSC_VER
-const ModelData_ModelType ModelData::SPN;
-const ModelData_ModelType ModelData::ModelType_MIN;
-const ModelData_ModelType ModelData::ModelType_MAX;
-const int ModelData::ModelType_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int ModelData::kNameFieldNumber;
-const int ModelData::kModelTypeFieldNumber;
-const int ModelData::kSpnDataFieldNumber;
-const int ModelData::kHyperParamsFieldNumber;
-const int ModelData::kNodesFieldNumber;
-const int ModelData::kEdgesFieldNumber;
-const int ModelData::kTrainMetricsFieldNumber;
-const int ModelData::kValidMetricsFieldNumber;
-const int ModelData::kTestMetricsFieldNumber;
-const int ModelData::kValidMetricBestFieldNumber;
-const int ModelData::kTrainMetricEsFieldNumber;
-const int ModelData::kTestMetricEsFieldNumber;
-#endif  // !_MSC_VER
-
-ModelData::ModelData()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void ModelData::InitAsDefaultInstance() {
-  spn_data_ = const_cast< ::model::SpnData*>(&::model::SpnData::default_instance());
-  hyper_params_ = const_cast< ::model::Hyperparams*>(&::model::Hyperparams::default_instance());
-  train_metrics_ = const_cast< ::model::Metrics*>(&::model::Metrics::default_instance());
-  valid_metrics_ = const_cast< ::model::Metrics*>(&::model::Metrics::default_instance());
-  test_metrics_ = const_cast< ::model::Metrics*>(&::model::Metrics::default_instance());
-  valid_metric_best_ = const_cast< ::model::Metrics*>(&::model::Metrics::default_instance());
-  train_metric_es_ = const_cast< ::model::Metrics*>(&::model::Metrics::default_instance());
-  test_metric_es_ = const_cast< ::model::Metrics*>(&::model::Metrics::default_instance());
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string node_list = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_node_list());
+    }
 
-ModelData::ModelData(const ModelData& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
+    // optional string adjacency_matrix = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_adjacency_matrix());
+    }
 
-void ModelData::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  model_type_ = 0;
-  spn_data_ = NULL;
-  hyper_params_ = NULL;
-  train_metrics_ = NULL;
-  valid_metrics_ = NULL;
-  test_metrics_ = NULL;
-  valid_metric_best_ = NULL;
-  train_metric_es_ = NULL;
-  test_metric_es_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+    // optional string input_indices = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_input_indices());
+    }
 
-ModelData::~ModelData() {
-  SharedDtor();
-}
+    // optional bool log_space = 5 [default = false];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
 
-void ModelData::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-    delete spn_data_;
-    delete hyper_params_;
-    delete train_metrics_;
-    delete valid_metrics_;
-    delete test_metrics_;
-    delete valid_metric_best_;
-    delete train_metric_es_;
-    delete test_metric_es_;
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ModelData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ModelData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ModelData_descriptor_;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpnData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpnData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpnData::GetClassData() const { return &_class_data_; }
 
-const ModelData& ModelData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
 
-ModelData* ModelData::default_instance_ = NULL;
+void SpnData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpnData*>(&to_msg);
+  auto& from = static_cast<const SpnData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.SpnData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-ModelData* ModelData::New() const {
-  return new ModelData;
-}
-
-void ModelData::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    model_type_ = 0;
-    if (has_spn_data()) {
-      if (spn_data_ != NULL) spn_data_->::model::SpnData::Clear();
-    }
-    if (has_hyper_params()) {
-      if (hyper_params_ != NULL) hyper_params_->::model::Hyperparams::Clear();
-    }
-    if (has_train_metrics()) {
-      if (train_metrics_ != NULL) train_metrics_->::model::Metrics::Clear();
-    }
-    if (has_valid_metrics()) {
-      if (valid_metrics_ != NULL) valid_metrics_->::model::Metrics::Clear();
-    }
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (has_test_metrics()) {
-      if (test_metrics_ != NULL) test_metrics_->::model::Metrics::Clear();
+  _this->_impl_.layers_.MergeFrom(from._impl_.layers_);
+  _this->_impl_.node_types_.MergeFrom(from._impl_.node_types_);
+  _this->_impl_.node_inputs_.MergeFrom(from._impl_.node_inputs_);
+  _this->_impl_.edge_children_.MergeFrom(from._impl_.edge_children_);
+  _this->_impl_.edge_parents_.MergeFrom(from._impl_.edge_parents_);
+  _this->_impl_.edge_weights_.MergeFrom(from._impl_.edge_weights_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_node_list(from._internal_node_list());
     }
-    if (has_valid_metric_best()) {
-      if (valid_metric_best_ != NULL) valid_metric_best_->::model::Metrics::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_adjacency_matrix(from._internal_adjacency_matrix());
     }
-    if (has_train_metric_es()) {
-      if (train_metric_es_ != NULL) train_metric_es_->::model::Metrics::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_input_indices(from._internal_input_indices());
     }
-    if (has_test_metric_es()) {
-      if (test_metric_es_ != NULL) test_metric_es_->::model::Metrics::Clear();
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.log_space_ = from._impl_.log_space_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  nodes_.Clear();
-  edges_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-bool ModelData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_model_type;
-        break;
-      }
-
-      // required .model.ModelData.ModelType model_type = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_model_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::ModelData_ModelType_IsValid(value)) {
-            set_model_type(static_cast< ::model::ModelData_ModelType >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(2, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_spn_data;
-        break;
-      }
-
-      // optional .model.SpnData spn_data = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_spn_data:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_spn_data()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_hyper_params;
-        break;
-      }
-
-      // optional .model.Hyperparams hyper_params = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_hyper_params:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_hyper_params()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_nodes;
-        break;
-      }
-
-      // repeated .model.NodeData nodes = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_nodes:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_nodes()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_nodes;
-        if (input->ExpectTag(50)) goto parse_edges;
-        break;
-      }
-
-      // repeated .model.EdgeData edges = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_edges:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_edges()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_edges;
-        if (input->ExpectTag(58)) goto parse_train_metrics;
-        break;
-      }
-
-      // optional .model.Metrics train_metrics = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_train_metrics:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_train_metrics()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_valid_metrics;
-        break;
-      }
-
-      // optional .model.Metrics valid_metrics = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_valid_metrics:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_valid_metrics()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(74)) goto parse_test_metrics;
-        break;
-      }
+void SpnData::CopyFrom(const SpnData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.SpnData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // optional .model.Metrics test_metrics = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_test_metrics:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_test_metrics()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(82)) goto parse_valid_metric_best;
-        break;
-      }
+bool SpnData::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.layers_))
+    return false;
+  return true;
+}
 
-      // optional .model.Metrics valid_metric_best = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_valid_metric_best:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_valid_metric_best()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(90)) goto parse_train_metric_es;
-        break;
-      }
+void SpnData::InternalSwap(SpnData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.layers_.InternalSwap(&other->_impl_.layers_);
+  _impl_.node_types_.InternalSwap(&other->_impl_.node_types_);
+  _impl_.node_inputs_.InternalSwap(&other->_impl_.node_inputs_);
+  _impl_.edge_children_.InternalSwap(&other->_impl_.edge_children_);
+  _impl_.edge_parents_.InternalSwap(&other->_impl_.edge_parents_);
+  _impl_.edge_weights_.InternalSwap(&other->_impl_.edge_weights_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_list_, lhs_arena,
+      &other->_impl_.node_list_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.adjacency_matrix_, lhs_arena,
+      &other->_impl_.adjacency_matrix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.input_indices_, lhs_arena,
+      &other->_impl_.input_indices_, rhs_arena
+  );
+  swap(_impl_.log_space_, other->_impl_.log_space_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpnData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[6]);
+}
 
-      // optional .model.Metrics train_metric_es = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_train_metric_es:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_train_metric_es()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(98)) goto parse_test_metric_es;
-        break;
-      }
+// ===================================================================
 
-      // optional .model.Metrics test_metric_es = 12;
-      case 12: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_test_metric_es:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_test_metric_es()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+class ModelData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ModelData>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  return true;
-#undef DO_
-}
-
-void ModelData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  static void set_has_model_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
   }
-
-  // required .model.ModelData.ModelType model_type = 2;
-  if (has_model_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->model_type(), output);
+  static const ::model::SpnData& spn_data(const ModelData* msg);
+  static void set_has_spn_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-
-  // optional .model.SpnData spn_data = 3;
-  if (has_spn_data()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->spn_data(), output);
+  static const ::model::Hyperparams& hyper_params(const ModelData* msg);
+  static void set_has_hyper_params(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-
-  // optional .model.Hyperparams hyper_params = 4;
-  if (has_hyper_params()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->hyper_params(), output);
+  static const ::model::Metrics& train_metrics(const ModelData* msg);
+  static void set_has_train_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-
-  // repeated .model.NodeData nodes = 5;
-  for (int i = 0; i < this->nodes_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->nodes(i), output);
+  static const ::model::Metrics& valid_metrics(const ModelData* msg);
+  static void set_has_valid_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
   }
-
-  // repeated .model.EdgeData edges = 6;
-  for (int i = 0; i < this->edges_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->edges(i), output);
+  static const ::model::Metrics& test_metrics(const ModelData* msg);
+  static void set_has_test_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
-
-  // optional .model.Metrics train_metrics = 7;
-  if (has_train_metrics()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->train_metrics(), output);
+  static const ::model::Metrics& valid_metric_best(const ModelData* msg);
+  static void set_has_valid_metric_best(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
   }
-
-  // optional .model.Metrics valid_metrics = 8;
-  if (has_valid_metrics()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->valid_metrics(), output);
+  static const ::model::Metrics& train_metric_es(const ModelData* msg);
+  static void set_has_train_metric_es(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
   }
-
-  // optional .model.Metrics test_metrics = 9;
-  if (has_test_metrics()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, this->test_metrics(), output);
+  static const ::model::Metrics& test_metric_es(const ModelData* msg);
+  static void set_has_test_metric_es(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
   }
-
-  // optional .model.Metrics valid_metric_best = 10;
-  if (has_valid_metric_best()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->valid_metric_best(), output);
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000201) ^ 0x00000201) != 0;
   }
+};
 
-  // optional .model.Metrics train_metric_es = 11;
-  if (has_train_metric_es()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->train_metric_es(), output);
-  }
+const ::model::SpnData&
+ModelData::_Internal::spn_data(const ModelData* msg) {
+  return *msg->_impl_.spn_data_;
+}
+const ::model::Hyperparams&
+ModelData::_Internal::hyper_params(const ModelData* msg) {
+  return *msg->_impl_.hyper_params_;
+}
+const ::model::Metrics&
+ModelData::_Internal::train_metrics(const ModelData* msg) {
+  return *msg->_impl_.train_metrics_;
+}
+const ::model::Metrics&
+ModelData::_Internal::valid_metrics(const ModelData* msg) {
+  return *msg->_impl_.valid_metrics_;
+}
+const ::model::Metrics&
+ModelData::_Internal::test_metrics(const ModelData* msg) {
+  return *msg->_impl_.test_metrics_;
+}
+const ::model::Metrics&
+ModelData::_Internal::valid_metric_best(const ModelData* msg) {
+  return *msg->_impl_.valid_metric_best_;
+}
+const ::model::Metrics&
+ModelData::_Internal::train_metric_es(const ModelData* msg) {
+  return *msg->_impl_.train_metric_es_;
+}
+const ::model::Metrics&
+ModelData::_Internal::test_metric_es(const ModelData* msg) {
+  return *msg->_impl_.test_metric_es_;
+}
+ModelData::ModelData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.ModelData)
+}
+ModelData::ModelData(const ModelData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModelData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_){from._impl_.nodes_}
+    , decltype(_impl_.edges_){from._impl_.edges_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.spn_data_){nullptr}
+    , decltype(_impl_.hyper_params_){nullptr}
+    , decltype(_impl_.train_metrics_){nullptr}
+    , decltype(_impl_.valid_metrics_){nullptr}
+    , decltype(_impl_.test_metrics_){nullptr}
+    , decltype(_impl_.valid_metric_best_){nullptr}
+    , decltype(_impl_.train_metric_es_){nullptr}
+    , decltype(_impl_.test_metric_es_){nullptr}
+    , decltype(_impl_.model_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_spn_data()) {
+    _this->_impl_.spn_data_ = new ::model::SpnData(*from._impl_.spn_data_);
+  }
+  if (from._internal_has_hyper_params()) {
+    _this->_impl_.hyper_params_ = new ::model::Hyperparams(*from._impl_.hyper_params_);
+  }
+  if (from._internal_has_train_metrics()) {
+    _this->_impl_.train_metrics_ = new ::model::Metrics(*from._impl_.train_metrics_);
+  }
+  if (from._internal_has_valid_metrics()) {
+    _this->_impl_.valid_metrics_ = new ::model::Metrics(*from._impl_.valid_metrics_);
+  }
+  if (from._internal_has_test_metrics()) {
+    _this->_impl_.test_metrics_ = new ::model::Metrics(*from._impl_.test_metrics_);
+  }
+  if (from._internal_has_valid_metric_best()) {
+    _this->_impl_.valid_metric_best_ = new ::model::Metrics(*from._impl_.valid_metric_best_);
+  }
+  if (from._internal_has_train_metric_es()) {
+    _this->_impl_.train_metric_es_ = new ::model::Metrics(*from._impl_.train_metric_es_);
+  }
+  if (from._internal_has_test_metric_es()) {
+    _this->_impl_.test_metric_es_ = new ::model::Metrics(*from._impl_.test_metric_es_);
+  }
+  _this->_impl_.model_type_ = from._impl_.model_type_;
+  // @@protoc_insertion_point(copy_constructor:model.ModelData)
+}
+
+inline void ModelData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_){arena}
+    , decltype(_impl_.edges_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.spn_data_){nullptr}
+    , decltype(_impl_.hyper_params_){nullptr}
+    , decltype(_impl_.train_metrics_){nullptr}
+    , decltype(_impl_.valid_metrics_){nullptr}
+    , decltype(_impl_.test_metrics_){nullptr}
+    , decltype(_impl_.valid_metric_best_){nullptr}
+    , decltype(_impl_.train_metric_es_){nullptr}
+    , decltype(_impl_.test_metric_es_){nullptr}
+    , decltype(_impl_.model_type_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-  // optional .model.Metrics test_metric_es = 12;
-  if (has_test_metric_es()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      12, this->test_metric_es(), output);
+ModelData::~ModelData() {
+  // @@protoc_insertion_point(destructor:model.ModelData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+inline void ModelData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
+  _impl_.edges_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.spn_data_;
+  if (this != internal_default_instance()) delete _impl_.hyper_params_;
+  if (this != internal_default_instance()) delete _impl_.train_metrics_;
+  if (this != internal_default_instance()) delete _impl_.valid_metrics_;
+  if (this != internal_default_instance()) delete _impl_.test_metrics_;
+  if (this != internal_default_instance()) delete _impl_.valid_metric_best_;
+  if (this != internal_default_instance()) delete _impl_.train_metric_es_;
+  if (this != internal_default_instance()) delete _impl_.test_metric_es_;
+}
+
+void ModelData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-::google::protobuf::uint8* ModelData::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+void ModelData::Clear() {
+// @@protoc_insertion_point(message_clear_start:model.ModelData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _impl_.edges_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.spn_data_ != nullptr);
+      _impl_.spn_data_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.hyper_params_ != nullptr);
+      _impl_.hyper_params_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.train_metrics_ != nullptr);
+      _impl_.train_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.valid_metrics_ != nullptr);
+      _impl_.valid_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.test_metrics_ != nullptr);
+      _impl_.test_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.valid_metric_best_ != nullptr);
+      _impl_.valid_metric_best_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.train_metric_es_ != nullptr);
+      _impl_.train_metric_es_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    GOOGLE_DCHECK(_impl_.test_metric_es_ != nullptr);
+    _impl_.test_metric_es_->Clear();
+  }
+  _impl_.model_type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ModelData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.ModelData.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .model.ModelData.ModelType model_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::ModelData_ModelType_IsValid(val))) {
+            _internal_set_model_type(static_cast<::model::ModelData_ModelType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.SpnData spn_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spn_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Hyperparams hyper_params = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hyper_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .model.NodeData nodes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .model.EdgeData edges = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_edges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Metrics train_metrics = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_train_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Metrics valid_metrics = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_valid_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Metrics test_metrics = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_test_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Metrics valid_metric_best = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_valid_metric_best(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Metrics train_metric_es = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_train_metric_es(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Metrics test_metric_es = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_test_metric_es(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ModelData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.ModelData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.ModelData.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // required .model.ModelData.ModelType model_type = 2;
-  if (has_model_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->model_type(), target);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_model_type(), target);
   }
 
   // optional .model.SpnData spn_data = 3;
-  if (has_spn_data()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->spn_data(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::spn_data(this),
+        _Internal::spn_data(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Hyperparams hyper_params = 4;
-  if (has_hyper_params()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->hyper_params(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::hyper_params(this),
+        _Internal::hyper_params(this).GetCachedSize(), target, stream);
   }
 
   // repeated .model.NodeData nodes = 5;
-  for (int i = 0; i < this->nodes_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->nodes(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .model.EdgeData edges = 6;
-  for (int i = 0; i < this->edges_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->edges(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_edges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_edges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional .model.Metrics train_metrics = 7;
-  if (has_train_metrics()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->train_metrics(), target);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::train_metrics(this),
+        _Internal::train_metrics(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Metrics valid_metrics = 8;
-  if (has_valid_metrics()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        8, this->valid_metrics(), target);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::valid_metrics(this),
+        _Internal::valid_metrics(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Metrics test_metrics = 9;
-  if (has_test_metrics()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        9, this->test_metrics(), target);
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::test_metrics(this),
+        _Internal::test_metrics(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Metrics valid_metric_best = 10;
-  if (has_valid_metric_best()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        10, this->valid_metric_best(), target);
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::valid_metric_best(this),
+        _Internal::valid_metric_best(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Metrics train_metric_es = 11;
-  if (has_train_metric_es()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        11, this->train_metric_es(), target);
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::train_metric_es(this),
+        _Internal::train_metric_es(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Metrics test_metric_es = 12;
-  if (has_test_metric_es()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        12, this->test_metric_es(), target);
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::test_metric_es(this),
+        _Internal::test_metric_es(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.ModelData)
   return target;
 }
 
-int ModelData::ByteSize() const {
-  int total_size = 0;
+size_t ModelData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:model.ModelData)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_name()) {
     // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
 
+  if (_internal_has_model_type()) {
     // required .model.ModelData.ModelType model_type = 2;
-    if (has_model_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->model_type());
-    }
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_model_type());
+  }
+
+  return total_size;
+}
+size_t ModelData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.ModelData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000201) ^ 0x00000201) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
 
+    // required .model.ModelData.ModelType model_type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_model_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .model.NodeData nodes = 5;
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .model.EdgeData edges = 6;
+  total_size += 1UL * this->_internal_edges_size();
+  for (const auto& msg : this->_impl_.edges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000feu) {
     // optional .model.SpnData spn_data = 3;
-    if (has_spn_data()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->spn_data());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.spn_data_);
     }
 
     // optional .model.Hyperparams hyper_params = 4;
-    if (has_hyper_params()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->hyper_params());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hyper_params_);
     }
 
     // optional .model.Metrics train_metrics = 7;
-    if (has_train_metrics()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->train_metrics());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.train_metrics_);
     }
 
     // optional .model.Metrics valid_metrics = 8;
-    if (has_valid_metrics()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->valid_metrics());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.valid_metrics_);
     }
 
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
     // optional .model.Metrics test_metrics = 9;
-    if (has_test_metrics()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->test_metrics());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.test_metrics_);
     }
 
     // optional .model.Metrics valid_metric_best = 10;
-    if (has_valid_metric_best()) {
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->valid_metric_best());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.valid_metric_best_);
     }
 
     // optional .model.Metrics train_metric_es = 11;
-    if (has_train_metric_es()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->train_metric_es());
-    }
-
-    // optional .model.Metrics test_metric_es = 12;
-    if (has_test_metric_es()) {
+    if (cached_has_bits & 0x00000080u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->test_metric_es());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.train_metric_es_);
     }
 
   }
-  // repeated .model.NodeData nodes = 5;
-  total_size += 1 * this->nodes_size();
-  for (int i = 0; i < this->nodes_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->nodes(i));
-  }
-
-  // repeated .model.EdgeData edges = 6;
-  total_size += 1 * this->edges_size();
-  for (int i = 0; i < this->edges_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->edges(i));
+  // optional .model.Metrics test_metric_es = 12;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.test_metric_es_);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ModelData::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const ModelData* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ModelData*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModelData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModelData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModelData::GetClassData() const { return &_class_data_; }
+
+
+void ModelData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModelData*>(&to_msg);
+  auto& from = static_cast<const ModelData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.ModelData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ModelData::MergeFrom(const ModelData& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  nodes_.MergeFrom(from.nodes_);
-  edges_.MergeFrom(from.edges_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  _this->_impl_.edges_.MergeFrom(from._impl_.edges_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_model_type()) {
-      set_model_type(from.model_type());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_spn_data()->::model::SpnData::MergeFrom(
+          from._internal_spn_data());
     }
-    if (from.has_spn_data()) {
-      mutable_spn_data()->::model::SpnData::MergeFrom(from.spn_data());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_hyper_params()->::model::Hyperparams::MergeFrom(
+          from._internal_hyper_params());
     }
-    if (from.has_hyper_params()) {
-      mutable_hyper_params()->::model::Hyperparams::MergeFrom(from.hyper_params());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_train_metrics()->::model::Metrics::MergeFrom(
+          from._internal_train_metrics());
     }
-    if (from.has_train_metrics()) {
-      mutable_train_metrics()->::model::Metrics::MergeFrom(from.train_metrics());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_valid_metrics()->::model::Metrics::MergeFrom(
+          from._internal_valid_metrics());
     }
-    if (from.has_valid_metrics()) {
-      mutable_valid_metrics()->::model::Metrics::MergeFrom(from.valid_metrics());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_test_metrics()->::model::Metrics::MergeFrom(
+          from._internal_test_metrics());
     }
-  }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_test_metrics()) {
-      mutable_test_metrics()->::model::Metrics::MergeFrom(from.test_metrics());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_valid_metric_best()->::model::Metrics::MergeFrom(
+          from._internal_valid_metric_best());
     }
-    if (from.has_valid_metric_best()) {
-      mutable_valid_metric_best()->::model::Metrics::MergeFrom(from.valid_metric_best());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_train_metric_es()->::model::Metrics::MergeFrom(
+          from._internal_train_metric_es());
     }
-    if (from.has_train_metric_es()) {
-      mutable_train_metric_es()->::model::Metrics::MergeFrom(from.train_metric_es());
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_test_metric_es()->::model::Metrics::MergeFrom(
+          from._internal_test_metric_es());
     }
-    if (from.has_test_metric_es()) {
-      mutable_test_metric_es()->::model::Metrics::MergeFrom(from.test_metric_es());
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.model_type_ = from._impl_.model_type_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void ModelData::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ModelData::CopyFrom(const ModelData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.ModelData)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool ModelData::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
-  if (has_spn_data()) {
-    if (!this->spn_data().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.nodes_))
+    return false;
+  if (_internal_has_spn_data()) {
+    if (!_impl_.spn_data_->IsInitialized()) return false;
   }
-  for (int i = 0; i < nodes_size(); i++) {
-    if (!this->nodes(i).IsInitialized()) return false;
+  if (_internal_has_train_metrics()) {
+    if (!_impl_.train_metrics_->IsInitialized()) return false;
   }
-  if (has_train_metrics()) {
-    if (!this->train_metrics().IsInitialized()) return false;
+  if (_internal_has_valid_metrics()) {
+    if (!_impl_.valid_metrics_->IsInitialized()) return false;
   }
-  if (has_valid_metrics()) {
-    if (!this->valid_metrics().IsInitialized()) return false;
+  if (_internal_has_test_metrics()) {
+    if (!_impl_.test_metrics_->IsInitialized()) return false;
   }
-  if (has_test_metrics()) {
-    if (!this->test_metrics().IsInitialized()) return false;
+  if (_internal_has_valid_metric_best()) {
+    if (!_impl_.valid_metric_best_->IsInitialized()) return false;
   }
-  if (has_valid_metric_best()) {
-    if (!this->valid_metric_best().IsInitialized()) return false;
+  if (_internal_has_train_metric_es()) {
+    if (!_impl_.train_metric_es_->IsInitialized()) return false;
   }
-  if (has_train_metric_es()) {
-    if (!this->train_metric_es().IsInitialized()) return false;
-  }
-  if (has_test_metric_es()) {
-    if (!this->test_metric_es().IsInitialized()) return false;
+  if (_internal_has_test_metric_es()) {
+    if (!_impl_.test_metric_es_->IsInitialized()) return false;
   }
   return true;
 }
 
-void ModelData::Swap(ModelData* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(model_type_, other->model_type_);
-    std::swap(spn_data_, other->spn_data_);
-    std::swap(hyper_params_, other->hyper_params_);
-    nodes_.Swap(&other->nodes_);
-    edges_.Swap(&other->edges_);
-    std::swap(train_metrics_, other->train_metrics_);
-    std::swap(valid_metrics_, other->valid_metrics_);
-    std::swap(test_metrics_, other->test_metrics_);
-    std::swap(valid_metric_best_, other->valid_metric_best_);
-    std::swap(train_metric_es_, other->train_metric_es_);
-    std::swap(test_metric_es_, other->test_metric_es_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata ModelData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ModelData_descriptor_;
-  metadata.reflection = ModelData_reflection_;
-  return metadata;
+void ModelData::InternalSwap(ModelData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
+  _impl_.edges_.InternalSwap(&other->_impl_.edges_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ModelData, _impl_.model_type_)
+      + sizeof(ModelData::_impl_.model_type_)
+      - PROTOBUF_FIELD_OFFSET(ModelData, _impl_.spn_data_)>(
+          reinterpret_cast<char*>(&_impl_.spn_data_),
+          reinterpret_cast<char*>(&other->_impl_.spn_data_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ModelData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[7]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Operation_Optimizer_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Operation_Optimizer_descriptor_;
-}
-bool Operation_Optimizer_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
-    case 4:
-    case 5:
-      return true;
-    default:
-      return false;
+class Operation_StopCondition::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Operation_StopCondition>()._impl_._has_bits_);
+  static void set_has_all_processed(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const Operation_Optimizer Operation::GRADIENT_DESCENT;
-const Operation_Optimizer Operation::HARD_GRADIENT_DESCENT;
-const Operation_Optimizer Operation::EM;
-const Operation_Optimizer Operation::HARD_EM;
-const Operation_Optimizer Operation::CD;
-const Operation_Optimizer Operation::PCD;
-const Operation_Optimizer Operation::Optimizer_MIN;
-const Operation_Optimizer Operation::Optimizer_MAX;
-const int Operation::Optimizer_ARRAYSIZE;
-#endif  // _MSC_VER
-const ::google::protobuf::EnumDescriptor* Operation_OperationType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Operation_OperationType_descriptor_;
-}
-bool Operation_OperationType_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-      return true;
-    default:
-      return false;
+  static void set_has_steps(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
-
-#ifndef _MSC_VER
-const Operation_OperationType Operation::TRAIN;
-const Operation_OperationType Operation::TEST;
-const Operation_OperationType Operation::OperationType_MIN;
-const Operation_OperationType Operation::OperationType_MAX;
-const int Operation::OperationType_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Operation_StopCondition::kAllProcessedFieldNumber;
-const int Operation_StopCondition::kStepsFieldNumber;
-#endif  // !_MSC_VER
-
-Operation_StopCondition::Operation_StopCondition()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+};
 
-void Operation_StopCondition::InitAsDefaultInstance() {
+Operation_StopCondition::Operation_StopCondition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.Operation.StopCondition)
 }
-
 Operation_StopCondition::Operation_StopCondition(const Operation_StopCondition& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Operation_StopCondition::SharedCtor() {
-  _cached_size_ = 0;
-  all_processed_ = true;
-  steps_ = 10000;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Operation_StopCondition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.all_processed_){}
+    , decltype(_impl_.steps_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.all_processed_, &from._impl_.all_processed_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.steps_) -
+    reinterpret_cast<char*>(&_impl_.all_processed_)) + sizeof(_impl_.steps_));
+  // @@protoc_insertion_point(copy_constructor:model.Operation.StopCondition)
+}
+
+inline void Operation_StopCondition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.all_processed_){true}
+    , decltype(_impl_.steps_){10000}
+  };
 }
 
 Operation_StopCondition::~Operation_StopCondition() {
+  // @@protoc_insertion_point(destructor:model.Operation.StopCondition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Operation_StopCondition::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Operation_StopCondition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Operation_StopCondition::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Operation_StopCondition::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Operation_StopCondition_descriptor_;
-}
-
-const Operation_StopCondition& Operation_StopCondition::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-Operation_StopCondition* Operation_StopCondition::default_instance_ = NULL;
-
-Operation_StopCondition* Operation_StopCondition::New() const {
-  return new Operation_StopCondition;
+  _impl_._cached_size_.Set(size);
 }
 
 void Operation_StopCondition::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    all_processed_ = true;
-    steps_ = 10000;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Operation_StopCondition::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:model.Operation.StopCondition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.all_processed_ = true;
+    _impl_.steps_ = 10000;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Operation_StopCondition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional bool all_processed = 1 [default = true];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &all_processed_)));
-          set_has_all_processed();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_steps;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_all_processed(&has_bits);
+          _impl_.all_processed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 steps = 2 [default = 10000];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_steps:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &steps_)));
-          set_has_steps();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Operation_StopCondition::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional bool all_processed = 1 [default = true];
-  if (has_all_processed()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->all_processed(), output);
-  }
-
-  // optional int32 steps = 2 [default = 10000];
-  if (has_steps()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->steps(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Operation_StopCondition::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_steps(&has_bits);
+          _impl_.steps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Operation_StopCondition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.Operation.StopCondition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional bool all_processed = 1 [default = true];
-  if (has_all_processed()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->all_processed(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_all_processed(), target);
   }
 
   // optional int32 steps = 2 [default = 10000];
-  if (has_steps()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->steps(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_steps(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.Operation.StopCondition)
   return target;
 }
 
-int Operation_StopCondition::ByteSize() const {
-  int total_size = 0;
+size_t Operation_StopCondition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.Operation.StopCondition)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional bool all_processed = 1 [default = true];
-    if (has_all_processed()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 + 1;
     }
 
     // optional int32 steps = 2 [default = 10000];
-    if (has_steps()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->steps());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_steps());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Operation_StopCondition::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Operation_StopCondition* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Operation_StopCondition*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Operation_StopCondition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Operation_StopCondition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Operation_StopCondition::GetClassData() const { return &_class_data_; }
 
-void Operation_StopCondition::MergeFrom(const Operation_StopCondition& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_all_processed()) {
-      set_all_processed(from.all_processed());
+
+void Operation_StopCondition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Operation_StopCondition*>(&to_msg);
+  auto& from = static_cast<const Operation_StopCondition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.Operation.StopCondition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.all_processed_ = from._impl_.all_processed_;
     }
-    if (from.has_steps()) {
-      set_steps(from.steps());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.steps_ = from._impl_.steps_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Operation_StopCondition::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Operation_StopCondition::CopyFrom(const Operation_StopCondition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.Operation.StopCondition)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Operation_StopCondition::IsInitialized() const {
-
   return true;
 }
 
-void Operation_StopCondition::Swap(Operation_StopCondition* other) {
-  if (other != this) {
-    std::swap(all_processed_, other->all_processed_);
-    std::swap(steps_, other->steps_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Operation_StopCondition::InternalSwap(Operation_StopCondition* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.all_processed_, other->_impl_.all_processed_);
+  swap(_impl_.steps_, other->_impl_.steps_);
 }
 
-::google::protobuf::Metadata Operation_StopCondition::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Operation_StopCondition_descriptor_;
-  metadata.reflection = Operation_StopCondition_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Operation_StopCondition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[8]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-::std::string* Operation::_default_name_ = NULL;
-#ifndef _MSC_VER
-const int Operation::kNameFieldNumber;
-const int Operation::kOptimizerFieldNumber;
-const int Operation::kStopConditionFieldNumber;
-const int Operation::kOperationTypeFieldNumber;
-const int Operation::kBatchSizeFieldNumber;
-const int Operation::kDataProtoFieldNumber;
-const int Operation::kEvalAfterFieldNumber;
-const int Operation::kCheckpointAfterFieldNumber;
-const int Operation::kCheckpointDirectoryFieldNumber;
-const int Operation::kRandomizeFieldNumber;
-const int Operation::kRandomSeedFieldNumber;
-const int Operation::kVerboseFieldNumber;
-const int Operation::kNormalizeEachTrainStepFieldNumber;
-#endif  // !_MSC_VER
+class Operation::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Operation>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_optimizer(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::model::Operation_StopCondition& stop_condition(const Operation* msg);
+  static void set_has_stop_condition(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_operation_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_batch_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_data_proto(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_eval_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_checkpoint_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_checkpoint_directory(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_randomize(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_random_seed(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_verbose(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_normalize_each_train_step(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_shard_rank(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_shard_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_thread_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_parallel_mode(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_prune_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_simplify(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-Operation::Operation()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::model::Operation_StopCondition&
+Operation::_Internal::stop_condition(const Operation* msg) {
+  return *msg->_impl_.stop_condition_;
 }
-
-void Operation::InitAsDefaultInstance() {
-  stop_condition_ = const_cast< ::model::Operation_StopCondition*>(&::model::Operation_StopCondition::default_instance());
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString Operation::Impl_::_i_give_permission_to_break_this_code_default_name_{{{"operation", 9}}, {nullptr}};
+Operation::Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.Operation)
 }
-
 Operation::Operation(const Operation& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Operation::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(_default_name_);
-  optimizer_ = 0;
-  stop_condition_ = NULL;
-  operation_type_ = 0;
-  batch_size_ = 100;
-  data_proto_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  eval_after_ = 500;
-  checkpoint_after_ = 1000;
-  checkpoint_directory_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  randomize_ = false;
-  random_seed_ = 42;
-  verbose_ = true;
-  normalize_each_train_step_ = true;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Operation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.data_proto_){}
+    , decltype(_impl_.checkpoint_directory_){}
+    , decltype(_impl_.stop_condition_){nullptr}
+    , decltype(_impl_.optimizer_){}
+    , decltype(_impl_.operation_type_){}
+    , decltype(_impl_.shard_rank_){}
+    , decltype(_impl_.randomize_){}
+    , decltype(_impl_.simplify_){}
+    , decltype(_impl_.parallel_mode_){}
+    , decltype(_impl_.prune_threshold_){}
+    , decltype(_impl_.thread_count_){}
+    , decltype(_impl_.batch_size_){}
+    , decltype(_impl_.eval_after_){}
+    , decltype(_impl_.checkpoint_after_){}
+    , decltype(_impl_.random_seed_){}
+    , decltype(_impl_.verbose_){}
+    , decltype(_impl_.normalize_each_train_step_){}
+    , decltype(_impl_.shard_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_proto_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_proto_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data_proto()) {
+    _this->_impl_.data_proto_.Set(from._internal_data_proto(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.checkpoint_directory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.checkpoint_directory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_checkpoint_directory()) {
+    _this->_impl_.checkpoint_directory_.Set(from._internal_checkpoint_directory(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_stop_condition()) {
+    _this->_impl_.stop_condition_ = new ::model::Operation_StopCondition(*from._impl_.stop_condition_);
+  }
+  ::memcpy(&_impl_.optimizer_, &from._impl_.optimizer_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_count_) -
+    reinterpret_cast<char*>(&_impl_.optimizer_)) + sizeof(_impl_.shard_count_));
+  // @@protoc_insertion_point(copy_constructor:model.Operation)
+}
+
+inline void Operation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.data_proto_){}
+    , decltype(_impl_.checkpoint_directory_){}
+    , decltype(_impl_.stop_condition_){nullptr}
+    , decltype(_impl_.optimizer_){0}
+    , decltype(_impl_.operation_type_){0}
+    , decltype(_impl_.shard_rank_){0}
+    , decltype(_impl_.randomize_){false}
+    , decltype(_impl_.simplify_){false}
+    , decltype(_impl_.parallel_mode_){0}
+    , decltype(_impl_.prune_threshold_){0}
+    , decltype(_impl_.thread_count_){1}
+    , decltype(_impl_.batch_size_){100}
+    , decltype(_impl_.eval_after_){500}
+    , decltype(_impl_.checkpoint_after_){1000}
+    , decltype(_impl_.random_seed_){42}
+    , decltype(_impl_.verbose_){true}
+    , decltype(_impl_.normalize_each_train_step_){true}
+    , decltype(_impl_.shard_count_){1}
+  };
+  _impl_.name_.InitDefault();
+  _impl_.data_proto_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_proto_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.checkpoint_directory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.checkpoint_directory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Operation::~Operation() {
+  // @@protoc_insertion_point(destructor:model.Operation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Operation::SharedDtor() {
-  if (name_ != _default_name_) {
-    delete name_;
-  }
-  if (data_proto_ != &::google::protobuf::internal::kEmptyString) {
-    delete data_proto_;
-  }
-  if (checkpoint_directory_ != &::google::protobuf::internal::kEmptyString) {
-    delete checkpoint_directory_;
-  }
-  if (this != default_instance_) {
-    delete stop_condition_;
-  }
+inline void Operation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.data_proto_.Destroy();
+  _impl_.checkpoint_directory_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.stop_condition_;
 }
 
 void Operation::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Operation::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Operation_descriptor_;
-}
-
-const Operation& Operation::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-Operation* Operation::default_instance_ = NULL;
-
-Operation* Operation::New() const {
-  return new Operation;
+  _impl_._cached_size_.Set(size);
 }
 
 void Operation::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != _default_name_) {
-        name_->assign(*_default_name_);
-      }
-    }
-    optimizer_ = 0;
-    if (has_stop_condition()) {
-      if (stop_condition_ != NULL) stop_condition_->::model::Operation_StopCondition::Clear();
-    }
-    operation_type_ = 0;
-    batch_size_ = 100;
-    if (has_data_proto()) {
-      if (data_proto_ != &::google::protobuf::internal::kEmptyString) {
-        data_proto_->clear();
-      }
-    }
-    eval_after_ = 500;
-    checkpoint_after_ = 1000;
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (has_checkpoint_directory()) {
-      if (checkpoint_directory_ != &::google::protobuf::internal::kEmptyString) {
-        checkpoint_directory_->clear();
-      }
-    }
-    randomize_ = false;
-    random_seed_ = 42;
-    verbose_ = true;
-    normalize_each_train_step_ = true;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Operation::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:model.Operation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearToDefault(::model::Operation::Impl_::_i_give_permission_to_break_this_code_default_name_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.data_proto_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.checkpoint_directory_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.stop_condition_ != nullptr);
+      _impl_.stop_condition_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.optimizer_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.randomize_) -
+        reinterpret_cast<char*>(&_impl_.optimizer_)) + sizeof(_impl_.randomize_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.simplify_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.prune_threshold_) -
+        reinterpret_cast<char*>(&_impl_.simplify_)) + sizeof(_impl_.prune_threshold_));
+    _impl_.thread_count_ = 1;
+    _impl_.batch_size_ = 100;
+    _impl_.eval_after_ = 500;
+    _impl_.checkpoint_after_ = 1000;
+    _impl_.random_seed_ = 42;
+  }
+  if (cached_has_bits & 0x00070000u) {
+    _impl_.verbose_ = true;
+    _impl_.normalize_each_train_step_ = true;
+    _impl_.shard_count_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Operation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1 [default = "operation"];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_optimizer;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.Operation.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_optimizer:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::Operation_Optimizer_IsValid(value)) {
-            set_optimizer(static_cast< ::model::Operation_Optimizer >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::Operation_Optimizer_IsValid(val))) {
+            _internal_set_optimizer(static_cast<::model::Operation_Optimizer>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_stop_condition;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Operation.StopCondition stop_condition = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_stop_condition:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_stop_condition()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_operation_type;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stop_condition(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_operation_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::Operation_OperationType_IsValid(value)) {
-            set_operation_type(static_cast< ::model::Operation_OperationType >(value));
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::Operation_OperationType_IsValid(val))) {
+            _internal_set_operation_type(static_cast<::model::Operation_OperationType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(4, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_batch_size;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 batch_size = 5 [default = 100];
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_batch_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &batch_size_)));
-          set_has_batch_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_data_proto;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_batch_size(&has_bits);
+          _impl_.batch_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string data_proto = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_data_proto:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_data_proto()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->data_proto().data(), this->data_proto().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(56)) goto parse_eval_after;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_data_proto();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.Operation.data_proto");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 eval_after = 7 [default = 500];
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_eval_after:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &eval_after_)));
-          set_has_eval_after();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_checkpoint_after;
-        break;
-      }
-
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_eval_after(&has_bits);
+          _impl_.eval_after_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 checkpoint_after = 8 [default = 1000];
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_checkpoint_after:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &checkpoint_after_)));
-          set_has_checkpoint_after();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(74)) goto parse_checkpoint_directory;
-        break;
-      }
-
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_checkpoint_after(&has_bits);
+          _impl_.checkpoint_after_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string checkpoint_directory = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_checkpoint_directory:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_checkpoint_directory()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->checkpoint_directory().data(), this->checkpoint_directory().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(80)) goto parse_randomize;
-        break;
-      }
-
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_checkpoint_directory();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.Operation.checkpoint_directory");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool randomize = 10 [default = false];
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_randomize:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &randomize_)));
-          set_has_randomize();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(88)) goto parse_random_seed;
-        break;
-      }
-
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_randomize(&has_bits);
+          _impl_.randomize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 random_seed = 11 [default = 42];
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_random_seed:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &random_seed_)));
-          set_has_random_seed();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(96)) goto parse_verbose;
-        break;
-      }
-
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_random_seed(&has_bits);
+          _impl_.random_seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool verbose = 12 [default = true];
-      case 12: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_verbose:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &verbose_)));
-          set_has_verbose();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(104)) goto parse_normalize_each_train_step;
-        break;
-      }
-
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_verbose(&has_bits);
+          _impl_.verbose_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool normalize_each_train_step = 13 [default = true];
-      case 13: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_normalize_each_train_step:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &normalize_each_train_step_)));
-          set_has_normalize_each_train_step();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Operation::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_normalize_each_train_step(&has_bits);
+          _impl_.normalize_each_train_step_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 shard_rank = 14 [default = 0];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_shard_rank(&has_bits);
+          _impl_.shard_rank_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 shard_count = 15 [default = 1];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_shard_count(&has_bits);
+          _impl_.shard_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 thread_count = 16 [default = 1];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_thread_count(&has_bits);
+          _impl_.thread_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.Operation.ParallelMode parallel_mode = 17 [default = NODE_LEVELS];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::Operation_ParallelMode_IsValid(val))) {
+            _internal_set_parallel_mode(static_cast<::model::Operation_ParallelMode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(17, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float prune_threshold = 18 [default = 0];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 149)) {
+          _Internal::set_has_prune_threshold(&has_bits);
+          _impl_.prune_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool simplify = 19 [default = false];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_simplify(&has_bits);
+          _impl_.simplify_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Operation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.Operation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1 [default = "operation"];
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.Operation.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
-  if (has_optimizer()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->optimizer(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_optimizer(), target);
   }
 
   // optional .model.Operation.StopCondition stop_condition = 3;
-  if (has_stop_condition()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->stop_condition(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::stop_condition(this),
+        _Internal::stop_condition(this).GetCachedSize(), target, stream);
   }
 
   // optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
-  if (has_operation_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->operation_type(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_operation_type(), target);
   }
 
   // optional int32 batch_size = 5 [default = 100];
-  if (has_batch_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->batch_size(), output);
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_batch_size(), target);
   }
 
   // optional string data_proto = 6;
-  if (has_data_proto()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->data_proto().data(), this->data_proto().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      6, this->data_proto(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_data_proto().data(), static_cast<int>(this->_internal_data_proto().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.Operation.data_proto");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_data_proto(), target);
   }
 
   // optional int32 eval_after = 7 [default = 500];
-  if (has_eval_after()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->eval_after(), output);
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_eval_after(), target);
   }
 
   // optional int32 checkpoint_after = 8 [default = 1000];
-  if (has_checkpoint_after()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(8, this->checkpoint_after(), output);
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_checkpoint_after(), target);
   }
 
   // optional string checkpoint_directory = 9;
-  if (has_checkpoint_directory()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->checkpoint_directory().data(), this->checkpoint_directory().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      9, this->checkpoint_directory(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_checkpoint_directory().data(), static_cast<int>(this->_internal_checkpoint_directory().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.Operation.checkpoint_directory");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_checkpoint_directory(), target);
   }
 
   // optional bool randomize = 10 [default = false];
-  if (has_randomize()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->randomize(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_randomize(), target);
   }
 
   // optional int32 random_seed = 11 [default = 42];
-  if (has_random_seed()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(11, this->random_seed(), output);
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_random_seed(), target);
   }
 
   // optional bool verbose = 12 [default = true];
-  if (has_verbose()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(12, this->verbose(), output);
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_verbose(), target);
   }
 
   // optional bool normalize_each_train_step = 13 [default = true];
-  if (has_normalize_each_train_step()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->normalize_each_train_step(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Operation::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1 [default = "operation"];
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
-  if (has_optimizer()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->optimizer(), target);
-  }
-
-  // optional .model.Operation.StopCondition stop_condition = 3;
-  if (has_stop_condition()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->stop_condition(), target);
-  }
-
-  // optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
-  if (has_operation_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      4, this->operation_type(), target);
-  }
-
-  // optional int32 batch_size = 5 [default = 100];
-  if (has_batch_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->batch_size(), target);
-  }
-
-  // optional string data_proto = 6;
-  if (has_data_proto()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->data_proto().data(), this->data_proto().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        6, this->data_proto(), target);
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_normalize_each_train_step(), target);
   }
 
-  // optional int32 eval_after = 7 [default = 500];
-  if (has_eval_after()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->eval_after(), target);
-  }
-
-  // optional int32 checkpoint_after = 8 [default = 1000];
-  if (has_checkpoint_after()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(8, this->checkpoint_after(), target);
+  // optional int32 shard_rank = 14 [default = 0];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_shard_rank(), target);
   }
 
-  // optional string checkpoint_directory = 9;
-  if (has_checkpoint_directory()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->checkpoint_directory().data(), this->checkpoint_directory().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        9, this->checkpoint_directory(), target);
+  // optional int32 shard_count = 15 [default = 1];
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_shard_count(), target);
   }
 
-  // optional bool randomize = 10 [default = false];
-  if (has_randomize()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->randomize(), target);
+  // optional int32 thread_count = 16 [default = 1];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_thread_count(), target);
   }
 
-  // optional int32 random_seed = 11 [default = 42];
-  if (has_random_seed()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(11, this->random_seed(), target);
+  // optional .model.Operation.ParallelMode parallel_mode = 17 [default = NODE_LEVELS];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      17, this->_internal_parallel_mode(), target);
   }
 
-  // optional bool verbose = 12 [default = true];
-  if (has_verbose()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(12, this->verbose(), target);
+  // optional float prune_threshold = 18 [default = 0];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(18, this->_internal_prune_threshold(), target);
   }
 
-  // optional bool normalize_each_train_step = 13 [default = true];
-  if (has_normalize_each_train_step()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(13, this->normalize_each_train_step(), target);
+  // optional bool simplify = 19 [default = false];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(19, this->_internal_simplify(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.Operation)
   return target;
 }
 
-int Operation::ByteSize() const {
-  int total_size = 0;
+size_t Operation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.Operation)
+  size_t total_size = 0;
+
+  // required string name = 1 [default = "operation"];
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string name = 1 [default = "operation"];
-    if (has_name()) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000feu) {
+    // optional string data_proto = 6;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_data_proto());
     }
 
-    // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
-    if (has_optimizer()) {
+    // optional string checkpoint_directory = 9;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optimizer());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_checkpoint_directory());
     }
 
     // optional .model.Operation.StopCondition stop_condition = 3;
-    if (has_stop_condition()) {
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.stop_condition_);
+    }
+
+    // optional .model.Operation.Optimizer optimizer = 2 [default = GRADIENT_DESCENT];
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->stop_condition());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_optimizer());
     }
 
     // optional .model.Operation.OperationType operation_type = 4 [default = TRAIN];
-    if (has_operation_type()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->operation_type());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_operation_type());
+    }
+
+    // optional int32 shard_rank = 14 [default = 0];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_shard_rank());
+    }
+
+    // optional bool randomize = 10 [default = false];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional bool simplify = 19 [default = false];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 + 1;
     }
 
-    // optional int32 batch_size = 5 [default = 100];
-    if (has_batch_size()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->batch_size());
+    // optional .model.Operation.ParallelMode parallel_mode = 17 [default = NODE_LEVELS];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_parallel_mode());
     }
 
-    // optional string data_proto = 6;
-    if (has_data_proto()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->data_proto());
+    // optional float prune_threshold = 18 [default = 0];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 + 4;
     }
 
-    // optional int32 eval_after = 7 [default = 500];
-    if (has_eval_after()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->eval_after());
+    // optional int32 thread_count = 16 [default = 1];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_thread_count());
     }
 
-    // optional int32 checkpoint_after = 8 [default = 1000];
-    if (has_checkpoint_after()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->checkpoint_after());
+    // optional int32 batch_size = 5 [default = 100];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_batch_size());
     }
 
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    // optional string checkpoint_directory = 9;
-    if (has_checkpoint_directory()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->checkpoint_directory());
+    // optional int32 eval_after = 7 [default = 500];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_eval_after());
     }
 
-    // optional bool randomize = 10 [default = false];
-    if (has_randomize()) {
-      total_size += 1 + 1;
+    // optional int32 checkpoint_after = 8 [default = 1000];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_checkpoint_after());
     }
 
     // optional int32 random_seed = 11 [default = 42];
-    if (has_random_seed()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->random_seed());
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_random_seed());
     }
 
+  }
+  if (cached_has_bits & 0x00070000u) {
     // optional bool verbose = 12 [default = true];
-    if (has_verbose()) {
+    if (cached_has_bits & 0x00010000u) {
       total_size += 1 + 1;
     }
 
     // optional bool normalize_each_train_step = 13 [default = true];
-    if (has_normalize_each_train_step()) {
+    if (cached_has_bits & 0x00020000u) {
       total_size += 1 + 1;
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional int32 shard_count = 15 [default = 1];
+    if (cached_has_bits & 0x00040000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_shard_count());
+    }
 
-void Operation::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Operation* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Operation*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Operation::MergeFrom(const Operation& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Operation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Operation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Operation::GetClassData() const { return &_class_data_; }
+
+
+void Operation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Operation*>(&to_msg);
+  auto& from = static_cast<const Operation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.Operation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_optimizer()) {
-      set_optimizer(from.optimizer());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_data_proto(from._internal_data_proto());
     }
-    if (from.has_stop_condition()) {
-      mutable_stop_condition()->::model::Operation_StopCondition::MergeFrom(from.stop_condition());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_checkpoint_directory(from._internal_checkpoint_directory());
     }
-    if (from.has_operation_type()) {
-      set_operation_type(from.operation_type());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_stop_condition()->::model::Operation_StopCondition::MergeFrom(
+          from._internal_stop_condition());
     }
-    if (from.has_batch_size()) {
-      set_batch_size(from.batch_size());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.optimizer_ = from._impl_.optimizer_;
     }
-    if (from.has_data_proto()) {
-      set_data_proto(from.data_proto());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.operation_type_ = from._impl_.operation_type_;
     }
-    if (from.has_eval_after()) {
-      set_eval_after(from.eval_after());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.shard_rank_ = from._impl_.shard_rank_;
     }
-    if (from.has_checkpoint_after()) {
-      set_checkpoint_after(from.checkpoint_after());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.randomize_ = from._impl_.randomize_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_checkpoint_directory()) {
-      set_checkpoint_directory(from.checkpoint_directory());
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.simplify_ = from._impl_.simplify_;
     }
-    if (from.has_randomize()) {
-      set_randomize(from.randomize());
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.parallel_mode_ = from._impl_.parallel_mode_;
     }
-    if (from.has_random_seed()) {
-      set_random_seed(from.random_seed());
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.prune_threshold_ = from._impl_.prune_threshold_;
     }
-    if (from.has_verbose()) {
-      set_verbose(from.verbose());
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.thread_count_ = from._impl_.thread_count_;
     }
-    if (from.has_normalize_each_train_step()) {
-      set_normalize_each_train_step(from.normalize_each_train_step());
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.batch_size_ = from._impl_.batch_size_;
     }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.eval_after_ = from._impl_.eval_after_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.checkpoint_after_ = from._impl_.checkpoint_after_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.random_seed_ = from._impl_.random_seed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Operation::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00070000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.verbose_ = from._impl_.verbose_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.normalize_each_train_step_ = from._impl_.normalize_each_train_step_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.shard_count_ = from._impl_.shard_count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Operation::CopyFrom(const Operation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.Operation)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Operation::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Operation::Swap(Operation* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(optimizer_, other->optimizer_);
-    std::swap(stop_condition_, other->stop_condition_);
-    std::swap(operation_type_, other->operation_type_);
-    std::swap(batch_size_, other->batch_size_);
-    std::swap(data_proto_, other->data_proto_);
-    std::swap(eval_after_, other->eval_after_);
-    std::swap(checkpoint_after_, other->checkpoint_after_);
-    std::swap(checkpoint_directory_, other->checkpoint_directory_);
-    std::swap(randomize_, other->randomize_);
-    std::swap(random_seed_, other->random_seed_);
-    std::swap(verbose_, other->verbose_);
-    std::swap(normalize_each_train_step_, other->normalize_each_train_step_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Operation::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Operation_descriptor_;
-  metadata.reflection = Operation_reflection_;
-  return metadata;
+void Operation::InternalSwap(Operation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_proto_, lhs_arena,
+      &other->_impl_.data_proto_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.checkpoint_directory_, lhs_arena,
+      &other->_impl_.checkpoint_directory_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Operation, _impl_.prune_threshold_)
+      + sizeof(Operation::_impl_.prune_threshold_)
+      - PROTOBUF_FIELD_OFFSET(Operation, _impl_.stop_condition_)>(
+          reinterpret_cast<char*>(&_impl_.stop_condition_),
+          reinterpret_cast<char*>(&other->_impl_.stop_condition_));
+  swap(_impl_.thread_count_, other->_impl_.thread_count_);
+  swap(_impl_.batch_size_, other->_impl_.batch_size_);
+  swap(_impl_.eval_after_, other->_impl_.eval_after_);
+  swap(_impl_.checkpoint_after_, other->_impl_.checkpoint_after_);
+  swap(_impl_.random_seed_, other->_impl_.random_seed_);
+  swap(_impl_.verbose_, other->_impl_.verbose_);
+  swap(_impl_.normalize_each_train_step_, other->_impl_.normalize_each_train_step_);
+  swap(_impl_.shard_count_, other->_impl_.shard_count_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Operation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[9]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* DatasetInfo_DataType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DatasetInfo_DataType_descriptor_;
-}
-bool DatasetInfo_DataType_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
+class DatasetInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DatasetInfo>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
-
-#ifndef _MSC_VER
-const DatasetInfo_DataType DatasetInfo::TRAIN_SET;
-const DatasetInfo_DataType DatasetInfo::EVAL_SET;
-const DatasetInfo_DataType DatasetInfo::TEST_SET;
-const DatasetInfo_DataType DatasetInfo::DataType_MIN;
-const DatasetInfo_DataType DatasetInfo::DataType_MAX;
-const int DatasetInfo::DataType_ARRAYSIZE;
-#endif  // _MSC_VER
-const ::google::protobuf::EnumDescriptor* DatasetInfo_DataFormat_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DatasetInfo_DataFormat_descriptor_;
-}
-bool DatasetInfo_DataFormat_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-      return true;
-    default:
-      return false;
+  static void set_has_file_pattern(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const DatasetInfo_DataFormat DatasetInfo::BOOST_MATRIX;
-const DatasetInfo_DataFormat DatasetInfo::CSV;
-const DatasetInfo_DataFormat DatasetInfo::DataFormat_MIN;
-const DatasetInfo_DataFormat DatasetInfo::DataFormat_MAX;
-const int DatasetInfo::DataFormat_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int DatasetInfo::kTypeFieldNumber;
-const int DatasetInfo::kFilePatternFieldNumber;
-const int DatasetInfo::kSizeFieldNumber;
-const int DatasetInfo::kDimensionsFieldNumber;
-const int DatasetInfo::kTypeSizeFieldNumber;
-const int DatasetInfo::kDataFormatFieldNumber;
-#endif  // !_MSC_VER
-
-DatasetInfo::DatasetInfo()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_dimensions(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_type_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_data_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_disk_reader(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
 
-void DatasetInfo::InitAsDefaultInstance() {
+DatasetInfo::DatasetInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.DatasetInfo)
 }
-
 DatasetInfo::DatasetInfo(const DatasetInfo& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DatasetInfo::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  file_pattern_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  size_ = 0;
-  dimensions_ = 0;
-  type_size_ = 4;
-  data_format_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DatasetInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_pattern_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.dimensions_){}
+    , decltype(_impl_.data_format_){}
+    , decltype(_impl_.disk_reader_){}
+    , decltype(_impl_.type_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_pattern_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_pattern_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_pattern()) {
+    _this->_impl_.file_pattern_.Set(from._internal_file_pattern(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_size_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.type_size_));
+  // @@protoc_insertion_point(copy_constructor:model.DatasetInfo)
+}
+
+inline void DatasetInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_pattern_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.size_){0}
+    , decltype(_impl_.dimensions_){0}
+    , decltype(_impl_.data_format_){0}
+    , decltype(_impl_.disk_reader_){0}
+    , decltype(_impl_.type_size_){4}
+  };
+  _impl_.file_pattern_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_pattern_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DatasetInfo::~DatasetInfo() {
+  // @@protoc_insertion_point(destructor:model.DatasetInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DatasetInfo::SharedDtor() {
-  if (file_pattern_ != &::google::protobuf::internal::kEmptyString) {
-    delete file_pattern_;
-  }
-  if (this != default_instance_) {
-  }
+inline void DatasetInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_pattern_.Destroy();
 }
 
 void DatasetInfo::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DatasetInfo::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DatasetInfo_descriptor_;
-}
-
-const DatasetInfo& DatasetInfo::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-DatasetInfo* DatasetInfo::default_instance_ = NULL;
-
-DatasetInfo* DatasetInfo::New() const {
-  return new DatasetInfo;
+  _impl_._cached_size_.Set(size);
 }
 
 void DatasetInfo::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_file_pattern()) {
-      if (file_pattern_ != &::google::protobuf::internal::kEmptyString) {
-        file_pattern_->clear();
-      }
-    }
-    size_ = 0;
-    dimensions_ = 0;
-    type_size_ = 4;
-    data_format_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool DatasetInfo::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:model.DatasetInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.file_pattern_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.disk_reader_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.disk_reader_));
+    _impl_.type_size_ = 4;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DatasetInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .model.DatasetInfo.DataType type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::DatasetInfo_DataType_IsValid(value)) {
-            set_type(static_cast< ::model::DatasetInfo_DataType >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::DatasetInfo_DataType_IsValid(val))) {
+            _internal_set_type(static_cast<::model::DatasetInfo_DataType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_file_pattern;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required string file_pattern = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_file_pattern:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_pattern()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->file_pattern().data(), this->file_pattern().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_size;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_file_pattern();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.DatasetInfo.file_pattern");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 size = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &size_)));
-          set_has_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_dimensions;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 dimensions = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_dimensions:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &dimensions_)));
-          set_has_dimensions();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_type_size;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_dimensions(&has_bits);
+          _impl_.dimensions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 type_size = 5 [default = 4];
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &type_size_)));
-          set_has_type_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(48)) goto parse_data_format;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_type_size(&has_bits);
+          _impl_.type_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_data_format:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::model::DatasetInfo_DataFormat_IsValid(value)) {
-            set_data_format(static_cast< ::model::DatasetInfo_DataFormat >(value));
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::DatasetInfo_DataFormat_IsValid(val))) {
+            _internal_set_data_format(static_cast<::model::DatasetInfo_DataFormat>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(6, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void DatasetInfo::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .model.DatasetInfo.DiskReader disk_reader = 7 [default = STREAM];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::model::DatasetInfo_DiskReader_IsValid(val))) {
+            _internal_set_disk_reader(static_cast<::model::DatasetInfo_DiskReader>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(7, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DatasetInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.DatasetInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .model.DatasetInfo.DataType type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // required string file_pattern = 2;
-  if (has_file_pattern()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->file_pattern().data(), this->file_pattern().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->file_pattern(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file_pattern().data(), static_cast<int>(this->_internal_file_pattern().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.DatasetInfo.file_pattern");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_file_pattern(), target);
   }
 
   // required int32 size = 3;
-  if (has_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->size(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_size(), target);
   }
 
   // required int32 dimensions = 4;
-  if (has_dimensions()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->dimensions(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_dimensions(), target);
   }
 
   // optional int32 type_size = 5 [default = 4];
-  if (has_type_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->type_size(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_type_size(), target);
   }
 
   // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
-  if (has_data_format()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      6, this->data_format(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_data_format(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional .model.DatasetInfo.DiskReader disk_reader = 7 [default = STREAM];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_disk_reader(), target);
   }
-}
 
-::google::protobuf::uint8* DatasetInfo::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .model.DatasetInfo.DataType type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.DatasetInfo)
+  return target;
+}
 
-  // required string file_pattern = 2;
-  if (has_file_pattern()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->file_pattern().data(), this->file_pattern().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->file_pattern(), target);
-  }
+size_t DatasetInfo::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:model.DatasetInfo)
+  size_t total_size = 0;
 
-  // required int32 size = 3;
-  if (has_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->size(), target);
+  if (_internal_has_file_pattern()) {
+    // required string file_pattern = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_pattern());
   }
 
-  // required int32 dimensions = 4;
-  if (has_dimensions()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->dimensions(), target);
+  if (_internal_has_type()) {
+    // required .model.DatasetInfo.DataType type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  // optional int32 type_size = 5 [default = 4];
-  if (has_type_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->type_size(), target);
+  if (_internal_has_size()) {
+    // required int32 size = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
   }
 
-  // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
-  if (has_data_format()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      6, this->data_format(), target);
+  if (_internal_has_dimensions()) {
+    // required int32 dimensions = 4;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_dimensions());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t DatasetInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.DatasetInfo)
+  size_t total_size = 0;
 
-int DatasetInfo::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string file_pattern = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_pattern());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required .model.DatasetInfo.DataType type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-
-    // required string file_pattern = 2;
-    if (has_file_pattern()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->file_pattern());
-    }
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
 
     // required int32 size = 3;
-    if (has_size()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->size());
-    }
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
 
     // required int32 dimensions = 4;
-    if (has_dimensions()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_dimensions());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000070u) {
+    // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->dimensions());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_data_format());
     }
 
-    // optional int32 type_size = 5 [default = 4];
-    if (has_type_size()) {
+    // optional .model.DatasetInfo.DiskReader disk_reader = 7 [default = STREAM];
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->type_size());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_disk_reader());
     }
 
-    // optional .model.DatasetInfo.DataFormat data_format = 6 [default = BOOST_MATRIX];
-    if (has_data_format()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->data_format());
+    // optional int32 type_size = 5 [default = 4];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type_size());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DatasetInfo::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DatasetInfo* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DatasetInfo*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DatasetInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DatasetInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DatasetInfo::GetClassData() const { return &_class_data_; }
+
 
-void DatasetInfo::MergeFrom(const DatasetInfo& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+void DatasetInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DatasetInfo*>(&to_msg);
+  auto& from = static_cast<const DatasetInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.DatasetInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_file_pattern(from._internal_file_pattern());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
-    if (from.has_file_pattern()) {
-      set_file_pattern(from.file_pattern());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.size_ = from._impl_.size_;
     }
-    if (from.has_size()) {
-      set_size(from.size());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.dimensions_ = from._impl_.dimensions_;
     }
-    if (from.has_dimensions()) {
-      set_dimensions(from.dimensions());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.data_format_ = from._impl_.data_format_;
     }
-    if (from.has_type_size()) {
-      set_type_size(from.type_size());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.disk_reader_ = from._impl_.disk_reader_;
     }
-    if (from.has_data_format()) {
-      set_data_format(from.data_format());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.type_size_ = from._impl_.type_size_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void DatasetInfo::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DatasetInfo::CopyFrom(const DatasetInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.DatasetInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DatasetInfo::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void DatasetInfo::Swap(DatasetInfo* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(file_pattern_, other->file_pattern_);
-    std::swap(size_, other->size_);
-    std::swap(dimensions_, other->dimensions_);
-    std::swap(type_size_, other->type_size_);
-    std::swap(data_format_, other->data_format_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void DatasetInfo::InternalSwap(DatasetInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_pattern_, lhs_arena,
+      &other->_impl_.file_pattern_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DatasetInfo, _impl_.disk_reader_)
+      + sizeof(DatasetInfo::_impl_.disk_reader_)
+      - PROTOBUF_FIELD_OFFSET(DatasetInfo, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+  swap(_impl_.type_size_, other->_impl_.type_size_);
 }
 
-::google::protobuf::Metadata DatasetInfo::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DatasetInfo_descriptor_;
-  metadata.reflection = DatasetInfo_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata DatasetInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[10]);
 }
 
-
 // ===================================================================
 
-::std::string* DatabaseInfo::_default_data_handler_ = NULL;
-#ifndef _MSC_VER
-const int DatabaseInfo::kNameFieldNumber;
-const int DatabaseInfo::kDataFieldNumber;
-const int DatabaseInfo::kDataHandlerFieldNumber;
-const int DatabaseInfo::kMainMemoryFieldNumber;
-const int DatabaseInfo::kGpuMemoryFieldNumber;
-const int DatabaseInfo::kPathPrefixFieldNumber;
-#endif  // !_MSC_VER
-
-DatabaseInfo::DatabaseInfo()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class DatabaseInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DatabaseInfo>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_data_handler(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_main_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_gpu_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_path_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_shard_rank(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_shard_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void DatabaseInfo::InitAsDefaultInstance() {
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString DatabaseInfo::Impl_::_i_give_permission_to_break_this_code_default_data_handler_{{{"deeplearn", 9}}, {nullptr}};
+DatabaseInfo::DatabaseInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:model.DatabaseInfo)
 }
-
 DatabaseInfo::DatabaseInfo(const DatabaseInfo& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DatabaseInfo::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  data_handler_ = const_cast< ::std::string*>(_default_data_handler_);
-  main_memory_ = 2;
-  gpu_memory_ = 1.5f;
-  path_prefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DatabaseInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){from._impl_.data_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.data_handler_){}
+    , decltype(_impl_.path_prefix_){}
+    , decltype(_impl_.shard_rank_){}
+    , decltype(_impl_.shard_count_){}
+    , decltype(_impl_.main_memory_){}
+    , decltype(_impl_.gpu_memory_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_handler_.InitDefault();
+  if (from._internal_has_data_handler()) {
+    _this->_impl_.data_handler_.Set(from._internal_data_handler(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.path_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_path_prefix()) {
+    _this->_impl_.path_prefix_.Set(from._internal_path_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.shard_rank_, &from._impl_.shard_rank_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.gpu_memory_) -
+    reinterpret_cast<char*>(&_impl_.shard_rank_)) + sizeof(_impl_.gpu_memory_));
+  // @@protoc_insertion_point(copy_constructor:model.DatabaseInfo)
+}
+
+inline void DatabaseInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.data_handler_){}
+    , decltype(_impl_.path_prefix_){}
+    , decltype(_impl_.shard_rank_){0}
+    , decltype(_impl_.shard_count_){1}
+    , decltype(_impl_.main_memory_){2}
+    , decltype(_impl_.gpu_memory_){1.5f}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_handler_.InitDefault();
+  _impl_.path_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DatabaseInfo::~DatabaseInfo() {
+  // @@protoc_insertion_point(destructor:model.DatabaseInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DatabaseInfo::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (data_handler_ != _default_data_handler_) {
-    delete data_handler_;
-  }
-  if (path_prefix_ != &::google::protobuf::internal::kEmptyString) {
-    delete path_prefix_;
-  }
-  if (this != default_instance_) {
-  }
+inline void DatabaseInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.data_handler_.Destroy();
+  _impl_.path_prefix_.Destroy();
 }
 
 void DatabaseInfo::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DatabaseInfo::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DatabaseInfo_descriptor_;
-}
-
-const DatabaseInfo& DatabaseInfo::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_deeplearn_2eproto();
-  return *default_instance_;
-}
-
-DatabaseInfo* DatabaseInfo::default_instance_ = NULL;
-
-DatabaseInfo* DatabaseInfo::New() const {
-  return new DatabaseInfo;
+  _impl_._cached_size_.Set(size);
 }
 
 void DatabaseInfo::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    if (has_data_handler()) {
-      if (data_handler_ != _default_data_handler_) {
-        data_handler_->assign(*_default_data_handler_);
-      }
-    }
-    main_memory_ = 2;
-    gpu_memory_ = 1.5f;
-    if (has_path_prefix()) {
-      if (path_prefix_ != &::google::protobuf::internal::kEmptyString) {
-        path_prefix_->clear();
-      }
-    }
-  }
-  data_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool DatabaseInfo::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:model.DatabaseInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.data_handler_.ClearToDefault(::model::DatabaseInfo::Impl_::_i_give_permission_to_break_this_code_default_data_handler_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.path_prefix_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000078u) {
+    _impl_.shard_rank_ = 0;
+    _impl_.shard_count_ = 1;
+    _impl_.main_memory_ = 2;
+    _impl_.gpu_memory_ = 1.5f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DatabaseInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_data;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.DatabaseInfo.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .model.DatasetInfo data = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_data:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_data()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_data;
-        if (input->ExpectTag(26)) goto parse_data_handler;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_data(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional string data_handler = 3 [default = "deeplearn"];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_data_handler:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_data_handler()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->data_handler().data(), this->data_handler().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(37)) goto parse_main_memory;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data_handler();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.DatabaseInfo.data_handler");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional float main_memory = 4 [default = 2];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_main_memory:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &main_memory_)));
-          set_has_main_memory();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(45)) goto parse_gpu_memory;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_main_memory(&has_bits);
+          _impl_.main_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float gpu_memory = 5 [default = 1.5];
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_gpu_memory:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &gpu_memory_)));
-          set_has_gpu_memory();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_path_prefix;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_gpu_memory(&has_bits);
+          _impl_.gpu_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string path_prefix = 6 [default = ""];
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_path_prefix:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path_prefix()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->path_prefix().data(), this->path_prefix().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void DatabaseInfo::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_path_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "model.DatabaseInfo.path_prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 shard_rank = 7 [default = 0];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_shard_rank(&has_bits);
+          _impl_.shard_rank_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 shard_count = 8 [default = 1];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_shard_count(&has_bits);
+          _impl_.shard_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DatabaseInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:model.DatabaseInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.DatabaseInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // repeated .model.DatasetInfo data = 2;
-  for (int i = 0; i < this->data_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->data(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_data_size()); i < n; i++) {
+    const auto& repfield = this->_internal_data(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional string data_handler = 3 [default = "deeplearn"];
-  if (has_data_handler()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->data_handler().data(), this->data_handler().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->data_handler(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_data_handler().data(), static_cast<int>(this->_internal_data_handler().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.DatabaseInfo.data_handler");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_data_handler(), target);
   }
 
   // optional float main_memory = 4 [default = 2];
-  if (has_main_memory()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->main_memory(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_main_memory(), target);
   }
 
   // optional float gpu_memory = 5 [default = 1.5];
-  if (has_gpu_memory()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->gpu_memory(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_gpu_memory(), target);
   }
 
   // optional string path_prefix = 6 [default = ""];
-  if (has_path_prefix()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->path_prefix().data(), this->path_prefix().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      6, this->path_prefix(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* DatabaseInfo::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_path_prefix().data(), static_cast<int>(this->_internal_path_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "model.DatabaseInfo.path_prefix");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_path_prefix(), target);
   }
 
-  // repeated .model.DatasetInfo data = 2;
-  for (int i = 0; i < this->data_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->data(i), target);
+  // optional int32 shard_rank = 7 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_shard_rank(), target);
   }
 
-  // optional string data_handler = 3 [default = "deeplearn"];
-  if (has_data_handler()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->data_handler().data(), this->data_handler().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->data_handler(), target);
+  // optional int32 shard_count = 8 [default = 1];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_shard_count(), target);
   }
 
-  // optional float main_memory = 4 [default = 2];
-  if (has_main_memory()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->main_memory(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:model.DatabaseInfo)
+  return target;
+}
 
-  // optional float gpu_memory = 5 [default = 1.5];
-  if (has_gpu_memory()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->gpu_memory(), target);
-  }
+size_t DatabaseInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:model.DatabaseInfo)
+  size_t total_size = 0;
 
-  // optional string path_prefix = 6 [default = ""];
-  if (has_path_prefix()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->path_prefix().data(), this->path_prefix().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        6, this->path_prefix(), target);
+  // required string name = 1;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated .model.DatasetInfo data = 2;
+  total_size += 1UL * this->_internal_data_size();
+  for (const auto& msg : this->_impl_.data_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  return target;
-}
-
-int DatabaseInfo::ByteSize() const {
-  int total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string name = 1;
-    if (has_name()) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007eu) {
+    // optional string data_handler = 3 [default = "deeplearn"];
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_data_handler());
     }
 
-    // optional string data_handler = 3 [default = "deeplearn"];
-    if (has_data_handler()) {
+    // optional string path_prefix = 6 [default = ""];
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->data_handler());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_path_prefix());
+    }
+
+    // optional int32 shard_rank = 7 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_shard_rank());
+    }
+
+    // optional int32 shard_count = 8 [default = 1];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_shard_count());
     }
 
     // optional float main_memory = 4 [default = 2];
-    if (has_main_memory()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 + 4;
     }
 
     // optional float gpu_memory = 5 [default = 1.5];
-    if (has_gpu_memory()) {
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 + 4;
     }
 
-    // optional string path_prefix = 6 [default = ""];
-    if (has_path_prefix()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->path_prefix());
-    }
-
-  }
-  // repeated .model.DatasetInfo data = 2;
-  total_size += 1 * this->data_size();
-  for (int i = 0; i < this->data_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->data(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DatabaseInfo::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DatabaseInfo* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DatabaseInfo*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DatabaseInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DatabaseInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DatabaseInfo::GetClassData() const { return &_class_data_; }
 
-void DatabaseInfo::MergeFrom(const DatabaseInfo& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  data_.MergeFrom(from.data_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+
+void DatabaseInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DatabaseInfo*>(&to_msg);
+  auto& from = static_cast<const DatabaseInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:model.DatabaseInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.data_.MergeFrom(from._impl_.data_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_data_handler(from._internal_data_handler());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_path_prefix(from._internal_path_prefix());
     }
-    if (from.has_data_handler()) {
-      set_data_handler(from.data_handler());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.shard_rank_ = from._impl_.shard_rank_;
     }
-    if (from.has_main_memory()) {
-      set_main_memory(from.main_memory());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.shard_count_ = from._impl_.shard_count_;
     }
-    if (from.has_gpu_memory()) {
-      set_gpu_memory(from.gpu_memory());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.main_memory_ = from._impl_.main_memory_;
     }
-    if (from.has_path_prefix()) {
-      set_path_prefix(from.path_prefix());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.gpu_memory_ = from._impl_.gpu_memory_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void DatabaseInfo::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DatabaseInfo::CopyFrom(const DatabaseInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:model.DatabaseInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DatabaseInfo::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  for (int i = 0; i < data_size(); i++) {
-    if (!this->data(i).IsInitialized()) return false;
-  }
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.data_))
+    return false;
   return true;
 }
 
-void DatabaseInfo::Swap(DatabaseInfo* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    data_.Swap(&other->data_);
-    std::swap(data_handler_, other->data_handler_);
-    std::swap(main_memory_, other->main_memory_);
-    std::swap(gpu_memory_, other->gpu_memory_);
-    std::swap(path_prefix_, other->path_prefix_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata DatabaseInfo::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DatabaseInfo_descriptor_;
-  metadata.reflection = DatabaseInfo_reflection_;
-  return metadata;
+void DatabaseInfo::InternalSwap(DatabaseInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.data_.InternalSwap(&other->_impl_.data_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_handler_, lhs_arena,
+      &other->_impl_.data_handler_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_prefix_, lhs_arena,
+      &other->_impl_.path_prefix_, rhs_arena
+  );
+  swap(_impl_.shard_rank_, other->_impl_.shard_rank_);
+  swap(_impl_.shard_count_, other->_impl_.shard_count_);
+  swap(_impl_.main_memory_, other->_impl_.main_memory_);
+  swap(_impl_.gpu_memory_, other->_impl_.gpu_memory_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DatabaseInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deeplearn_2eproto_getter, &descriptor_table_deeplearn_2eproto_once,
+      file_level_metadata_deeplearn_2eproto[11]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace model
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::model::Metric*
+Arena::CreateMaybeMessage< ::model::Metric >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::Metric >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::Metrics*
+Arena::CreateMaybeMessage< ::model::Metrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::Metrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::Hyperparams*
+Arena::CreateMaybeMessage< ::model::Hyperparams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::Hyperparams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::NodeData*
+Arena::CreateMaybeMessage< ::model::NodeData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::NodeData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::EdgeData*
+Arena::CreateMaybeMessage< ::model::EdgeData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::EdgeData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::SpnLayerInit*
+Arena::CreateMaybeMessage< ::model::SpnLayerInit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::SpnLayerInit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::SpnData*
+Arena::CreateMaybeMessage< ::model::SpnData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::SpnData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::ModelData*
+Arena::CreateMaybeMessage< ::model::ModelData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::ModelData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::Operation_StopCondition*
+Arena::CreateMaybeMessage< ::model::Operation_StopCondition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::Operation_StopCondition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::Operation*
+Arena::CreateMaybeMessage< ::model::Operation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::Operation >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::DatasetInfo*
+Arena::CreateMaybeMessage< ::model::DatasetInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::DatasetInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::model::DatabaseInfo*
+Arena::CreateMaybeMessage< ::model::DatabaseInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::model::DatabaseInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -6,13 +6,23 @@
  */
 
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <streambuf>
+#include <sstream>
+#include <ctime>
+#include <cmath>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
 #include "spnet/Spn.h"
+#include "spnet/ProductNode.h"
 #include "deeplearn.pb.h"
 #include "Util.h"
 #include <DataHandler.h>
+#include <DeepLearnDataHandler.h>
+#include <Dataset.h>
+#include <SharedMemoryDataHandler.h>
 #include <Util.h>
 
 /*
@@ -59,7 +69,79 @@ void testSpn()
     }
     spn->PrintBackpropOrder(std::cout);
     
+    // reload the network from its nodes and edges only
+    model::ModelData saved, reloaded;
+    spn->ToModelData(saved);
+    saved.clear_spn_data();
     delete spn;
+    spn = (model::Spn*)model::Model::FromModelData(saved);
+    if (spn && spn->Validate())
+        spn->ToModelData(reloaded);
+    if (reloaded.nodes_size() != saved.nodes_size() || reloaded.edges_size() != saved.edges_size())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpn (test_model) message=couldn't reload the network" << std::endl;
+    }
+    delete spn;
+    
+    // 1 -> 2 -> 3 -> 1 is a cycle
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    spnData->set_node_list("[1,5]((4,3,3,4,0))");
+    spnData->set_input_indices("[1,5]((-1,-1,-1,-1,0))");
+    spnData->set_adjacency_matrix("[5,5]((0,0,0,0,0),(0,0,1,0,0),(0,0,0,1,0),(1,1,0,0,0),(0,1,0,0,0))");
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("cyclic_spn");
+    spn = (model::Spn*)model::Model::FromModelData(modelData);
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (cyclic_spn)");
+    if (spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpn (test_model) message=the cycle was not detected" << std::endl;
+    }
+    delete spn;
+}
+
+/*
+ * inputs -> sums (fully connected) -> products of up to
+ * `combinations` sums -> root sum. Inputs cycle over 4 columns.
+ */
+model::Spn* createLayeredSpn(int inputs, int sums, int combinations
+    , bool bLogSpace = false)
+{
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    spnData->set_log_space(bLogSpace);
+    std::stringstream ss;
+    
+    ss << "[1," << inputs << "]((";
+    for (int i = 0; i < inputs; ++i)
+        ss << (i > 0 ? "," : "") << i % 4;
+    ss << "))";
+    
+    model::SpnLayerInit *layer = spnData->add_layers();
+    layer->set_name("input");
+    layer->set_type(model::NodeData::INPUT);
+    layer->set_size(inputs);
+    layer->set_input_indices(ss.str());
+    
+    layer = spnData->add_layers();
+    layer->set_name("sum");
+    layer->set_type(model::NodeData::SUM);
+    layer->set_size(sums);
+    
+    layer = spnData->add_layers();
+    layer->set_name("product");
+    layer->set_type(model::NodeData::PRODUCT);
+    layer->set_product_combinations(combinations);
+    
+    layer = spnData->add_layers();
+    layer->set_name("root");
+    layer->set_type(model::NodeData::SUM);
+    layer->set_size(1);
+    
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("layered_spn");
+    
+    return (model::Spn*)model::Model::FromModelData(modelData);
 }
 
 /*****************************************************************************/
@@ -96,6 +178,258 @@ void testDataHandler()
 
 /*****************************************************************************/
 
+void testDataHandlerShards()
+{
+    model::DatabaseInfo databaseInfo;
+    std::string sProtoFile(DATA_PROTOBUF);
+
+    if(!util::Util::LoadProto(sProtoFile, &databaseInfo))
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testDataHandlerShards (test_model) message=protobuf import failed" << std::endl;
+        return;
+    }
+    
+    // m1.m has 600 rows, row i is (i/600, 1 - i/600, ...),
+    // so the 2 shards of the training set are [0, 0.5) and [0.5, 1)
+    databaseInfo.set_shard_count(2);
+    for (int rank = 0; rank < 2; ++rank)
+    {
+        databaseInfo.set_shard_rank(rank);
+        data::DataHandler *handler = data::DataHandler::GetDataHandler(databaseInfo, false, 42, true);
+        data::Dataset* trainSet = handler->GetDataset(model::DatasetInfo::TRAIN_SET);
+        
+        trainSet->SetBatchSize(100);
+        if (trainSet->GetNumBatches() != 3)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testDataHandlerShards (test_model) message=unbalanced number of batches" << std::endl;
+        }
+        for (int i = trainSet->GetNumBatches() - 1; i >= 0; --i)
+        {
+            trainSet->EndLoadNextBatch();
+            math::pimatrix *batch = trainSet->GetCurrentBatch();
+            trainSet->BeginLoadNextBatch();
+            
+            for (size_t j = 0; j < batch->size1(); ++j)
+            {
+                if ((batch->operator()(j, 0) < 0.5f) != (rank == 0))
+                {
+                    std::cout << "%TEST_FAILED% time=0 testname=testDataHandlerShards (test_model) message=sample from the wrong shard" << std::endl;
+                    delete handler;
+                    return;
+                }
+            }
+        }
+        delete handler;
+    }
+}
+
+/*****************************************************************************/
+
+void testPlanMemory()
+{
+    model::DatabaseInfo databaseInfo;
+    model::DatasetInfo_DataType types[] = {model::DatasetInfo::TRAIN_SET
+        , model::DatasetInfo::EVAL_SET, model::DatasetInfo::TEST_SET};
+    for (int i = 0; i < 3; ++i)
+    {
+        model::DatasetInfo* dataInfo = databaseInfo.add_data();
+        dataInfo->set_type(types[i]);
+        dataInfo->set_dimensions(4);
+    }
+    databaseInfo.set_main_memory(1);
+    
+    // samples in the train, eval and test sets, the shard count, and the
+    // expected capacities of 1 GB split among them, 16 bytes per sample.
+    const size_t GB = 1000000000, M = 100000000;
+    size_t cases[][7] = {
+        // all fit: each set gets its footprint
+        {600, 200, 200, 1, 600*16, 200*16, 200*16},
+        // none fits: 60/20/20 shares
+        {M, M, M, 1, 6*GB/10, 2*GB/10, 2*GB/10},
+        // the space eval and test sets do not need goes to the training set
+        {M, 200, 200, 1, GB - 400*16, 200*16, 200*16},
+        // a training shard fits, the rest goes to the eval set
+        {M, M, M, 4, 4*GB/10, 4*GB/10, 2*GB/10}};
+    
+    for (int c = 0; c < 4; ++c)
+    {
+        for (int i = 0; i < 3; ++i)
+            databaseInfo.mutable_data(i)->set_size(cases[c][i]);
+        databaseInfo.set_shard_count(cases[c][3]);
+        
+        std::map<model::DatasetInfo_DataType, size_t> capacities;
+        data::DeepLearnDataHandler::planMemory(databaseInfo, capacities, false);
+        for (int i = 0; i < 3; ++i)
+        {
+            if (capacities[types[i]] != cases[c][4 + i])
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testPlanMemory (test_model) message=wrong capacity in case " << c << std::endl;
+                break;
+            }
+        }
+    }
+}
+
+/*****************************************************************************/
+
+void testDatasetUnevenShard()
+{
+    model::DatabaseInfo databaseInfo;
+    std::string sProtoFile(DATA_PROTOBUF);
+
+    if(!util::Util::LoadProto(sProtoFile, &databaseInfo))
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testDatasetUnevenShard (test_model) message=protobuf import failed" << std::endl;
+        return;
+    }
+    
+    // the last of 7 shards of m1.m has 86 rows, one more than the 600/7
+    // declared. With a cache large enough for the whole shard, the extra
+    // row must still come in the second pass.
+    const model::DatasetInfo& trainInfo = databaseInfo.data(0);
+    data::Dataset dataset(600 * 4 * 4, false, 42, false, 6, 7);
+    dataset.Append(trainInfo, databaseInfo.path_prefix());
+    dataset.SetBatchSize(30);
+    if (dataset.GetSize() != 85)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testDatasetUnevenShard (test_model) message=wrong declared size" << std::endl;
+    }
+    
+    std::vector<int> counts(600, 0);
+    for (int i = 2 * dataset.GetNumBatches() - 1; i >= 0; --i)
+    {
+        dataset.EndLoadNextBatch();
+        math::pimatrix *batch = dataset.GetCurrentBatch();
+        for (size_t j = 0; j < batch->size1(); ++j)
+            ++counts.at((int)(batch->operator()(j, 0) * 600 + 0.5f));
+    }
+    if (std::count(counts.begin() + 514, counts.end(), 0) != 0)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testDatasetUnevenShard (test_model) message=rows of the shard were never read" << std::endl;
+    }
+}
+
+/*****************************************************************************/
+
+void testSharedMemoryDataHandler()
+{
+    model::DatabaseInfo databaseInfo;
+    std::string sProtoFile(DATA_PROTOBUF);
+
+    if(!util::Util::LoadProto(sProtoFile, &databaseInfo))
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSharedMemoryDataHandler (test_model) message=protobuf import failed" << std::endl;
+        return;
+    }
+    if (!data::SharedMemoryDataHandler::Publish(databaseInfo, true))
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSharedMemoryDataHandler (test_model) message=Publish() failed" << std::endl;
+        return;
+    }
+    
+    data::DataHandler *diskHandler, *shmHandler;
+    diskHandler = data::DataHandler::GetDataHandler(databaseInfo, false, 42, false);
+    databaseInfo.set_data_handler(data::SharedMemoryDataHandler::GetHandlerName());
+    shmHandler = data::DataHandler::GetDataHandler(databaseInfo, false, 42, true);
+    data::SharedMemoryDataHandler::Unpublish(databaseInfo);
+    
+    if (!shmHandler)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSharedMemoryDataHandler (test_model) message=GetDataHandler() failed" << std::endl;
+        delete diskHandler;
+        return;
+    }
+    
+    // both handlers should give the same batches
+    data::Dataset* diskSet = diskHandler->GetDataset(model::DatasetInfo::EVAL_SET);
+    data::Dataset* shmSet = shmHandler->GetDataset(model::DatasetInfo::EVAL_SET);
+    diskSet->SetBatchSize(70);
+    shmSet->SetBatchSize(70);
+    if (diskSet->GetNumBatches() != shmSet->GetNumBatches())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSharedMemoryDataHandler (test_model) message=different number of batches" << std::endl;
+    }
+    for (int i = 2*diskSet->GetNumBatches() - 1; i >= 0; --i)
+    {
+        diskSet->EndLoadNextBatch();
+        shmSet->EndLoadNextBatch();
+        math::pimatrix *b1 = diskSet->GetCurrentBatch(), *b2 = shmSet->GetCurrentBatch();
+        for (size_t r = 0; r < b1->size1(); ++r)
+        {
+            for (size_t c = 0; c < b1->size2(); ++c)
+            {
+                if (b1->operator()(r, c) != b2->operator()(r, c))
+                {
+                    std::cout << "%TEST_FAILED% time=0 testname=testSharedMemoryDataHandler (test_model) message=different data" << std::endl;
+                    i = 0;
+                    r = b1->size1();
+                    break;
+                }
+            }
+        }
+    }
+    
+    delete diskHandler;
+    delete shmHandler;
+}
+
+/*****************************************************************************/
+
+void testDatasetEpoch()
+{
+    model::DatabaseInfo databaseInfo;
+    std::string sProtoFile(DATA_PROTOBUF);
+
+    if(!util::Util::LoadProto(sProtoFile, &databaseInfo))
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testDatasetEpoch (test_model) message=protobuf import failed" << std::endl;
+        return;
+    }
+    
+    // m1.m has 600 rows, row i is (i/600, ...). Try a cache holding
+    // the whole set and one holding 250 rows, in order and shuffled.
+    const model::DatasetInfo& trainInfo = databaseInfo.data(0);
+    size_t capacities[] = {600 * 4 * 4, 250 * 4 * 4};
+    for (int c = 0; c < 2; ++c)
+    {
+        for (int randomize = 0; randomize < 2; ++randomize)
+        {
+            data::Dataset dataset(capacities[c], randomize == 1, 42, false);
+            dataset.Append(trainInfo, databaseInfo.path_prefix());
+            dataset.SetBatchSize(70);
+            
+            // a training step in the middle of the epoch, then 2 full epochs
+            dataset.EndLoadNextBatch();
+            for (int epoch = 0; epoch < 2; ++epoch)
+            {
+                std::vector<int> counts(600, 0);
+                int nBatches = 0;
+                
+                dataset.ResetEpoch();
+                while (dataset.LoadEpochBatch())
+                {
+                    math::pimatrix *batch = dataset.GetCurrentBatch();
+                    for (size_t j = 0; j < batch->size1(); ++j)
+                        ++counts.at((int)(batch->operator()(j, 0) * 600 + 0.5f));
+                    ++nBatches;
+                }
+                
+                if (nBatches != dataset.GetNumBatches() || !dataset.IsEpochEnd()
+                    || dataset.GetCurrentBatch()->size1() != 600 % 70)
+                {
+                    std::cout << "%TEST_FAILED% time=0 testname=testDatasetEpoch (test_model) message=wrong batches in the epoch" << std::endl;
+                }
+                if (std::count(counts.begin(), counts.end(), 1) != 600)
+                {
+                    std::cout << "%TEST_FAILED% time=0 testname=testDatasetEpoch (test_model) message=samples are not read exactly once" << std::endl;
+                }
+            }
+        }
+    }
+}
+
+/*****************************************************************************/
+
 void testSpnForward()
 {
     // get Spn
@@ -151,24 +485,1328 @@ void testSpnForward()
 
 /*****************************************************************************/
 
-int main(int argc, char** argv)
+void testSpnCompiled()
 {
-    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    model::Spn* spn = createLayeredSpn(8, 6, 2);
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createLayeredSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnCompiled (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
     
-    std::cout << "%SUITE_STARTING% test_model" << std::endl;
-    std::cout << "%SUITE_STARTED%" << std::endl;
+    boost::random::minstd_rand gen(42);
+    boost::random::uniform_real_distribution<float> dist(0.1f, 1.0f);
+    math::pimatrix batch(50, 4);
+    for (size_t i = 0; i < batch.size1(); ++i)
+        for (size_t j = 0; j < batch.size2(); ++j)
+            batch.set(i, j, dist(gen));
+    
+    // the flat arrays and the nodes should agree
+    math::pimatrix compiled = spn->Forward(&batch);
+    spn->SetUseCompiled(false);
+    math::pimatrix nodes = spn->Forward(&batch);
+    
+    for (size_t i = 0; i < batch.size1(); ++i)
+    {
+        if (std::abs(compiled(i, 0) - nodes(i, 0)) > 1E-5 * std::abs(nodes(i, 0)))
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnCompiled (test_model) message=compiled forward computation failed" << std::endl;
+            std::cout << compiled(i, 0) << " " << nodes(i, 0) << std::endl;
+            break;
+        }
+    }
+    delete spn;
+}
 
-    std::cout << "%TEST_STARTED% testSpn (test_model)" << std::endl;
-    testSpn();
-    std::cout << "%TEST_FINISHED% time=0 testSpn (test_model)" << std::endl;
+void testSpnLogSpace()
+{
+    model::Spn* spn = createLayeredSpn(8, 6, 2);
+    model::Spn* logSpn = createLayeredSpn(8, 6, 2, true);
+    BOOST_ASSERT_MSG(spn && logSpn, "Couldn't create Spn (createLayeredSpn)");
+    if (!spn->Validate() || !logSpn->Validate() || !logSpn->IsLogSpace())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnLogSpace (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        delete logSpn;
+        return;
+    }
+    
+    boost::random::minstd_rand gen(42);
+    boost::random::uniform_real_distribution<float> dist(0.1f, 1.0f);
+    math::pimatrix batch(50, 4);
+    for (size_t i = 0; i < batch.size1(); ++i)
+        for (size_t j = 0; j < batch.size2(); ++j)
+            batch.set(i, j, dist(gen));
+    
+    math::pimatrix prob = spn->Forward(&batch);
+    math::pimatrix logProb = logSpn->Forward(&batch);
+    for (size_t i = 0; i < batch.size1(); ++i)
+    {
+        if (std::abs(std::log(prob(i, 0)) - logProb(i, 0)) > 1E-4)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnLogSpace (test_model) message=log-space forward computation failed" << std::endl;
+            std::cout << std::log(prob(i, 0)) << " " << logProb(i, 0) << std::endl;
+            break;
+        }
+    }
+    delete spn;
+    delete logSpn;
+    
+    // a product of 4 inputs of 1E-12 underflows in float, but not in log space
+    model::ModelData modelData;
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("product_spn");
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    spnData->set_node_list("[1,6]((4,3,0,0,0,0))");
+    spnData->set_input_indices("[1,6]((-1,-1,0,1,2,3))");
+    spnData->set_adjacency_matrix("[6,6]((0,0,0,0,0,0),(1,0,0,0,0,0),(0,1,0,0,0,0),(0,1,0,0,0,0),(0,1,0,0,0,0),(0,1,0,0,0,0))");
+    spnData->set_log_space(true);
+    
+    logSpn = (model::Spn*)model::Model::FromModelData(modelData);
+    BOOST_ASSERT_MSG(logSpn, "Couldn't create Spn");
+    if (!logSpn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnLogSpace (test_model) message=spn->Validate() failed" << std::endl;
+        delete logSpn;
+        return;
+    }
+    batch = math::pimatrix(10, 4, 1E-12f);
+    logProb = logSpn->Forward(&batch);
+    if (std::abs(logProb(0, 0) - 4 * std::log(1E-12f)) > 1E-3)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnLogSpace (test_model) message=log-space product underflows" << std::endl;
+        std::cout << logProb(0, 0) << " " << 4 * std::log(1E-12f) << std::endl;
+    }
+    delete logSpn;
+}
 
-    std::cout << "%TEST_STARTED% testDataHandler (test_model)" << std::endl;
-    testDataHandler();
-    std::cout << "%TEST_FINISHED% time=0 testDataHandler (test_model)" << std::endl;
+void testSpnThreads()
+{
+    model::Spn* spn = createLayeredSpn(8, 6, 2);
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createLayeredSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnThreads (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
     
-    std::cout << "%TEST_STARTED% testSpnForward (test_model)" << std::endl;
-    testSpnForward();
-    std::cout << "%TEST_FINISHED% time=0 testSpnForward (test_model)" << std::endl;
+    // large enough to split the levels into several chunks
+    boost::random::minstd_rand gen(42);
+    boost::random::uniform_real_distribution<float> dist(0.1f, 1.0f);
+    math::pimatrix batch(4000, 4);
+    for (size_t i = 0; i < batch.size1(); ++i)
+        for (size_t j = 0; j < batch.size2(); ++j)
+            batch.set(i, j, dist(gen));
+    
+    // every node is computed by one thread, in the same order
+    math::pimatrix single = spn->Forward(&batch);
+    spn->SetThreadCount(4);
+    math::pimatrix multi = spn->Forward(&batch);
+    spn->SetThreadCount(4, model::Operation::BATCH_ROWS);
+    math::pimatrix rows = spn->Forward(&batch);
+    
+    for (size_t i = 0; i < batch.size1(); ++i)
+    {
+        if (single(i, 0) != multi(i, 0) || single(i, 0) != rows(i, 0))
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnThreads (test_model) message=multi-threaded forward computation failed" << std::endl;
+            std::cout << single(i, 0) << " " << multi(i, 0) << " " << rows(i, 0) << std::endl;
+            break;
+        }
+    }
+    
+    // in backward, every node gathers its derivative from its parents.
+    // With BATCH_ROWS, the gradients of the row ranges are added up,
+    // in another order than in the single-threaded sums.
+    std::vector<float> singleGradients, multiGradients, rowsGradients;
+    spn->SetThreadCount(1);
+    spn->ComputeGradients(&batch, singleGradients);
+    spn->SetThreadCount(4);
+    spn->ComputeGradients(&batch, multiGradients);
+    spn->SetThreadCount(4, model::Operation::BATCH_ROWS);
+    spn->ComputeGradients(&batch, rowsGradients);
+    if (singleGradients != multiGradients)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnThreads (test_model) message=multi-threaded backward computation failed" << std::endl;
+    }
+    for (size_t k = 0; k < singleGradients.size(); ++k)
+    {
+        if (k >= rowsGradients.size() || std::abs(rowsGradients[k] - singleGradients[k])
+                > 1E-4 * std::abs(singleGradients[k]))
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnThreads (test_model) message=batch-partitioned backward computation failed" << std::endl;
+            break;
+        }
+    }
+    delete spn;
+}
+
+void testSpnMpe()
+{
+    // root = P1 + P2, P1 = x0 * x2, P2 = x1 * x3: indicators of 2 variables
+    model::Spn* spn = createSimpleSpn();
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createSimpleSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnMpe (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    // both missing (P1 wins the tie), first variable observed, second observed
+    math::pimatrix batch, assignment, expected;
+    batch.FromDebugString("[3,4]((1,1,1,1),(0,1,1,1),(1,1,0,1))");
+    expected.FromDebugString("[3,4]((1,0,1,0),(0,1,0,1),(0,1,0,1))");
+    math::pimatrix mpe = spn->Mpe(&batch, assignment);
+    
+    for (size_t i = 0; i < expected.size1(); ++i)
+    {
+        bool bFailed = (mpe(i, 0) != 1);
+        for (size_t j = 0; j < expected.size2(); ++j)
+            bFailed = bFailed || (assignment(i, j) != expected(i, j));
+        if (bFailed)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnMpe (test_model) message=wrong MPE assignment" << std::endl;
+            std::cout << assignment.ToDebugString() << std::endl;
+            break;
+        }
+    }
+    delete spn;
+    
+    // the same network with a max node at the root
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    spnData->set_node_list("[1,7]((5,3,3,0,0,0,0))");
+    spnData->set_input_indices("[1,7]((-1,-1,-1,0,1,2,3))");
+    spnData->set_adjacency_matrix("[7,7]((0,0,0,0,0,0,0),(1,0,0,0,0,0,0),(1,0,0,0,0,0,0),(0,1,0,0,0,0,0),(0,0,1,0,0,0,0),(0,1,0,0,0,0,0),(0,0,1,0,0,0,0))");
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("max_spn");
+    spn = (model::Spn*)model::Model::FromModelData(modelData);
+    if (!spn || !spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnMpe (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    boost::random::minstd_rand gen(42);
+    boost::random::uniform_real_distribution<float> dist(0.1f, 1.0f);
+    batch.resize(50, 4);
+    for (size_t i = 0; i < batch.size1(); ++i)
+        for (size_t j = 0; j < batch.size2(); ++j)
+            batch.set(i, j, dist(gen));
+    
+    math::pimatrix compiled = spn->Forward(&batch);
+    spn->SetUseCompiled(false);
+    math::pimatrix nodes = spn->Forward(&batch);
+    for (size_t i = 0; i < batch.size1(); ++i)
+    {
+        float m = std::max(batch(i, 0) * batch(i, 2), batch(i, 1) * batch(i, 3));
+        if (compiled(i, 0) != m || nodes(i, 0) != m)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnMpe (test_model) message=max node forward computation failed" << std::endl;
+            std::cout << m << " " << compiled(i, 0) << " " << nodes(i, 0) << std::endl;
+            break;
+        }
+    }
+    delete spn;
+    
+    // root = w P1 + (1 - w) P2, P1 = x0 * x2, P2 = x1 * x2' where x2 and x2'
+    // both read column 2: it is 1 whichever product wins
+    int types[] = {4, 3, 3, 0, 0, 0, 0}, inputs[] = {-1, -1, -1, 0, 1, 2, 2};
+    int children[] = {1, 2, 3, 5, 4, 6}, parents[] = {0, 0, 1, 1, 2, 2};
+    batch.FromDebugString("[1,4]((1,1,1,1))");
+    for (int c = 0; c < 2; ++c)
+    {
+        float w = (c == 0 ? 0.6f : 0.4f);
+        float weights[] = {w, 1 - w, 1, 1, 1, 1};
+        model::ModelData sparseData;
+        model::SpnData *sparseSpn = sparseData.mutable_spn_data();
+        for (int i = 0; i < 7; ++i)
+        {
+            sparseSpn->add_node_types(types[i]);
+            sparseSpn->add_node_inputs(inputs[i]);
+        }
+        for (int i = 0; i < 6; ++i)
+        {
+            sparseSpn->add_edge_children(children[i]);
+            sparseSpn->add_edge_parents(parents[i]);
+            sparseSpn->add_edge_weights(weights[i]);
+        }
+        sparseData.set_model_type(model::ModelData::SPN);
+        sparseData.set_name("duplicate_leaves_spn");
+        spn = (model::Spn*)model::Model::FromModelData(sparseData);
+        if (!spn || !spn->Validate())
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnMpe (test_model) message=spn->Validate() failed" << std::endl;
+            delete spn;
+            return;
+        }
+        
+        expected.FromDebugString(c == 0 ? "[1,4]((1,0,1,1))" : "[1,4]((0,1,1,1))");
+        spn->Mpe(&batch, assignment);
+        bool bFailed = false;
+        for (size_t j = 0; j < expected.size2(); ++j)
+            bFailed = bFailed || (assignment(0, j) != expected(0, j));
+        if (bFailed)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnMpe (test_model) message=wrong MPE assignment with two leaves on a column" << std::endl;
+            std::cout << assignment.ToDebugString() << std::endl;
+        }
+        delete spn;
+    }
+}
+
+void testSpnEM()
+{
+    model::Spn* spn = createSimpleSpn();
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createSimpleSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnEM (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    // one pass of EM from the weights (0.5, 0.5) of the root:
+    // w_k = sum(w_k * child_k / root) / sum(1)
+    model::DatabaseInfo databaseInfo;
+    if (!util::Util::LoadProto(DATA_PROTOBUF, &databaseInfo))
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnEM (test_model) message=protobuf import failed" << std::endl;
+        delete spn;
+        return;
+    }
+    data::DataHandler *handler = data::DataHandler::GetDataHandler(databaseInfo, false, 42, false);
+    data::Dataset* trainSet = handler->GetDataset(model::DatasetInfo::TRAIN_SET);
+    trainSet->SetBatchSize(trainSet->GetSize());
+    trainSet->EndLoadNextBatch();
+    math::pimatrix *batch = trainSet->GetCurrentBatch();
+    double count1 = 0, count2 = 0;
+    for (size_t i = 0; i < batch->size1(); ++i)
+    {
+        double p1 = (*batch)(i, 0) * (*batch)(i, 2), p2 = (*batch)(i, 1) * (*batch)(i, 3);
+        count1 += p1 / (p1 + p2);
+        count2 += p2 / (p1 + p2);
+    }
+    float expected = (float)(count1 / (count1 + count2));
+    delete handler;
+    
+    model::Operation trainOp;
+    trainOp.set_name("em");
+    trainOp.set_optimizer(model::Operation::EM);
+    // the last batch of the pass only has 100 samples
+    trainOp.set_batch_size(250);
+    trainOp.set_data_proto(DATA_PROTOBUF);
+    trainOp.set_verbose(false);
+    trainOp.set_checkpoint_directory((boost::filesystem::temp_directory_path()
+            / "deeplearn_test_em").generic_string());
+    spn->Train(trainOp);
+    
+    model::ModelData modelData;
+    spn->ToModelData(modelData);
+    for (int i = 0; i < modelData.edges_size(); ++i)
+    {
+        math::pimatrix w;
+        w.FromString(modelData.edges(i).weight());
+        if (modelData.edges(i).node1() == "1" && std::abs(w(0, 0) - expected) > 1E-4)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnEM (test_model) message=wrong EM update" << std::endl;
+            std::cout << w(0, 0) << " " << expected << std::endl;
+        }
+    }
+    
+    // the graph reads the trained weights from the edges
+    model::SpnData spnData;
+    spn->GetGraph().ToSpnData(spnData);
+    for (int k = 0; k < spnData.edge_children_size(); ++k)
+    {
+        if (spnData.edge_children(k) == 1 && std::abs(spnData.edge_weights(k) - expected) > 1E-4)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnEM (test_model) message=stale weights in the graph" << std::endl;
+            std::cout << spnData.edge_weights(k) << " " << expected << std::endl;
+        }
+    }
+    boost::filesystem::remove_all(trainOp.checkpoint_directory());
+    delete spn;
+}
+
+void testSpnQuery()
+{
+    // root = x0 * x2 + x1 * x3: indicators of 2 variables A and B
+    model::Spn* spn = createSimpleSpn();
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createSimpleSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnQuery (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    // A = a0 and B missing, then both missing.
+    // Queries: B = b0, B = b1, A = a0
+    math::pimatrix evidence, missing, queries, conditionals, expected;
+    evidence.FromDebugString("[2,4]((1,0,0,0),(0,0,0,0))");
+    missing.FromDebugString("[2,4]((0,0,1,1),(1,1,1,1))");
+    queries.FromDebugString("[3,4]((-1,-1,1,0),(-1,-1,0,1),(1,0,-1,-1))");
+    expected.FromDebugString("[2,3]((1,0,1),(0.5,0.5,0.5))");
+    
+    for (int c = 1; c >= 0; --c)
+    {
+        spn->SetUseCompiled(c == 1);
+        math::pimatrix logEvidence = spn->Query(&evidence, &missing, &queries, conditionals);
+        
+        bool bFailed = std::abs(logEvidence(0, 0)) > 1E-6
+                || std::abs(logEvidence(1, 0) - std::log(2.0f)) > 1E-6;
+        for (size_t i = 0; i < expected.size1(); ++i)
+            for (size_t j = 0; j < expected.size2(); ++j)
+                bFailed = bFailed || std::abs(conditionals(i, j) - expected(i, j)) > 1E-6;
+        if (bFailed)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnQuery (test_model) message=wrong marginal or conditional probabilities" << std::endl;
+            std::cout << conditionals.ToDebugString() << std::endl;
+        }
+    }
+    
+    // queries on B only: the leaves of A are evaluated once for all
+    queries.FromDebugString("[2,4]((-1,-1,1,0),(-1,-1,0,1))");
+    expected.FromDebugString("[2,2]((1,0),(0.5,0.5))");
+    spn->SetUseCompiled(true);
+    spn->Query(&evidence, &missing, &queries, conditionals);
+    bool bFailed = conditionals.size1() != 2 || conditionals.size2() != 2;
+    for (size_t i = 0; i < expected.size1() && !bFailed; ++i)
+        for (size_t j = 0; j < expected.size2(); ++j)
+            bFailed = bFailed || std::abs(conditionals(i, j) - expected(i, j)) > 1E-6;
+    if (bFailed)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnQuery (test_model) message=wrong conditional probabilities of the queries on B" << std::endl;
+        std::cout << conditionals.ToDebugString() << std::endl;
+    }
+    delete spn;
+}
+
+void testSpnQueryPhase()
+{
+    // the simple SPN, where the last 2 columns are query variables
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    spnData->set_node_list("[1,7]((4,3,3,0,0,2,2))");
+    spnData->set_input_indices("[1,7]((-1,-1,-1,0,1,2,3))");
+    spnData->set_adjacency_matrix("[7,7]((0,0,0,0,0,0,0),(1,0,0,0,0,0,0),(1,0,0,0,0,0,0),(0,1,0,0,0,0,0),(0,0,1,0,0,0,0),(0,1,0,0,0,0,0),(0,0,1,0,0,0,0))");
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("query_spn");
+    modelData.mutable_hyper_params()->set_base_learningrate(0.1f);
+    
+    model::Operation trainOp;
+    trainOp.set_name("query_phase");
+    trainOp.set_batch_size(100);
+    trainOp.mutable_stop_condition()->set_all_processed(false);
+    trainOp.mutable_stop_condition()->set_steps(6);
+    trainOp.set_data_proto(DATA_PROTOBUF);
+    trainOp.set_verbose(false);
+    trainOp.set_checkpoint_directory((boost::filesystem::temp_directory_path()
+            / "deeplearn_test_query_phase").generic_string());
+    
+    // the compiled evaluator shares the nodes below the query variables,
+    // the nodes evaluate the doubled batch
+    math::pimatrix weights[2];
+    for (int c = 0; c < 2; ++c)
+    {
+        model::Spn* spn = (model::Spn*)model::Model::FromModelData(modelData);
+        if (!spn || !spn->Validate())
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnQueryPhase (test_model) message=spn->Validate() failed" << std::endl;
+            delete spn;
+            return;
+        }
+        spn->SetUseCompiled(c == 0);
+        spn->Train(trainOp);
+        
+        model::ModelData trained;
+        spn->ToModelData(trained);
+        weights[c].resize(trained.edges_size(), 1);
+        for (int i = 0; i < trained.edges_size(); ++i)
+        {
+            math::pimatrix w;
+            w.FromString(trained.edges(i).weight());
+            weights[c].set(i, 0, w(0, 0));
+        }
+        delete spn;
+    }
+    boost::filesystem::remove_all(trainOp.checkpoint_directory());
+    
+    for (size_t i = 0; i < weights[0].size1(); ++i)
+    {
+        if (std::abs(weights[0](i, 0) - weights[1](i, 0)) > 1E-5)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnQueryPhase (test_model) message=compiled training with a query phase failed" << std::endl;
+            std::cout << weights[0](i, 0) << " " << weights[1](i, 0) << std::endl;
+            break;
+        }
+    }
+    if (weights[0](0, 0) == 0.5f)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnQueryPhase (test_model) message=weights didn't change" << std::endl;
+    }
+}
+
+void testSpnIncremental()
+{
+    model::Spn* spn = createLayeredSpn(8, 6, 2);
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createLayeredSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnIncremental (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    boost::random::minstd_rand gen(42);
+    boost::random::uniform_real_distribution<float> dist(0.1f, 1.0f);
+    math::pimatrix batch(200, 4);
+    for (size_t i = 0; i < batch.size1(); ++i)
+        for (size_t j = 0; j < batch.size2(); ++j)
+            batch.set(i, j, dist(gen));
+    
+    // once on one thread, once on several row blocks
+    for (int round = 0; round < 2; ++round)
+    {
+        if (round == 1)
+            spn->SetThreadCount(4, model::Operation::BATCH_ROWS);
+        spn->Forward(&batch);
+        math::pimatrix same = spn->ForwardIncremental(&batch);
+        for (size_t i = 0; i < batch.size1(); i += 3)
+            batch.set(i, 2, dist(gen));
+        math::pimatrix incremental = spn->ForwardIncremental(&batch);
+        math::pimatrix full = spn->Forward(&batch);
+        
+        for (size_t i = 0; i < batch.size1(); ++i)
+        {
+            if (incremental(i, 0) != full(i, 0))
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testSpnIncremental (test_model) message=incremental forward computation failed" << std::endl;
+                std::cout << incremental(i, 0) << " " << full(i, 0) << std::endl;
+                break;
+            }
+            if (i % 3 == 0 && same(i, 0) == full(i, 0))
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testSpnIncremental (test_model) message=changed rows weren't evaluated again" << std::endl;
+                break;
+            }
+        }
+    }
+    delete spn;
+}
+
+void testSpnSample()
+{
+    // root = P1 + P2 with equal weights, P1 = x0 * x2, P2 = x1 * x3
+    model::Spn* spn = createSimpleSpn();
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createSimpleSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnSample (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    model::Operation op;
+    op.set_name("sample");
+    op.set_random_seed(7);
+    math::pimatrix samples, multi;
+    spn->Sample(op, 20000, samples);
+    op.set_thread_count(4);
+    spn->Sample(op, 20000, multi);
+    
+    size_t count1 = 0;
+    for (size_t i = 0; i < samples.size1(); ++i)
+    {
+        bool bP1 = (samples(i, 0) == 1 && samples(i, 1) == 0 && samples(i, 2) == 1 && samples(i, 3) == 0);
+        bool bP2 = (samples(i, 0) == 0 && samples(i, 1) == 1 && samples(i, 2) == 0 && samples(i, 3) == 1);
+        bool bSame = true;
+        for (size_t j = 0; j < samples.size2(); ++j)
+            bSame = bSame && (samples(i, j) == multi(i, j));
+        if (!(bP1 || bP2) || !bSame)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnSample (test_model) message=invalid sample" << std::endl;
+            std::cout << samples(i, 0) << samples(i, 1) << samples(i, 2) << samples(i, 3) << std::endl;
+            delete spn;
+            return;
+        }
+        count1 += bP1;
+    }
+    if (samples.size1() != 20000 || std::abs(count1 / 20000.0 - 0.5) > 0.02)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnSample (test_model) message=wrong sample distribution" << std::endl;
+        std::cout << count1 << std::endl;
+    }
+    delete spn;
+}
+
+void testSpnSparse()
+{
+    // createSimpleSpn() with the sparse structure
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    int types[] = {4, 3, 3, 0, 0, 0, 0}, inputs[] = {-1, -1, -1, 0, 1, 2, 3};
+    int children[] = {1, 2, 3, 4, 5, 6}, parents[] = {0, 0, 1, 2, 1, 2};
+    for (int i = 0; i < 7; ++i)
+    {
+        spnData->add_node_types(types[i]);
+        spnData->add_node_inputs(inputs[i]);
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+        spnData->add_edge_children(children[i]);
+        spnData->add_edge_parents(parents[i]);
+    }
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("sparse_spn");
+    
+    // and through the binary encoding
+    std::string sFile = (boost::filesystem::temp_directory_path()
+            / "deeplearn_test_sparse.pb").generic_string();
+    util::Util::WriteProto(sFile, &modelData);
+    model::ModelData binaryData;
+    bool bLoaded = util::Util::LoadBinaryProto(sFile, &binaryData);
+    boost::filesystem::remove(sFile);
+    
+    model::Spn* dense = createSimpleSpn();
+    model::Spn* sparse = (model::Spn*)model::Model::FromModelData(modelData);
+    model::Spn* binary = bLoaded ? (model::Spn*)model::Model::FromModelData(binaryData) : NULL;
+    if (!dense || !sparse || !binary || !dense->Validate() || !sparse->Validate() || !binary->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnSparse (test_model) message=couldn't load the sparse structure" << std::endl;
+        delete dense;
+        delete sparse;
+        delete binary;
+        return;
+    }
+    
+    math::pimatrix batch;
+    batch.FromDebugString("[3,4]((1,1,1,1),(0,1,1,1),(0.2,0.7,0.5,0.1))");
+    math::pimatrix expected = dense->Forward(&batch);
+    math::pimatrix fromSparse = sparse->Forward(&batch);
+    math::pimatrix fromBinary = binary->Forward(&batch);
+    for (size_t i = 0; i < batch.size1(); ++i)
+    {
+        if (fromSparse(i, 0) != expected(i, 0) || fromBinary(i, 0) != expected(i, 0))
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnSparse (test_model) message=wrong forward computation" << std::endl;
+            std::cout << expected(i, 0) << " " << fromSparse(i, 0) << " " << fromBinary(i, 0) << std::endl;
+            break;
+        }
+    }
+    delete dense;
+    delete sparse;
+    delete binary;
+}
+
+void testSpnGraph()
+{
+    model::Spn* spn = createSimpleSpn();
+    BOOST_ASSERT_MSG(spn, "Couldn't create Spn (createSimpleSpn)");
+    if (!spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnGraph (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    // root = 0, P1 = 1, P2 = 2, the root being the last one in the order
+    const model::SpnGraph& graph = spn->GetGraph();
+    std::vector<boost::uint32_t> order;
+    if (graph.GetNodeCount() != 7 || graph.GetEdgeCount() != 6
+            || graph.GetChildEnd(0) - graph.GetChildBegin(0) != 2
+            || graph.GetParentEnd(3) - graph.GetParentBegin(3) != 1
+            || !graph.TopologicalSort(order) || order.back() != 0)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnGraph (test_model) message=wrong graph structure" << std::endl;
+    }
+    
+    // back through the sparse structure, with the weight of P1 set to 3
+    model::ModelData modelData;
+    graph.ToSpnData(*modelData.mutable_spn_data());
+    for (int k = 0; k < modelData.spn_data().edge_children_size(); ++k)
+    {
+        if (modelData.spn_data().edge_children(k) == 1)
+            modelData.mutable_spn_data()->set_edge_weights(k, 3);
+    }
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("graph_spn");
+    delete spn;
+    
+    spn = (model::Spn*)model::Model::FromModelData(modelData);
+    if (!spn || !spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnGraph (test_model) message=couldn't load the graph" << std::endl;
+        delete spn;
+        return;
+    }
+    math::pimatrix batch;
+    batch.FromDebugString("[2,4]((1,1,1,1),(0.2,0.7,0.5,0.1))");
+    math::pimatrix result = spn->Forward(&batch);
+    for (size_t i = 0; i < batch.size1(); ++i)
+    {
+        float expected = 3 * batch(i, 0) * batch(i, 2) + batch(i, 1) * batch(i, 3);
+        if (std::abs(result(i, 0) - expected) > 1E-6)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnGraph (test_model) message=wrong forward computation" << std::endl;
+            std::cout << result(i, 0) << " " << expected << std::endl;
+            break;
+        }
+    }
+    delete spn;
+}
+
+void testSpnPrune()
+{
+    // root = 0.5 S1 + 0.5 P2, S1 = 0.95 P3 + 0.05 P4,
+    // P2 = P4 = x1 * x3, P3 = x0 * x2
+    // P4 goes away, P3 takes the place of S1.
+    // Then a chain: root = 0.5 S1 + 0.5 P2, S1 = S4, S4 = P3,
+    // P3 takes the place of S4, then of S1.
+    int types[][9] = {{4, 4, 3, 3, 3, 0, 0, 0, 0}, {4, 4, 3, 3, 4, 0, 0, 0, 0}};
+    int inputs[] = {-1, -1, -1, -1, -1, 0, 1, 2, 3};
+    int children[][10] = {{1, 2, 3, 4, 5, 7, 6, 8, 6, 8}, {1, 2, 4, 3, 5, 7, 6, 8}};
+    int parents[][10] = {{0, 0, 1, 1, 3, 3, 4, 4, 2, 2}, {0, 0, 1, 4, 3, 3, 2, 2}};
+    float weights[][10] = {{0.5f, 0.5f, 0.95f, 0.05f, 1, 1, 1, 1, 1, 1}
+        , {0.5f, 0.5f, 1, 1, 1, 1, 1, 1}};
+    int edgeCounts[] = {10, 8};
+    
+    for (int c = 0; c < 2; ++c)
+    {
+        model::ModelData modelData;
+        model::SpnData *spnData = modelData.mutable_spn_data();
+        for (int i = 0; i < 9; ++i)
+        {
+            spnData->add_node_types(types[c][i]);
+            spnData->add_node_inputs(inputs[i]);
+        }
+        for (int i = 0; i < edgeCounts[c]; ++i)
+        {
+            spnData->add_edge_children(children[c][i]);
+            spnData->add_edge_parents(parents[c][i]);
+            spnData->add_edge_weights(weights[c][i]);
+        }
+        modelData.set_model_type(model::ModelData::SPN);
+        modelData.set_name("prune_spn");
+        
+        model::Spn* spn = (model::Spn*)model::Model::FromModelData(modelData);
+        if (!spn || !spn->Validate())
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnPrune (test_model) message=spn->Validate() failed" << std::endl;
+            delete spn;
+            return;
+        }
+        
+        spn->Prune(0.1f);
+        model::ModelData pruned;
+        spn->ToModelData(pruned);
+        if (pruned.nodes_size() != 7 || pruned.edges_size() != 6)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnPrune (test_model) message=wrong pruned structure" << std::endl;
+            std::cout << pruned.nodes_size() << " nodes, " << pruned.edges_size() << " edges" << std::endl;
+        }
+        
+        math::pimatrix batch;
+        batch.FromDebugString("[2,4]((1,1,1,1),(0.2,0.7,0.5,0.1))");
+        math::pimatrix result = spn->Forward(&batch);
+        for (size_t i = 0; i < batch.size1(); ++i)
+        {
+            float expected = 0.5f * batch(i, 0) * batch(i, 2) + 0.5f * batch(i, 1) * batch(i, 3);
+            if (std::abs(result(i, 0) - expected) > 1E-6)
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testSpnPrune (test_model) message=wrong forward computation" << std::endl;
+                std::cout << result(i, 0) << " " << expected << std::endl;
+                break;
+            }
+        }
+        delete spn;
+    }
+}
+
+void testSpnSimplify()
+{
+    // root = 0.3 P1 + 0.7 P2, P1 = P3 * x2, P3 = x0 * x1, P2 = x0 * x1 * x2:
+    // P1 and P2 are the same product once P3 is flattened
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    int types[] = {4, 3, 3, 3, 0, 0, 0}, inputs[] = {-1, -1, -1, -1, 0, 1, 2};
+    int children[] = {1, 2, 3, 6, 4, 5, 4, 5, 6}, parents[] = {0, 0, 1, 1, 3, 3, 2, 2, 2};
+    float weights[] = {0.3f, 0.7f, 1, 1, 1, 1, 1, 1, 1};
+    for (int i = 0; i < 7; ++i)
+    {
+        spnData->add_node_types(types[i]);
+        spnData->add_node_inputs(inputs[i]);
+    }
+    for (int i = 0; i < 9; ++i)
+    {
+        spnData->add_edge_children(children[i]);
+        spnData->add_edge_parents(parents[i]);
+        spnData->add_edge_weights(weights[i]);
+    }
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("chain_spn");
+    
+    model::Spn* chain = (model::Spn*)model::Model::FromModelData(modelData);
+    
+    // root = 0.4 S1 + 0.6 S2, S1 = 0.5 P3 + 0.5 P4, S2 = 0.3 P3 + 0.7 P4,
+    // P3 = x0 * x1, P4 = x2 * x3: with bWeights, root = 0.38 P3 + 0.62 P4
+    int sumTypes[] = {4, 4, 4, 3, 3, 0, 0, 0, 0}, sumInputs[] = {-1, -1, -1, -1, -1, 0, 1, 2, 3};
+    int sumChildren[] = {1, 2, 3, 4, 3, 4, 5, 6, 7, 8}, sumParents[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4};
+    float sumWeights[] = {0.4f, 0.6f, 0.5f, 0.5f, 0.3f, 0.7f, 1, 1, 1, 1};
+    spnData->Clear();
+    for (int i = 0; i < 9; ++i)
+    {
+        spnData->add_node_types(sumTypes[i]);
+        spnData->add_node_inputs(sumInputs[i]);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        spnData->add_edge_children(sumChildren[i]);
+        spnData->add_edge_parents(sumParents[i]);
+        spnData->add_edge_weights(sumWeights[i]);
+    }
+    modelData.set_name("sum_spn");
+    model::Spn* sums = (model::Spn*)model::Model::FromModelData(modelData);
+    
+    model::Spn* layered = createLayeredSpn(8, 6, 2);
+    if (!chain || !layered || !sums || !chain->Validate() || !layered->Validate()
+            || !sums->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnSimplify (test_model) message=spn->Validate() failed" << std::endl;
+        delete chain;
+        delete layered;
+        delete sums;
+        return;
+    }
+    
+    boost::random::minstd_rand gen(42);
+    boost::random::uniform_real_distribution<float> dist(0.1f, 1.0f);
+    math::pimatrix batch(20, 4);
+    for (size_t i = 0; i < batch.size1(); ++i)
+        for (size_t j = 0; j < batch.size2(); ++j)
+            batch.set(i, j, dist(gen));
+    
+    // the weights of the root are only merged with bWeights,
+    // the layered network is only checked by its outputs
+    int expectedEdges[][2] = {{5, 4}, {-1, -1}, {10, 6}};
+    model::Spn* spns[] = {chain, layered, sums};
+    for (int n = 0; n < 3; ++n)
+    {
+        math::pimatrix before = spns[n]->Forward(&batch);
+        for (int bWeights = 0; bWeights < 2; ++bWeights)
+        {
+            model::ModelData original, simplified;
+            spns[n]->ToModelData(original);
+            spns[n]->Simplify(bWeights == 1);
+            spns[n]->ToModelData(simplified);
+            math::pimatrix after = spns[n]->Forward(&batch);
+            
+            bool bFailed = (simplified.edges_size() > original.edges_size())
+                    || (expectedEdges[n][bWeights] >= 0
+                        && simplified.edges_size() != expectedEdges[n][bWeights]);
+            for (size_t i = 0; i < batch.size1(); ++i)
+                bFailed = bFailed || std::abs(after(i, 0) - before(i, 0)) > 1E-5 * before(i, 0);
+            if (bFailed)
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testSpnSimplify (test_model) message=wrong simplification" << std::endl;
+                std::cout << n << " " << bWeights << ": " << original.edges_size() << " -> " << simplified.edges_size()
+                          << " edges, " << before(0, 0) << " " << after(0, 0) << std::endl;
+            }
+        }
+    }
+    delete chain;
+    delete layered;
+    delete sums;
+}
+
+/*
+ * Forward passes with and without the compiled evaluator
+ */
+void benchmarkSpnForward()
+{
+    model::Spn* spn = createLayeredSpn(20, 100, 1);
+    if (!spn || !spn->Validate())
+    {
+        std::cout << "Couldn't create Spn (createLayeredSpn)" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    math::pimatrix batch(1000, 4, 0.5f);
+    int iterations = 20;
+    
+    for (int c = 1; c >= 0; --c)
+    {
+        spn->SetUseCompiled(c == 1);
+        std::clock_t start = std::clock();
+        for (int i = 0; i < iterations; ++i)
+            spn->Forward(&batch);
+        std::cout << (c == 1 ? "Compiled: " : "Nodes:    ")
+                  << 1000.0 * (std::clock() - start) / CLOCKS_PER_SEC / iterations
+                  << " ms per batch" << std::endl;
+    }
+    
+    // wall time, since clock() adds up all the threads
+    spn->SetUseCompiled(true);
+    for (int m = 0; m < 2; ++m)
+    {
+        for (int t = 1; t <= 8; t *= 2)
+        {
+            spn->SetThreadCount(t, m == 0 ? model::Operation::NODE_LEVELS
+                                          : model::Operation::BATCH_ROWS);
+            boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+            for (int i = 0; i < iterations; ++i)
+                spn->Forward(&batch);
+            std::cout << (m == 0 ? "Levels, " : "Rows,   ") << t << " thread(s): "
+                      << (boost::posix_time::microsec_clock::local_time() - start)
+                            .total_microseconds() / 1000.0 / iterations
+                      << " ms per batch" << std::endl;
+        }
+    }
+    delete spn;
+}
+
+/*
+ * Topological sort of layered networks from 10^3 to 10^7 edges:
+ * 100 inputs fully connected to E / 100 sums. The largest one
+ * needs a few GB of memory.
+ */
+void benchmarkValidate()
+{
+    for (int edges = 1000; edges <= 10000000; edges *= 10)
+    {
+        model::Spn* spn = createLayeredSpn(100, edges / 100, 1);
+        if (!spn)
+        {
+            std::cout << "Couldn't create Spn (createLayeredSpn)" << std::endl;
+            return;
+        }
+        
+        // the sort only, without compiling the network
+        std::clock_t start = std::clock();
+        bool bSorted = spn->model::Model::Validate();
+        std::cout << edges << " edges: " << (bSorted ? "" : "(failed) ")
+                  << 1000.0 * (std::clock() - start) / CLOCKS_PER_SEC
+                  << " ms" << std::endl;
+        delete spn;
+    }
+}
+
+/*
+ * A node whose activations are set by the test, and whose
+ * derivatives can be read back
+ */
+class FixedNode : public model::Node
+{
+public:
+    FixedNode(const model::NodeData& nodeData)
+    : Node(nodeData)
+    {
+    }
+    
+    virtual void Forward()
+    {
+    }
+    
+    virtual void Backward()
+    {
+    }
+    
+    virtual void NormalizeIncomingEdges()
+    {
+    }
+    
+    void SetActivations(const math::pimatrix& activations)
+    {
+        m_activations = activations;
+    }
+    
+    math::pimatrix& GetDerivatives()
+    {
+        return m_derivatives;
+    }
+};
+
+void testProductBackward()
+{
+    // children (2, 3, 4), (0, 3, 4) and (0, 0, 5) in the 3 samples
+    float acts[3][3] = {{2, 3, 4}, {0, 3, 4}, {0, 0, 5}};
+    float expected[3][3] = {{12, 8, 6}, {12, 0, 0}, {0, 0, 0}};
+    
+    model::NodeData nodeData;
+    nodeData.set_dimension(1);
+    nodeData.set_type(model::NodeData::PRODUCT);
+    model::ProductNode product(nodeData);
+    nodeData.set_type(model::NodeData::HIDDEN);
+    
+    std::vector<FixedNode*> children;
+    std::vector<model::Edge*> edges;
+    for (int k = 0; k < 3; ++k)
+    {
+        math::pimatrix act(3, 1);
+        for (int b = 0; b < 3; ++b)
+            act.set(b, 0, acts[b][k]);
+        children.push_back(new FixedNode(nodeData));
+        children[k]->SetActivations(act);
+        children[k]->InitializeDerivative();
+        edges.push_back(new model::Edge(children[k], &product, true));
+    }
+    
+    product.Forward();
+    product.InitializeDerivative();
+    math::pimatrix ones(3, 1, 1.0f);
+    product.AccumDerivatives(ones);
+    product.Backward();
+    
+    for (int k = 0; k < 3; ++k)
+    {
+        for (int b = 0; b < 3; ++b)
+        {
+            if (children[k]->GetDerivatives()(b, 0) != expected[b][k])
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testProductBackward (test_model) message=wrong derivative of child " << k
+                        << " in sample " << b << ": " << children[k]->GetDerivatives()(b, 0)
+                        << " instead of " << expected[b][k] << std::endl;
+            }
+        }
+    }
+    
+    for (int k = 0; k < 3; ++k)
+    {
+        delete edges[k];
+        delete children[k];
+    }
+}
+
+void testSpnCompiledBackward()
+{
+    // root = 0.5 P1 + 0.5 x4, P1 = S1 * S2, S1 = x0 + 1e-30 x1, S2 = x2 + x3
+    int types[] = {4, 3, 4, 4, 0, 0, 0, 0, 0};
+    int inputs[] = {-1, -1, -1, -1, 0, 1, 2, 3, 4};
+    int children[] = {1, 8, 2, 3, 4, 5, 6, 7};
+    int parents[] = {0, 0, 1, 1, 2, 2, 3, 3};
+    float weights[] = {0.5f, 0.5f, 1, 1, 1, 1e-30f, 1, 1};
+    
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    for (int i = 0; i < 9; ++i)
+    {
+        spnData->add_node_types(types[i]);
+        spnData->add_node_inputs(inputs[i]);
+    }
+    for (int i = 0; i < 8; ++i)
+    {
+        spnData->add_edge_children(children[i]);
+        spnData->add_edge_parents(parents[i]);
+        spnData->add_edge_weights(weights[i]);
+    }
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("product_spn");
+    
+    model::Spn* spn = (model::Spn*)model::Model::FromModelData(modelData);
+    if (!spn || !spn->Validate())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnCompiledBackward (test_model) message=spn->Validate() failed" << std::endl;
+        delete spn;
+        return;
+    }
+    
+    // S1 = 0 in the first sample. In the second one, S1 * S2 = 1e-50
+    // underflows, but the gradient of the weight of x1, which goes with S2, does not.
+    math::pimatrix batch;
+    batch.FromDebugString("[2,5]((0,0,1,1,1),(0,1,1e-20,0,1))");
+    std::vector<float> compiled, nodes;
+    spn->ComputeGradients(&batch, compiled);
+    spn->SetUseCompiled(false);
+    spn->ComputeGradients(&batch, nodes);
+    
+    if (compiled.size() != nodes.size())
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testSpnCompiledBackward (test_model) message=wrong number of gradients" << std::endl;
+    }
+    for (size_t k = 0; k < std::min(compiled.size(), nodes.size()); ++k)
+    {
+        if (std::abs(compiled[k] - nodes[k]) > 1E-4 * std::abs(nodes[k]))
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnCompiledBackward (test_model) message=compiled backward computation failed" << std::endl;
+            std::cout << k << ": " << compiled[k] << " " << nodes[k] << std::endl;
+            break;
+        }
+    }
+    delete spn;
+}
+
+void testEdgeParameters()
+{
+    model::NodeData nodeData;
+    nodeData.set_dimension(1);
+    nodeData.set_type(model::NodeData::HIDDEN);
+    FixedNode node1(nodeData), node2(nodeData);
+    model::Edge edge(&node1, &node2, true);
+    
+    model::Hyperparams hyp;
+    hyp.set_base_learningrate(0.1f);
+    hyp.set_initial_momentum(0.5f);
+    hyp.set_final_momentum(0.5f);
+    edge.MergeHyperparams(hyp);
+    
+    // w = 1 - 0.1 * 2, then 0.8 - 0.1 * (4 + 0.5 * 2)
+    float g = 2;
+    edge.SetDerivatives(&g);
+    edge.UpdateParams(0, 1);
+    g = 4;
+    edge.SetDerivatives(&g);
+    edge.UpdateParams(1, 1);
+    if (std::abs(edge.GetWeight()(0, 0) - 0.3f) > 1E-6)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testEdgeParameters (test_model) message=wrong update: "
+                << edge.GetWeight()(0, 0) << " instead of 0.3" << std::endl;
+    }
+    
+    // the weight and both derivatives move to the shared buffer
+    model::ParameterBuffer params;
+    params.Allocate(3);
+    edge.BindParameters(&params);
+    if (edge.GetParameterOffset() != 3 || params.GetSize() != 4
+            || edge.GetWeightData() != params.GetWeights() + 3)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testEdgeParameters (test_model) message=wrong offset in the buffer" << std::endl;
+    }
+    params.Update(0, params.GetSize(), 0.1f, 0.5f, 1);
+    if (std::abs(edge.GetWeight()(0, 0) + 0.2f) > 1E-6 || params.GetWeights()[0] != 1)
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testEdgeParameters (test_model) message=wrong update in the buffer: "
+                << edge.GetWeight()(0, 0) << " instead of -0.2" << std::endl;
+    }
+    
+    // an edge bound before its parameters are used starts from weight 1
+    model::Edge fresh(&node2, &node1, true);
+    fresh.BindParameters(&params);
+    if (fresh.GetParameterOffset() != 4 || fresh.GetWeight()(0, 0) != 1
+            || params.GetGradients()[4] != 0 || params.GetWeights()[3] != edge.GetWeightData()[0])
+    {
+        std::cout << "%TEST_FAILED% time=0 testname=testEdgeParameters (test_model) message=wrong initial parameters of an unused edge" << std::endl;
+    }
+}
+
+void testSpnNormalize()
+{
+    // root = 2 S1 + 6 P2, S1 = 3 P3 + 1 P4, P2 = P4 = x1 * x3, P3 = x0 * x2
+    model::ModelData modelData;
+    model::SpnData *spnData = modelData.mutable_spn_data();
+    int types[] = {4, 4, 3, 3, 3, 0, 0, 0, 0}, inputs[] = {-1, -1, -1, -1, -1, 0, 1, 2, 3};
+    int children[] = {1, 2, 3, 4, 5, 7, 6, 8, 6, 8}, parents[] = {0, 0, 1, 1, 3, 3, 4, 4, 2, 2};
+    float weights[] = {2, 6, 3, 1, 1, 1, 1, 1, 1, 1};
+    for (int i = 0; i < 9; ++i)
+    {
+        spnData->add_node_types(types[i]);
+        spnData->add_node_inputs(inputs[i]);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        spnData->add_edge_children(children[i]);
+        spnData->add_edge_parents(parents[i]);
+        spnData->add_edge_weights(weights[i]);
+    }
+    modelData.set_model_type(model::ModelData::SPN);
+    modelData.set_name("normalize_spn");
+    
+    for (int t = 1; t <= 4; t += 3)
+    {
+        model::Spn* spn = (model::Spn*)model::Model::FromModelData(modelData);
+        if (!spn || !spn->Validate())
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testSpnNormalize (test_model) message=spn->Validate() failed" << std::endl;
+            delete spn;
+            return;
+        }
+        spn->SetThreadCount(t);
+        
+        // normalizes the weights, no edge is small enough to go
+        spn->Prune(1E-6f);
+        
+        math::pimatrix batch;
+        batch.FromDebugString("[2,4]((1,1,1,1),(0.2,0.7,0.5,0.1))");
+        math::pimatrix result = spn->Forward(&batch);
+        for (size_t i = 0; i < batch.size1(); ++i)
+        {
+            float expected = 0.25f * (0.75f * batch(i, 0) * batch(i, 2) + 0.25f * batch(i, 1) * batch(i, 3))
+                            + 0.75f * batch(i, 1) * batch(i, 3);
+            if (std::abs(result(i, 0) - expected) > 1E-6)
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testSpnNormalize (test_model) message=wrong normalized weights with "
+                        << t << " threads" << std::endl;
+                std::cout << result(i, 0) << " " << expected << std::endl;
+                break;
+            }
+        }
+        delete spn;
+    }
+}
+
+void testParameterOptimizers()
+{
+    // one weight, gradients 2 then -1 summed over batches of 2 samples
+    const float grads[] = {2, -1}, lr = 0.01f, eps = 1E-8f;
+    double expected[3] = {1, 1, 1}, m = 0, v[3] = {0, 0, 0};
+    model::ParameterBuffer params[3];
+    for (int p = 0; p < 3; ++p)
+        params[p].Allocate(1);
+    
+    for (int t = 1; t <= 2; ++t)
+    {
+        double g = grads[t - 1] / 2.0;
+        
+        // Adam, AdaGrad, RMSProp
+        m = 0.9 * m + 0.1 * g;
+        v[0] = 0.999 * v[0] + 0.001 * g * g;
+        expected[0] -= lr * std::sqrt(1 - std::pow(0.999, t)) / (1 - std::pow(0.9, t))
+                        * m / (std::sqrt(v[0]) + eps);
+        v[1] += g * g;
+        expected[1] -= lr * g / (std::sqrt(v[1]) + eps);
+        v[2] = 0.9 * v[2] + 0.1 * g * g;
+        expected[2] -= lr * g / (std::sqrt(v[2]) + eps);
+        
+        for (int p = 0; p < 3; ++p)
+            params[p].GetGradients()[0] = grads[t - 1];
+        params[0].UpdateAdam(0, 1, lr, 0.9f, 0.999f, eps, t, 2);
+        params[1].UpdateAdaGrad(0, 1, lr, eps, 2);
+        params[2].UpdateRmsProp(0, 1, lr, 0.9f, eps, 2);
+    }
+    
+    const char* names[] = {"Adam", "AdaGrad", "RMSProp"};
+    for (int p = 0; p < 3; ++p)
+    {
+        if (std::abs(params[p].GetWeights()[0] - expected[p]) > 1E-6)
+        {
+            std::cout << "%TEST_FAILED% time=0 testname=testParameterOptimizers (test_model) message=wrong "
+                    << names[p] << " update: " << params[p].GetWeights()[0]
+                    << " instead of " << expected[p] << std::endl;
+        }
+    }
+}
+
+/*****************************************************************************/
+
+int main(int argc, char** argv)
+{
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    
+    std::cout << "%SUITE_STARTING% test_model" << std::endl;
+    std::cout << "%SUITE_STARTED%" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpn (test_model)" << std::endl;
+    testSpn();
+    std::cout << "%TEST_FINISHED% time=0 testSpn (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testDataHandler (test_model)" << std::endl;
+    testDataHandler();
+    std::cout << "%TEST_FINISHED% time=0 testDataHandler (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testDataHandlerShards (test_model)" << std::endl;
+    testDataHandlerShards();
+    std::cout << "%TEST_FINISHED% time=0 testDataHandlerShards (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testPlanMemory (test_model)" << std::endl;
+    testPlanMemory();
+    std::cout << "%TEST_FINISHED% time=0 testPlanMemory (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testDatasetUnevenShard (test_model)" << std::endl;
+    testDatasetUnevenShard();
+    std::cout << "%TEST_FINISHED% time=0 testDatasetUnevenShard (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSharedMemoryDataHandler (test_model)" << std::endl;
+    testSharedMemoryDataHandler();
+    std::cout << "%TEST_FINISHED% time=0 testSharedMemoryDataHandler (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testDatasetEpoch (test_model)" << std::endl;
+    testDatasetEpoch();
+    std::cout << "%TEST_FINISHED% time=0 testDatasetEpoch (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnForward (test_model)" << std::endl;
+    testSpnForward();
+    std::cout << "%TEST_FINISHED% time=0 testSpnForward (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnCompiled (test_model)" << std::endl;
+    testSpnCompiled();
+    std::cout << "%TEST_FINISHED% time=0 testSpnCompiled (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnLogSpace (test_model)" << std::endl;
+    testSpnLogSpace();
+    std::cout << "%TEST_FINISHED% time=0 testSpnLogSpace (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnThreads (test_model)" << std::endl;
+    testSpnThreads();
+    std::cout << "%TEST_FINISHED% time=0 testSpnThreads (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnMpe (test_model)" << std::endl;
+    testSpnMpe();
+    std::cout << "%TEST_FINISHED% time=0 testSpnMpe (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnEM (test_model)" << std::endl;
+    testSpnEM();
+    std::cout << "%TEST_FINISHED% time=0 testSpnEM (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnQuery (test_model)" << std::endl;
+    testSpnQuery();
+    std::cout << "%TEST_FINISHED% time=0 testSpnQuery (test_model)" << std::endl;
+    
+    std::cout << "%TEST_STARTED% testSpnQueryPhase (test_model)" << std::endl;
+    testSpnQueryPhase();
+    std::cout << "%TEST_FINISHED% time=0 testSpnQueryPhase (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnIncremental (test_model)" << std::endl;
+    testSpnIncremental();
+    std::cout << "%TEST_FINISHED% time=0 testSpnIncremental (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnSample (test_model)" << std::endl;
+    testSpnSample();
+    std::cout << "%TEST_FINISHED% time=0 testSpnSample (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnSparse (test_model)" << std::endl;
+    testSpnSparse();
+    std::cout << "%TEST_FINISHED% time=0 testSpnSparse (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnGraph (test_model)" << std::endl;
+    testSpnGraph();
+    std::cout << "%TEST_FINISHED% time=0 testSpnGraph (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnPrune (test_model)" << std::endl;
+    testSpnPrune();
+    std::cout << "%TEST_FINISHED% time=0 testSpnPrune (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnSimplify (test_model)" << std::endl;
+    testSpnSimplify();
+    std::cout << "%TEST_FINISHED% time=0 testSpnSimplify (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testProductBackward (test_model)" << std::endl;
+    testProductBackward();
+    std::cout << "%TEST_FINISHED% time=0 testProductBackward (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnCompiledBackward (test_model)" << std::endl;
+    testSpnCompiledBackward();
+    std::cout << "%TEST_FINISHED% time=0 testSpnCompiledBackward (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testEdgeParameters (test_model)" << std::endl;
+    testEdgeParameters();
+    std::cout << "%TEST_FINISHED% time=0 testEdgeParameters (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testSpnNormalize (test_model)" << std::endl;
+    testSpnNormalize();
+    std::cout << "%TEST_FINISHED% time=0 testSpnNormalize (test_model)" << std::endl;
+
+    std::cout << "%TEST_STARTED% testParameterOptimizers (test_model)" << std::endl;
+    testParameterOptimizers();
+    std::cout << "%TEST_FINISHED% time=0 testParameterOptimizers (test_model)" << std::endl;
+    
+    //benchmarkSpnForward();
+    //benchmarkValidate();
     
     std::cout << "%SUITE_FINISHED% time=0" << std::endl;
 
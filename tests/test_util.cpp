@@ -12,6 +12,8 @@
 #include <string>
 #include <iostream>
 #include <pimatrix.h>
+#include <DirectReader.h>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 #include "deeplearn.pb.h"
 #include "Util.h"
@@ -232,6 +234,78 @@ void testLoadCsvMatrix()
 
 /*****************************************************************************/
 
+void testDirectReader()
+{
+    math::pimatrix m(3000, 7, 0);
+    for (size_t i = 0; i < m.size1(); ++i)
+        for (size_t j = 0; j < m.size2(); ++j)
+            m.set(i, j, i * 0.5f - j);
+    std::string sFile("./tmpDirect.m");
+    m.save(sFile);
+
+    // small chunks, so that several reads are in flight
+    data::DirectReader reader(4096, 4);
+    for (size_t shardCount = 1; shardCount <= 3; ++shardCount)
+    {
+        for (size_t shard = 0; shard < shardCount; ++shard)
+        {
+            math::pimatrix m1, m2;
+            m1.load(sFile, shard, shardCount);
+            if (!reader.Read(sFile, m2, shard, shardCount)
+                || m1.size1() != m2.size1() || m1.size2() != m2.size2())
+            {
+                std::cout << "%TEST_FAILED% time=0 testname=testDirectReader (test_util) message=Read() failed." << std::endl;
+                return;
+            }
+            for (size_t i = 0; i < m1.size1(); ++i)
+            {
+                for (size_t j = 0; j < m1.size2(); ++j)
+                {
+                    if (m1(i, j) != m2(i, j))
+                    {
+                        std::cout << "%TEST_FAILED% time=0 testname=testDirectReader (test_util) message=Read() is incorrect." << std::endl;
+                        return;
+                    }
+                }
+            }
+        }
+    }
+    boost::filesystem::remove(sFile);
+}
+
+/*
+ * Throughput of pimatrix::load() against DirectReader on a big file.
+ * The second and later load() calls are mostly served by the page cache.
+ */
+void benchmarkDiskReaders()
+{
+    namespace pt = boost::posix_time;
+    
+    math::pimatrix m(250000, 100, 0.5f);
+    std::string sFile("./tmpBenchmark.m");
+    m.save(sFile);
+    double dSize = m.size1() * m.size2() * sizeof(float) / 1E6;
+    int iterations = 10;
+
+    math::pimatrix m2;
+    pt::ptime start = pt::microsec_clock::universal_time();
+    for (int i = 0; i < iterations; ++i)
+        m2.load(sFile);
+    double dLoad = (pt::microsec_clock::universal_time() - start).total_microseconds() / 1E6;
+
+    data::DirectReader reader;
+    start = pt::microsec_clock::universal_time();
+    for (int i = 0; i < iterations; ++i)
+        reader.Read(sFile, m2);
+    double dDirect = (pt::microsec_clock::universal_time() - start).total_microseconds() / 1E6;
+
+    std::cout << "pimatrix::load():     " << dSize * iterations / dLoad << " MB/s" << std::endl
+              << "DirectReader::Read(): " << dSize * iterations / dDirect << " MB/s" << std::endl;
+    boost::filesystem::remove(sFile);
+}
+
+/*****************************************************************************/
+
 int main(int argc, char** argv)
 {
     /*
@@ -261,10 +335,15 @@ int main(int argc, char** argv)
     testProtobufMerge();
     std::cout << "%TEST_FINISHED% time=0 testProtobufMerge (test_util)" << std::endl;
     
+    std::cout << "%TEST_STARTED% testDirectReader (test_util)" << std::endl;
+    testDirectReader();
+    std::cout << "%TEST_FINISHED% time=0 testDirectReader (test_util)" << std::endl;
+    
     //generateData();
     //testCpp();
     //testCombination();
     //testLoadCsvMatrix();
+    //benchmarkDiskReaders();
             
     std::cout << "%SUITE_FINISHED% time=0" << std::endl;
     //std::cin.get();
@@ -0,0 +1,129 @@
+/*
+ * File:   ThreadPool.cpp
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:44 PM
+ */
+
+#include "ThreadPool.h"
+#include <boost/bind.hpp>
+#include <algorithm>
+
+namespace util
+{
+
+ThreadPool::ThreadPool(size_t threadCount)
+: m_job(NULL)
+, m_count(0)
+, m_next(0)
+, m_chunk(1)
+, m_generation(0)
+, m_busy(0)
+, m_bStop(false)
+{
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        m_threads.push_back(new boost::thread(
+                boost::bind(&ThreadPool::workerLoop, this, i)));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_bStop = true;
+    }
+    m_jobReady.notify_all();
+    
+    for (size_t i = 0; i < m_threads.size(); ++i)
+    {
+        m_threads[i]->join();
+        delete m_threads[i];
+    }
+    m_threads.clear();
+}
+
+/*****************************************************************************/
+
+void ThreadPool::ParallelFor(size_t count, const Job& job, size_t minChunk /*= 1*/)
+{
+    minChunk = std::max(minChunk, (size_t)1);
+    if (m_threads.empty() || count <= minChunk)
+    {
+        if (count > 0)
+            job(0, count, 0);
+        return;
+    }
+    
+    {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_job = &job;
+        m_count = count;
+        m_next = 0;
+        // a few chunks per thread, to balance the load
+        m_chunk = std::max(minChunk, count / (4 * GetThreadCount()) + 1);
+        ++m_generation;
+    }
+    m_jobReady.notify_all();
+    
+    runChunks(0);
+    
+    boost::mutex::scoped_lock lock(m_mutex);
+    while (m_next < m_count || m_busy > 0)
+    {
+        m_jobDone.wait(lock);
+    }
+    m_job = NULL;
+}
+
+/*****************************************************************************/
+
+void ThreadPool::workerLoop(size_t threadIndex)
+{
+    size_t generation = 0;
+    
+    while (true)
+    {
+        {
+            boost::mutex::scoped_lock lock(m_mutex);
+            while (!m_bStop && (m_generation == generation || m_job == NULL))
+            {
+                m_jobReady.wait(lock);
+            }
+            if (m_bStop)
+                return;
+            generation = m_generation;
+            ++m_busy;
+        }
+        
+        runChunks(threadIndex);
+        
+        {
+            boost::mutex::scoped_lock lock(m_mutex);
+            --m_busy;
+        }
+        m_jobDone.notify_all();
+    }
+}
+
+void ThreadPool::runChunks(size_t threadIndex)
+{
+    while (true)
+    {
+        const Job* job;
+        size_t begin, end;
+        {
+            boost::mutex::scoped_lock lock(m_mutex);
+            if (m_job == NULL || m_next >= m_count)
+                return;
+            job = m_job;
+            begin = m_next;
+            end = std::min(m_count, begin + m_chunk);
+            m_next = end;
+        }
+        (*job)(begin, end, threadIndex);
+    }
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * File:   ThreadPool.h
+ * Author: agent
+ *
+ * Created on October 18, 2026, 4:44 PM
+ */
+
+#ifndef THREADPOOL_H
+#define	THREADPOOL_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <vector>
+
+namespace util
+{
+
+/*
+ * A fixed set of worker threads running data-parallel loops.
+ * The calling thread takes part in every loop, so a pool of
+ * threadCount threads starts threadCount - 1 workers.
+ */
+class ThreadPool : boost::noncopyable
+{
+public:
+    /*
+     * job(begin, end, threadIndex): process items [begin, end),
+     * 0 <= threadIndex < GetThreadCount()
+     */
+    typedef boost::function<void (size_t, size_t, size_t)> Job;
+
+private:
+    std::vector<boost::thread*> m_threads;
+    boost::mutex m_mutex;
+    boost::condition_variable m_jobReady, m_jobDone;
+    
+    const Job* m_job;
+    size_t m_count, m_next, m_chunk;
+    size_t m_generation;        // incremented for every new job
+    size_t m_busy;              // number of workers in the current job
+    bool m_bStop;
+
+public:
+    ThreadPool(size_t threadCount);
+
+    virtual ~ThreadPool();
+
+    size_t GetThreadCount()
+    {
+        return m_threads.size() + 1;
+    }
+
+    /*
+     * Run job on chunks of [0, count) on all threads, and wait for it
+     * to finish. Chunks have at least minChunk items; loops smaller than
+     * that run on the calling thread only.
+     */
+    void ParallelFor(size_t count, const Job& job, size_t minChunk = 1);
+
+private:
+    void workerLoop(size_t threadIndex);
+
+    void runChunks(size_t threadIndex);
+};
+
+}
+
+#endif	/* THREADPOOL_H */
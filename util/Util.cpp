@@ -65,6 +65,22 @@ bool Util::LoadProto(const std::string& sFile, google::protobuf::Message* mess)
     return bRet;
 }
 
+bool Util::LoadBinaryProto(const std::string& sFile, google::protobuf::Message* mess)
+{
+    int fileDescriptor = getFileHandle(sFile);
+    
+    if( fileDescriptor < 0 )
+    {
+        return false;
+    }
+
+    // parsed while reading, the file is never held in memory as a whole
+    google::protobuf::io::FileInputStream fileInput(fileDescriptor);
+    fileInput.SetCloseOnDelete( true );
+
+    return mess->ParseFromZeroCopyStream(&fileInput);
+}
+
 void Util::WriteProto(const std::string& sFile, google::protobuf::Message* mess)
 {
     std::ofstream ofs(sFile.c_str(), std::ios_base::out | std::ios_base::trunc);
@@ -75,7 +91,8 @@ void Util::WriteProto(const std::string& sFile, google::protobuf::Message* mess)
 }
 
 data::DataHandler* Util::LoadDataHandler(const std::string& sDataProtoFile
-    , bool randomize /*= false*/, int random_seed /*= 42*/, bool verbose /*= false*/)
+    , bool randomize /*= false*/, int random_seed /*= 42*/, bool verbose /*= false*/
+    , int shard_rank /*= 0*/, int shard_count /*= 1*/)
 {
     model::DatabaseInfo databaseInfo;
     if (!util::Util::LoadProto(sDataProtoFile, &databaseInfo))
@@ -83,6 +100,11 @@ data::DataHandler* Util::LoadDataHandler(const std::string& sDataProtoFile
         std::cout << "ERR\tUnable to load the dataset proto file." << std::endl;
         return NULL;
     }
+    if (shard_count > 1)
+    {
+        databaseInfo.set_shard_rank(shard_rank);
+        databaseInfo.set_shard_count(shard_count);
+    }
     data::DataHandler* dataHandler = 
             data::DataHandler::GetDataHandler(databaseInfo, randomize
         , random_seed, verbose);
@@ -25,10 +25,21 @@ public:
     
     static bool LoadProto(const std::string& sFile, google::protobuf::Message* mess);
 
+    /*
+     * Binary encoding, as written by WriteProto(): checkpoints, or models
+     * whose SpnData uses the (packed) sparse structure.
+     */
+    static bool LoadBinaryProto(const std::string& sFile, google::protobuf::Message* mess);
+
     static void WriteProto(const std::string& sFile, google::protobuf::Message* mess);
     
+    /*
+     * shard_rank and shard_count override the values in the data proto
+     * if shard_count > 1.
+     */
     static data::DataHandler* LoadDataHandler(const std::string& sDataProtoFile
-        , bool randomize = false, int random_seed = 42, bool verbose = false);
+        , bool randomize = false, int random_seed = 42, bool verbose = false
+        , int shard_rank = 0, int shard_count = 1);
     
     static void GetLearningRateAndMomentum(int step
                 , const model::Hyperparams& hyperParams